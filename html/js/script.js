@@ -269,6 +269,11 @@ $(function ()
         SendCommand('clearstatistics');
     }));
 
+    $('#btn_selftest').on("click", (function () {
+        // drives every pixel and serial port at full speed for 10 seconds
+        SendCommand('XJ?selftest=10');
+    }));
+
     $('#DeviceConfigSave').on("click", (function () {
         submitDeviceConfig();
     }));
@@ -1625,6 +1630,12 @@ function ProcessReceivedJsonConfigMessage(JsonConfigData) {
             $('#TemperatureSensorGrp').addClass("hidden");
         }
 
+        if ({}.hasOwnProperty.call(System_Config, 'log')) {
+            $('#log_level').val(System_Config.log.level);
+            $('#log_syslog').val(System_Config.log.syslog);
+            $('#log_port').val(System_Config.log.port);
+        }
+
         if ({}.hasOwnProperty.call(System_Config.device, 'sd_pwr_pin'))
         {
             $('#SdPowerControlGrp').removeClass("hidden");
@@ -1866,6 +1877,7 @@ function ExtractNetworkConfigFromHtmlPage() {
 function submitNetworkConfig() {
     System_Config.device.id = $('#config #device #id').val();
     System_Config.device.blanktime = parseInt($('#config #device #blanktime').val(), 10);
+    System_Config.device.startcolor = $('#config #device #startcolor').val();
     System_Config.device.miso_pin = parseInt($('#config #device #miso_pin').val(), 10);
     System_Config.device.mosi_pin = parseInt($('#config #device #mosi_pin').val(), 10);
     System_Config.device.clock_pin = parseInt($('#config #device #clock_pin').val(), 10);
@@ -1875,6 +1887,12 @@ function submitNetworkConfig() {
     System_Config.device.password = $('#ftppassword').val();
     System_Config.device.enabled = $('#ftp_enable').prop('checked');
 
+    if ({}.hasOwnProperty.call(System_Config, 'log')) {
+        System_Config.log.level = parseInt($('#log_level').val(), 10);
+        System_Config.log.syslog = $('#log_syslog').val();
+        System_Config.log.port = parseInt($('#log_port').val(), 10);
+    }
+
     if ({}.hasOwnProperty.call(System_Config.device, 'sd_pwr_pin'))
     {
         System_Config.device.sd_pwr_pin = parseInt($('#config #device #sd_pwr_pin').val(), 10);
@@ -2169,6 +2187,14 @@ function int2ip(num) {
     return d;
 } // int2ip
 
+// packet to output frame latency, reported in microseconds
+function FormatLatency(Latency) {
+    if ((undefined === Latency) || (0 === Latency.count)) {
+        return "-";
+    }
+    return [Latency.p50, Latency.p95, Latency.p99, Latency.max].map(Us => (Us / 1000).toFixed(1)).join(" / ") + " ms";
+} // FormatLatency
+
 // Ping every 4sec if there is no other traffic
 function MonitorServerConnection()
 {
@@ -2311,6 +2337,16 @@ function ProcessReceivedJsonStatusMessage(JsonStat) {
     // getHeap(data)
     $('#x_freeheap').text(System.freeheap);
 
+    if ({}.hasOwnProperty.call(System, 'psram')) {
+        $('#i_psram').removeClass("hidden");
+        $('#x_psram').removeClass("hidden");
+        $('#x_psram').text(System.psram.free);
+    }
+    else {
+        $('#i_psram').addClass("hidden");
+        $('#x_psram').addClass("hidden");
+    }
+
     if ({}.hasOwnProperty.call(System, 'HeapDetails'))
     {
         let HeapDetails = System.HeapDetails;
@@ -2366,6 +2402,10 @@ function ProcessReceivedJsonStatusMessage(JsonStat) {
         $('#x_used').addClass("hidden");
     }
 
+    if ({}.hasOwnProperty.call(System, 'log')) {
+        $('#x_loglines').text(System.log.lines + " (" + System.log.dropped + ")");
+    }
+
     if ({}.hasOwnProperty.call(System, 'sensor')) {
         $('#i_temperature').removeClass("hidden");
         $('#x_temperature').removeClass("hidden");
@@ -2394,6 +2434,7 @@ function ProcessReceivedJsonStatusMessage(JsonStat) {
         $('#chanlim').text(InputStatus.e131.unichanlim);
         $('#perr').text(InputStatus.e131.packet_errors);
         $('#clientip').text(int2ip(parseInt(InputStatus.e131.last_clientIP, 10)));
+        $('#latency').text(FormatLatency(InputStatus.latency));
     }
     else {
         $('#E131Status').addClass("hidden")
@@ -2409,6 +2450,7 @@ function ProcessReceivedJsonStatusMessage(JsonStat) {
         $('#an_perr').text(InputStatus.Artnet.packet_errors);
         $('#an_PollCounter').text(InputStatus.Artnet.PollCounter);
         $('#an_clientip').text(InputStatus.Artnet.last_clientIP);
+        $('#an_latency').text(FormatLatency(InputStatus.latency));
     }
     else {
         $('#ArtnetStatus').addClass("hidden")
@@ -2421,6 +2463,7 @@ function ProcessReceivedJsonStatusMessage(JsonStat) {
         $('#ddpbytesreceived').text(InputStatus.ddp.bytesreceived);
         $('#ddperrors').text(InputStatus.ddp.errors);
         $('#ddplasterror').text(InputStatus.ddp.lasterror);
+        $('#ddplatency').text(FormatLatency(InputStatus.latency));
     }
     else {
         $('#ddpStatus').addClass("hidden")
@@ -2495,6 +2538,65 @@ function ProcessReceivedJsonStatusMessage(JsonStat) {
         }
     }
 
+    if ({}.hasOwnProperty.call(System, 'cpu')) {
+        let Cpu = System.cpu;
+        $('#CpuStatus').removeClass("hidden");
+        $('#cpu_idle').text(Cpu.idle.join(" / "));
+
+        $('#CpuTaskTable').empty();
+        if ({}.hasOwnProperty.call(Cpu, 'tasks')) {
+            Cpu.tasks.forEach(function (task)
+            {
+                let rowPattern = '<tr>' +
+                    '<td>' + task.name + '</td>' +
+                    '<td>' + ((-1 === task.core) ? "any" : task.core) + '</td>' +
+                    '<td>' + task.priority + '</td>' +
+                    '<td>' + task.stackfree + '</td>' +
+                    '<td>' + (({}.hasOwnProperty.call(task, 'cpu')) ? task.cpu : "n/a") + '</td>' +
+                    '</tr>';
+                $('#CpuTaskTable').append(rowPattern);
+            });
+        }
+    }
+    else {
+        $('#CpuStatus').addClass("hidden");
+    }
+
+    if ({}.hasOwnProperty.call(Status, 'selftest')) {
+        let SelfTest = Status.selftest;
+        $('#SelfTestStatus').removeClass("hidden");
+        $('#btn_selftest').prop("disabled", true === SelfTest.running);
+
+        if (true === SelfTest.running) {
+            $('#selftest_state').text("Running (" + Math.floor(SelfTest.elapsedms / 1000) + " of " + Math.floor(SelfTest.durationms / 1000) + " sec)");
+        }
+        else {
+            $('#selftest_state').text("Done after " + (SelfTest.elapsedms / 1000).toFixed(1) + " sec");
+            $('#selftest_pixelspersec').text(SelfTest.pixelspersec);
+            $('#selftest_idle').text(({}.hasOwnProperty.call(SelfTest, 'idle')) ? SelfTest.idle.join(" / ") : "n/a");
+
+            $('#SelfTestTable').empty();
+            SelfTest.port.forEach(function (port)
+            {
+                let rowPattern = '<tr>' +
+                    '<td>' + port.id + '</td>' +
+                    '<td>' + port.fps + '</td>' +
+                    '<td>' + port.wirefps + '</td>' +
+                    '<td>' + port.pixels + '</td>' +
+                    '<td>' + port.pixelspersec + '</td>' +
+                    '<td>' + (port.isrpermille / 10).toFixed(1) + '</td>' +
+                    '<td>' + port.isrmaxus + '</td>' +
+                    '<td>' + port.underruns + '</td>' +
+                    '<td>' + port.aborted + '</td>' +
+                    '</tr>';
+                $('#SelfTestTable').append(rowPattern);
+            });
+        }
+    }
+    else {
+        $('#SelfTestStatus').addClass("hidden");
+    }
+
     // Device Refresh is dynamic
     // #refresh is used in device config tab to reflect what refresh rate should be, not what it currently is
     // $('#refresh').text(Status.output[0].framerefreshrate + " fps");
@@ -54,6 +54,8 @@ extern const CN_PROGMEM char CN_cfgver [];
 extern const CN_PROGMEM char CN_channels [];
 extern const CN_PROGMEM char CN_clean [];
 extern const CN_PROGMEM char CN_clock_pin [];
+extern const CN_PROGMEM char CN_clone_of [];
+extern const CN_PROGMEM char CN_clone_reverse [];
 extern const CN_PROGMEM char CN_cmd [];
 extern const CN_PROGMEM char CN_color [];
 extern const CN_PROGMEM char CN_color_order [];
@@ -70,6 +72,7 @@ extern const CN_PROGMEM char CN_device [];
 extern const CN_PROGMEM char CN_dhcp [];
 extern const CN_PROGMEM char CN_Default [];
 extern const CN_PROGMEM char CN_Disabled [];
+extern const CN_PROGMEM char CN_dither [];
 extern const CN_PROGMEM char CN_dnsp [];
 extern const CN_PROGMEM char CN_dnss [];
 extern const CN_PROGMEM char CN_Dotfseq [];
@@ -126,6 +129,7 @@ extern const CN_PROGMEM char CN_gen_ser_hdr [];
 extern const CN_PROGMEM char CN_gen_ser_ftr [];
 extern const CN_PROGMEM char CN_gid [];
 extern const CN_PROGMEM char CN_group_size [];
+extern const CN_PROGMEM char CN_group_store [];
 extern const CN_PROGMEM char CN_groups [];
 extern const CN_PROGMEM char CN_GS8208 [];
 extern const CN_PROGMEM char CN_hadisco [];
@@ -143,6 +147,8 @@ extern const CN_PROGMEM char CN_ip [];
 extern const CN_PROGMEM char CN_input [];
 extern const CN_PROGMEM char CN_input_config [];
 extern const CN_PROGMEM char CN_last_clientIP [];
+extern const CN_PROGMEM char CN_level [];
+extern const CN_PROGMEM char CN_log [];
 extern const CN_PROGMEM char CN_long [];
 extern const CN_PROGMEM char CN_lwt [];
 extern const CN_PROGMEM char CN_mac [];
@@ -152,6 +158,7 @@ extern const CN_PROGMEM char CN_mdio_pin [];
 extern const CN_PROGMEM char CN_Max [];
 extern const CN_PROGMEM char CN_MaxChannels [];
 extern const CN_PROGMEM char CN_Min [];
+extern const CN_PROGMEM char CN_minframetime [];
 extern const CN_PROGMEM char CN_minussigns [];
 extern const CN_PROGMEM char CN_mirror [];
 extern const CN_PROGMEM char CN_miso_pin [];
@@ -219,12 +226,14 @@ extern const CN_PROGMEM char CN_speed [];
 extern const CN_PROGMEM char CN_ssid [];
 extern const CN_PROGMEM char CN_sta_timeout [];
 extern const CN_PROGMEM char CN_stars [];
+extern const CN_PROGMEM char CN_startcolor [];
 extern const CN_PROGMEM char CN_state [];
 extern const CN_PROGMEM char CN_status [];
 extern const CN_PROGMEM char CN_status_name [];
 extern const CN_PROGMEM char CN_StayInApMode [];
 extern const CN_PROGMEM char CN_subnet [];
 extern const CN_PROGMEM char CN_SyncOffset [];
+extern const CN_PROGMEM char CN_syslog [];
 extern const CN_PROGMEM char CN_system [];
 extern const CN_PROGMEM char CN_textSLASHplain [];
 extern const CN_PROGMEM char CN_time [];
@@ -258,6 +267,8 @@ extern const CN_PROGMEM char CN_version [];
 extern const CN_PROGMEM char CN_Version [];
 extern const CN_PROGMEM char CN_w [];
 extern const CN_PROGMEM char CN_weus [];
+extern const CN_PROGMEM char CN_white_extract [];
+extern const CN_PROGMEM char CN_white_temp [];
 extern const CN_PROGMEM char CN_wifi [];
 extern const CN_PROGMEM char CN_WiFiDrv [];
 extern const CN_PROGMEM char CN_WS2801 [];
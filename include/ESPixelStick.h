@@ -32,10 +32,6 @@
 #	error "Unsupported CPU type"
 #endif
 
-#ifdef BOARD_HAS_PSRAM
-#   error "PSRAM is not supported by ESPixelStick"
-#endif // def BOARD_HAS_PSRAM
-
 #define ARDUINOJSON_USE_LONG_LONG 1
 #define ARDUINOJSON_DEFAULT_NESTING_LIMIT 15
 
@@ -65,9 +61,9 @@
 #define STRINGIFY(X) #X
 #define STRING(X) STRINGIFY(X)
 
-extern void RequestReboot(String & Reason, uint32_t LoopDelay, bool SkipDisable = false);
+extern void RequestReboot(String & Reason, uint32_t DelayMs, bool SkipDisable = false);
 extern bool RebootInProgress();
-extern void DelayReboot(uint32_t MinDelay);
+extern void DelayReboot(uint32_t MinDelayMs);
 
 /// Core configuration structure
 struct config_t
@@ -75,6 +71,7 @@ struct config_t
     // Device
     char        id[65];
     uint32_t    BlankDelay = uint32_t(5);
+    char        StartColor[8] = "#000000";  ///< shown on the outputs until the first input data arrives
 };
 
 String  serializeCore          (bool pretty = false);
@@ -206,13 +203,28 @@ void inline ResetGpio(const gpio_num_t pinId)
 #endif
 
 extern bool ConsoleUartIsActive;
-#define logcon(msg) \
+
+// log levels, the same order as the syslog severities
+#define LOG_LEVEL_ERROR     0
+#define LOG_LEVEL_WARNING   1
+#define LOG_LEVEL_INFO      2
+#define LOG_LEVEL_DEBUG     3
+
+extern uint32_t LogLevel;
+#define logmsg(level, msg) \
 { \
-    String DN; \
-    GetDriverName (DN); \
-    extern void _logcon (String & DriverName, String Message); \
-    _logcon (DN, msg); \
+    if ((level) <= LogLevel) \
+    { \
+        String DN; \
+        GetDriverName (DN); \
+        extern void _logcon (uint32_t Level, String & DriverName, const String & Message); \
+        _logcon (level, DN, msg); \
+    } \
 }
+#define logerr(msg)     logmsg (LOG_LEVEL_ERROR,   msg)
+#define logwarn(msg)    logmsg (LOG_LEVEL_WARNING, msg)
+#define logcon(msg)     logmsg (LOG_LEVEL_INFO,    msg)
+#define logdbg(msg)     logmsg (LOG_LEVEL_DEBUG,   msg)
 
 extern config_t config;
 extern bool ConfigSaveNeeded;
@@ -220,3 +232,5 @@ extern bool ConfigSaveNeeded;
 #define LOAD_CONFIG_DELAY 4
 // #define DEBUG_GPIO gpio_num_t::GPIO_NUM_25
 // #define DEBUG_GPIO1 gpio_num_t::GPIO_NUM_14
+// pulses at the start of every output frame that carries new input data
+// #define LATENCY_GPIO gpio_num_t::GPIO_NUM_26
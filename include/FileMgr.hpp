@@ -54,7 +54,7 @@ public:
     const static FileId INVALID_FILE_HANDLE = 0;
 
     void    Begin     ();
-    void    Poll      ();
+    uint32_t Poll     ();   ///< returns the ms until the next poll
     void    GetConfig (JsonObject& json);
     bool    SetConfig (JsonObject& json);
     void    GetStatus (JsonObject& json);
@@ -142,9 +142,6 @@ private:
     bool    SeekSdFile(const FileId & FileHandle, uint64_t position, SeekMode Mode);
     void    BuildDefaultFseqList ();
     bool    IsCompressed(String FileName);
-    #ifdef DEFAULT_SD_POWER_PIN
-    void    PowerCycleSdCard();
-    #endif // def DEFAULT_SD_POWER_PIN
 
 #   define SD_CARD_CLK_MHZ     SD_SCK_MHZ(37)  // 50 MHz SPI clock
 #ifndef MaxSdTransSpeedMHz
@@ -158,13 +155,24 @@ private:
 #endif // def DEDICATED_SPI
 
 
-    void StartSdCard ();
+    uint32_t StartSdCard ();
     void listDir (fs::FS& fs, String dirname, uint8_t levels);
     void DescribeSdCardToUser ();
     void handleFileUploadNewFile (const String & filename);
     void printDirectory (FsFile & dir, int numTabs);
+    bool LoadConfigSnapshot   (const String & FileName, uint32_t JsonFileSize, uint32_t JsonFileTime, JsonDocument & Doc);
+    void SaveConfigSnapshot   (const String & FileName, JsonDocument & Doc);
+    void DeleteConfigSnapshot (const String & FileName);
 
     bool     SdCardInstalled = false;
+    enum SdStartState_t
+    {
+        SdStart_Idle = 0,
+        SdStart_PowerOff,
+        SdStart_Mount,
+        SdStart_BuildFseqList,
+    };
+    SdStartState_t SdStartState = SdStart_Idle;
     uint8_t  miso_pin = SD_CARD_MISO_PIN;
     uint8_t  mosi_pin = SD_CARD_MOSI_PIN;
     uint8_t  clk_pin  = SD_CARD_CLK_PIN;
@@ -118,6 +118,8 @@
 #   include "platforms/GPIO_Defs_ESP32_DevkitV_ETH.hpp"
 #elif defined(BOARD_ESP32S3_FH4R2)
 #   include "platforms/GPIO_Defs_ESP32S3_FH4R2.hpp"
+#elif defined (BOARD_ESPS_NATIVE)
+#   include "platforms/GPIO_Defs_Native.hpp"
 #elif defined (ARDUINO_ARCH_ESP32)
 #   include "platforms/GPIO_Defs_ESP32_generic.hpp"
 #elif defined (ARDUINO_ARCH_ESP8266)
@@ -0,0 +1,114 @@
+#pragma once
+/*
+* RtConfig.hpp - Core, priority and interrupt level of the real time work
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Every value can be overridden from the platform file of a board or
+*   with a -D build flag.
+*
+*   WiFi and lwIP run on core 0 (PRO_CPU). The Arduino loop, and with it
+*   the output manager, runs on core 1 (APP_CPU). The output ISRs are
+*   placed on core 1 so a burst of network traffic cannot delay a refill.
+*
+*   Input ingest is the InputMgr task. It also runs the local file player,
+*   so it is the task that reads the SD card. There is no separate SD
+*   prefetch task.
+*
+*   An interrupt is serviced by the core that allocated it. RtRunOnCore is
+*   used to allocate (and free) the output interrupts on their core no
+*   matter which task set up the driver. A core of tskNO_AFFINITY runs the
+*   allocation on the calling core.
+*/
+
+#include "ESPixelStick.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#   include <esp_ipc.h>
+#   include <esp_intr_alloc.h>
+
+// input ingest
+#ifndef RT_INPUT_TASK_CORE
+#   define RT_INPUT_TASK_CORE       0
+#endif // ndef RT_INPUT_TASK_CORE
+#ifndef RT_INPUT_TASK_PRIORITY
+#   define RT_INPUT_TASK_PRIORITY   5
+#endif // ndef RT_INPUT_TASK_PRIORITY
+#ifndef RT_INPUT_TASK_STACK
+#   define RT_INPUT_TASK_STACK      4096
+#endif // ndef RT_INPUT_TASK_STACK
+
+// output scheduling. Starts the next frame on every RMT channel
+#ifndef RT_OUTPUT_TASK_CORE
+#   define RT_OUTPUT_TASK_CORE      1
+#endif // ndef RT_OUTPUT_TASK_CORE
+#ifndef RT_OUTPUT_TASK_PRIORITY
+#   define RT_OUTPUT_TASK_PRIORITY  5
+#endif // ndef RT_OUTPUT_TASK_PRIORITY
+#ifndef RT_OUTPUT_TASK_STACK
+#   define RT_OUTPUT_TASK_STACK     4096
+#endif // ndef RT_OUTPUT_TASK_STACK
+
+// SPI output (WS2801, APA102, Grinch). Fills the SPI transactions
+#ifndef RT_SPI_TASK_CORE
+#   define RT_SPI_TASK_CORE         tskNO_AFFINITY
+#endif // ndef RT_SPI_TASK_CORE
+#ifndef RT_SPI_TASK_PRIORITY
+#   define RT_SPI_TASK_PRIORITY     (ESP_TASK_PRIO_MIN + 4)
+#endif // ndef RT_SPI_TASK_PRIORITY
+#ifndef RT_SPI_TASK_STACK
+#   define RT_SPI_TASK_STACK        2000
+#endif // ndef RT_SPI_TASK_STACK
+
+// console log. Writes the log ring to the UART and the syslog server
+#ifndef RT_LOG_TASK_CORE
+#   define RT_LOG_TASK_CORE         tskNO_AFFINITY
+#endif // ndef RT_LOG_TASK_CORE
+#ifndef RT_LOG_TASK_PRIORITY
+#   define RT_LOG_TASK_PRIORITY     (ESP_TASK_PRIO_MIN + 1)
+#endif // ndef RT_LOG_TASK_PRIORITY
+#ifndef RT_LOG_TASK_STACK
+#   define RT_LOG_TASK_STACK        3072
+#endif // ndef RT_LOG_TASK_STACK
+
+// output ISRs. Levels above 3 cannot be used, the handlers are written in C
+#ifndef RT_RMT_ISR_CORE
+#   define RT_RMT_ISR_CORE          1
+#endif // ndef RT_RMT_ISR_CORE
+#ifndef RT_RMT_ISR_LEVEL
+#   define RT_RMT_ISR_LEVEL         ESP_INTR_FLAG_LEVEL1
+#endif // ndef RT_RMT_ISR_LEVEL
+#ifndef RT_UART_ISR_CORE
+#   define RT_UART_ISR_CORE         1
+#endif // ndef RT_UART_ISR_CORE
+#ifndef RT_UART_ISR_LEVEL
+#   define RT_UART_ISR_LEVEL        ESP_INTR_FLAG_LEVEL1
+#endif // ndef RT_UART_ISR_LEVEL
+
+//-----------------------------------------------------------------------------
+inline void RtRunOnCore (BaseType_t Core, esp_ipc_func_t Function, void * Arg)
+{
+    if ((Core < 0) || (Core >= portNUM_PROCESSORS) || (Core == xPortGetCoreID ()))
+    {
+        Function (Arg);
+    }
+    else
+    {
+        // runs in the IPC task of the other core and waits for it to finish
+        ESP_ERROR_CHECK (esp_ipc_call_blocking (Core, Function, Arg));
+    }
+} // RtRunOnCore
+
+#endif // def ARDUINO_ARCH_ESP32
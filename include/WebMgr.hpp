@@ -33,7 +33,7 @@ public:
 
     void Begin           (config_t * NewConfig); ///< set up the operating environment based on the current config (or defaults)
     void ValidateConfig  (config_t * NewConfig);
-    void Process         ();
+    uint32_t Process     ();    ///< returns the ms until the next call
 
     void onAlexaMessage        (EspalexaDevice * pDevice);
     void RegisterAlexaCallback (DeviceCallbackFunction cb);
@@ -68,6 +68,8 @@ private:
 
     void ProcessXJRequest           (AsyncWebServerRequest * client);
     void ProcessHeapRequest         (AsyncWebServerRequest * client);
+    void ProcessCountersRequest     (AsyncWebServerRequest * client);
+    void ProcessTraceRequest        (AsyncWebServerRequest * client);
     void ProcessSetTimeRequest      (time_t DateTime);
 
     void GetDeviceOptions           ();
@@ -30,6 +30,7 @@ class c_InputArtnet : public c_InputCommon
 
     char     _Artnet[sizeof(Artnet)];
     Artnet * pArtnet = nullptr;
+    bool     Listening = false;     ///< pArtnet has an open socket
 
     /// JSON configuration parameters
     uint16_t    startUniverse              = 1;    ///< Universe to listen for
@@ -57,9 +58,10 @@ class c_InputArtnet : public c_InputCommon
     };
     Universe_t UniverseArray[MAX_NUM_UNIVERSES];
 
+    void CreateReceiver ();
     void SetUpArtnet ();
+    void StopListening ();
     void validateConfiguration ();
-    void NetworkStateChanged (bool IsConnected, bool RebootAllowed); // used by poorly designed rx functions
     void SetBufferTranslation ();
     void onDmxFrame (uint16_t CurrentUniverseId, uint32_t length, uint8_t sequence, uint8_t* data, IPAddress remoteIP);
     void onDmxPoll (IPAddress  broadcastIP);
@@ -81,6 +83,7 @@ class c_InputArtnet : public c_InputCommon
     void NetworkStateChanged (bool IsConnected); // used by poorly designed rx functions
     bool isShutDownRebootNeeded () { return HasBeenInitialized; }
     virtual void Process () {}                                       ///< Call from loop(),  renders Input data
+    uint32_t GetPollPeriodUs () { return INPUT_POLL_NOT_NEEDED; }    ///< the receive callback writes the data
     void ClearStatistics ();
 
   }; // c_InputArtnet
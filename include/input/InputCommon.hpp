@@ -45,11 +45,23 @@ public:
     virtual void ProcessButtonActions(c_ExternalInput::InputValue_t value) {};
     virtual void ClearStatistics (void);
     virtual void SetBlankTimerIsRunning (bool value) {IsBlankTimerRunning = value;}
+    virtual uint32_t GetPollPeriodUs () { return FPP_TICKER_PERIOD_MS * MicroSecondsInAmilliSecond; } ///< How long until this input next needs Process() called. INPUT_POLL_NOT_NEEDED: only after InputMgr.SignalWork()
 
     c_InputMgr::e_InputChannelIds GetInputChannelId () { return InputChannelId; }
     c_InputMgr::e_InputType       GetInputType ()      { return ChannelType; }
 
 protected:
+    // the network inputs re-bind their listeners in place when the network comes back
+    void        NetworkLost         ();                             ///< the listeners are down. Start timing the outage
+    void        NetworkRecovered    (uint32_t RebindStartUs);       ///< the listeners are back
+    void        GetRebindStatus     (JsonObject & jsonStatus);
+
+    // the async UDP task delivers packets while SetConfig replaces the receiver
+    bool        EnterPacketCallback ();                             ///< false: drop the packet, the receiver is being replaced
+    void        LeavePacketCallback ();
+    void        PausePacketCallbacks ();                            ///< returns once no packet callback is running
+    void        ResumePacketCallbacks ();
+
     bool        HasBeenInitialized  = false;
     uint32_t    InputDataBufferSize = 0;
     bool        IsInputChannelActive = true;
@@ -58,5 +70,12 @@ protected:
     c_InputMgr::e_InputType       ChannelType = c_InputMgr::e_InputType::InputType_Disabled;
 
 private:
+    bool        NetworkIsLost       = false;
+    uint32_t    NetworkLostTimeMs   = 0;
+    uint32_t    RebindCount         = 0;
+    uint32_t    LastRecoveryMs      = 0;    ///< network lost until listening again
+    uint32_t    LastRebindUs        = 0;    ///< time taken to tear down and re-open the listeners
+    bool        PacketCallbacksPaused = false;  ///< atomic access only
+    bool        PacketCallbackActive  = false;  ///< atomic access only
 
 }; // c_InputCommon
@@ -39,6 +39,7 @@ public:
     void GetConfig (JsonObject & jsonConfig);   ///< Get the current config used by the driver
     void GetStatus (JsonObject & jsonStatus);
     void Process   ();
+    uint32_t GetPollPeriodUs () { return INPUT_POLL_NOT_NEEDED; }
     void GetDriverName (String& sDriverName) { sDriverName = "Disabled"; } ///< get the name for the instantiated driver
     void SetBufferInfo (uint32_t BufferSize) {}
 
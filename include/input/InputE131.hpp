@@ -40,7 +40,10 @@ class c_InputE131 : public c_InputCommon
     uint16_t    ChannelsPerUniverse        = 512;  ///< Universe boundary limit
     uint16_t    FirstUniverseChannelOffset = 1;    ///< Channel to start listening at - 1 based
     ESPAsyncE131PortId PortId              = E131_DEFAULT_PORT;
-    bool        ESPAsyncE131Initialized    = false;
+    bool        ESPAsyncE131Initialized    = false;    ///< the unicast and multicast listeners are open
+    ESPAsyncE131PortId ListenPortId        = 0;        ///< where the open listeners are bound
+    uint16_t    ListenStartUniverse        = 0;
+    uint16_t    ListenLastUniverse         = 0;
 
     /// from sketch globals
     uint16_t    channel_count = 0;       ///< Number of channels. Derived from output module configuration.
@@ -56,7 +59,9 @@ class c_InputE131 : public c_InputCommon
     Universe_t UniverseArray[MAX_NUM_UNIVERSES];
 
     void validateConfiguration ();
-    void NetworkStateChanged (bool IsConnected, bool RebootAllowed); // used by poorly designed rx functions
+    void CreateReceiver ();
+    void StartListening ();
+    void StopListening ();
     void SetBufferTranslation ();
 
   public:
@@ -72,6 +77,7 @@ class c_InputE131 : public c_InputCommon
     void GetConfig (JsonObject & jsonConfig);   ///< Get the current config used by the driver
     void GetStatus (JsonObject & jsonStatus);
     void Process   ();
+    uint32_t GetPollPeriodUs () { return INPUT_POLL_NOT_NEEDED; } ///< the receive callback writes the data
     void GetDriverName (String & sDriverName) { sDriverName = "E1.31"; } ///< get the name for the instantiated driver
     void SetBufferInfo (uint32_t BufferSize);
     void NetworkStateChanged (bool IsConnected); // used by poorly designed rx functions
@@ -44,6 +44,7 @@ class c_InputFPPRemote : public c_InputCommon
       void ProcessButtonActions(c_ExternalInput::InputValue_t value);
       void SetOperationalState (bool ActiveFlag);
       void SetBlankTimerIsRunning (bool BlankTimerRunning);
+      uint32_t GetPollPeriodUs ();
 
       void StartPlaying (String & FileName, time_t SecondsElapsed, bool IsRemote);
       void StopPlaying ();
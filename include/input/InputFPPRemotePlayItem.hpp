@@ -31,6 +31,8 @@ protected:
 
 #if defined(ARDUINO_ARCH_ESP8266)
 const uint64_t  LocalIntensityBufferSize = 512;
+#elif defined(BOARD_HAS_PSRAM)
+const uint64_t  LocalIntensityBufferSize = 16384;  // in PSRAM. Most frames are read in one pass
 #else
 const uint64_t  LocalIntensityBufferSize = 2048;
 #endif // defined(ARDUINO_ARCH_ESP8266)
@@ -62,6 +64,10 @@ public:
     } FileControl[2];
     #define CurrentFile 0
     #define NextFile 1
+    // shortest FSEQ step time we will play. Protects the frame id math from a zero step time.
+    #define FSEQ_MIN_FRAME_STEP_TIME_MS 5
+
+    virtual uint32_t GetFrameStepTimeUs () { return FileControl[CurrentFile].FrameStepTimeMS * MicroSecondsInAmilliSecond; }
 
     virtual bool     Poll           () = 0;
     virtual void     Start          (String & FileName, float SecondsElapsed, uint32_t RemainingPlayCount) = 0;
@@ -44,6 +44,7 @@ class c_InputMQTT : public c_InputCommon
       void GetStatus (JsonObject& jsonStatus);
       void ClearStatistics ();
       void Process   ();
+      uint32_t GetPollPeriodUs ();
       void GetDriverName (String& sDriverName) { sDriverName = "MQTT"; } ///< get the name for the instantiated driver
       void SetBufferInfo (uint32_t BufferSize);
       void NetworkStateChanged (bool IsConnected); // used by poorly designed rx functions
@@ -51,7 +51,7 @@ public:
 
     void Begin                (uint32_t BufferSize);
     void LoadConfig           ();
-    void ScheduleLoadConfig   () {ConfigLoadNeeded = now();}
+    void ScheduleLoadConfig   () {ConfigLoadNeeded = now(); SignalWork();}
     void GetConfig            (byte * Response, uint32_t maxlen);
     void GetStatus            (JsonObject & jsonStatus);
     void SetConfig            (const char * NewConfig);
@@ -68,6 +68,9 @@ public:
     void ProcessButtonActions (c_ExternalInput::InputValue_t value);
     bool RemotePlayEnabled    (void);
     void ClearStatistics      (void);
+    uint32_t GetPollPeriodUs  (void);
+    void SignalWork           (void); ///< an input has work for Process(). Wakes the input task
+    void IRAM_ATTR ISR_SignalWork (void);
 
     enum e_InputType
     {
@@ -99,7 +102,6 @@ private:
     };
 
     #define NO_CONFIG_NEEDED time_t(-1)
-    #define INPUTMGR_TASK_PRIORITY 5
 
     DriverInfo_t    InputChannelDrivers[InputChannelId_End]; ///< pointer(s) to the current active Input driver
     uint32_t        InputDataBufferSize = 0;
@@ -107,6 +109,8 @@ private:
     c_ExternalInput ExternalInput;
     bool            EffectEngineIsConfiguredToRun[InputChannelId_End];
     bool            IsConnected         = false;
+    bool            HoldLastFrame       = false;    ///< the network dropped. Do not blank until it is back
+    bool            HeldBlankTimers[InputChannelId_End];    ///< blank timers that were running when the network dropped
     bool            configInProgress    = false;
     time_t          ConfigLoadNeeded    = NO_CONFIG_NEEDED;
     bool            PauseProcessing     = false;
@@ -127,8 +131,9 @@ private:
     FastTimer BlankEndTime[InputChannelId_End];
 
 #   define    FPP_TICKER_PERIOD_MS 25
+#   define    INPUT_POLL_NOT_NEEDED uint32_t(-1)
     Ticker    MsTicker;
-    uint32_t  LastTickerTimeStampMS = 0;
+    bool      WorkSignaled = false;
 
 }; // c_InputMgr
 
@@ -43,6 +43,7 @@ public:
 
 	void         Init              (uint32_t iInputId, uint32_t iPinId, Polarity_t Poliarity, String & sName);
 	void         Poll              (void);
+	uint32_t     GetPollPeriodUs   (void);
 	void         GetConfig         (JsonObject JsonData);
 	void         GetStatistics     (JsonObject JsonData);
 	void         ProcessConfig     (JsonObject JsonData);
@@ -70,6 +71,7 @@ protected:
 	uint32_t                  InputDebounceCount  = 0;
 	FastTimer                 InputHoldTimer;
 	uint32_t				  LongPushDelayMS     = 2000;
+	bool                      InterruptAttached   = false;
 	fsm_ExternalInput_state * CurrentFsmState     = nullptr;    // initialized in constructor
 
 	friend class fsm_ExternalInput_boot;
@@ -0,0 +1,278 @@
+#pragma once
+/*
+* Arduino.h - Arduino core API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Stands in for the ESP32 Arduino core when the firmware is built for the
+*   host. Time comes from the simulator clock and pin operations go to the
+*   simulated GPIO matrix. The serial ports all print to stdout.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <sys/types.h>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include "esp_idf_version.h"
+#include "esp_err.h"
+#include "esp_intr_alloc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/gpio.h"
+#include "NativeSim.hpp"
+#include "WString.h"
+
+// mixed type min / max, as in the ESP8266 core
+template <typename T, typename L>
+inline auto min (const T & a, const L & b) -> decltype ((b < a) ? b : a) { return (b < a) ? b : a; }
+template <typename T, typename L>
+inline auto max (const T & a, const L & b) -> decltype ((b < a) ? b : a) { return (a < b) ? b : a; }
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define F_CPU               240000000L
+#define APB_CLK_FREQ        80000000
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define PROGMEM
+#define PGM_P               const char *
+
+#define PSTR(s)             (s)
+#define F(s)                (reinterpret_cast<const __FlashStringHelper *>(PSTR(s)))
+#define FPSTR(p)            (reinterpret_cast<const __FlashStringHelper *>(p))
+
+#define pgm_read_byte(addr)     (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)     (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)    (*(const uint32_t *)(addr))
+#define pgm_read_float(addr)    (*(const float *)(addr))
+#define pgm_read_double(addr)   (*(const double *)(addr))
+#define pgm_read_ptr(addr)      (*(void * const *)(addr))
+#define strlen_P                strlen
+#define strcpy_P                strcpy
+#define strncpy_P               strncpy
+#define strcmp_P                strcmp
+#define strncmp_P               strncmp
+#define strcasecmp_P            strcasecmp
+#define memcpy_P                memcpy
+#define memcmp_P                memcmp
+#define sprintf_P               sprintf
+#define snprintf_P              snprintf
+
+#define LOW                 0x0
+#define HIGH                0x1
+#define INPUT               0x01
+#define OUTPUT              0x03
+#define PULLUP              0x04
+#define INPUT_PULLUP        0x05
+#define PULLDOWN            0x08
+#define INPUT_PULLDOWN      0x09
+#define OPEN_DRAIN          0x10
+#define OUTPUT_OPEN_DRAIN   0x12
+#define RISING              0x01
+#define FALLING             0x02
+#define CHANGE              0x03
+
+#ifndef BIT
+#   define BIT(nr)          (1UL << (nr))
+#endif // ndef BIT
+
+#define bitRead(value, bit)     (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit)      ((value) |= (1UL << (bit)))
+#define bitClear(value, bit)    ((value) &= ~(1UL << (bit)))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define _min(a, b)          ((a) < (b) ? (a) : (b))
+#define _max(a, b)          ((a) > (b) ? (a) : (b))
+
+#define PI                  3.1415926535897932384626433832795
+#define HALF_PI             1.5707963267948966192313216916398
+#define TWO_PI              6.283185307179586476925286766559
+
+#define likely(x)           __builtin_expect(!!(x), 1)
+#define unlikely(x)         __builtin_expect(!!(x), 0)
+
+// time
+inline unsigned long millis ()                      { return (unsigned long)(NativeSim.NowPs () / NATIVE_SIM_PS_PER_MS); }
+inline unsigned long micros ()                      { return (unsigned long)(NativeSim.NowPs () / NATIVE_SIM_PS_PER_US); }
+inline int64_t       esp_timer_get_time ()          { return int64_t(NativeSim.NowPs () / NATIVE_SIM_PS_PER_US); }
+inline void          delay (uint32_t ms)            { NativeSim.Sleep (uint64_t(ms) * NATIVE_SIM_PS_PER_MS); }
+inline void          delayMicroseconds (uint32_t us) { NativeSim.Sleep (uint64_t(us) * NATIVE_SIM_PS_PER_US); }
+inline void          yield ()                       { NativeSim.Yield (); }
+
+// pins
+inline void pinMode (uint8_t pin, uint8_t mode)     { NativeSim.SetPinMode (pin, mode); }
+inline void digitalWrite (uint8_t pin, uint8_t val) { NativeSim.DigitalWrite (pin, val); }
+inline int  digitalRead (uint8_t pin)               { return NativeSim.DigitalRead (pin); }
+inline void pinMatrixOutAttach (uint8_t pin, uint32_t function, bool invertOut, bool invertEnable) { (void)invertEnable; NativeSim.AttachSignal (pin, function, invertOut); }
+// the simulator has no external inputs, pin interrupts never fire
+inline void attachInterrupt (uint8_t pin, void (*isr)(void), int mode) { (void)pin; (void)isr; (void)mode; }
+inline void detachInterrupt (uint8_t pin)           { (void)pin; }
+inline void pinMatrixOutDetach (uint8_t pin, bool invertOut, bool invertEnable) { (void)invertEnable; NativeSim.DetachSignal (pin, invertOut); }
+
+// math
+inline long random (long howbig)                    { return howbig ? (::random () % howbig) : 0; }
+inline long random (long howsmall, long howbig)     { return (howsmall >= howbig) ? howsmall : (howsmall + random (howbig - howsmall)); }
+inline void randomSeed (unsigned long seed)         { if (seed) { srandom (unsigned(seed)); } }
+inline long map (long x, long in_min, long in_max, long out_min, long out_max)
+{
+    return (in_max == in_min) ? out_min : ((x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min);
+}
+
+//----------------------------------------------------------------------------
+class Print;
+
+class Printable
+{
+public:
+    virtual ~Printable () {}
+    virtual size_t printTo (Print & p) const = 0;
+}; // Printable
+
+class Print
+{
+public:
+    virtual ~Print () {}
+
+    virtual size_t write (uint8_t c) = 0;
+    virtual size_t write (const uint8_t * buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+        {
+            n += write (*buffer++);
+        }
+        return n;
+    }
+    size_t write (const char * str)                     { return str ? write ((const uint8_t *)str, strlen (str)) : 0; }
+    size_t write (const char * buffer, size_t size)     { return write ((const uint8_t *)buffer, size); }
+    virtual void flush () {}
+
+    size_t print (const String & s)                     { return write (s.c_str (), s.length ()); }
+    size_t print (const char * s)                       { return write (s); }
+    size_t print (const __FlashStringHelper * s)        { return write (reinterpret_cast<const char *>(s)); }
+    size_t print (char c)                               { return write (uint8_t(c)); }
+    size_t print (const Printable & x)                  { return x.printTo (*this); }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    size_t print (T value, int base = DEC)              { return print (String (value, base)); }
+    size_t print (double value, int digits = 2)         { return print (String (value, (unsigned int)digits)); }
+    size_t print (float value, int digits = 2)          { return print (String (value, (unsigned int)digits)); }
+
+    size_t println ()                                   { return write ("\r\n"); }
+    template <typename T>
+    size_t println (const T & value)                    { size_t n = print (value); return n + println (); }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    size_t println (T value, int base)                  { size_t n = print (value, base); return n + println (); }
+
+    size_t printf (const char * format, ...) __attribute__ ((format (printf, 2, 3)))
+    {
+        char buf[512];
+        va_list args;
+        va_start (args, format);
+        int len = vsnprintf (buf, sizeof (buf), format, args);
+        va_end (args);
+        return (len > 0) ? write (buf, std::min (size_t(len), sizeof (buf) - 1)) : 0;
+    }
+}; // Print
+
+class Stream : public Print
+{
+public:
+    virtual int  available () = 0;
+    virtual int  read () = 0;
+    virtual int  peek () = 0;
+
+    void   setTimeout (unsigned long timeout)          { Timeout = timeout; }
+    size_t readBytes (char * buffer, size_t length)
+    {
+        size_t count = 0;
+        while (count < length)
+        {
+            int c = read ();
+            if (c < 0)
+            {
+                break;
+            }
+            *buffer++ = char(c);
+            ++count;
+        }
+        return count;
+    }
+    size_t readBytes (uint8_t * buffer, size_t length) { return readBytes ((char *)buffer, length); }
+    String readString ()
+    {
+        String Response;
+        for (int c = read (); c >= 0; c = read ())
+        {
+            Response += char(c);
+        }
+        return Response;
+    }
+
+protected:
+    unsigned long Timeout = 1000;
+}; // Stream
+
+class HardwareSerial : public Stream
+{
+public:
+    explicit HardwareSerial (int _UartNum) : UartNum (_UartNum) {}
+
+    void   begin (unsigned long baud, uint32_t config = 0, int8_t rxPin = -1, int8_t txPin = -1) { (void)baud; (void)config; (void)rxPin; (void)txPin; }
+    void   end ()                                       {}
+    int    available () override                        { return 0; }
+    int    read () override                             { return -1; }
+    int    peek () override                             { return -1; }
+    size_t write (uint8_t c) override                   { return fwrite (&c, 1, 1, stdout); }
+    size_t write (const uint8_t * buffer, size_t size) override { return fwrite (buffer, 1, size, stdout); }
+    void   flush () override                            { fflush (stdout); }
+    operator bool () const                              { return true; }
+    using Print::write;
+
+private:
+    int UartNum;
+}; // HardwareSerial
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+
+//----------------------------------------------------------------------------
+class EspClass
+{
+public:
+    uint32_t getCycleCount ()       { return uint32_t ((NativeSim.NowPs () * (F_CPU / 1000000)) / NATIVE_SIM_PS_PER_US); }
+    uint32_t getFreeHeap ()         { return 200 * 1024; }
+    uint32_t getMinFreeHeap ()      { return 150 * 1024; }
+    uint32_t getMaxAllocHeap ()     { return 100 * 1024; }
+    uint32_t getHeapSize ()         { return 300 * 1024; }
+    uint32_t getPsramSize ()        { return 0; }
+    uint32_t getFreePsram ()        { return 0; }
+    uint32_t getCpuFreqMHz ()       { return F_CPU / 1000000; }
+    uint64_t getEfuseMac ()         { return 0x0000AABBCCDDEEFFULL; }
+    const char * getSdkVersion ()   { return "native"; }
+    [[noreturn]] void restart ()    { NativeSim.Exit (0); }
+}; // EspClass
+
+extern EspClass ESP;
@@ -0,0 +1,63 @@
+#pragma once
+/*
+* Artnet.h - Art-Net receiver for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Stands in for the Artnet library. ArtDmx and ArtPoll packets are
+*   decoded the same way and handed to the registered callbacks. No
+*   ArtPollReply is sent.
+*/
+
+#include "Arduino.h"
+#include "AsyncUDP.h"
+
+#define ART_NET_PORT    6454
+#define ART_POLL        0x2000
+#define ART_POLL_REPLY  0x2100
+#define ART_DMX         0x5000
+#define ART_SYNC        0x5200
+#define ART_DMX_START   18
+#define MAX_BUFFER_ARTNET 530
+
+class Artnet
+{
+public:
+    Artnet ();
+
+    void        begin               ();
+    void        setBroadcast        (byte bc[]) { broadcast = IPAddress (bc[0], bc[1], bc[2], bc[3]); }
+    void        setBroadcast        (IPAddress bc) { broadcast = bc; }
+    IPAddress   getRemoteIP         () { return remoteIP; }
+    uint16_t    getOpcode           () { return opcode; }
+
+    void        setArtDmxCallback   (void (*fptr)(uint16_t universe, uint16_t length, uint8_t sequence, uint8_t * data, IPAddress remoteIP)) { artDmxCallback = fptr; }
+    void        setArtPollCallback  (void (*fptr)(IPAddress broadcastIP)) { artPollCallback = fptr; }
+    void        setArtSyncCallback  (void (*fptr)(IPAddress remoteIP)) { artSyncCallback = fptr; }
+
+private:
+    void        parsePacket         (AsyncUDPPacket & _packet);
+
+    AsyncUDP    udp;
+    uint8_t     artnetPacket[MAX_BUFFER_ARTNET];
+    IPAddress   remoteIP;
+    IPAddress   broadcast;
+    uint16_t    opcode = 0;
+
+    void (*artDmxCallback)  (uint16_t universe, uint16_t length, uint8_t sequence, uint8_t * data, IPAddress remoteIP) = nullptr;
+    void (*artPollCallback) (IPAddress broadcastIP) = nullptr;
+    void (*artSyncCallback) (IPAddress remoteIP) = nullptr;
+
+}; // Artnet
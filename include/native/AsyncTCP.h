@@ -0,0 +1,27 @@
+#pragma once
+/*
+* AsyncTCP.h - Async TCP API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   TCP services are not part of the simulator. Only the types the firmware
+*   headers refer to are provided.
+*/
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+class AsyncClient;
+class AsyncServer;
@@ -0,0 +1,106 @@
+#pragma once
+/*
+* AsyncUDP.h - Async UDP API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The simulator has no network interface. The sockets are bound to a
+*   loopback network instead: AsyncUDP::Deliver hands a datagram to the
+*   onPacket handler of every socket listening on the destination port,
+*   in the caller's context, the same way the lwIP task calls the handler
+*   on the ESP32. Multicast group membership is not checked. Datagrams the
+*   firmware sends are counted and dropped.
+*/
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include <arpa/inet.h>
+#include <vector>
+
+class AsyncUDP;
+
+class AsyncUDPMessage : public Print
+{
+public:
+    AsyncUDPMessage (size_t size = 1460) { Buffer.reserve (size); }
+
+    size_t    write (uint8_t data) { Buffer.push_back (data); return 1; }
+    size_t    write (const uint8_t * data, size_t len) { Buffer.insert (Buffer.end (), data, data + len); return len; }
+    uint8_t * data ()   { return Buffer.data (); }
+    size_t    length () { return Buffer.size (); }
+    void      flush ()  { Buffer.clear (); }
+    operator  bool ()   { return true; }
+
+private:
+    std::vector<uint8_t> Buffer;
+}; // AsyncUDPMessage
+
+class AsyncUDPPacket
+{
+public:
+    AsyncUDPPacket (AsyncUDP * udp, uint8_t * data, size_t len, IPAddress remoteIP, uint16_t remotePort, IPAddress localIP, uint16_t localPort) :
+        Udp (udp), Data (data), Length (len), RemoteIP (remoteIP), RemotePort (remotePort), LocalIP (localIP), LocalPort (localPort) {}
+
+    uint8_t * data ()           { return Data; }
+    size_t    length ()         { return Length; }
+    IPAddress remoteIP ()       { return RemoteIP; }
+    uint16_t  remotePort ()     { return RemotePort; }
+    IPAddress localIP ()        { return LocalIP; }
+    uint16_t  localPort ()      { return LocalPort; }
+    bool      isBroadcast ()    { return 255 == LocalIP[3]; }
+    bool      isMulticast ()    { return 0xe0 == (LocalIP[0] & 0xf0); }
+    size_t    send (AsyncUDPMessage & message);
+
+private:
+    AsyncUDP  * Udp;
+    uint8_t   * Data;
+    size_t      Length;
+    IPAddress   RemoteIP;
+    uint16_t    RemotePort;
+    IPAddress   LocalIP;
+    uint16_t    LocalPort;
+}; // AsyncUDPPacket
+
+typedef std::function<void (AsyncUDPPacket & packet)> AuPacketHandlerFunction;
+
+class AsyncUDP
+{
+public:
+    AsyncUDP ();
+    virtual ~AsyncUDP ();
+
+    void    onPacket        (AuPacketHandlerFunction cb) { Handler = cb; }
+    bool    listen          (const IPAddress addr, uint16_t port);
+    bool    listen          (uint16_t port) { return listen (IPAddress (), port); }
+    bool    listenMulticast (const IPAddress addr, uint16_t port, uint8_t ttl = 1);
+    void    close           ();
+    bool    connected       () { return 0 != Port; }
+    size_t  sendTo          (AsyncUDPMessage & message, const IPAddress addr, uint16_t port);
+    size_t  writeTo         (const uint8_t * data, size_t len, const IPAddress addr, uint16_t port);
+    size_t  broadcastTo     (AsyncUDPMessage & message, uint16_t port) { return sendTo (message, IPAddress (255, 255, 255, 255), port); }
+    size_t  broadcastTo     (uint8_t * data, size_t len, uint16_t port) { return writeTo (data, len, IPAddress (255, 255, 255, 255), port); }
+
+    // loopback network
+    static uint32_t Deliver     (uint8_t * data, size_t len, IPAddress remoteIP, uint16_t remotePort, IPAddress localIP, uint16_t localPort);
+    static uint32_t GetTxCount  () { return TxCount; }
+
+private:
+    AuPacketHandlerFunction Handler;
+    uint16_t                Port = 0;
+
+    static std::vector<AsyncUDP *>  Sockets;
+    static uint32_t                 TxCount;
+
+}; // AsyncUDP
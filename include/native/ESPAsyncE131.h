@@ -0,0 +1,102 @@
+#pragma once
+/*
+* ESPAsyncE131.h - E1.31 (sACN) receiver for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Stands in for the ESPAsyncE131 library. The packet layout, the header
+*   checks and the statistics match the library. Only the callback mode
+*   used by c_InputE131 is provided, there is no packet ring buffer.
+*/
+
+#include "Arduino.h"
+#include "AsyncUDP.h"
+
+#define E131_DEFAULT_PORT   5568
+#define E131_UNIVERSE_MAX   512
+
+typedef uint16_t ESPAsyncE131PortId;
+
+typedef union
+{
+    struct __attribute__ ((packed))
+    {
+        // Root Layer
+        uint16_t preamble_size;
+        uint16_t postamble_size;
+        uint8_t  acn_id[12];
+        uint16_t root_flength;
+        uint32_t root_vector;
+        uint8_t  cid[16];
+
+        // Frame Layer
+        uint16_t frame_flength;
+        uint32_t frame_vector;
+        uint8_t  source_name[64];
+        uint8_t  priority;
+        uint16_t reserved;
+        uint8_t  sequence_number;
+        uint8_t  options;
+        uint16_t universe;
+
+        // DMP Layer
+        uint16_t dmp_flength;
+        uint8_t  dmp_vector;
+        uint8_t  type;
+        uint16_t first_address;
+        uint16_t address_increment;
+        uint16_t property_value_count;
+        uint8_t  property_values[E131_UNIVERSE_MAX + 1];
+    };
+
+    uint8_t raw[638];
+} e131_packet_t;
+
+typedef enum
+{
+    E131_UNICAST = 0,
+    E131_MULTICAST
+} e131_listen_t;
+
+typedef struct
+{
+    uint32_t        num_packets;
+    uint32_t        packet_errors;
+    IPAddress       last_clientIP;
+    uint16_t        last_clientPort;
+    unsigned long   last_seen;
+} e131_stats_t;
+
+typedef void (*e131_callback_function) (e131_packet_t * ReceivedData, void * UserInfo);
+
+class ESPAsyncE131
+{
+public:
+    ESPAsyncE131 (uint8_t buffers = 1);
+
+    bool begin              (e131_listen_t type, ESPAsyncE131PortId UdpPortId = E131_DEFAULT_PORT, uint16_t universe = 1, uint8_t n = 1);
+    void registerCallback   (void * UserInfo, e131_callback_function callback) { this->UserInfo = UserInfo; PacketCallback = callback; }
+
+    e131_stats_t    stats;
+
+private:
+    void parsePacket        (AsyncUDPPacket & _packet);
+
+    AsyncUDP                udp;
+    e131_packet_t           Packet;
+    void                  * UserInfo = nullptr;
+    e131_callback_function  PacketCallback = nullptr;
+
+}; // ESPAsyncE131
@@ -0,0 +1,62 @@
+#pragma once
+/*
+* IPAddress.h - IPv4 address class for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "WString.h"
+
+class IPAddress
+{
+public:
+    IPAddress ()                                    {}
+    IPAddress (uint8_t a, uint8_t b, uint8_t c, uint8_t d) { Bytes[0] = a; Bytes[1] = b; Bytes[2] = c; Bytes[3] = d; }
+    IPAddress (uint32_t address)                    { memcpy (Bytes, &address, sizeof (Bytes)); }
+
+    operator uint32_t () const                      { uint32_t Response; memcpy (&Response, Bytes, sizeof (Response)); return Response; }
+    uint8_t   operator [] (int index) const         { return Bytes[index & 3]; }
+    uint8_t & operator [] (int index)               { return Bytes[index & 3]; }
+    bool      operator == (const IPAddress & rhs) const { return 0 == memcmp (Bytes, rhs.Bytes, sizeof (Bytes)); }
+    bool      operator != (const IPAddress & rhs) const { return !(*this == rhs); }
+
+    String toString () const
+    {
+        char buf[16];
+        snprintf (buf, sizeof (buf), "%u.%u.%u.%u", Bytes[0], Bytes[1], Bytes[2], Bytes[3]);
+        return String (buf);
+    }
+
+    bool fromString (const char * address)
+    {
+        unsigned a, b, c, d;
+        if ((nullptr == address) || (4 != sscanf (address, "%u.%u.%u.%u", &a, &b, &c, &d)) || (a > 255) || (b > 255) || (c > 255) || (d > 255))
+        {
+            return false;
+        }
+        *this = IPAddress (uint8_t (a), uint8_t (b), uint8_t (c), uint8_t (d));
+        return true;
+    }
+    bool fromString (const String & address)        { return fromString (address.c_str ()); }
+
+private:
+    uint8_t Bytes[4] = {0, 0, 0, 0};
+}; // IPAddress
+
+const IPAddress INADDR_NONE (0, 0, 0, 0);
@@ -0,0 +1,52 @@
+#pragma once
+/*
+* LittleFS.h - Flash file system types for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Flash files are handled by the native file manager, which stores them in
+*   a host directory. Only the types the firmware headers refer to are
+*   provided.
+*/
+
+#include "Arduino.h"
+
+namespace fs
+{
+    enum SeekMode
+    {
+        SeekSet = 0,
+        SeekCur = 1,
+        SeekEnd = 2,
+    };
+
+    class File
+    {
+    public:
+        operator bool () const  { return false; }
+        void close ()           {}
+    }; // File
+
+    class FS
+    {
+    }; // FS
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
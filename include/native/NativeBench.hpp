@@ -0,0 +1,98 @@
+#pragma once
+/*
+* NativeBench.hpp - Output hot path benchmarks for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Runs the per frame kernels of the output drivers and the effects engine
+*   in a loop and times them with the host clock. Each benchmark is run in
+*   five batches of at least MinMs / 5 and the fastest batch is reported,
+*   which keeps the numbers stable on a busy build machine.
+*
+*   The drivers are created once and reconfigured for each case, the same
+*   way the output manager applies a new config. Destroying an RMT driver
+*   requests a reboot, so the benchmark object is never deleted.
+*
+*   Results are host numbers. They are meant for comparing one build with
+*   another, not for predicting the time on an ESP32.
+*/
+
+#include "ESPixelStick.h"
+#include "output/OutputGECERmt.hpp"
+#include "output/OutputGECEUart.hpp"
+#include "output/OutputSerialRmt.hpp"
+#include "output/OutputSerialUart.hpp"
+#include "output/OutputWS2811Rmt.hpp"
+#include "output/OutputWS2811Uart.hpp"
+#include <functional>
+#include <vector>
+
+#if defined(USE_UART_OUTPUT_DRIVERS)
+    #define BENCH_CLASS_TYPE_NAME(n)    n ## Uart
+#else
+    #define BENCH_CLASS_TYPE_NAME(n)    n ## Rmt
+#endif // defined(USE_UART_OUTPUT_DRIVERS)
+
+class c_NativeBench
+{
+public:
+    c_NativeBench ();
+    virtual ~c_NativeBench ();
+
+    void    Run             (const String & Filter, uint32_t MinMs, const String & JsonFileName);
+    void    GetDriverName   (String & Name) { Name = F ("Bench"); }
+
+private:
+    struct Result_t
+    {
+        String      Name;
+        uint32_t    Pixels;             ///< pixels handled per iteration. 0 for non pixel kernels
+        uint32_t    Bytes;              ///< intensity bytes handled per iteration
+        uint64_t    Iterations;
+        double      NsPerIteration;
+    };
+
+    struct PixelCase_t
+    {
+        const char *    Name;
+        const char *    ColorOrder;
+        uint32_t        PixelCount;
+        uint32_t        GroupSize;
+        uint32_t        ZigSize;
+        uint32_t        NullPixels;     ///< prepended and appended
+        bool            Dither;
+        bool            WhiteExtract;
+    };
+
+    bool    IsSelected      (const String & Name);
+    void    Measure         (const String & Name, uint32_t Pixels, uint32_t Bytes, std::function<void ()> Kernel);
+    void    ConfigurePixel  (c_OutputPixel & Driver, const PixelCase_t & Case);
+    void    BenchPixel      (const PixelCase_t & Case);
+    void    BenchGECE       ();
+    void    BenchRenard     ();
+    void    BenchEffects    ();
+    void    Report          (const String & JsonFileName);
+
+    BENCH_CLASS_TYPE_NAME(c_OutputWS2811)   PixelDriver;
+    BENCH_CLASS_TYPE_NAME(c_OutputGECE)     GECEDriver;
+    BENCH_CLASS_TYPE_NAME(c_OutputSerial)   RenardDriver;
+
+    String                  Filter;
+    uint32_t                MinMs = 200;
+    std::vector<Result_t>   Results;
+    uint8_t                 SourceData[OM_MAX_NUM_CHANNELS];
+    uint8_t                 TargetData[OM_MAX_NUM_CHANNELS];
+
+}; // c_NativeBench
@@ -0,0 +1,81 @@
+#pragma once
+/*
+* NativeReplay.hpp - Replays recorded E1.31 / Art-Net / DDP traffic in the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Reads a capture and hands every UDP payload to the loopback network,
+*   where the E1.31, Art-Net and DDP input drivers receive it through the
+*   same library callbacks they use on the ESP32. The output manager must
+*   be running, the inputs write into its buffer.
+*
+*   Captures are either a pcap file (Ethernet, Linux cooked or raw IPv4
+*   link types) or a text log with one packet per line:
+*
+*       <seconds> <udp port> <payload as hex>
+*
+*   Lines starting with '#' are ignored.
+*
+*   A speed of 1 delivers the packets at the recorded times on the
+*   simulated clock, 2 twice as fast and so on. A speed of 0 delivers them
+*   back to back without advancing the simulated clock, which measures the
+*   input path on the host. The output manager is still polled between
+*   packets, so only the frames that fit in the recorded time are
+*   presented when the capture is paced.
+*
+*   Like on the ESP32, the input drivers cannot give their sockets back,
+*   so they are never deleted.
+*/
+
+#include "ESPixelStick.h"
+#include <vector>
+
+class c_InputCommon;
+
+class c_NativeReplay
+{
+public:
+    c_NativeReplay ();
+    virtual ~c_NativeReplay ();
+
+    bool    Run             (const String & FileName, double Speed, uint16_t FirstUniverse, uint16_t ChannelsPerUniverse);
+    void    GetDriverName   (String & Name) { Name = F ("Replay"); }
+
+private:
+    struct Packet_t
+    {
+        uint64_t                TimeUs;
+        IPAddress               SourceIp;
+        uint16_t                SourcePort;
+        IPAddress               DestinationIp;
+        uint16_t                DestinationPort;
+        std::vector<uint8_t>    Payload;
+    };
+
+    bool        LoadCapture     (const String & FileName);
+    bool        LoadPcap        (FILE * file);
+    bool        LoadLog         (FILE * file);
+    bool        ParseFrame      (uint32_t LinkType, const uint8_t * Frame, uint32_t Length, uint64_t TimeUs);
+    uint32_t    CountChannels   (const Packet_t & Packet);
+    void        AdvanceTo       (uint64_t TimePs);
+    void        PollOnce        ();
+    uint32_t    GetFramesPresented ();
+    void        ReportUniverses (JsonObject & Status);
+
+    std::vector<Packet_t>           Packets;
+    std::vector<c_InputCommon *>    Inputs;
+    uint64_t                        NextPollPs = 0;
+
+}; // c_NativeReplay
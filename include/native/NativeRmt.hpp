@@ -0,0 +1,81 @@
+#pragma once
+/*
+* NativeRmt.hpp - RMT transmitter model for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Each channel reads items from its 64 entry block of RMTMEM, wrapping at
+*   the end, and drives its output signal with the item levels for the item
+*   durations. A zero duration ends the transmission. After every tx_lim
+*   items the threshold interrupt is raised and at the end of transmission
+*   the tx end interrupt is raised, exactly as the ESP32 does.
+*
+*   Every item that is sent is captured with its start time.
+*/
+
+#include "Arduino.h"
+#include "driver/rmt.h"
+
+class c_NativeRmt : public c_NativePeripheral
+{
+public:
+    struct Item_t
+    {
+        uint64_t        TimePs;
+        rmt_item32_t    Item;
+    };
+
+    void        Begin       ();
+    void        Config      (const rmt_config_t & Config);
+    void        TxStart     (uint32_t Channel);
+    void        TxStop      (uint32_t Channel);
+    void        ResetReadPointer (uint32_t Channel);
+
+    const char * GetName    () override { return "RMT"; }
+    uint64_t    NextEventPs () override;
+    void        Service     (uint64_t NowPs) override;
+
+    // capture
+    const std::vector<Item_t> & GetItems (uint32_t Channel) { return Channels[Channel % RMT_LL_NUM_CHANNELS].Items; }
+    uint64_t    GetTickPs   (uint32_t Channel);
+    void        ClearCapture ();
+
+private:
+    enum ItemPhase_t
+    {
+        ItemStart = 0,      ///< read the next item and send level0
+        ItemLevel1,         ///< send level1
+    };
+
+    struct Channel_t
+    {
+        bool                Active          = false;
+        ItemPhase_t         Phase           = ItemStart;
+        uint32_t            ReadIndex       = 0;
+        uint32_t            ItemsSinceThres = 0;
+        rmt_item32_t        CurrentItem;
+        uint64_t            NextEventPs     = NATIVE_SIM_NEVER;
+        std::vector<Item_t> Items;
+    };
+
+    void        EndOfTransmission (uint32_t Channel, uint64_t TimePs);
+    void        SetOutput   (uint32_t Channel, uint8_t Level, uint64_t TimePs);
+
+    bool        HasBeenInitialized = false;
+    Channel_t   Channels[RMT_LL_NUM_CHANNELS];
+
+}; // c_NativeRmt
+
+extern c_NativeRmt NativeRmt;
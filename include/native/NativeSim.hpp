@@ -0,0 +1,145 @@
+#pragma once
+/*
+* NativeSim.hpp - Virtual clock, task scheduler and GPIO model for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The simulator runs the firmware against a virtual clock. Firmware code
+*   takes no simulated time. Time only moves forward when every task is
+*   blocked (delay, task notification, semaphore), at which point the clock
+*   jumps to the next task wake up or peripheral event.
+*
+*   FreeRTOS tasks are host threads, but only one of them runs at a time.
+*   A task runs until it blocks, then the highest priority runnable task
+*   gets the CPU. Tasks of equal priority take turns.
+*
+*   Peripheral models (RMT, UART) derive from c_NativePeripheral. They are
+*   serviced between task switches and call their interrupt handlers from
+*   there, so an ISR never runs in the middle of task code.
+*
+*   Every change of a GPIO output level is recorded with its time stamp.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+typedef struct NativeTask_t      * TaskHandle_t;
+typedef struct NativeSemaphore_t * SemaphoreHandle_t;
+typedef struct NativeIntr_t      * intr_handle_t;
+typedef void (*NativeIsr_t) (void * arg);
+
+#define NATIVE_SIM_NEVER            uint64_t(-1)
+#define NATIVE_SIM_PS_PER_NS        uint64_t(1000)
+#define NATIVE_SIM_PS_PER_US        uint64_t(1000000)
+#define NATIVE_SIM_PS_PER_MS        uint64_t(1000000000)
+#define NATIVE_SIM_PS_PER_APB_TICK  uint64_t(12500)         ///< 80 MHz peripheral clock
+#define NATIVE_SIM_NUM_GPIO         40
+#define NATIVE_SIM_NUM_SIGNALS      256
+#define NATIVE_SIM_NO_SIGNAL        uint32_t(-1)
+
+//----------------------------------------------------------------------------
+class c_NativePeripheral
+{
+public:
+    virtual ~c_NativePeripheral () {}
+
+    virtual const char * GetName     () = 0;
+    virtual uint64_t     NextEventPs () = 0;                    ///< NATIVE_SIM_NEVER when idle
+    virtual void         Service     (uint64_t NowPs) = 0;      ///< process everything due at or before NowPs
+    virtual bool         ReadReg     (uint32_t Address, uint32_t & Value) { return false; }
+    virtual bool         WriteReg    (uint32_t Address, uint32_t Value)   { return false; }
+
+    c_NativePeripheral * pNext = nullptr;
+
+}; // c_NativePeripheral
+
+//----------------------------------------------------------------------------
+class c_NativeSim
+{
+public:
+    struct Edge_t
+    {
+        uint64_t    TimePs;
+        uint8_t     Level;
+    };
+
+    c_NativeSim ();
+
+    // clock
+    uint64_t            NowPs () { return CurrentTimePs; }
+
+    // scheduler
+    TaskHandle_t        CreateTask      (void (*Function)(void *), const char * Name, uint32_t Priority, void * Arg);
+    void                DeleteTask      (TaskHandle_t Task);
+    void                SetPriority     (TaskHandle_t Task, uint32_t Priority);
+    TaskHandle_t        GetCurrentTask  ();
+    TaskHandle_t        FindTask        (const char * Name);
+    const char        * GetTaskName     (TaskHandle_t Task);
+    uint32_t            GetPriority     (TaskHandle_t Task);
+    void                Sleep           (uint64_t DurationPs);
+    void                Yield           () { Sleep (0); }
+    uint32_t            NotifyTake      (bool ClearOnExit, uint64_t TimeoutPs);
+    void                NotifyGive      (TaskHandle_t Task);
+    SemaphoreHandle_t   CreateSemaphore (uint32_t MaxCount, uint32_t InitialCount);
+    void                DeleteSemaphore (SemaphoreHandle_t Semaphore);
+    bool                SemaphoreTake   (SemaphoreHandle_t Semaphore, uint64_t TimeoutPs);
+    bool                SemaphoreGive   (SemaphoreHandle_t Semaphore);
+    [[noreturn]] void   Exit            (int Status);
+
+    // peripherals and interrupts
+    void                AddPeripheral   (c_NativePeripheral * pPeripheral);
+    intr_handle_t       AllocInterrupt  (int Source, NativeIsr_t Handler, void * Arg);
+    void                FreeInterrupt   (intr_handle_t Handle);
+    void                CallInterrupt   (int Source);
+    uint32_t            ReadReg         (uint32_t Address);
+    void                WriteReg        (uint32_t Address, uint32_t Value);
+
+    // gpio matrix
+    void                SetPinMode      (uint32_t Pin, uint8_t Mode);
+    void                DigitalWrite    (uint32_t Pin, uint8_t Level);
+    int                 DigitalRead     (uint32_t Pin);
+    void                AttachSignal    (uint32_t Pin, uint32_t Signal, bool Invert);
+    void                DetachSignal    (uint32_t Pin, bool Invert);
+    void                SetSignal       (uint32_t Signal, uint8_t Level, uint64_t TimePs);
+
+    // capture
+    const std::vector<Edge_t> & GetEdges (uint32_t Pin) { return Pins[Pin % NATIVE_SIM_NUM_GPIO].Edges; }
+    void                ClearCapture    ();
+
+private:
+    struct Pin_t
+    {
+        uint32_t            Signal  = NATIVE_SIM_NO_SIGNAL;  ///< peripheral signal driving the pin
+        bool                Invert  = false;
+        bool                IsOutput = false;
+        uint8_t             GpioLevel = 0;                  ///< level written with digitalWrite
+        uint8_t             Level   = 0;                    ///< current level on the pin
+        std::vector<Edge_t> Edges;
+    };
+
+    void                UpdatePin       (uint32_t Pin, uint64_t TimePs);
+    void                Block           (bool (*IsReady)(void * Context), void * Context, uint64_t WakePs);
+    NativeTask_t      * PickNextTask    ();
+    void                ServicePeripherals ();
+
+    uint64_t            CurrentTimePs   = 0;
+    c_NativePeripheral* pPeripherals    = nullptr;
+    Pin_t               Pins[NATIVE_SIM_NUM_GPIO];
+    uint8_t             SignalLevels[NATIVE_SIM_NUM_SIGNALS];
+
+}; // c_NativeSim
+
+extern c_NativeSim NativeSim;
@@ -0,0 +1,105 @@
+#pragma once
+/*
+* NativeUart.hpp - UART transmitter model for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Models the transmit half of an ESP32 UART: the register block, the 128
+*   byte TX FIFO and the shift register. The bit time comes from CLKDIV and
+*   the frame format from CONF0, including TXD_INV.
+*
+*   When TXD_BRK is set, the transmitter sends TX_BRK_NUM break bits after
+*   the FIFO drains, raises TX_BRK_DONE, holds the line idle for TX_IDLE_NUM
+*   bits and raises TX_BRK_IDLE_DONE. TX_DONE is raised when the line goes
+*   idle with nothing left to send. TXFIFO_EMPTY is raised whenever the FIFO
+*   holds fewer bytes than the CONF1 threshold.
+*
+*   Every byte that is shifted out is captured with its start time.
+*/
+
+#include "Arduino.h"
+#include "driver/uart.h"
+
+class c_NativeUart : public c_NativePeripheral
+{
+public:
+    struct Byte_t
+    {
+        uint64_t    TimePs;
+        uint8_t     Value;
+    };
+
+    void        Begin       (uart_port_t UartId);
+    void        SetTxPin    (int Pin);
+
+    const char * GetName    () override { return Name; }
+    uint64_t    NextEventPs () override;
+    void        Service     (uint64_t NowPs) override;
+    bool        ReadReg     (uint32_t Address, uint32_t & Value) override;
+    bool        WriteReg    (uint32_t Address, uint32_t Value) override;
+
+    // capture
+    const std::vector<Byte_t> & GetBytes () { return Bytes; }
+    uint64_t    GetBitPs    ();
+    void        ClearCapture () { Bytes.clear (); }
+
+private:
+    enum TxState_t
+    {
+        TxIdle = 0,
+        TxSending,      ///< shifting out a character
+        TxBreak,        ///< sending break bits after the FIFO drained
+        TxBreakIdle,    ///< holding the line idle after a break
+    };
+
+    void        StartNextAction (uint64_t TimePs);
+    void        StartCharacter  (uint8_t Value, uint64_t TimePs);
+    void        SetLine         (uint8_t Level, uint64_t TimePs);
+    void        UpdateFifoEmpty ();
+    void        RaiseInterrupt  (uint32_t Mask);
+    uint32_t    GetSignal       ();
+
+    uart_port_t UartId              = UART_NUM_0;
+    char        Name[8]             = "UART";
+    bool        HasBeenInitialized  = false;
+
+    // registers
+    uint32_t    IntRaw              = 0;
+    uint32_t    IntEna              = 0;
+    uint32_t    ClkDiv              = 0;
+    uint32_t    Conf0               = 0;
+    uint32_t    Conf1               = 0;
+    uint32_t    IdleConf            = 0;
+
+    // fifo
+    uint8_t     Fifo[UART_FIFO_LEN];
+    uint32_t    FifoReadIndex       = 0;
+    uint32_t    FifoCount           = 0;
+
+    // transmitter
+    TxState_t   TxState             = TxIdle;
+    uint8_t     LineLevel           = HIGH;     ///< before TXD_INV is applied
+    bool        SentSinceBreak      = false;
+    uint32_t    NumSegments         = 0;
+    uint32_t    SegmentIndex        = 0;
+    uint8_t     SegmentLevel[12];
+    uint64_t    SegmentPs[12];
+    uint64_t    NextSegmentPs       = NATIVE_SIM_NEVER;
+
+    std::vector<Byte_t> Bytes;
+
+}; // c_NativeUart
+
+extern c_NativeUart NativeUart[UART_NUM_MAX];
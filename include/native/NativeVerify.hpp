@@ -0,0 +1,122 @@
+#pragma once
+/*
+* NativeVerify.hpp - Waveform timing verifier for the pixel protocol encoders
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Runs every pixel protocol on port 0 (RMT or UART driver, whichever the
+*   build uses), sends test frames through the output manager and decodes
+*   the edges recorded on the data pin back into pulses. The pulses are
+*   checked against the datasheet windows in the table in NativeVerify.cpp.
+*   The table is kept apart from the encoder constants on purpose, a wrong
+*   constant must not be able to fix its own check.
+*
+*   Switching protocols deletes the old driver, which requests a reboot on
+*   the ESP32. Each protocol therefore runs in its own process: Fork
+*   returns once in every child with the protocol it must set up, the
+*   parent collects the results and exits without returning.
+*
+*   Polarity is taken from the level most of the resets on the pin are at
+*   (the longer total time when it is a tie). A pin that rests at the
+*   opposite of the level the pixel expects is reported as inverted (the
+*   board is expected to invert it) and decoded as the pixel would see it
+*   after the inverter.
+*
+*   A gap in front of a frame that is held at the active level runs into
+*   the first pulse of the frame, the pixel never sees a reset. It is
+*   counted as an active gap and is a violation.
+*
+*   The driver runs for a while before recording starts, and whatever is
+*   on the pin before the first reset is not checked.
+*/
+
+#include "ESPixelStick.h"
+#include <vector>
+
+class c_NativeVerify
+{
+public:
+    c_NativeVerify ();
+    virtual ~c_NativeVerify ();
+
+    enum Coding_t
+    {
+        PulseWidth,     ///< pulse at the active level carries the bit, the rest of the bit is at the idle level
+        SpaceFirst,     ///< start pulse, then idle level time followed by the active pulse (GECE)
+        Manchester,     ///< every bit changes level in the middle (TLS3001)
+    };
+
+    struct Window_t
+    {
+        uint32_t    MinNs;
+        uint32_t    MaxNs;      ///< 0 = no upper limit
+    };
+
+    struct Protocol_t
+    {
+        const char *    Name;
+        int32_t         OutputType;
+        Coding_t        Coding;
+        uint8_t         IdleLevel;      ///< at the pixel
+        Window_t        Active[2];      ///< bit 0, bit 1. Manchester: half bit, full bit
+        Window_t        Idle[2];        ///< {0, 0} = not specified by the datasheet
+        Window_t        Start;          ///< start pulse (SpaceFirst only)
+        uint32_t        MinResetNs;
+    };
+
+    int32_t Fork            (const String & Filter, const String & JsonFileName);
+    [[noreturn]] void Run   (uint32_t NumFrames);
+    void    GetDriverName   (String & Name) { Name = F ("Verify"); }
+
+private:
+    // fixed size so it can be written through a pipe
+    struct Result_t
+    {
+        char        Name[16];
+        bool        Ran;
+        bool        Inverted;
+        uint32_t    Pin;
+        uint32_t    Frames;
+        uint32_t    MinBits;
+        uint32_t    MaxBits;
+        double      BitsPerSecond;
+        double      FrameUs;            ///< longest frame, without the reset
+        double      MinResetUs;         ///< shortest gap between two frames
+        double      FramesPerSecond;    ///< with the longest frame and the datasheet reset
+        uint32_t    ActiveGaps;         ///< frames whose gap ran into the first pulse
+        uint32_t    Violations;
+        char        FirstViolation[160];
+    };
+
+    struct Pulse_t
+    {
+        uint8_t     Level;
+        uint64_t    DurationPs;
+    };
+
+    bool        IsSelected      (const Protocol_t & Protocol);
+    bool        InWindow        (const Window_t & Window, uint64_t DurationPs);
+    void        Violation       (const String & Message);
+    void        DecodeFrame     (const std::vector<Pulse_t> & Frame, uint64_t FrameStartPs);
+    void        Report          (const std::vector<Result_t> & Results, const String & JsonFileName);
+
+    String              Filter;
+    const Protocol_t *  pProtocol = nullptr;
+    Result_t            Result;
+    double              SumBitPs = 0.0;
+    uint64_t            SumBits = 0;
+    int                 ResultFd = -1;
+
+}; // c_NativeVerify
@@ -0,0 +1,42 @@
+#pragma once
+/*
+* SdFat.h - SD card types for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The simulator has no SD card. Only the types the firmware headers refer
+*   to are provided.
+*/
+
+#include <stdint.h>
+
+#define SD_SCK_MHZ(maxMhz)  (1000000UL * (maxMhz))
+#define DEDICATED_SPI       1
+#define SHARED_SPI          0
+
+class FsFile
+{
+public:
+    operator bool () const  { return false; }
+    void close ()           {}
+}; // FsFile
+
+class SdFile : public FsFile
+{
+}; // SdFile
+
+class SdFat
+{
+}; // SdFat
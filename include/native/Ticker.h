@@ -0,0 +1,44 @@
+#pragma once
+/*
+* Ticker.h - Periodic timer API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Ticker callbacks run from the esp_timer task on the target. The
+*   simulator does not model that task, so a Ticker never fires. Code that
+*   depends on one must be driven from the test harness instead.
+*/
+
+#include <stdint.h>
+
+class Ticker
+{
+public:
+    typedef void (*callback_t) (void);
+
+    void attach    (float seconds, callback_t callback)              { (void)seconds; (void)callback; Active = true; }
+    void attach_ms (uint32_t milliseconds, callback_t callback)      { (void)milliseconds; (void)callback; Active = true; }
+    void once      (float seconds, callback_t callback)              { (void)seconds; (void)callback; Active = true; }
+    void once_ms   (uint32_t milliseconds, callback_t callback)      { (void)milliseconds; (void)callback; Active = true; }
+    template <typename TArg>
+    void attach_ms (uint32_t milliseconds, void (*callback)(TArg), TArg arg) { (void)milliseconds; (void)callback; (void)arg; Active = true; }
+    template <typename TArg>
+    void once_ms   (uint32_t milliseconds, void (*callback)(TArg), TArg arg) { (void)milliseconds; (void)callback; (void)arg; Active = true; }
+    void detach    ()                                                { Active = false; }
+    bool active    ()                                                { return Active; }
+
+private:
+    bool Active = false;
+}; // Ticker
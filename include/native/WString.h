@@ -0,0 +1,234 @@
+#pragma once
+/*
+* WString.h - Arduino String class for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Only the parts of the Arduino String API used by the firmware and by
+*   ArduinoJson are provided. Storage is a std::string.
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <string>
+
+class __FlashStringHelper;
+
+#define HEX 16
+#define DEC 10
+#define OCT 8
+#define BIN 2
+
+class StringSumHelper;
+
+class String
+{
+public:
+    String ()                                       {}
+    String (const String & value) = default;
+    String (const char * value)                     { if (value) { Data = value; } }
+    String (const std::string & value) : Data (value) {}
+    String (const __FlashStringHelper * value)      { if (value) { Data = reinterpret_cast<const char *>(value); } }
+    explicit String (char value)                    { Data.assign (1, value); }
+    explicit String (unsigned char value, unsigned char base = DEC)      { FromUnsigned (value, base); }
+    explicit String (int value, unsigned char base = DEC)                { FromSigned (value, base); }
+    explicit String (unsigned int value, unsigned char base = DEC)       { FromUnsigned (value, base); }
+    explicit String (long value, unsigned char base = DEC)               { FromSigned (value, base); }
+    explicit String (unsigned long value, unsigned char base = DEC)      { FromUnsigned (value, base); }
+    explicit String (long long value, unsigned char base = DEC)          { FromSigned (value, base); }
+    explicit String (unsigned long long value, unsigned char base = DEC) { FromUnsigned (value, base); }
+    explicit String (float value, unsigned int decimalPlaces = 2)        { FromDouble (value, decimalPlaces); }
+    explicit String (double value, unsigned int decimalPlaces = 2)       { FromDouble (value, decimalPlaces); }
+
+    String & operator = (const String & value) = default;
+    String & operator = (const char * value)                { if (value) { Data = value; } else { Data.clear (); } return *this; }
+    String & operator = (const __FlashStringHelper * value) { return operator = (reinterpret_cast<const char *>(value)); }
+
+    bool concat (const String & value)              { Data += value.Data; return true; }
+    bool concat (const char * value)                { if (!value) { return false; } Data += value; return true; }
+    bool concat (const char * value, unsigned int length) { if (!value) { return false; } Data.append (value, length); return true; }
+    bool concat (const __FlashStringHelper * value) { return concat (reinterpret_cast<const char *>(value)); }
+    bool concat (char value)                        { Data += value; return true; }
+    bool concat (unsigned char value)               { return concat (String (value)); }
+    bool concat (int value)                         { return concat (String (value)); }
+    bool concat (unsigned int value)                { return concat (String (value)); }
+    bool concat (long value)                        { return concat (String (value)); }
+    bool concat (unsigned long value)               { return concat (String (value)); }
+    bool concat (long long value)                   { return concat (String (value)); }
+    bool concat (unsigned long long value)          { return concat (String (value)); }
+    bool concat (float value)                       { return concat (String (value)); }
+    bool concat (double value)                      { return concat (String (value)); }
+
+    template <typename T>
+    String & operator += (const T & value)          { concat (value); return *this; }
+
+    unsigned int length () const                    { return (unsigned int)Data.length (); }
+    bool         isEmpty () const                   { return Data.empty (); }
+    const char * c_str () const                     { return Data.c_str (); }
+    bool         reserve (unsigned int size)        { Data.reserve (size); return true; }
+    void         clear ()                           { Data.clear (); }
+
+    char   charAt (unsigned int index) const        { return (index < Data.length ()) ? Data[index] : 0; }
+    char   operator [] (unsigned int index) const   { return charAt (index); }
+    char & operator [] (unsigned int index)         { return Data[index]; }
+
+    int  compareTo (const String & value) const     { return Data.compare (value.Data); }
+    bool equals (const String & value) const        { return Data == value.Data; }
+    bool equals (const char * value) const          { return Data == (value ? value : ""); }
+    bool equalsIgnoreCase (const String & value) const
+    {
+        return (Data.length () == value.Data.length ()) && (0 == strcasecmp (Data.c_str (), value.Data.c_str ()));
+    }
+    bool operator == (const String & value) const   { return equals (value); }
+    bool operator == (const char * value) const     { return equals (value); }
+    bool operator != (const String & value) const   { return !equals (value); }
+    bool operator != (const char * value) const     { return !equals (value); }
+    bool operator <  (const String & value) const   { return Data <  value.Data; }
+    bool operator >  (const String & value) const   { return Data >  value.Data; }
+    bool operator <= (const String & value) const   { return Data <= value.Data; }
+    bool operator >= (const String & value) const   { return Data >= value.Data; }
+
+    bool startsWith (const String & prefix) const   { return 0 == Data.compare (0, prefix.Data.length (), prefix.Data); }
+    bool startsWith (const String & prefix, unsigned int offset) const { return (offset <= Data.length ()) && (0 == Data.compare (offset, prefix.Data.length (), prefix.Data)); }
+    bool endsWith (const String & suffix) const
+    {
+        return (Data.length () >= suffix.Data.length ()) &&
+               (0 == Data.compare (Data.length () - suffix.Data.length (), suffix.Data.length (), suffix.Data));
+    }
+
+    int indexOf (char value, unsigned int from = 0) const           { return FindResult (Data.find (value, from)); }
+    int indexOf (const String & value, unsigned int from = 0) const { return FindResult (Data.find (value.Data, from)); }
+    int lastIndexOf (char value) const                              { return FindResult (Data.rfind (value)); }
+    int lastIndexOf (const String & value) const                    { return FindResult (Data.rfind (value.Data)); }
+
+    String substring (unsigned int from) const      { return (from < Data.length ()) ? String (Data.substr (from)) : String (); }
+    String substring (unsigned int from, unsigned int to) const
+    {
+        if (from > to) { unsigned int temp = from; from = to; to = temp; }
+        return (from < Data.length ()) ? String (Data.substr (from, to - from)) : String ();
+    }
+
+    void replace (const String & find, const String & replace)
+    {
+        if (find.Data.empty ()) { return; }
+        for (size_t pos = Data.find (find.Data); std::string::npos != pos; pos = Data.find (find.Data, pos + replace.Data.length ()))
+        {
+            Data.replace (pos, find.Data.length (), replace.Data);
+        }
+    }
+    void replace (char find, char replace)          { for (auto & c : Data) { if (c == find) { c = replace; } } }
+    void remove (unsigned int index)                { if (index < Data.length ()) { Data.erase (index); } }
+    void remove (unsigned int index, unsigned int count) { if (index < Data.length ()) { Data.erase (index, count); } }
+    void toLowerCase ()                             { for (auto & c : Data) { c = char(tolower (c)); } }
+    void toUpperCase ()                             { for (auto & c : Data) { c = char(toupper (c)); } }
+    void trim ()
+    {
+        size_t first = Data.find_first_not_of (" \t\r\n\f\v");
+        if (std::string::npos == first) { Data.clear (); return; }
+        size_t last = Data.find_last_not_of (" \t\r\n\f\v");
+        Data = Data.substr (first, last - first + 1);
+    }
+
+    long   toInt () const                           { return strtol (Data.c_str (), nullptr, 10); }
+    float  toFloat () const                         { return float(strtod (Data.c_str (), nullptr)); }
+    double toDouble () const                        { return strtod (Data.c_str (), nullptr); }
+
+    void getBytes (unsigned char * buf, unsigned int bufsize, unsigned int index = 0) const
+    {
+        if (!bufsize || !buf) { return; }
+        size_t len = (index < Data.length ()) ? Data.length () - index : 0;
+        if (len > bufsize - 1) { len = bufsize - 1; }
+        memcpy (buf, Data.c_str () + index, len);
+        buf[len] = 0;
+    }
+    void toCharArray (char * buf, unsigned int bufsize, unsigned int index = 0) const { getBytes ((unsigned char *)buf, bufsize, index); }
+
+private:
+    static int FindResult (size_t pos) { return (std::string::npos == pos) ? -1 : int(pos); }
+
+    void FromUnsigned (unsigned long long value, unsigned char base)
+    {
+        char buf[8 * sizeof (value) + 1];
+        char * p = &buf[sizeof (buf) - 1];
+        *p = 0;
+        if (base < 2) { base = 10; }
+        do
+        {
+            unsigned digit = unsigned(value % base);
+            *--p = char((digit < 10) ? ('0' + digit) : ('a' + digit - 10));
+            value /= base;
+        } while (value);
+        Data = p;
+    }
+    void FromSigned (long long value, unsigned char base)
+    {
+        if ((value < 0) && (DEC == base)) { FromUnsigned ((unsigned long long)(-value), base); Data.insert (0, 1, '-'); }
+        else { FromUnsigned ((unsigned long long)value, base); }
+    }
+    void FromDouble (double value, unsigned int decimalPlaces)
+    {
+        char buf[64];
+        snprintf (buf, sizeof (buf), "%.*f", int(decimalPlaces), value);
+        Data = buf;
+    }
+
+    std::string Data;
+}; // String
+
+class StringSumHelper : public String
+{
+public:
+    StringSumHelper (const String & value) : String (value) {}
+    StringSumHelper (const char * value) : String (value) {}
+    template <typename T>
+    explicit StringSumHelper (T value) : String (value) {}
+}; // StringSumHelper
+
+// As in the Arduino core the left side is always a StringSumHelper, a String
+// on the left converts to one. Overloads that take a String on the left as
+// well make String + char[N] ambiguous.
+#define STRING_SUM_OPERATOR(Type) \
+    inline StringSumHelper & operator + (const StringSumHelper & lhs, Type rhs) \
+    { \
+        StringSumHelper & result = const_cast<StringSumHelper &>(lhs); \
+        result.concat (rhs); \
+        return result; \
+    }
+
+STRING_SUM_OPERATOR (const String &)
+STRING_SUM_OPERATOR (const char *)
+STRING_SUM_OPERATOR (const __FlashStringHelper *)
+STRING_SUM_OPERATOR (char)
+STRING_SUM_OPERATOR (unsigned char)
+STRING_SUM_OPERATOR (int)
+STRING_SUM_OPERATOR (unsigned int)
+STRING_SUM_OPERATOR (long)
+STRING_SUM_OPERATOR (unsigned long)
+STRING_SUM_OPERATOR (long long)
+STRING_SUM_OPERATOR (unsigned long long)
+STRING_SUM_OPERATOR (float)
+STRING_SUM_OPERATOR (double)
+
+#undef STRING_SUM_OPERATOR
+
+inline StringSumHelper operator + (const char * lhs, const String & rhs)        { StringSumHelper result (lhs); result.concat (rhs); return result; }
+inline StringSumHelper operator + (const __FlashStringHelper * lhs, const String & rhs) { StringSumHelper result (lhs); result.concat (rhs); return result; }
+inline bool operator == (const char * lhs, const String & rhs)                  { return rhs.equals (lhs); }
+inline bool operator != (const char * lhs, const String & rhs)                  { return !rhs.equals (lhs); }
+
+extern const String emptyString;
@@ -0,0 +1,53 @@
+#pragma once
+/*
+* WiFi.h - WiFi API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The simulator has no radio. Only the types the firmware headers refer
+*   to are provided. The station is always connected to the loopback
+*   network provided by AsyncUDP.h.
+*/
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+typedef enum
+{
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+} arduino_event_id_t;
+
+typedef arduino_event_id_t WiFiEvent_t;
+
+typedef union
+{
+    uint32_t reason;
+} arduino_event_info_t;
+
+typedef arduino_event_info_t WiFiEventInfo_t;
+
+class WiFiClass
+{
+public:
+    String      macAddress ()   { return F ("02:00:00:00:00:01"); }
+    IPAddress   localIP ()      { return IPAddress (127, 0, 0, 1); }
+    IPAddress   subnetMask ()   { return IPAddress (255, 0, 0, 0); }
+    IPAddress   broadcastIP ()  { return IPAddress (127, 255, 255, 255); }
+    bool        isConnected ()  { return true; }
+}; // WiFiClass
+
+extern WiFiClass WiFi;
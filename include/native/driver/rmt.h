@@ -0,0 +1,126 @@
+#pragma once
+/*
+* rmt.h - Legacy RMT driver API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Only the configuration and interrupt registration calls are provided.
+*   Transmission is done through the low level API in hal/rmt_ll.h.
+*/
+
+#include "esp_err.h"
+#include "esp_intr_alloc.h"
+#include "driver/gpio.h"
+#include "hal/rmt_ll.h"
+
+typedef intr_handle_t rmt_isr_handle_t;
+
+typedef enum
+{
+    RMT_CHANNEL_0 = 0, RMT_CHANNEL_1, RMT_CHANNEL_2, RMT_CHANNEL_3,
+    RMT_CHANNEL_4,     RMT_CHANNEL_5, RMT_CHANNEL_6, RMT_CHANNEL_7,
+    RMT_CHANNEL_MAX,
+} rmt_channel_t;
+
+typedef enum
+{
+    RMT_MODE_TX = 0,
+    RMT_MODE_RX,
+    RMT_MODE_MAX,
+} rmt_mode_t;
+
+typedef enum
+{
+    RMT_IDLE_LEVEL_LOW = 0,
+    RMT_IDLE_LEVEL_HIGH,
+    RMT_IDLE_LEVEL_MAX,
+} rmt_idle_level_t;
+
+typedef enum
+{
+    RMT_CARRIER_LEVEL_LOW = 0,
+    RMT_CARRIER_LEVEL_HIGH,
+    RMT_CARRIER_LEVEL_MAX,
+} rmt_carrier_level_t;
+
+typedef enum
+{
+    RMT_MEM_64  = 1,
+    RMT_MEM_128 = 2,
+    RMT_MEM_192 = 3,
+    RMT_MEM_256 = 4,
+    RMT_MEM_320 = 5,
+    RMT_MEM_384 = 6,
+    RMT_MEM_448 = 7,
+    RMT_MEM_512 = 8,
+} rmt_reserve_memsize_t;
+
+typedef struct
+{
+    uint32_t            carrier_freq_hz;
+    rmt_carrier_level_t carrier_level;
+    rmt_idle_level_t    idle_level;
+    uint8_t             carrier_duty_percent;
+    uint32_t            loop_count;
+    bool                carrier_en;
+    bool                loop_en;
+    bool                idle_output_en;
+} rmt_tx_config_t;
+
+typedef struct
+{
+    uint16_t            filter_ticks_thresh;
+    uint16_t            idle_threshold;
+    bool                filter_en;
+} rmt_rx_config_t;
+
+typedef struct
+{
+    rmt_mode_t          rmt_mode;
+    rmt_channel_t       channel;
+    gpio_num_t          gpio_num;
+    uint8_t             clk_div;
+    uint8_t             mem_block_num;
+    uint32_t            flags;
+    union
+    {
+        rmt_tx_config_t tx_config;
+        rmt_rx_config_t rx_config;
+    };
+} rmt_config_t;
+
+#define RMT_DEFAULT_CONFIG_TX(gpio, channel_id)     \
+    {                                               \
+        .rmt_mode = RMT_MODE_TX,                    \
+        .channel = channel_id,                      \
+        .gpio_num = gpio,                           \
+        .clk_div = 80,                              \
+        .mem_block_num = 1,                         \
+        .flags = 0,                                 \
+        .tx_config = {                              \
+            .carrier_freq_hz = 38000,               \
+            .carrier_level = RMT_CARRIER_LEVEL_HIGH,\
+            .idle_level = RMT_IDLE_LEVEL_LOW,       \
+            .carrier_duty_percent = 33,             \
+            .loop_count = 0,                        \
+            .carrier_en = false,                    \
+            .loop_en = false,                       \
+            .idle_output_en = true,                 \
+        }                                           \
+    }
+
+extern esp_err_t rmt_config (const rmt_config_t * rmt_param);
+extern esp_err_t rmt_isr_register (void (*fn)(void *), void * arg, int intr_alloc_flags, rmt_isr_handle_t * handle);
+extern esp_err_t rmt_isr_deregister (rmt_isr_handle_t handle);
@@ -0,0 +1,33 @@
+#pragma once
+/*
+* uart.h - UART driver API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The configuration calls program the simulated UART registers the same
+*   way the IDF driver programs the real ones.
+*/
+
+#include "esp_err.h"
+#include "esp_intr_alloc.h"
+#include "driver/gpio.h"
+#include "hal/uart_types.h"
+#include "soc/uart_reg.h"
+
+extern esp_err_t uart_param_config      (uart_port_t uart_num, const uart_config_t * uart_config);
+extern esp_err_t uart_set_pin           (uart_port_t uart_num, int tx_io_num, int rx_io_num, int rts_io_num, int cts_io_num);
+extern esp_err_t uart_set_hw_flow_ctrl  (uart_port_t uart_num, uart_hw_flowcontrol_t flow_ctrl, uint8_t rx_thresh);
+extern esp_err_t uart_set_sw_flow_ctrl  (uart_port_t uart_num, bool enable, uint8_t rx_thresh_xon, uint8_t rx_thresh_xoff);
+extern esp_err_t uart_isr_register      (uart_port_t uart_num, void (*fn)(void *), void * arg, int intr_alloc_flags, intr_handle_t * handle);
@@ -0,0 +1,43 @@
+#pragma once
+/*
+* esp_err.h - ESP-IDF error codes for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int32_t esp_err_t;
+
+#define ESP_OK                  0
+#define ESP_FAIL                -1
+#define ESP_ERR_NO_MEM          0x101
+#define ESP_ERR_INVALID_ARG     0x102
+#define ESP_ERR_INVALID_STATE   0x103
+#define ESP_ERR_NOT_FOUND       0x105
+
+#define ESP_ERROR_CHECK(x) \
+    do \
+    { \
+        esp_err_t NativeErrorCode = (x); \
+        if (ESP_OK != NativeErrorCode) \
+        { \
+            fprintf (stderr, "ESP_ERROR_CHECK failed: 0x%x at %s:%d (%s)\n", int(NativeErrorCode), __FILE__, __LINE__, #x); \
+            abort (); \
+        } \
+    } while (0)
@@ -0,0 +1,30 @@
+#pragma once
+/*
+* esp_freertos_hooks.h - FreeRTOS idle and tick hooks for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The simulator has no tick interrupt, the hooks are accepted and never
+*   called.
+*/
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef bool (*esp_freertos_idle_cb_t) ();
+typedef void (*esp_freertos_tick_cb_t) ();
+
+inline esp_err_t esp_register_freertos_idle_hook_for_cpu (esp_freertos_idle_cb_t Hook, UBaseType_t Cpu) { (void)Hook; (void)Cpu; return ESP_OK; }
+inline esp_err_t esp_register_freertos_tick_hook_for_cpu (esp_freertos_tick_cb_t Hook, UBaseType_t Cpu) { (void)Hook; (void)Cpu; return ESP_OK; }
@@ -0,0 +1,53 @@
+#pragma once
+/*
+* esp_intr_alloc.h - Interrupt allocation for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "esp_err.h"
+#include "NativeSim.hpp"
+
+typedef void (*intr_handler_t) (void * arg);
+
+#define ESP_INTR_FLAG_LEVEL1    (1 << 1)
+#define ESP_INTR_FLAG_LEVEL2    (1 << 2)
+#define ESP_INTR_FLAG_LEVEL3    (1 << 3)
+#define ESP_INTR_FLAG_SHARED    (1 << 8)
+#define ESP_INTR_FLAG_EDGE      (1 << 9)
+#define ESP_INTR_FLAG_IRAM      (1 << 10)
+
+#define ETS_RMT_INTR_SOURCE     47
+#define ETS_UART0_INTR_SOURCE   34
+#define ETS_UART1_INTR_SOURCE   35
+#define ETS_UART2_INTR_SOURCE   36
+
+inline esp_err_t esp_intr_alloc (int Source, int Flags, intr_handler_t Handler, void * Arg, intr_handle_t * pHandle)
+{
+    (void)Flags;
+    intr_handle_t Handle = NativeSim.AllocInterrupt (Source, Handler, Arg);
+    if (pHandle)
+    {
+        *pHandle = Handle;
+    }
+    return ESP_OK;
+}
+
+inline esp_err_t esp_intr_free (intr_handle_t Handle)
+{
+    NativeSim.FreeInterrupt (Handle);
+    return ESP_OK;
+}
@@ -0,0 +1,32 @@
+#pragma once
+/*
+* esp_ipc.h - Inter processor calls for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The simulator has a single CPU. The function runs in the calling task.
+*/
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef void (*esp_ipc_func_t) (void * arg);
+
+inline esp_err_t esp_ipc_call_blocking (uint32_t Cpu, esp_ipc_func_t Function, void * Arg)
+{
+    (void)Cpu;
+    Function (Arg);
+    return ESP_OK;
+}
@@ -0,0 +1,58 @@
+#pragma once
+/*
+* FreeRTOS.h - FreeRTOS kernel types for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Tasks, notifications and semaphores are mapped onto the simulator
+*   scheduler. One tick is one millisecond.
+*/
+
+#include <stdint.h>
+#include "NativeSim.hpp"
+
+typedef int32_t     BaseType_t;
+typedef uint32_t    UBaseType_t;
+typedef uint32_t    TickType_t;
+typedef int         portMUX_TYPE;
+
+#define pdFALSE                 ((BaseType_t)0)
+#define pdTRUE                  ((BaseType_t)1)
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+#define configTICK_RATE_HZ      1000
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+#define portNUM_PROCESSORS      2
+#define tskNO_AFFINITY          0x7FFFFFFF
+#define ESP_TASK_PRIO_MIN       0
+#define configMAX_PRIORITIES    25
+#define INCLUDE_xTaskGetHandle  1
+
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         do { (void)(mux); } while (0)
+#define portEXIT_CRITICAL(mux)          do { (void)(mux); } while (0)
+#define portENTER_CRITICAL_ISR(mux)     do { (void)(mux); } while (0)
+#define portEXIT_CRITICAL_ISR(mux)      do { (void)(mux); } while (0)
+#define portYIELD_FROM_ISR(x)           do { (void)(x); } while (0)
+
+inline BaseType_t xPortGetCoreID ()                 { return 1; }
+inline void vPortYieldOtherCore (BaseType_t core)   { (void)core; }
+
+inline uint64_t NativeTicksToPs (TickType_t Ticks)
+{
+    return (portMAX_DELAY == Ticks) ? NATIVE_SIM_NEVER : (uint64_t(Ticks) * (NATIVE_SIM_PS_PER_MS * portTICK_PERIOD_MS));
+}
@@ -0,0 +1,39 @@
+#pragma once
+/*
+* semphr.h - FreeRTOS semaphore API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "freertos/FreeRTOS.h"
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary ()                  { return NativeSim.CreateSemaphore (1, 0); }
+inline SemaphoreHandle_t xSemaphoreCreateMutex ()                   { return NativeSim.CreateSemaphore (1, 1); }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex ()          { return NativeSim.CreateSemaphore (1, 1); }
+inline SemaphoreHandle_t xSemaphoreCreateCounting (UBaseType_t MaxCount, UBaseType_t InitialCount) { return NativeSim.CreateSemaphore (MaxCount, InitialCount); }
+inline void       vSemaphoreDelete          (SemaphoreHandle_t Semaphore) { NativeSim.DeleteSemaphore (Semaphore); }
+inline BaseType_t xSemaphoreTake            (SemaphoreHandle_t Semaphore, TickType_t Ticks) { return NativeSim.SemaphoreTake (Semaphore, NativeTicksToPs (Ticks)) ? pdTRUE : pdFALSE; }
+inline BaseType_t xSemaphoreTakeRecursive   (SemaphoreHandle_t Semaphore, TickType_t Ticks) { return xSemaphoreTake (Semaphore, Ticks); }
+inline BaseType_t xSemaphoreGive            (SemaphoreHandle_t Semaphore) { return NativeSim.SemaphoreGive (Semaphore) ? pdTRUE : pdFALSE; }
+inline BaseType_t xSemaphoreGiveRecursive   (SemaphoreHandle_t Semaphore) { return xSemaphoreGive (Semaphore); }
+inline BaseType_t xSemaphoreGiveFromISR     (SemaphoreHandle_t Semaphore, BaseType_t * pWoken)
+{
+    if (pWoken)
+    {
+        *pWoken = pdTRUE;
+    }
+    return xSemaphoreGive (Semaphore);
+}
@@ -0,0 +1,66 @@
+#pragma once
+/*
+* task.h - FreeRTOS task API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "freertos/FreeRTOS.h"
+
+typedef void (*TaskFunction_t) (void *);
+
+inline BaseType_t xTaskCreatePinnedToCore (TaskFunction_t Function, const char * Name, uint32_t StackDepth,
+                                           void * Arg, UBaseType_t Priority, TaskHandle_t * pHandle, BaseType_t CoreId)
+{
+    (void)StackDepth;
+    (void)CoreId;
+    TaskHandle_t Handle = NativeSim.CreateTask (Function, Name, Priority, Arg);
+    if (pHandle)
+    {
+        *pHandle = Handle;
+    }
+    return pdPASS;
+}
+
+inline BaseType_t xTaskCreate (TaskFunction_t Function, const char * Name, uint32_t StackDepth,
+                               void * Arg, UBaseType_t Priority, TaskHandle_t * pHandle)
+{
+    return xTaskCreatePinnedToCore (Function, Name, StackDepth, Arg, Priority, pHandle, tskNO_AFFINITY);
+}
+
+inline void         vTaskDelete             (TaskHandle_t Task)                     { NativeSim.DeleteTask (Task); }
+inline void         vTaskDelay              (TickType_t Ticks)                      { NativeSim.Sleep (NativeTicksToPs (Ticks)); }
+inline void         vTaskPrioritySet        (TaskHandle_t Task, UBaseType_t Priority) { NativeSim.SetPriority (Task, Priority); }
+inline TaskHandle_t xTaskGetCurrentTaskHandle ()                                    { return NativeSim.GetCurrentTask (); }
+inline TaskHandle_t xTaskGetHandle          (const char * Name)                     { return NativeSim.FindTask (Name); }
+inline char *       pcTaskGetName           (TaskHandle_t Task)                     { return const_cast<char *> (NativeSim.GetTaskName (Task)); }
+inline BaseType_t   xTaskGetAffinity        (TaskHandle_t Task)                     { (void)Task; return tskNO_AFFINITY; }
+inline UBaseType_t  uxTaskPriorityGet       (TaskHandle_t Task)                     { return NativeSim.GetPriority (Task); }
+// host threads have no fixed stack to measure
+inline UBaseType_t  uxTaskGetStackHighWaterMark (TaskHandle_t Task)                 { (void)Task; return 0; }
+inline TaskHandle_t xTaskGetIdleTaskHandleForCPU (UBaseType_t Cpu)                  { (void)Cpu; return nullptr; }
+inline TickType_t   xTaskGetTickCount       ()                                      { return TickType_t (NativeSim.NowPs () / (NATIVE_SIM_PS_PER_MS * portTICK_PERIOD_MS)); }
+inline void         taskYIELD               ()                                      { NativeSim.Yield (); }
+inline uint32_t     ulTaskNotifyTake        (BaseType_t ClearOnExit, TickType_t Ticks) { return NativeSim.NotifyTake (pdFALSE != ClearOnExit, NativeTicksToPs (Ticks)); }
+inline BaseType_t   xTaskNotifyGive         (TaskHandle_t Task)                     { NativeSim.NotifyGive (Task); return pdPASS; }
+inline void         vTaskNotifyGiveFromISR  (TaskHandle_t Task, BaseType_t * pWoken)
+{
+    NativeSim.NotifyGive (Task);
+    if (pWoken)
+    {
+        *pWoken = pdTRUE;
+    }
+}
@@ -0,0 +1,242 @@
+#pragma once
+/*
+* rmt_ll.h - ESP32 RMT register block and low level API for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The register block and the item memory are plain structures that the
+*   firmware reads and writes directly, exactly as it does on the target.
+*   The interrupt bit layout matches the ESP32: for channel n, tx end is
+*   bit 3n, rx end is bit 3n+1, error is bit 3n+2 and tx threshold is bit
+*   24+n. Writes to int_clr take effect on the next low level call or when
+*   the simulator looks at the interrupt state.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define RMT_LL_NUM_CHANNELS     8
+#define RMT_LL_MEM_ITEMS        64
+
+typedef struct rmt_item32_s
+{
+    union
+    {
+        struct
+        {
+            uint32_t duration0 : 15;
+            uint32_t level0    : 1;
+            uint32_t duration1 : 15;
+            uint32_t level1    : 1;
+        };
+        uint32_t val;
+    };
+} rmt_item32_t;
+
+typedef volatile struct rmt_mem_s
+{
+    struct
+    {
+        rmt_item32_t data32[RMT_LL_MEM_ITEMS];
+    } chan[RMT_LL_NUM_CHANNELS];
+} rmt_mem_t;
+
+typedef union
+{
+    uint32_t val;
+} rmt_ll_reg_t;
+
+typedef volatile struct rmt_dev_s
+{
+    struct
+    {
+        union
+        {
+            struct
+            {
+                uint32_t div_cnt        : 8;
+                uint32_t idle_thres     : 16;
+                uint32_t mem_size       : 4;
+                uint32_t carrier_en     : 1;
+                uint32_t carrier_out_lv : 1;
+                uint32_t mem_pd         : 1;
+                uint32_t clk_en         : 1;
+            };
+            uint32_t val;
+        } conf0;
+        union
+        {
+            struct
+            {
+                uint32_t tx_start       : 1;
+                uint32_t rx_en          : 1;
+                uint32_t mem_wr_rst     : 1;
+                uint32_t mem_rd_rst     : 1;
+                uint32_t apb_mem_rst    : 1;
+                uint32_t mem_owner      : 1;
+                uint32_t tx_conti_mode  : 1;
+                uint32_t rx_filter_en   : 1;
+                uint32_t rx_filter_thres: 8;
+                uint32_t ref_cnt_rst    : 1;
+                uint32_t ref_always_on  : 1;
+                uint32_t idle_out_lv    : 1;
+                uint32_t idle_out_en    : 1;
+                uint32_t reserved20     : 12;
+            };
+            uint32_t val;
+        } conf1;
+    } conf_ch[RMT_LL_NUM_CHANNELS];
+    rmt_ll_reg_t int_raw;
+    rmt_ll_reg_t int_st;
+    rmt_ll_reg_t int_ena;
+    rmt_ll_reg_t int_clr;
+    union
+    {
+        struct
+        {
+            uint32_t limit      : 9;
+            uint32_t reserved9  : 23;
+        };
+        uint32_t val;
+    } tx_lim_ch[RMT_LL_NUM_CHANNELS];
+    union
+    {
+        struct
+        {
+            uint32_t fifo_mask      : 1;
+            uint32_t mem_tx_wrap_en : 1;
+            uint32_t reserved2      : 30;
+        };
+        uint32_t val;
+    } apb_conf;
+} rmt_dev_t;
+
+extern rmt_dev_t RMT;
+extern rmt_mem_t RMTMEM;
+
+typedef enum
+{
+    RMT_MEM_OWNER_TX = 0,
+    RMT_MEM_OWNER_RX = 1,
+    RMT_MEM_OWNER_MAX,
+} rmt_mem_owner_t;
+
+typedef enum
+{
+    RMT_DATA_MODE_FIFO = 0,
+    RMT_DATA_MODE_MEM  = 1,
+    RMT_DATA_MODE_MAX,
+} rmt_data_mode_t;
+
+// implemented by the RMT model
+extern void NativeRmtTxStart (uint32_t channel);
+extern void NativeRmtTxStop (uint32_t channel);
+extern void NativeRmtTxResetPointer (uint32_t channel);
+
+static inline void rmt_ll_sync_interrupts (rmt_dev_t * dev)
+{
+    dev->int_raw.val &= ~dev->int_clr.val;
+    dev->int_clr.val  = 0;
+    dev->int_st.val   = dev->int_raw.val & dev->int_ena.val;
+}
+
+static inline void rmt_ll_set_interrupt_enable (rmt_dev_t * dev, uint32_t mask, bool enable)
+{
+    rmt_ll_sync_interrupts (dev);
+    dev->int_ena.val = enable ? (dev->int_ena.val | mask) : (dev->int_ena.val & ~mask);
+    rmt_ll_sync_interrupts (dev);
+}
+
+static inline void rmt_ll_clear_interrupt (rmt_dev_t * dev, uint32_t mask)
+{
+    dev->int_clr.val |= mask;
+    rmt_ll_sync_interrupts (dev);
+}
+
+static inline void rmt_ll_enable_tx_end_interrupt   (rmt_dev_t * dev, uint32_t channel, bool enable) { rmt_ll_set_interrupt_enable (dev, 1U << (channel * 3), enable); }
+static inline void rmt_ll_enable_tx_err_interrupt   (rmt_dev_t * dev, uint32_t channel, bool enable) { rmt_ll_set_interrupt_enable (dev, 1U << (channel * 3 + 2), enable); }
+static inline void rmt_ll_enable_tx_thres_interrupt (rmt_dev_t * dev, uint32_t channel, bool enable) { rmt_ll_set_interrupt_enable (dev, 1U << (channel + 24), enable); }
+static inline void rmt_ll_clear_tx_end_interrupt    (rmt_dev_t * dev, uint32_t channel) { rmt_ll_clear_interrupt (dev, 1U << (channel * 3)); }
+static inline void rmt_ll_clear_tx_err_interrupt    (rmt_dev_t * dev, uint32_t channel) { rmt_ll_clear_interrupt (dev, 1U << (channel * 3 + 2)); }
+static inline void rmt_ll_clear_tx_thres_interrupt  (rmt_dev_t * dev, uint32_t channel) { rmt_ll_clear_interrupt (dev, 1U << (channel + 24)); }
+
+static inline uint32_t rmt_ll_get_tx_end_interrupt_status (rmt_dev_t * dev)
+{
+    rmt_ll_sync_interrupts (dev);
+    uint32_t Response = 0;
+    for (uint32_t channel = 0; channel < RMT_LL_NUM_CHANNELS; ++channel)
+    {
+        Response |= ((dev->int_st.val >> (channel * 3)) & 0x1) << channel;
+    }
+    return Response;
+}
+
+static inline uint32_t rmt_ll_get_tx_err_interrupt_status (rmt_dev_t * dev)
+{
+    rmt_ll_sync_interrupts (dev);
+    uint32_t Response = 0;
+    for (uint32_t channel = 0; channel < RMT_LL_NUM_CHANNELS; ++channel)
+    {
+        Response |= ((dev->int_st.val >> (channel * 3 + 2)) & 0x1) << channel;
+    }
+    return Response;
+}
+
+static inline uint32_t rmt_ll_get_tx_thres_interrupt_status (rmt_dev_t * dev)
+{
+    rmt_ll_sync_interrupts (dev);
+    return (dev->int_st.val >> 24) & 0xFF;
+}
+
+static inline void rmt_ll_tx_set_limit (rmt_dev_t * dev, uint32_t channel, uint32_t limit)
+{
+    dev->tx_lim_ch[channel].limit = limit;
+}
+
+static inline void rmt_ll_tx_start (rmt_dev_t * dev, uint32_t channel)
+{
+    rmt_ll_sync_interrupts (dev);
+    dev->conf_ch[channel].conf1.tx_start = 1;
+    NativeRmtTxStart (channel);
+}
+
+static inline void rmt_ll_tx_stop (rmt_dev_t * dev, uint32_t channel)
+{
+    RMTMEM.chan[channel].data32[0].val = 0;
+    dev->conf_ch[channel].conf1.tx_start = 0;
+    NativeRmtTxStop (channel);
+}
+
+static inline void rmt_ll_tx_reset_pointer (rmt_dev_t * dev, uint32_t channel)
+{
+    dev->conf_ch[channel].conf1.mem_rd_rst = 1;
+    dev->conf_ch[channel].conf1.mem_rd_rst = 0;
+    NativeRmtTxResetPointer (channel);
+}
+
+static inline void rmt_ll_rx_set_mem_owner (rmt_dev_t * dev, uint32_t channel, rmt_mem_owner_t owner)
+{
+    dev->conf_ch[channel].conf1.mem_owner = owner;
+}
+
+static inline void rmt_ll_enable_mem_access (rmt_dev_t * dev, bool enable)
+{
+    dev->apb_conf.fifo_mask = enable;
+}
+
+static inline void rmt_ll_power_down_mem (rmt_dev_t * dev, bool enable)
+{
+    dev->conf_ch[0].conf0.mem_pd = enable;
+}
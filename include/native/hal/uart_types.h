@@ -0,0 +1,85 @@
+#pragma once
+/*
+* uart_types.h - UART types for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef int uart_port_t;
+
+#define UART_NUM_0              (0)
+#define UART_NUM_1              (1)
+#define UART_NUM_2              (2)
+#define UART_NUM_MAX            (3)
+#define UART_FIFO_LEN           (128)
+#define UART_PIN_NO_CHANGE      (-1)
+
+typedef enum
+{
+    UART_DATA_5_BITS = 0x0,
+    UART_DATA_6_BITS = 0x1,
+    UART_DATA_7_BITS = 0x2,
+    UART_DATA_8_BITS = 0x3,
+    UART_DATA_BITS_MAX = 0x4,
+} uart_word_length_t;
+
+typedef enum
+{
+    UART_STOP_BITS_1   = 0x1,
+    UART_STOP_BITS_1_5 = 0x2,
+    UART_STOP_BITS_2   = 0x3,
+    UART_STOP_BITS_MAX = 0x4,
+} uart_stop_bits_t;
+
+typedef enum
+{
+    UART_PARITY_DISABLE = 0x0,
+    UART_PARITY_EVEN    = 0x2,
+    UART_PARITY_ODD     = 0x3,
+} uart_parity_t;
+
+typedef enum
+{
+    UART_HW_FLOWCTRL_DISABLE = 0x0,
+    UART_HW_FLOWCTRL_RTS     = 0x1,
+    UART_HW_FLOWCTRL_CTS     = 0x2,
+    UART_HW_FLOWCTRL_CTS_RTS = 0x3,
+    UART_HW_FLOWCTRL_MAX     = 0x4,
+} uart_hw_flowcontrol_t;
+
+typedef enum
+{
+    UART_SCLK_APB = 0x0,
+    UART_SCLK_REF_TICK,
+} uart_sclk_t;
+
+typedef struct
+{
+    int                     baud_rate;
+    uart_word_length_t      data_bits;
+    uart_parity_t           parity;
+    uart_stop_bits_t        stop_bits;
+    uart_hw_flowcontrol_t   flow_ctrl;
+    uint8_t                 rx_flow_ctrl_thresh;
+    union
+    {
+        uart_sclk_t         source_clk;
+        bool                use_ref_tick;
+    };
+} uart_config_t;
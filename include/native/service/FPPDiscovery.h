@@ -0,0 +1,37 @@
+#pragma once
+/*
+* FPPDiscovery.h - FPP discovery service for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Found ahead of include/service/FPPDiscovery.h in the native build. The
+*   real service needs the web server, so only the system information that
+*   the DDP input puts in its query replies is provided.
+*/
+
+#include "ESPixelStick.h"
+
+class c_FPPDiscovery
+{
+public:
+    c_FPPDiscovery () {}
+    virtual ~c_FPPDiscovery () {}
+
+    void GetSysInfoJSON (JsonObject & jsonResponse);
+    void GetDriverName  (String & Name) { Name = "FPPD"; }
+
+}; // c_FPPDiscovery
+
+extern c_FPPDiscovery FPPDiscovery;
@@ -0,0 +1,24 @@
+#pragma once
+/*
+* gpio_sig_map.h - GPIO matrix signal numbers used by the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#define U0TXD_OUT_IDX       14
+#define U1TXD_OUT_IDX       17
+#define RMT_SIG_OUT0_IDX    87
+#define U2TXD_OUT_IDX       198
@@ -0,0 +1,44 @@
+#pragma once
+/*
+* soc.h - Peripheral register access for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Register reads and writes are routed to the simulated peripherals
+*   instead of memory, so read-modify-write macros behave as on the target.
+*/
+
+#include <stdint.h>
+#include "NativeSim.hpp"
+
+#ifndef BIT
+#   define BIT(nr)                  (1UL << (nr))
+#endif // ndef BIT
+
+#define DR_REG_UART_BASE            0x3ff40000
+#define DR_REG_UART1_BASE           0x3ff50000
+#define DR_REG_UART2_BASE           0x3ff6e000
+#define DR_REG_AHB_UART_BASE        0x60000000
+
+#define REG_READ(addr)              NativeSim.ReadReg (uint32_t (addr))
+#define REG_WRITE(addr, val)        NativeSim.WriteReg (uint32_t (addr), uint32_t (val))
+#define READ_PERI_REG(addr)         REG_READ (addr)
+#define WRITE_PERI_REG(addr, val)   REG_WRITE (addr, val)
+#define SET_PERI_REG_MASK(reg, mask)    WRITE_PERI_REG ((reg), (READ_PERI_REG (reg) | (mask)))
+#define CLEAR_PERI_REG_MASK(reg, mask)  WRITE_PERI_REG ((reg), (READ_PERI_REG (reg) & (~(mask))))
+#define GET_PERI_REG_MASK(reg, mask)    (READ_PERI_REG (reg) & (mask))
+#define SET_PERI_REG_BITS(reg, bit_map, value, shift) \
+    WRITE_PERI_REG ((reg), ((READ_PERI_REG (reg) & (~((bit_map) << (shift)))) | (((value) & (bit_map)) << (shift))))
+#define GET_PERI_REG_BITS2(reg, mask, shift) ((READ_PERI_REG (reg) >> (shift)) & (mask))
@@ -0,0 +1,93 @@
+#pragma once
+/*
+* uart_reg.h - ESP32 UART register map for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Addresses and bit positions match the ESP32 so the firmware register
+*   code runs unchanged. Only the registers the output driver uses are
+*   listed.
+*/
+
+#include "soc/soc.h"
+
+// unsigned like the bus addresses the simulator compares them with
+#define REG_UART_BASE(i)                ((uint32_t)(DR_REG_UART_BASE + (i) * 0x10000 + ((i) > 1 ? 0xe000 : 0)))
+#define REG_UART_AHB_BASE(i)            ((uint32_t)(DR_REG_AHB_UART_BASE + (i) * 0x10000 + ((i) > 1 ? 0xe000 : 0)))
+
+#define UART_FIFO_AHB_REG(i)            (REG_UART_AHB_BASE (i) + 0x0)
+#define UART_FIFO_REG(i)                (REG_UART_BASE (i) + 0x0)
+#define UART_INT_RAW_REG(i)             (REG_UART_BASE (i) + 0x4)
+#define UART_INT_ST_REG(i)              (REG_UART_BASE (i) + 0x8)
+#define UART_INT_ENA_REG(i)             (REG_UART_BASE (i) + 0xC)
+#define UART_INT_CLR_REG(i)             (REG_UART_BASE (i) + 0x10)
+#define UART_CLKDIV_REG(i)              (REG_UART_BASE (i) + 0x14)
+#define UART_STATUS_REG(i)              (REG_UART_BASE (i) + 0x1C)
+#define UART_CONF0_REG(i)               (REG_UART_BASE (i) + 0x20)
+#define UART_CONF1_REG(i)               (REG_UART_BASE (i) + 0x24)
+#define UART_IDLE_CONF_REG(i)           (REG_UART_BASE (i) + 0x40)
+
+// interrupt bits. The same positions are used in the raw, status, enable and clear registers
+#define UART_TXFIFO_EMPTY_INT_RAW       BIT(1)
+#define UART_TXFIFO_EMPTY_INT_ST        BIT(1)
+#define UART_TXFIFO_EMPTY_INT_ENA       BIT(1)
+#define UART_TXFIFO_EMPTY_INT_CLR       BIT(1)
+#define UART_TX_BRK_DONE_INT_RAW        BIT(12)
+#define UART_TX_BRK_DONE_INT_ST         BIT(12)
+#define UART_TX_BRK_DONE_INT_ENA        BIT(12)
+#define UART_TX_BRK_DONE_INT_CLR        BIT(12)
+#define UART_TX_BRK_IDLE_DONE_INT_RAW   BIT(13)
+#define UART_TX_BRK_IDLE_DONE_INT_ST    BIT(13)
+#define UART_TX_BRK_IDLE_DONE_INT_ENA   BIT(13)
+#define UART_TX_BRK_IDLE_DONE_INT_CLR   BIT(13)
+#define UART_TX_DONE_INT_RAW            BIT(14)
+#define UART_TX_DONE_INT_ST             BIT(14)
+#define UART_TX_DONE_INT_ENA            BIT(14)
+#define UART_TX_DONE_INT_CLR            BIT(14)
+
+// UART_CLKDIV_REG
+#define UART_CLKDIV_V                   0xFFFFF
+#define UART_CLKDIV_S                   0
+#define UART_CLKDIV_FRAG_V              0xF
+#define UART_CLKDIV_FRAG_S              20
+
+// UART_STATUS_REG
+#define UART_TXFIFO_CNT_V               0xFF
+#define UART_TXFIFO_CNT_S               16
+#define UART_TXFIFO_CNT_M               ((UART_TXFIFO_CNT_V) << (UART_TXFIFO_CNT_S))
+
+// UART_CONF0_REG
+#define UART_PARITY                     BIT(0)
+#define UART_PARITY_EN                  BIT(1)
+#define UART_BIT_NUM_V                  0x3
+#define UART_BIT_NUM_S                  2
+#define UART_STOP_BIT_NUM_V             0x3
+#define UART_STOP_BIT_NUM_S             4
+#define UART_TXD_BRK                    BIT(8)
+#define UART_RXFIFO_RST                 BIT(17)
+#define UART_TXFIFO_RST                 BIT(18)
+#define UART_TXD_INV                    BIT(22)
+
+// UART_CONF1_REG
+#define UART_TXFIFO_EMPTY_THRHD_V       0x7F
+#define UART_TXFIFO_EMPTY_THRHD_S       8
+
+// UART_IDLE_CONF_REG
+#define UART_RX_IDLE_THRHD_V            0x3FF
+#define UART_RX_IDLE_THRHD_S            0
+#define UART_TX_IDLE_NUM_V              0x3FF
+#define UART_TX_IDLE_NUM_S              10
+#define UART_TX_BRK_NUM_V               0xFF
+#define UART_TX_BRK_NUM_S               20
@@ -65,7 +65,7 @@ public:
     void            GetStatus           (JsonObject & jsonStatus);
     void            SetEthHostname      ();
     void            reset               ();
-    void            Poll                ();
+    uint32_t        Poll                ();
     bool            IsConnected         ();
     inline void     SetFsmState         (fsm_Eth_state * NewState) { pCurrentFsmState = NewState; }
     void            AnnounceState       ();
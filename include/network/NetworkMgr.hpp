@@ -38,10 +38,11 @@ public:
     void GetConfig            (JsonObject & json);
     void GetStatus            (JsonObject & json);
     bool SetConfig            (JsonObject & json);
-    void Poll                 ();
+    uint32_t Poll             ();   ///< returns the ms until the next poll
     void GetDriverName        (String & Name) { Name = "NetworkMgr"; }
 
     void SetWiFiIsConnected     (bool newState);
+    void ReadSdConfig           () { WiFiDriver.ReadSdConfig (); }
     void SetEthernetIsConnected (bool newState);
 
     bool IsConnected () { return (IsWiFiConnected || IsEthernetConnected); }
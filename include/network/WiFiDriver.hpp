@@ -59,6 +59,7 @@ public:
     void GetConfig (JsonObject & json);
     void GetStatus (JsonObject & json);
     bool SetConfig (JsonObject & json);
+    void ReadSdConfig ();
 
     IPAddress getIpAddress    () { return CurrentIpAddress; }
     void      setIpAddress    (IPAddress NewAddress ) { CurrentIpAddress = NewAddress; }
@@ -66,7 +67,7 @@ public:
     void      setIpSubNetMask (IPAddress NewAddress) { CurrentSubnetMask = NewAddress; }
     void      connectWifi     (const String & ssid, const String & passphrase);
     void      reset           ();
-    void      Poll ();
+    uint32_t  Poll ();
 
     void      SetFsmState (fsm_WiFi_state* NewState);
     void      AnnounceState   ();
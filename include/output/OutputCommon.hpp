@@ -42,6 +42,7 @@ public:
     virtual bool         SetConfig (ArduinoJson::JsonObject & jsonConfig);     ///< Set a new config in the driver
     virtual void         GetConfig (ArduinoJson::JsonObject & jsonConfig);     ///< Get the current config used by the driver
     virtual uint32_t     Poll () = 0;                                        ///< Call from loop(),  renders output data
+    virtual uint32_t     GetPollPeriodUs ();                                   ///< how long before Poll can start the next frame
 #ifdef ARDUINO_ARCH_ESP32
     virtual bool         RmtPoll () = 0;                                        ///< Call from loop(),  renders output data
 #endif // def ARDUINO_ARCH_ESP32
@@ -53,18 +54,29 @@ public:
             OTYPE_t      GetOutputType ()      { return OutputType; }          ///< Have the instance report its type.
     virtual void         GetStatus (ArduinoJson::JsonObject & jsonStatus) = 0;
     virtual void         BaseGetStatus (ArduinoJson::JsonObject & jsonStatus);
-            void         SetOutputBufferAddress (uint8_t* pNewOutputBuffer) { pOutputBuffer = pNewOutputBuffer; }
-    virtual void         SetOutputBufferSize (uint32_t NewOutputBufferSize)  { OutputBufferSize = NewOutputBufferSize; };
+            void         SetOutputBufferAddress (uint8_t* pNewOutputBuffer) { pOutputBuffer = pNewOutputBuffer; UpdateFrameBuffer (); }
+    virtual void         SetClone (bool NewIsClone, bool NewReverse) { IsClone = NewIsClone; ReverseClone = NewIsClone && NewReverse; } ///< send the buffer of another port
+    virtual void         GetGrouping (uint32_t & StoredGroupSize, uint32_t & GroupRepeatCount) { StoredGroupSize = 1; GroupRepeatCount = 0; } ///< how grouped pixels are kept in the buffer
+    virtual void         SetCloneGrouping (uint32_t /* StoredGroupSize */, uint32_t /* GroupRepeatCount */) {} ///< send the buffer grouped the way the clone source keeps it
+    virtual void         SetOutputBufferSize (uint32_t NewOutputBufferSize)  { OutputBufferSize = NewOutputBufferSize; UpdateFrameBuffer (); };
     virtual uint32_t     GetNumOutputBufferBytesNeeded () = 0;
     virtual uint32_t     GetNumOutputBufferChannelsServiced () = 0;
     virtual void         PauseOutput (bool NewState) {Paused = NewState;}
     virtual void         WriteChannelData (uint32_t StartChannelId, uint32_t ChannelCount, byte *pSourceData);
     virtual void         ReadChannelData (uint32_t StartChannelId, uint32_t ChannelCount, byte *pTargetData);
+    virtual void         ClearBuffer () {}                                     ///< the output buffer was zeroed. Clear any data the driver sends instead of it
+    virtual void         FillColor (uint8_t /* Red */, uint8_t /* Green */, uint8_t /* Blue */) {} ///< set every pixel to one color. Non pixel outputs ignore it
     virtual bool         ValidateGpio (gpio_num_t ConsoleTxGpio, gpio_num_t ConsoleRxGpio);
     virtual bool         DriverIsSendingIntensityData() {return false;}
     virtual uint32_t     GetFrameTimeMs() {return 1 + (ActualFrameDurationMicroSec / 1000); }
+            uint32_t     GetActualFrameDurationMicroSec () { return ActualFrameDurationMicroSec; }
+            uint32_t     GetFrameCount ()      { return FrameCount; }
+    virtual uint32_t     GetPixelCount ()      { return 0; }           ///< number of pixels sent in each frame. Zero for non pixel outputs
+            void         SetUnthrottled (bool NewState) { Unthrottled = NewState; } ///< refresh as soon as the wire time allows (self test)
     bool                 IsPaused() {return Paused;}
     virtual void         ClearStatistics (void);
+            void         SetTimingStats (c_OutputTimingStats * pNewTimingStats) { pTimingStats = pNewTimingStats; }
+            c_OutputTimingStats * GetTimingStats () { return pTimingStats; }
 
 protected:
 
@@ -75,10 +87,18 @@ protected:
     uint32_t    ActualFrameDurationMicroSec = 50000; // Default time for relays is every 50ms
     uint8_t   * pOutputBuffer               = nullptr;
     uint32_t    OutputBufferSize            = 0;
+    uint8_t   * pFrameBuffer                = nullptr;  ///< what the ISR sends. The output buffer or a copy of it in internal RAM
+    bool        IsrReadsFrameBuffer         = false;    ///< set by the drivers that send from an ISR
+    bool        IsClone                     = false;    ///< the output buffer belongs to another port. WriteChannelData is never called
+    bool        ReverseClone                = false;    ///< a clone that sends its pixels last to first
     uint32_t    FrameCount                  = 0;
     bool        Paused = false;
+    bool        Unthrottled                 = false;
+    c_OutputTimingStats * pTimingStats      = nullptr;
 
     virtual void ReportNewFrame ();
+            void UpdateFrameBuffer ();
+            void StageFrame ();
 
     inline bool canRefresh ()
     {
@@ -91,13 +111,12 @@ protected:
             FrameTimeDeltaInMicroSec = Now + (0 - FrameStartTimeInMicroSec);
         }
 
-        return (FrameTimeDeltaInMicroSec > FrameDurationInMicroSec);
+        return (FrameTimeDeltaInMicroSec > (Unthrottled ? ActualFrameDurationMicroSec : FrameDurationInMicroSec));
     }
 
-    #ifdef USE_RMT_DEBUG_COUNTERS
-    protected: uint32_t FrameStartTimeInMicroSec = 0;
-    #else
-    private:   uint32_t FrameStartTimeInMicroSec = 0;
-    #endif // def USE_RMT_DEBUG_COUNTERS
+private:
+    uint32_t FrameStartTimeInMicroSec = 0;
+    uint8_t  * pStagingBuffer         = nullptr;
+    uint32_t   StagingBufferSize      = 0;
 
 }; // c_OutputCommon
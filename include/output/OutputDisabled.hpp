@@ -38,6 +38,7 @@ public:
     void         GetConfig (ArduinoJson::JsonObject & jsonConfig); ///< Get the current config used by the driver
     void         GetStatus (ArduinoJson::JsonObject & jsonConfig);
     uint32_t     Poll ();                                          ///< Call from loop(),  renders output data
+    uint32_t     GetPollPeriodUs () { return uint32_t (-1); }      ///< there is never anything to send
 #ifdef ARDUINO_ARCH_ESP32
     bool         RmtPoll () {return false;}
 #endif // def ARDUINO_ARCH_ESP32
@@ -67,25 +67,6 @@ private:
     uint32_t DataPattern = 0;
     uint32_t CurrentDataMask = 0;
 
-    // #define GECE_RMT_DEBUG_COUNTERS
-    #ifdef GECE_RMT_DEBUG_COUNTERS
-    #define INC_GECE_RMT_DEBUG_COUNTERS(c) (++RmtDebugCounters.c)
-    struct
-    {
-        uint32_t GetNextBit = 0;
-        uint32_t FrameStarts = 0;
-        uint32_t FrameEnds = 0;
-        uint32_t BreakBits = 0;
-        uint32_t MabBits = 0;
-        uint32_t StartBits = 0;
-        uint32_t DataBits = 0;
-        uint32_t StopBits = 0;
-        uint32_t Underrun = 0;
-    } RmtDebugCounters;
-    #else
-    #define INC_GECE_RMT_DEBUG_COUNTERS(c)
-    #endif // def GECE_RMT_DEBUG_COUNTERS
-
     c_OutputRmt Rmt;
 
 }; // c_OutputGECERmt
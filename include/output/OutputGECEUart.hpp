@@ -56,13 +56,6 @@ private:
 
         c_OutputUart Uart;
 
-// #define GECE_UART_DEBUG_COUNTERS
-#ifdef GECE_UART_DEBUG_COUNTERS
-    uint32_t NewFrameCounter = 0;
-    uint32_t TimeSinceLastFrameMS = 0;
-    uint32_t TimeLastFrameStartedMS = 0;
-#endif // def GECE_UART_DEBUG_COUNTERS
-
 }; // c_OutputGECEUart
 
 #endif // defined(SUPPORT_OutputProtocol_GECE)
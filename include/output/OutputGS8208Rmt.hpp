@@ -48,25 +48,6 @@ public:
     bool    ISR_GetNextBitToSend (rmt_item32_t & DataToSend);
 
 private:
-    // #define GS8208_RMT_DEBUG_COUNTERS
-    #ifdef GS8208_RMT_DEBUG_COUNTERS
-    #define INC_GS8208_RMT_DEBUG_COUNTERS(c) (++RmtDebugCounters.c)
-    struct
-    {
-        uint32_t GetNextBit = 0;
-        uint32_t FrameStarts = 0;
-        uint32_t FrameEnds = 0;
-        uint32_t BreakBits = 0;
-        uint32_t MabBits = 0;
-        uint32_t StartBits = 0;
-        uint32_t DataBits = 0;
-        uint32_t StopBits = 0;
-        uint32_t Underrun = 0;
-    } RmtDebugCounters;
-    #else
-    #define INC_GS8208_RMT_DEBUG_COUNTERS(c)
-    #endif // def GS8208_RMT_DEBUG_COUNTERS
-
     // The adjustments compensate for rounding errors in the calculations
     #define GS8208_PIXEL_RMT_TICKS_BIT_0_HIGH    uint16_t ( (GS8208_PIXEL_NS_BIT_0_HIGH / RMT_TickLengthNS) + 0.0)
     #define GS8208_PIXEL_RMT_TICKS_BIT_0_LOW     uint16_t ( (GS8208_PIXEL_NS_BIT_0_LOW  / RMT_TickLengthNS) + 0.0)
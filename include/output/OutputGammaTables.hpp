@@ -0,0 +1,65 @@
+#pragma once
+/*
+* OutputGammaTables.hpp - Gamma / brightness tables shared by the pixel ports
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   A table maps an input intensity to 255 (or 65535) * (i * brightness)^gamma.
+*   Ports that ask for the same gamma, brightness and width get the same
+*   table. Each table counts its users and is freed when the last port
+*   releases it. Gamma is matched to 0.01, the resolution of the config.
+*
+*   The tables are built in fixed point (log2, scale, exp2) so a rebuild
+*   does not need 256 calls to pow(). The result is within one step of
+*   the floating point value.
+*/
+
+#include "ESPixelStick.h"
+
+class c_OutputGammaTables
+{
+public:
+    c_OutputGammaTables ();
+    virtual ~c_OutputGammaTables ();
+
+    const uint8_t  * Acquire8   (float Gamma, uint8_t Brightness);
+    const uint16_t * Acquire16  (float Gamma, uint8_t Brightness);
+    void             Release    (const void * pTable);
+    void             GetStatus  (JsonObject & jsonStatus);
+    void             GetDriverName (String & Name) { Name = F ("Gamma"); }
+
+private:
+    #define OUTPUT_GAMMA_NUM_ENTRIES    256
+
+    struct Table_t
+    {
+        Table_t   * pNext;
+        uint32_t    GammaHundredths;
+        uint32_t    RefCount;
+        uint8_t     Brightness;
+        uint8_t     BitDepth;
+
+        // OUTPUT_GAMMA_NUM_ENTRIES entries of BitDepth bits follow the header
+        void * GetData () { return (void*)(this + 1); }
+    };
+
+    void *          Acquire     (float Gamma, uint8_t Brightness, uint8_t BitDepth);
+    static void     Build       (Table_t & Table);
+
+    Table_t       * pTables = nullptr;
+
+}; // c_OutputGammaTables
+
+extern c_OutputGammaTables OutputGammaTables;
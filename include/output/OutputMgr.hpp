@@ -24,8 +24,11 @@
 
 #include "ESPixelStick.h"
 #include "OutputMgrPortDefs.hpp"
+#include "OutputTimingStats.hpp"
+#include "OutputSelfTest.hpp"
 #include "memdebug.h"
 #include "FileMgr.hpp"
+#include "utility/TimerWheel.hpp"
 #include <TimeLib.h>
 
 class c_OutputCommon; ///< forward declaration to the pure virtual output class that will be defined later.
@@ -41,8 +44,16 @@ class c_OutputMgr
 private:
     #ifdef ARDUINO_ARCH_ESP8266
     #define OM_MAX_NUM_CHANNELS  (1200 * 3)
+    #define OM_DEFAULT_NUM_CHANNELS OM_MAX_NUM_CHANNELS
+    #elif defined(BOARD_HAS_PSRAM)
+    // upper limit. The buffer is sized from the free memory at boot
+    #define OM_MAX_NUM_CHANNELS  (32768 * 3)
+    #define OM_DEFAULT_NUM_CHANNELS (3000 * 3)
+    #define OM_SPIRAM_RESERVE    (256 * 1024)   ///< PSRAM left for the JSON documents and the file buffers
+    #define OM_INTERNAL_RESERVE  (96 * 1024)    ///< heap left for everything else once the ports have copied their data
     #else // ARDUINO_ARCH_ESP32
     #define OM_MAX_NUM_CHANNELS  (3000 * 3)
+    #define OM_DEFAULT_NUM_CHANNELS OM_MAX_NUM_CHANNELS
     #endif // !def ARDUINO_ARCH_ESP32
 
 public:
@@ -50,7 +61,7 @@ public:
     virtual ~c_OutputMgr ();
 
     void      Begin             ();                        ///< set up the operating environment based on the current config (or defaults)
-    void      Poll              ();                        ///< Call from loop(),  renders output data
+    uint32_t  Poll              ();                        ///< Call from the timer wheel, renders output data. Returns the ms until the next poll
     void      ScheduleLoadConfig () {ConfigLoadNeeded = now();}
     void      LoadConfig        ();                        ///< Read the current configuration data from nvram
     void      GetConfig         (byte * Response, uint32_t maxlen);
@@ -61,7 +72,8 @@ public:
 //    void      GetPortCounts     (uint16_t& PixelCount, uint16_t& SerialCount) {PixelCount = uint16_t(OutputPortId_End); SerialCount = uint16_t(NUM_UARTS); }
     uint8_t*  GetBufferAddress  () { return pOutputBuffer; } ///< Get the address of the buffer into which the E1.31 handler will stuff data
     uint32_t  GetBufferUsedSize () { return UsedBufferSize; } ///< Get the size (in intensities) of the buffer into which the E1.31 handler will stuff data
-    uint32_t  GetBufferSize     () { return uint32_t(OM_MAX_NUM_CHANNELS); } ///< Get the size (in intensities) of the buffer into which the E1.31 handler will stuff data
+    uint32_t  GetBufferSize     () { return BufferSize; } ///< Get the size (in intensities) of the buffer into which the E1.31 handler will stuff data
+    bool      BufferIsInSpiRam  () { return BufferInSpiRam; } ///< ISRs may not read the buffer while the flash cache is off
     void      DeleteConfig      () { FileMgr.DeleteFlashFile (ConfigFileName); }
     void      PauseOutputs      (bool NewState);
     void      GetDriverName     (String & Name) { Name = "OutputMgr"; }
@@ -72,6 +84,8 @@ public:
     void      RelayUpdate       (uint8_t RelayId, String & NewValue, String & Response);
     void      ClearStatistics   (void);
     uint8_t   GetNumPorts       () {return NumOutputPorts;}
+    void      ScheduleSelfTest  (uint32_t DurationMs) { SelfTestDurationMs = DurationMs; SelfTestRequested = true; TimerWheel.Schedule (PollJob, 0); } ///< 0 stops a running test
+    bool      SelfTestIsRunning () { return SelfTest.IsRunning (); }
 
     // do NOT insert into the middle of this list. Always add new types to the end of the list
     enum e_OutputProtocolType
@@ -150,8 +164,7 @@ public:
     uint32_t NumberOfOutputProtocols = uint32_t(0);
 
     // must be 16 byte aligned. Determined by upshifting the max size of all drivers
-    // #define OutputDriverMemorySize 1200
-    #define OutputDriverMemorySize 1400
+    #define OutputDriverMemorySize 1200
     uint32_t GetDriverSize() {return OutputDriverMemorySize;}
 private:
     struct alignas(16) DriverInfo_t
@@ -168,6 +181,19 @@ private:
         OM_OutputPortDefinition_t PortDefinition;
         uint8_t             DriverId                    = -1;
         bool                OutputDriverInUse           = false;
+
+        // a clone sends the output buffer of another port. It has no buffer space or input channels of its own
+        #define OM_NO_CLONE uint8_t(-1)
+        uint8_t             CloneOf                     = OM_NO_CLONE;  ///< port id of the source
+        bool                CloneReverse                = false;
+        DriverInfo_t      * pCloneSource                = nullptr;      ///< set when the source is valid
+
+        // a port is only stopped and reconfigured when its config or its place in the buffer changes
+        uint32_t            ConfigHash                  = 0;            ///< type and driver config last sent to the driver
+        bool                ReconfigNeeded              = true;         ///< new driver or config. Paused until the load is done
+        // kept outside of the driver memory so it does not count against OutputDriverMemorySize
+        c_OutputTimingStats TimingStats;
+        c_OutputSelfTest::PortResult_t SelfTestResult;
     };
 
     // pointer(s) to the current active output drivers
@@ -182,19 +208,35 @@ private:
     bool ConfigInProgress   = false;
     bool OutputIsPaused     = false;
     bool BuildingNewConfig  = false;
+    c_OutputSelfTest SelfTest;
+    bool     SelfTestRequested  = false;
+    uint32_t SelfTestDurationMs = 0;
+    c_TimerWheel::JobId_t PollJob = TIMER_WHEEL_NO_JOB;
+    uint32_t ReconfigDurationUs = 0;   ///< time taken by the last config load
+    uint8_t  ReconfigPortCount  = 0;   ///< ports that were stopped by the last config load
+    uint32_t FirstFrameMs       = 0;   ///< time from reset to the first frame any port sent
 
     bool ProcessJsonConfig (JsonDocument & jsonConfig);
     void CreateJsonConfig  (JsonObject & jsonConfig);
     void UpdateDisplayBufferReferences (void);
+    DriverInfo_t * FindCloneSource (DriverInfo_t & CurrentOutput);
+    void HoldForReconfig (DriverInfo_t & CurrentOutput);
+    bool SelfTestDrivesPort (DriverInfo_t & CurrentOutput);
+    void FillStartColor     ();
+    void StartSelfTest (uint32_t DurationMs);
+    void StopSelfTest ();
     void InstantiateNewOutputChannel(DriverInfo_t &ChannelIndex, e_OutputProtocolType NewChannelType, bool StartDriver = true);
     void CreateNewConfig();
     void SetSerialUart();
+    void SizeBuffer();
     bool FindJsonChannelConfig (JsonDocument& jsonConfig, OM_PortId_t PortId, JsonObject& ChanConfig);
     bool SetPortDefnitionDefaults(DriverInfo_t & CurrentOutput, e_OutputProtocolType TargetProtocolType);
 
     String ConfigFileName;
 
     uint8_t    *pOutputBuffer = nullptr;
+    uint32_t   BufferSize = OM_DEFAULT_NUM_CHANNELS;
+    bool       BufferInSpiRam = false;
     uint32_t   UsedBufferSize = 0;
 
     #ifndef DEFAULT_CONSOLE_TX_GPIO
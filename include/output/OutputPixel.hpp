@@ -24,6 +24,8 @@
 
 #include "OutputCommon.hpp"
 
+#define PIXEL_DEFAULT_MIN_FRAME_DURATION_US 25000
+
 class c_OutputPixel : public c_OutputCommon
 {
 protected:
@@ -33,6 +35,7 @@ protected:
     void SetPixelPrependInformation (const uint8_t* data, uint32_t len);
 
     uint16_t  InterFrameGapInMicroSec = 300;
+    uint32_t  MinFrameDurationInMicroSec = PIXEL_DEFAULT_MIN_FRAME_DURATION_US; ///< Never refresh faster than this. Wire time wins if it is longer.
 
     void SetFrameDurration (float IntensityBitTimeInUs, uint16_t BlockSize = 1, float BlockDelayUs = 0.0, uint OutBitsPerDataBit = 8);
 
@@ -45,6 +48,7 @@ private:
     uint32_t      pixel_count                 = 100;
     uint32_t      SentPixelsCount             = 0;
     uint32_t      PixelIntensityCurrentIndex  = 0;
+    uint32_t      FirstPixelIntensityIndex    = 0;    ///< not 0 for a reversed clone
     uint32_t      PixelIntensityCurrentColor  = 0;
 
     uint8_t     * pFramePrependData           = nullptr;
@@ -62,6 +66,13 @@ private:
     uint32_t      PixelGroupSize              = 1;
     uint32_t      PixelGroups                 = 100;
 
+    // Group storage. When set, each group is kept once in the output buffer
+    // and the ISR repeats it PixelGroupSize times on the wire.
+    bool          GroupStore                  = false;
+    uint32_t      StoredGroupSize             = 1;    ///< Copies of a group kept in the buffer. 1 with GroupStore
+    uint32_t      GroupRepeatCount            = 0;    ///< Times the ISR sends each stored pixel. 0 = no repeat
+    uint32_t      GroupRepeatCurrentCount     = 0;
+
     float       IntensityBitTimeInUs        = 0.0;
     uint32_t    BlockSize                   = 1;
     float       BlockDelayUs                = 0.0;
@@ -76,30 +87,29 @@ private:
 
     bool        InvertData                  = false;
     uint32_t    IntensityMultiplier         = 1;
+    uint32_t    IntensityDataWidth          = 8;
+    uint32_t    WideDataShift               = 8;
+
+    // High bit depth pipeline. These are only allocated when the port
+    // sends more than 8 bits per intensity or dithering has been enabled.
+    bool        Dither                      = false;
+    const uint16_t * pGammaTable16          = nullptr;  ///< 16 bit Gamma Adjustment table. Shared, see OutputGammaTables
+    uint16_t  * pWideOutputBuffer           = nullptr;  ///< 16 bit intensity values. One per output buffer byte
+    uint8_t   * pDitherError                = nullptr;  ///< Residual left over from the last frame. One per output buffer byte
+    uint32_t    WideOutputBufferSize        = 0;
+
+    // RGB input on an RGBW strip. W takes over the part of R, G and B that
+    // its LED can make. The rest stays in R, G and B.
+    #define PIXEL_WHITE_DEFAULT_TEMPERATURE 6500
+    bool        WhiteExtract                = false;
+    uint32_t    WhiteTemperature            = PIXEL_WHITE_DEFAULT_TEMPERATURE;  ///< Kelvin. Color of the W LED
+    uint32_t    NumInputChannelsPerPixel    = PIXEL_DEFAULT_INTENSITY_BYTES_PER_PIXEL;
+    uint16_t    WhiteRgb[3]                 = {256, 256, 256};  ///< R, G, B made by a full W. 256 = full
+    uint16_t    WhiteRgbInverse[3]          = {256, 256, 256};  ///< 65536 / WhiteRgb
+    uint32_t    WhitePixelId                = uint32_t(-1);     ///< the pixel being collected
+    uint32_t    WhitePixelMask              = 0;                ///< colors received for WhitePixelId
+    uint32_t    WhitePixelData[3];
 
-// #define USE_PIXEL_DEBUG_COUNTERS
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    uint32_t   PixelsToSend                        = 0;
-    uint32_t   IntensityBytesSent                  = 0;
-    uint32_t   IntensityBytesSentLastFrame         = 0;
-    uint32_t   FrameStartCounter                   = 0;
-    uint32_t   FrameEndCounter                     = 0;
-    uint32_t   SentPixels                          = 0;
-    uint32_t   AbortFrameCounter                   = 0;
-    uint32_t   FramePrependDataCounter             = 0;
-    uint32_t   FrameSendPixelsCounter              = 0;
-    uint32_t   FrameAppendDataCounter              = 0;
-    uint32_t   FrameDoneCounter                    = 0;
-    uint32_t   FrameStateUnknownCounter            = 0;
-    uint32_t   PixelPrependNullsCounter            = 0;
-    uint32_t   PixelSendIntensityCounter           = 0;
-    uint32_t   PixelAppendNullsCounter             = 0;
-    uint32_t   PixelUnkownState                    = 0;
-    uint32_t   GetNextIntensityToSendCounter       = 0;
-    uint32_t   GetNextIntensityToSendFailedCounter = 0;
-    uint32_t   LastGECEdataSent                    = uint32_t(-1);
-    uint32_t   NumGECEdataSent                     = 0;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
 
     // functions used to implement pixel FSM
     uint32_t IRAM_ATTR ISR_FramePrependData();
@@ -129,7 +139,8 @@ private:
     } ColorOffsets_t;
     ColorOffsets_t  ColorOffsets;
 
-    uint8_t     gamma_table[256]    = { 0 };    ///< Gamma Adjustment table
+    const uint8_t * pGammaTable     = nullptr;  ///< Gamma Adjustment table. Shared, see OutputGammaTables
+    bool            ChannelDataWriteActive = false;   ///< an input write is using the gamma tables. Atomic access only
     float       gamma               = 1.0;      ///< gamma value to use
     uint8_t     brightness          = 100;
     uint32_t    AdjustedBrightness  = 256;
@@ -141,10 +152,18 @@ private:
 
     // Internal variables
 
-    void updateGammaTable(); ///< Generate gamma correction table
+    void updateGammaTable(); ///< Switch to the shared gamma correction tables for the current settings
+    void updateWideBuffers(); ///< Allocate / free the high bit depth buffers
+    void freeWideBuffers();
+    void WaitForChannelDataWrite ();
+    void updateGrouping ();          ///< Buffer grouping from this port's own config
     void updateColorOrderOffsets(); ///< Update color order
+    void updateWhiteBalance();      ///< Color of the W LED for the current white temperature
     bool validate ();        ///< confirm that the current configuration is valid
     inline uint32_t CalculateIntensityOffset(uint32_t ChannelId);
+    inline void     SetIntensity(uint32_t CalculatedChannelId, uint32_t IntensityData, uint32_t WideIntensityData);
+    void            WriteWhiteExtractChannelData(uint32_t StartChannelId, uint32_t ChannelCount, byte *pSourceData, const uint8_t * pGamma, const uint16_t * pGamma16);
+    void            WriteWhiteExtractPixel(uint32_t PixelId, const uint8_t * pBufferEnd);
     uint32_t IRAM_ATTR ISR_GetIntensityData();
 
 public:
@@ -156,12 +175,17 @@ public:
     virtual  bool         SetConfig (ArduinoJson::JsonObject & jsonConfig); ///< Set a new config in the driver
     virtual  void         GetConfig (ArduinoJson::JsonObject & jsonConfig); ///< Get the current config used by the driver
     virtual  void         GetStatus (ArduinoJson::JsonObject& jsonStatus);
-             uint32_t     GetNumOutputBufferBytesNeeded () { return (pixel_count * NumIntensityBytesPerPixel); };
-             uint32_t     GetNumOutputBufferChannelsServiced () { return (GetNumOutputBufferBytesNeeded() / PixelGroupSize); };
+             uint32_t     GetNumOutputBufferBytesNeeded () { return (GroupRepeatCount ? (((pixel_count + GroupRepeatCount - 1) / GroupRepeatCount) * NumIntensityBytesPerPixel) : (pixel_count * NumIntensityBytesPerPixel)); };
+             uint32_t     GetNumOutputBufferChannelsServiced () { return ((GetNumOutputBufferBytesNeeded() / NumIntensityBytesPerPixel) * NumInputChannelsPerPixel / StoredGroupSize); };
     virtual  void         SetOutputBufferSize (uint32_t NumChannelsAvailable);
+    virtual  void         SetClone (bool NewIsClone, bool NewReverse);
+    virtual  void         GetGrouping (uint32_t & _StoredGroupSize, uint32_t & _GroupRepeatCount) { _StoredGroupSize = StoredGroupSize; _GroupRepeatCount = GroupRepeatCount; }
+    virtual  void         SetCloneGrouping (uint32_t _StoredGroupSize, uint32_t _GroupRepeatCount);
              void         SetInvertData (bool _InvertData) { InvertData = _InvertData; }
     virtual  void         WriteChannelData (uint32_t StartChannelId, uint32_t ChannelCount, byte *pSourceData);
     virtual  void         ReadChannelData (uint32_t StartChannelId, uint32_t ChannelCount, byte *pTargetData);
+    virtual  void         ClearBuffer ();
+    virtual  void         FillColor (uint8_t Red, uint8_t Green, uint8_t Blue);
     inline   void         SetIntensityBitTimeInUS (float value) { IntensityBitTimeInUs = value; }
              void         SetIntensityDataWidth(uint32_t value);
     virtual  void         StartNewFrame();
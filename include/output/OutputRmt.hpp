@@ -23,6 +23,7 @@
 #include <hal/rmt_ll.h>
 #include "OutputPixel.hpp"
 #include "OutputSerial.hpp"
+#include "utility/DebugCounters.hpp"
 
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
     #include <driver/rmt_tx.h>
@@ -39,6 +40,18 @@
     #include <driver/rmt.h>
 #endif // ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
 
+// Bit level counters shared by the protocol drivers that feed the RMT
+DEBUG_COUNTER_DECLARE(2, RmtBitGetNextBit);
+DEBUG_COUNTER_DECLARE(2, RmtBitFrameStarts);
+DEBUG_COUNTER_DECLARE(2, RmtBitFrameEnds);
+DEBUG_COUNTER_DECLARE(2, RmtBitBreakBits);
+DEBUG_COUNTER_DECLARE(2, RmtBitMabBits);
+DEBUG_COUNTER_DECLARE(2, RmtBitStartBits);
+DEBUG_COUNTER_DECLARE(2, RmtBitDataBits);
+DEBUG_COUNTER_DECLARE(2, RmtBitStopBits);
+DEBUG_COUNTER_DECLARE(2, RmtBitUnderrun);
+#define RMT_BIT_COUNTER(c) DEBUG_COUNTER_INC(2, RmtBit##c, OutputPortDefinition.PortId)
+
 class c_OutputRmt
 {
 public:
@@ -91,6 +104,11 @@ private:
 
     uint32_t            TxIntensityDataStartingMask = 0x80;
 
+    // used to work out how close each refill came to running the hardware dry
+    uint32_t            TxStartTimeUs               = 0;
+    uint32_t            NumTicksQueuedThisFrame     = 0;
+    c_OutputTimingStats * pTimingStats              = nullptr;
+
     inline void IRAM_ATTR ISR_TransferIntensityDataToRMT (uint32_t NumEntriesToTransfer);
     inline void IRAM_ATTR ISR_CreateIntensityData ();
     inline void IRAM_ATTR ISR_WriteToBuffer(uint32_t value);
@@ -166,44 +184,11 @@ inline void IRAM_ATTR ClearRmtInterrupts()
 #define RMT_ClockRate       80000000.0
 #define RMT_Clock_Divisor   2.0
 #define RMT_TickLengthNS    float ( (1/ (RMT_ClockRate/RMT_Clock_Divisor)) * float(NanoSecondsInASecond))
+#define RMT_TicksPerUs      uint32_t ( (RMT_ClockRate/RMT_Clock_Divisor) / float(MicroSecondsInASecond))
 
     bool ThereIsDataToSend = false;
 
     void IRAM_ATTR ISR_Handler (isrTxFlags_t isrFlags);
     c_OutputCommon * pParent = nullptr;
-
-// #define USE_RMT_DEBUG_COUNTERS
-#ifdef USE_RMT_DEBUG_COUNTERS
-// #define IncludeBufferData
-   // debug counters
-   uint32_t DataCallbackCounter = 0;
-   uint32_t DataTaskcounter = 0;
-   uint32_t ISRcounter = 0;
-   uint32_t FrameStartCounter = 0;
-   uint32_t SendBlockIsrCounter = 0;
-   uint32_t RanOutOfData = 0;
-   uint32_t UnknownISRcounter = 0;
-   uint32_t IntTxEndIsrCounter = 0;
-   uint32_t IntTxThrIsrCounter = 0;
-   uint32_t RxIsr = 0;
-   uint32_t ErrorIsr = 0;
-   uint32_t IntensityValuesSent = 0;
-   uint32_t IntensityBitsSent = 0;
-   uint32_t IntensityValuesSentLastFrame = 0;
-   uint32_t IntensityBitsSentLastFrame = 0;
-   uint32_t IncompleteFrame = 0;
-   uint32_t RmtEntriesTransfered = 0;
-   uint32_t RmtXmtFills = 0;
-   uint32_t RmtWhiteDetected = 0;
-   uint32_t FailedToSendAllData = 0;
-
-#define RMT_DEBUG_COUNTER(p) p
-
-#else
-
-#define RMT_DEBUG_COUNTER(p)
-
-#endif // def USE_RMT_DEBUG_COUNTERS
-
 };
 #endif // def #ifdef ARDUINO_ARCH_ESP32
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+/*
+* OutputSelfTest.hpp - Output throughput self test
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   While the test runs, the output manager ignores the data the inputs
+*   send, writes a moving ramp into the buffer of every pixel, serial and
+*   SPI port and lets each driver refresh as soon as its wire time allows
+*   instead of waiting for the configured minimum frame time. Relay and
+*   servo ports are left alone.
+*
+*   The port statistics are cleared when the test starts. When it ends the
+*   frame count, ISR time, underruns and aborted frames of every port are
+*   kept here until the next test, along with the idle time of each core.
+*/
+
+#include "ESPixelStick.h"
+#include "utility/CpuLoad.hpp"
+
+class c_OutputCommon;
+
+class c_OutputSelfTest
+{
+public:
+    #define OUTPUT_SELF_TEST_DEFAULT_DURATION_MS    10000
+    #define OUTPUT_SELF_TEST_MAX_DURATION_MS        60000
+
+    struct PortResult_t
+    {
+        bool        Valid;
+        uint32_t    OutputType;
+        uint32_t    Frames;
+        uint32_t    PixelsPerFrame;     ///< zero for non pixel ports
+        uint32_t    BytesPerFrame;
+        uint32_t    WireFrameUs;        ///< wire time of one frame including the reset
+        uint64_t    IsrCycles;
+        uint32_t    MaxIsrCycles;
+        uint32_t    Underruns;
+        uint32_t    AbortedFrames;
+
+        void     Record     (c_OutputCommon & Port);
+        uint32_t GetStatus  (JsonObject & jsonStatus, uint32_t ElapsedMs);
+    };
+
+    c_OutputSelfTest ();
+    virtual ~c_OutputSelfTest ();
+
+    void        Start           (uint32_t DurationMs);
+    void        Stop            ();
+    bool        IsRunning       () { return Running; }
+    bool        HasRun          () { return (0 != DurationMs); }
+    bool        TimeIsUp        () { return (millis () - StartMs) >= DurationMs; }
+    bool        NextPattern     ();
+    void        FillBuffer      (uint8_t * pBuffer, uint32_t Size);
+    uint32_t    GetElapsedMs    () { return Running ? (millis () - StartMs) : ElapsedMs; }
+    void        GetStatus       (JsonObject & jsonStatus);
+    void        GetDriverName   (String & Name) { Name = F ("SelfTest"); }
+
+private:
+    bool                Running     = false;
+    uint32_t            DurationMs  = 0;
+    uint32_t            StartMs     = 0;
+    uint32_t            ElapsedMs   = 0;
+    uint32_t            LastStepMs  = 0;
+    uint8_t             Step        = 0;
+    c_CpuLoad::Sample_t CpuStart;
+    c_CpuLoad::Sample_t CpuEnd;
+
+}; // c_OutputSelfTest
@@ -100,25 +100,6 @@ private:
     const uint8_t FireGodNumMaxControllers = 4;
     const uint8_t FireGodNumChanPerController = 32;
 
-#define USE_SERIAL_DEBUG_COUNTERS
-#ifdef USE_SERIAL_DEBUG_COUNTERS
-    uint32_t   IntensityBytesSent = 0;
-    uint32_t   IntensityBytesSentLastFrame = 0;
-    uint32_t   FrameStartCounter = 0;
-    uint32_t   FrameEndCounter = 0;
-    uint32_t   AbortFrameCounter = 0;
-    uint32_t   LastDataSent = 0;
-    uint32_t   DmxFrameStart = 0;
-    uint32_t   DmxSendData = 0;
-    uint32_t   Serialidle = 0;
-#define SERIAL_DEBUG_COUNTER(p) p
-
-#else
-
-#define SERIAL_DEBUG_COUNTER(p)
-
-#endif // def USE_SERIAL_DEBUG_COUNTERS
-
     bool validate ();        ///< confirm that the current configuration is valid
 
     enum RenardFrameDefinitions_t
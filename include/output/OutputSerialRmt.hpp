@@ -64,25 +64,6 @@ private:
     uint32_t        StopBitCount = 0;
     uint32_t        DataPattern;
 
-    // #define SERIAL_RMT_DEBUG_COUNTERS
-    #ifdef SERIAL_RMT_DEBUG_COUNTERS
-    #define INC_SERIAL_RMT_DEBUG_COUNTERS(c) (++SerialRmtDebugCounters.c)
-    struct
-    {
-        uint32_t GetNextBit = 0;
-        uint32_t FrameStarts = 0;
-        uint32_t FrameEnds = 0;
-        uint32_t BreakBits = 0;
-        uint32_t MabBits = 0;
-        uint32_t StartBits = 0;
-        uint32_t DataBits = 0;
-        uint32_t StopBits = 0;
-        uint32_t Underrun = 0;
-    } SerialRmtDebugCounters;
-    #else
-    #define INC_SERIAL_RMT_DEBUG_COUNTERS(c)
-    #endif // def SERIAL_RMT_DEBUG_COUNTERS
-
 }; // c_OutputSerialRmt
 
 #endif // defined(SUPPORT_OutputProtocol_FireGod) || (defined(SUPPORT_OutputProtocol_DMX) || defined(SUPPORT_OutputProtocol_Serial) || defined(SUPPORT_OutputProtocol_Renard)) && defined(ARDUINO_ARCH_ESP32)
@@ -63,25 +63,6 @@ private:
     uint32_t        DataPattern;
     uint32_t        DataPatternMask;
 
-    // #define TM1814_RMT_DEBUG_COUNTERS
-    #ifdef TM1814_RMT_DEBUG_COUNTERS
-    #define INC_TM1814_RMT_DEBUG_COUNTERS(c) (++RmtDebugCounters.c)
-    struct
-    {
-        uint32_t GetNextBit = 0;
-        uint32_t FrameStarts = 0;
-        uint32_t FrameEnds = 0;
-        uint32_t BreakBits = 0;
-        uint32_t MabBits = 0;
-        uint32_t StartBits = 0;
-        uint32_t DataBits = 0;
-        uint32_t StopBits = 0;
-        uint32_t Underrun = 0;
-    } RmtDebugCounters;
-    #else
-    #define INC_TM1814_RMT_DEBUG_COUNTERS(c)
-    #endif // def TM1814_RMT_DEBUG_COUNTERS
-
     c_OutputRmt     Rmt;
 
 }; // c_OutputTM1814Rmt
@@ -0,0 +1,98 @@
+#pragma once
+/*
+* OutputTimingStats.hpp - Per port frame timing histograms
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Always on timing telemetry for an output port. Each histogram uses log2
+*   buckets: bucket N counts samples in the range [2^(N-1), 2^N). The last
+*   bucket also collects everything larger. Sample recording is a handful of
+*   instructions so it can be called from the output ISRs.
+*
+*/
+
+#include "ESPixelStick.h"
+
+class c_OutputTimingStats
+{
+public:
+    #define OUTPUT_TIMING_NUM_BUCKETS 20
+
+    struct LogHistogram_t
+    {
+        uint32_t Buckets[OUTPUT_TIMING_NUM_BUCKETS];
+        uint32_t Max;
+        uint64_t Sum;
+
+        inline void IRAM_ATTR Add (uint32_t Value)
+        {
+            uint32_t Index = (0 == Value) ? 0 : uint32_t(32 - __builtin_clz (Value));
+            ++Buckets[(Index < OUTPUT_TIMING_NUM_BUCKETS) ? Index : (OUTPUT_TIMING_NUM_BUCKETS - 1)];
+            Max = (Value > Max) ? Value : Max;
+            Sum += Value;
+        }
+
+        void GetStatus (JsonObject & jsonStatus, const __FlashStringHelper * Name);
+    };
+
+    LogHistogram_t  FrameDurationUs;    ///< start of frame to the last data handed to the hardware
+    LogHistogram_t  FrameIntervalUs;    ///< start of frame to start of the next frame
+    LogHistogram_t  IsrCycles;          ///< CPU cycles spent in the output ISR
+    LogHistogram_t  RefillSlackUs;      ///< time left before the hardware would have run dry at each refill
+    uint32_t        Underruns;          ///< refills that arrived after the hardware ran dry
+    uint32_t        AbortedFrames;      ///< frames the hardware stopped sending before all of the data went out
+
+    inline void IRAM_ATTR ISR_FrameStart (uint32_t NowUs)
+    {
+        if (LastFrameStartUs)
+        {
+            FrameIntervalUs.Add (NowUs - LastFrameStartUs);
+        }
+        LastFrameStartUs = NowUs;
+        FrameInProgress  = true;
+    }
+
+    inline void IRAM_ATTR ISR_FrameEnd (uint32_t NowUs)
+    {
+        if (FrameInProgress)
+        {
+            FrameDurationUs.Add (NowUs - LastFrameStartUs);
+            FrameInProgress = false;
+        }
+    }
+
+    inline void IRAM_ATTR ISR_RefillSlack (int32_t SlackUs)
+    {
+        if (SlackUs < 0)
+        {
+            ++Underruns;
+            SlackUs = 0;
+        }
+        RefillSlackUs.Add (uint32_t (SlackUs));
+    }
+
+    inline void IRAM_ATTR ISR_FrameAborted ()
+    {
+        ++AbortedFrames;
+    }
+
+    void Clear     ();
+    void GetStatus (JsonObject & jsonStatus);
+
+private:
+    uint32_t        LastFrameStartUs;
+    bool            FrameInProgress;
+
+}; // c_OutputTimingStats
@@ -58,33 +58,14 @@ private:
 
 //     {{UCS1903_PIXEL_RMT_TICKS_IDLE / 10,  0, UCS1903_PIXEL_RMT_TICKS_IDLE / 10, 1}, c_OutputRmt::RmtDataBitIdType_t::RMT_INTERFRAME_GAP_ID},
 
-    rmt_item32_t    ZeroBit = {UCS1903_PIXEL_RMT_TICKS_BIT_0_HIGH, 0, UCS1903_PIXEL_RMT_TICKS_BIT_0_LOW, 1};
-    rmt_item32_t    OneBit  = {UCS1903_PIXEL_RMT_TICKS_BIT_1_HIGH, 0, UCS1903_PIXEL_RMT_TICKS_BIT_1_LOW, 1};
+    rmt_item32_t    ZeroBit = {UCS1903_PIXEL_RMT_TICKS_BIT_0_HIGH, 1, UCS1903_PIXEL_RMT_TICKS_BIT_0_LOW, 0};
+    rmt_item32_t    OneBit  = {UCS1903_PIXEL_RMT_TICKS_BIT_1_HIGH, 1, UCS1903_PIXEL_RMT_TICKS_BIT_1_LOW, 0};
     rmt_item32_t    IfgBit;
     uint32_t        IfgBitCount;
     uint32_t        IfgBitCurrentCount;
     uint32_t        DataPattern;
     uint32_t        DataPatternMask;
 
-    // #define UCS1903_RMT_DEBUG_COUNTERS
-    #ifdef UCS1903_RMT_DEBUG_COUNTERS
-    #define INC_UCS1903_RMT_DEBUG_COUNTERS(c) (++RmtDebugCounters.c)
-    struct
-    {
-        uint32_t GetNextBit = 0;
-        uint32_t FrameStarts = 0;
-        uint32_t FrameEnds = 0;
-        uint32_t BreakBits = 0;
-        uint32_t MabBits = 0;
-        uint32_t StartBits = 0;
-        uint32_t DataBits = 0;
-        uint32_t StopBits = 0;
-        uint32_t Underrun = 0;
-    } RmtDebugCounters;
-    #else
-    #define INC_UCS1903_RMT_DEBUG_COUNTERS(c)
-    #endif // def UCS1903_RMT_DEBUG_COUNTERS
-
     c_OutputRmt Rmt;
 
 }; // c_OutputUCS1903Rmt
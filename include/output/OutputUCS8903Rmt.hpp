@@ -55,33 +55,14 @@ private:
     #define UCS8903_PIXEL_RMT_TICKS_BIT_1_LOW     uint16_t ( (UCS8903_PIXEL_NS_BIT_1_LOW  / RMT_TickLengthNS) + 1.0)
     #define UCS8903_PIXEL_RMT_TICKS_IDLE          uint16_t ( (UCS8903_PIXEL_IDLE_TIME_NS  / RMT_TickLengthNS) + 1.0)
 
-    rmt_item32_t    ZeroBit = {UCS8903_PIXEL_RMT_TICKS_BIT_0_HIGH, 0, UCS8903_PIXEL_RMT_TICKS_BIT_0_LOW, 1};
-    rmt_item32_t    OneBit  = {UCS8903_PIXEL_RMT_TICKS_BIT_1_HIGH, 0, UCS8903_PIXEL_RMT_TICKS_BIT_1_LOW, 1};
+    rmt_item32_t    ZeroBit = {UCS8903_PIXEL_RMT_TICKS_BIT_0_HIGH, 1, UCS8903_PIXEL_RMT_TICKS_BIT_0_LOW, 0};
+    rmt_item32_t    OneBit  = {UCS8903_PIXEL_RMT_TICKS_BIT_1_HIGH, 1, UCS8903_PIXEL_RMT_TICKS_BIT_1_LOW, 0};
     rmt_item32_t    IfgBit;
     uint32_t        IfgBitCount;
     uint32_t        IfgBitCurrentCount;
     uint32_t        DataPattern;
     uint32_t        DataPatternMask;
 
-    // #define UCS8903_RMT_DEBUG_COUNTERS
-    #ifdef UCS8903_RMT_DEBUG_COUNTERS
-    #define INC_UCS8903_RMT_DEBUG_COUNTERS(c) (++RmtDebugCounters.c)
-    struct
-    {
-        uint32_t GetNextBit = 0;
-        uint32_t FrameStarts = 0;
-        uint32_t FrameEnds = 0;
-        uint32_t BreakBits = 0;
-        uint32_t MabBits = 0;
-        uint32_t StartBits = 0;
-        uint32_t DataBits = 0;
-        uint32_t StopBits = 0;
-        uint32_t Underrun = 0;
-    } RmtDebugCounters;
-    #else
-    #define INC_UCS8903_RMT_DEBUG_COUNTERS(c)
-    #endif // def UCS8903_RMT_DEBUG_COUNTERS
-
     c_OutputRmt Rmt;
 
 }; // c_OutputUCS8903Rmt
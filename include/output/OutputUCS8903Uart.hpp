@@ -50,12 +50,6 @@ public:
 
 private:
     c_OutputUart Uart;
-#ifdef UCS8903_UART_DEBUG_COUNTERS
-    uint32_t NewFrameCounter        = 0;
-    uint32_t TimeSinceLastFrameMS   = 0;
-    uint32_t TimeLastFrameStartedMS = 0;
-#endif // def UCS8903_UART_DEBUG_COUNTERS
-
 }; // c_OutputUCS8903Uart
 
 #endif // defined(SUPPORT_OutputProtocol_UCS8903)
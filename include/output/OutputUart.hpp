@@ -133,7 +133,12 @@ private:
     uint32_t        NumUartSlotsPerIntensityValue   = 1;
     uint32_t        MarkAfterInterintensityBreakBitCCOUNT          = 0;
     uint32_t        ActiveIsrMask                   = 0;
+    uint32_t        UartSlotTimeNs                  = 0;
+    c_OutputTimingStats * pTimingStats              = nullptr;
 #if defined(ARDUINO_ARCH_ESP32)
+    static void AllocateIsr             (void * pThis);
+    static void FreeIsr                 (void * pThis);
+
     intr_handle_t   IsrHandle                       = nullptr;
     SemaphoreHandle_t  WaitFrameDone;
 #endif // defined(ARDUINO_ARCH_ESP32)
@@ -147,36 +152,7 @@ private:
     inline void     IRAM_ATTR   EnableUartInterrupts();
     inline void     IRAM_ATTR   ISR_ClearUartInterrupts();
     inline void     IRAM_ATTR   ISR_DisableUartInterrupts();
-
-// #define USE_UART_DEBUG_COUNTERS
-#ifdef USE_UART_DEBUG_COUNTERS
-    // debug counters
-    uint32_t DataCallbackCounter = 0;
-    uint32_t DataTaskcounter = 0;
-    uint32_t RxIsr = 0;
-    uint32_t ErrorIsr = 0;
-    uint32_t FiFoISRcounter = 0;
-    uint32_t BreakIsrCounter = 0;
-    uint32_t IdleIsrCounter = 0;
-    uint32_t IsrIsNotForUs = 0;
-    uint32_t UnknownIsr = 0;
-    uint32_t TimerIsrCounter = 0;
-    uint32_t TimerIsrNoDataToSend = 0;
-    uint32_t TimerIsrSendData = 0;
-    uint32_t FrameThresholdCounter = 0;
-    uint32_t FrameEndISRcounter = 0;
-    uint32_t FrameStartCounter = 0;
-    uint32_t IntensityValuesSent = 0;
-    uint32_t IntensityBitsSent = 0;
-    uint32_t IntensityValuesSentLastFrame = 0;
-    uint32_t IntensityBitsSentLastFrame = 0;
-    uint32_t IncompleteFrame = 0;
-    uint32_t EnqueueCounter = 0;
-    uint32_t FiFoNotEmpty = 0;
-    uint32_t FiFoEmpty = 0;
-    uint32_t TxStopped = 0;
-
-#endif // def USE_UART_DEBUG_COUNTERS
+    inline uint32_t IRAM_ATTR   ISR_GetFifoDrainTimeUs();
 
 #ifndef UART_TX_BRK_DONE_INT_ENA
 #   define UART_TX_BRK_DONE_INT_ENA 0
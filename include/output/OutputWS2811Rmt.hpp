@@ -49,10 +49,6 @@ public:
 
 private:
 
-#ifdef USE_RMT_DEBUG_COUNTERS
-    uint32_t CanRefresh = 0;
-    uint32_t CannotRefresh = 0;
-#endif // def USE_RMT_DEBUG_COUNTERS
 // The adjustments compensate for rounding errors in the calculations
 #define WS2811_PIXEL_RMT_TICKS_BIT_0_HIGH    uint16_t ( (WS2811_PIXEL_NS_BIT_0_HIGH / RMT_TickLengthNS) + 0.0)
 #define WS2811_PIXEL_RMT_TICKS_BIT_0_LOW     uint16_t ( (WS2811_PIXEL_NS_BIT_0_LOW  / RMT_TickLengthNS) + 0.0)
@@ -68,25 +64,6 @@ private:
     uint32_t        DataPattern;
     uint32_t        DataPatternMask;
 
-    // #define WS2811_RMT_DEBUG_COUNTERS
-    #ifdef WS2811_RMT_DEBUG_COUNTERS
-    #define INC_WS2811_RMT_DEBUG_COUNTERS(c) (++RmtDebugCounters.c)
-    struct
-    {
-        uint32_t GetNextBit = 0;
-        uint32_t FrameStarts = 0;
-        uint32_t FrameEnds = 0;
-        uint32_t BreakBits = 0;
-        uint32_t MabBits = 0;
-        uint32_t StartBits = 0;
-        uint32_t DataBits = 0;
-        uint32_t StopBits = 0;
-        uint32_t Underrun = 0;
-    } RmtDebugCounters;
-    #else
-    #define INC_WS2811_RMT_DEBUG_COUNTERS(c)
-    #endif // def WS2811_RMT_DEBUG_COUNTERS
-
     c_OutputRmt Rmt;
 
 }; // c_OutputWS2811Rmt
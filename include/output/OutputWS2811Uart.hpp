@@ -51,12 +51,6 @@ public:
 
 private:
     c_OutputUart Uart;
-#ifdef WS2811_UART_DEBUG_COUNTERS
-    uint32_t NewFrameCounter = 0;
-    uint32_t TimeSinceLastFrameMS = 0;
-    uint32_t TimeLastFrameStartedMS = 0;
-#endif // def WS2811_UART_DEBUG_COUNTERS
-
 }; // c_OutputWS2811Uart
 
 #endif // defined(SUPPORT_OutputProtocol_WS2811)
@@ -0,0 +1,52 @@
+#pragma once
+/*
+ * GPIO_Defs_Native.hpp - Output Management class
+ *
+ * Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+ * Copyright (c) 2026 Shelby Merrick
+ * http://www.forkineye.com
+ *
+ *  This program is provided free for you to use in any way that you wish,
+ *  subject to the laws and regulations where you are using it.  Due diligence
+ *  is strongly suggested before using this code.  Please give credit where due.
+ *
+ *  The Author makes no warranty of any kind, express or implied, with regard
+ *  to this program or the documentation contained in this document.  The
+ *  Author shall not be liable in any event for incidental or consequential
+ *  damages in connection with, or arising out of, the furnishing, performance
+ *  or use of these programs.
+ *
+ *  Simulated board used by the native (host) build. Only the serial ports
+ *  are provided since those are the ones backed by a simulated peripheral.
+ *  In the RMT build each port uses the RMT channel with the same number.
+ *  In the UART build (USE_UART_OUTPUT_DRIVERS) each port uses the UART with
+ *  the same number.
+ */
+
+const OM_OutputPortDefinition_t OM_OutputPortDefinitions[] =
+{
+    {OM_PortId_t(0), OM_PortType_t::OM_SERIAL, {gpio_num_t::GPIO_NUM_2}},
+    {OM_PortId_t(1), OM_PortType_t::OM_SERIAL, {gpio_num_t::GPIO_NUM_13}},
+    {OM_PortId_t(2), OM_PortType_t::OM_SERIAL, {gpio_num_t::GPIO_NUM_12}},
+};
+
+// File Manager. Not used by the simulator but referenced by the file manager class.
+#define SD_CARD_MISO_PIN        gpio_num_t::GPIO_NUM_19
+#define SD_CARD_MOSI_PIN        gpio_num_t::GPIO_NUM_23
+#define SD_CARD_CLK_PIN         gpio_num_t::GPIO_NUM_18
+#define SD_CARD_CS_PIN          gpio_num_t::GPIO_NUM_4
+
+// Output Types
+#ifndef USE_UART_OUTPUT_DRIVERS
+#define SUPPORT_OutputProtocol_TLS3001          // OM_SERIAL (RMT only)
+#endif // ndef USE_UART_OUTPUT_DRIVERS
+#define SUPPORT_OutputProtocol_DMX              // OM_SERIAL
+#define SUPPORT_OutputProtocol_GECE             // OM_SERIAL
+#define SUPPORT_OutputProtocol_GS8208           // OM_SERIAL
+#define SUPPORT_OutputProtocol_Renard           // OM_SERIAL
+#define SUPPORT_OutputProtocol_Serial           // OM_SERIAL
+#define SUPPORT_OutputProtocol_TM1814           // OM_SERIAL
+#define SUPPORT_OutputProtocol_UCS1903          // OM_SERIAL
+#define SUPPORT_OutputProtocol_UCS8903          // OM_SERIAL
+#define SUPPORT_OutputProtocol_WS2811           // OM_SERIAL
+#define SUPPORT_OutputProtocol_FireGod          // OM_SERIAL
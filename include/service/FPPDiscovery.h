@@ -132,7 +132,7 @@ public:
     virtual ~c_FPPDiscovery() {}
 
     void begin ();
-    void Poll ();
+    uint32_t Poll ();   ///< returns the ms until the next poll
     void ProcessFPPJson      (AsyncWebServerRequest* request);
     void ProcessFPPDJson     (AsyncWebServerRequest* request);
     void ProcessGET          (AsyncWebServerRequest* request);
@@ -16,6 +16,11 @@
 *  damages in connection with, or arising out of, the furnishing, performance
 *  or use of these programs.
 *
+*   The sensor is driven one bus operation per poll: a reset, or a single
+*   byte written or read. The conversion runs on the sensor while the main
+*   loop carries on and the scratchpad is only read once the conversion
+*   time for the configured resolution has gone by. The longest poll is a
+*   reset, about 1 ms on the wire.
 */
 
 #include "ESPixelStick.h"
@@ -29,6 +34,10 @@
 #	error Platform not supported
 #endif
 
+#include <OneWire.h>
+
+#define SENSOR_DS18B20_READ_PERIOD_MS   MilliSecondsInASecond
+
 class c_SensorDS18B20
 {
 private:
@@ -37,17 +46,41 @@ private:
         TempUnitCentegrade = 0,
         TempUnitFahrenheit,
     };
+    enum State_t
+    {
+        StartConversion,
+        SendConvertCommand,
+        WaitForConversion,
+        StartRead,
+        SendReadCommand,
+        ReadScratchpad,
+    };
     TempUnit_t TempUnit = TempUnit_t::TempUnitCentegrade;
     uint8_t SensorPresent = 0;
-    time_t  LastReadingTime = 0;
-    float   LastReading = 0.0;
+    float   LastReading = 0.0;      ///< Centegrade
+
+    OneWire  Bus;
+    uint8_t  Address[8];
+    bool     ParasitePower = false;
+    uint32_t ConversionMs = 750;
+    State_t  State = State_t::StartConversion;
+    uint8_t  Command[10];
+    uint8_t  CommandLength = 0;
+    uint8_t  ByteIndex = 0;
+    uint8_t  Scratchpad[9];
+    uint32_t ConversionStartMs = 0;
+    uint32_t MaxPollUs = 0;
+    uint32_t ReadErrors = 0;
+
+    uint32_t RunState     ();
+    uint32_t ReadFailed   ();
 
 public:
-    c_SensorDS18B20 () {};
+    c_SensorDS18B20 () : Bus (ONEWIRE_PIN) {};
     virtual ~c_SensorDS18B20() {}
 
     void    Begin     ();
-    void    Poll      ();
+    uint32_t Poll     ();   ///< returns the ms until the next poll
     void    GetConfig (JsonObject& json);
     bool    SetConfig (JsonObject& json);
     void    GetStatus (JsonObject& json);
@@ -0,0 +1,99 @@
+#pragma once
+/*
+* AsyncLog.hpp - Ring buffered console log
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   logcon and its siblings copy the formatted line into a fixed ring and
+*   return. A line that does not fit is counted as dropped, the caller
+*   never waits for the UART. Lines above the configured level are
+*   filtered out by the macros before the message is built.
+*
+*   The ring is written out by a low priority task on the ESP32 and by a
+*   timer wheel job on the ESP8266. The job only writes what fits in the
+*   UART FIFO. Each line goes to the console UART (unless an output owns
+*   its pins) and, when a server is set, as a syslog datagram.
+*
+*   Until Begin is called every line is written out as soon as it is
+*   queued, which keeps the boot messages (and the native tools) in order
+*   with anything else printed on the port. Flush writes out whatever is
+*   queued from the calling task, it is used before a reboot.
+*/
+
+#include "ESPixelStick.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#   define ASYNC_LOG_BUFFER_SIZE    4096
+#else
+#   define ASYNC_LOG_BUFFER_SIZE    1024
+#endif // def ARDUINO_ARCH_ESP32
+#define ASYNC_LOG_MAX_LINE          200     // longer lines are truncated
+#define ASYNC_LOG_POLL_MS           10
+#define ASYNC_LOG_SYSLOG_PORT       514
+
+class c_AsyncLog
+{
+public:
+    c_AsyncLog ();
+    virtual ~c_AsyncLog ();
+
+    void        Begin           ();
+    void        Write           (uint32_t Level, const String & DriverName, const String & Message);
+    void        Flush           ();
+    void        StopConsole     ();
+    void        GetConfig       (JsonObject & json);
+    bool        SetConfig       (JsonObject & json);
+    void        GetStatus       (JsonObject & jsonStatus);
+    void        GetDriverName   (String & Name) { Name = F ("Log"); }
+
+private:
+    struct Header_t
+    {
+        uint8_t     Level;
+        uint8_t     Length;
+    };
+
+    void        CopyIn          (uint32_t Position, const void * pData, uint32_t Length);
+    void        CopyOut         (uint32_t Position, void * pData, uint32_t Length);
+    void        LockDrain       ();
+    void        UnlockDrain     ();
+    void        Drain           (bool MayBlock);
+    void        Send            (uint32_t Level, const char * pLine, uint32_t Length);
+    static uint32_t DrainJob    (void * pContext);
+
+    uint8_t             Buffer[ASYNC_LOG_BUFFER_SIZE];
+    volatile uint32_t   Head = 0;           ///< written by the callers, free running
+    volatile uint32_t   Tail = 0;           ///< written by the drain, free running
+    uint32_t            Lines = 0;
+    volatile uint32_t   Dropped = 0;
+    uint32_t            ReportedDropped = 0;
+    bool                Started = false;
+
+    bool                SyslogEnabled = false;
+    IPAddress           SyslogServer;
+    uint16_t            SyslogPort = ASYNC_LOG_SYSLOG_PORT;
+    AsyncUDP            SyslogUdp;
+
+#ifdef ARDUINO_ARCH_ESP32
+    static void         DrainTask       (void * pContext);
+
+    portMUX_TYPE        WriteLock = portMUX_INITIALIZER_UNLOCKED;
+    SemaphoreHandle_t   DrainLock = nullptr;
+    TaskHandle_t        DrainTaskHandle = nullptr;
+#endif // def ARDUINO_ARCH_ESP32
+
+}; // c_AsyncLog
+
+extern c_AsyncLog AsyncLog;
@@ -0,0 +1,55 @@
+#pragma once
+/*
+* BootTimeline.hpp - Time from reset to each step of the start up
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   setup() marks the steps it runs in order. The steps that finish in the
+*   background after setup() (SD card, FSEQ list, network, first output
+*   frame) mark themselves when they are done. Each mark is logged with
+*   the time since reset and since the previous mark, and the list is
+*   kept for the status page.
+*
+*   A phase is only recorded the first time it is marked, so a network
+*   that comes back later does not add to the boot timeline.
+*/
+
+#include "ESPixelStick.h"
+
+#define BOOT_TIMELINE_MAX_PHASES    16
+
+class c_BootTimeline
+{
+public:
+    c_BootTimeline ();
+    virtual ~c_BootTimeline ();
+
+    void        Mark            (const __FlashStringHelper * Phase);
+    void        GetStatus       (JsonObject & jsonStatus);
+    void        GetDriverName   (String & Name) { Name = F ("Boot"); }
+
+private:
+    struct Phase_t
+    {
+        const __FlashStringHelper * Name;
+        uint32_t                    TimeMs;
+    };
+
+    Phase_t     Phases[BOOT_TIMELINE_MAX_PHASES];
+    uint32_t    NumPhases = 0;
+
+}; // c_BootTimeline
+
+extern c_BootTimeline BootTimeline;
@@ -0,0 +1,74 @@
+#pragma once
+/*
+* ConfigSnapshot.hpp - Binary copies of the JSON config files for a fast boot
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Every config file the file manager loads (/name.json) gets a MessagePack
+*   copy of its parsed document next to it (/name.snap). The next load reads
+*   the copy instead of parsing the text. The copy is rewritten whenever
+*   the JSON document is saved and removed when the file is written any
+*   other way.
+*
+*   The header holds the size and write time of the JSON file it was made
+*   from and an FNV-1a checksum of the payload. A copy that does not match
+*   its JSON file, or fails the checksum, is ignored and rebuilt. The JSON
+*   file stays the master: deleting it resets the config even if a copy is
+*   left behind.
+*
+*   The copy holds the document, not the decoded settings, so the managers
+*   still validate every value and a firmware update can keep the copies.
+*/
+
+#include "ESPixelStick.h"
+
+class c_ConfigSnapshot
+{
+public:
+    c_ConfigSnapshot ();
+    virtual ~c_ConfigSnapshot ();
+
+    bool        IsCached        (const String & JsonFileName) { return JsonFileName.endsWith (F (".json")); }
+    String      GetFileName     (const String & JsonFileName);
+    uint8_t *   Encode          (JsonDocument & Doc, uint32_t JsonFileSize, uint32_t JsonFileTime, size_t & Length);  ///< free with SpiRam.Free
+    bool        Decode          (const uint8_t * pData, size_t Length, uint32_t JsonFileSize, uint32_t JsonFileTime, JsonDocument & Doc);
+    void        CountLoad       (bool FromSnapshot, uint32_t DurationUs);
+    void        GetStatus       (JsonObject & jsonStatus);
+    void        GetDriverName   (String & Name) { Name = F ("Snapshot"); }
+
+private:
+    #define CONFIG_SNAPSHOT_SIGNATURE   0x50414E53  // "SNAP"
+    #define CONFIG_SNAPSHOT_VERSION     1
+
+    struct Header_t
+    {
+        uint32_t    Signature;
+        uint16_t    Version;
+        uint16_t    HeaderSize;
+        uint32_t    JsonFileSize;
+        uint32_t    JsonFileTime;
+        uint32_t    PayloadSize;
+        uint32_t    Checksum;
+    };
+
+    static uint32_t Checksum    (const uint8_t * pData, size_t Length);
+
+    uint32_t    SnapshotLoads   = 0;
+    uint32_t    JsonLoads       = 0;
+    uint32_t    LoadDurationUs  = 0;    ///< all loads since boot
+
+}; // c_ConfigSnapshot
+
+extern c_ConfigSnapshot ConfigSnapshot;
@@ -0,0 +1,109 @@
+#pragma once
+/*
+* CpuLoad.hpp - Per core idle time sampler
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The FreeRTOS tick hook of each core checks whether the idle task of that
+*   core was running when the tick arrived. The ratio of idle ticks to all
+*   ticks between two samples is the idle time of the core. Time spent in
+*   an ISR is charged to the task it interrupted.
+*
+*   The hooks are only registered the first time Begin is called. The
+*   ESP8266 has no scheduler and reports no cores.
+*
+*   The same tick charges the registered tasks. The real time tasks add
+*   themselves when they are created, the tasks of the core, WiFi, lwIP
+*   and the web server are looked up by name. Run time stats are not
+*   enabled in the Arduino sdkconfig, so this is the only per task
+*   measure available. It is in ticks, a task that runs for less than a
+*   tick at a time is only seen when a tick lands on it.
+*
+*   GetStatus(JsonObject) reports the time since the previous call.
+*/
+
+#include "ESPixelStick.h"
+
+#define CPU_LOAD_MAX_CORES 2
+#define CPU_LOAD_MAX_TASKS 12
+
+class c_CpuLoad
+{
+public:
+    struct Sample_t
+    {
+        uint32_t IdleTicks[CPU_LOAD_MAX_CORES];
+        uint32_t TotalTicks[CPU_LOAD_MAX_CORES];
+    };
+
+    c_CpuLoad ();
+    virtual ~c_CpuLoad ();
+
+    void        Begin           ();
+    void        GetSample       (Sample_t & Sample);
+    void        GetStatus       (JsonArray & jsonIdle, const Sample_t & Start, const Sample_t & End);
+    void        GetStatus       (JsonObject & jsonStatus);
+    uint32_t    GetNumCores     () { return NumCores; }
+    void        GetDriverName   (String & Name) { Name = F ("CpuLoad"); }
+
+#ifdef ARDUINO_ARCH_ESP32
+    void        AddTask         (TaskHandle_t Handle);
+    void        RemoveTask      (TaskHandle_t Handle);
+
+    inline void IRAM_ATTR ISR_Tick (uint32_t Core)
+    {
+        ++TotalTicks[Core];
+        TaskHandle_t CurrentTask = xTaskGetCurrentTaskHandle ();
+        if (CurrentTask == IdleTaskHandle[Core])
+        {
+            ++IdleTicks[Core];
+        }
+        else
+        {
+            for (auto & CurrentEntry : Tasks)
+            {
+                if (CurrentEntry.Handle == CurrentTask)
+                {
+                    ++CurrentEntry.Ticks;
+                    break;
+                }
+            }
+        }
+    }
+#endif // def ARDUINO_ARCH_ESP32
+
+private:
+    uint32_t            NumCores = 0;
+    volatile uint32_t   IdleTicks[CPU_LOAD_MAX_CORES];
+    volatile uint32_t   TotalTicks[CPU_LOAD_MAX_CORES];
+    Sample_t            Reported;
+#ifdef ARDUINO_ARCH_ESP32
+    struct Task_t
+    {
+        TaskHandle_t volatile   Handle;
+        volatile uint32_t       Ticks;
+        uint32_t                ReportedTicks;
+    };
+
+    void                FindSystemTasks ();
+
+    TaskHandle_t        IdleTaskHandle[CPU_LOAD_MAX_CORES];
+    Task_t              Tasks[CPU_LOAD_MAX_TASKS];
+    bool                SystemTasksFound = false;
+#endif // def ARDUINO_ARCH_ESP32
+
+}; // c_CpuLoad
+
+extern c_CpuLoad CpuLoad;
@@ -0,0 +1,131 @@
+#pragma once
+/*
+* DebugCounters.hpp - Registry of named debug counters and gauges
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Every counter is given a level when it is defined. Counters above
+*   DEBUG_COUNTER_LEVEL compile out completely, storage included. The ones
+*   that remain register themselves at boot and are reported by /counters.
+*
+*       Level 1 - frame level events (frame starts, aborts, timeouts)
+*       Level 2 - ISR and bit level events
+*
+*   Each counter holds one value per instance (normally the output port id)
+*   per core. An increment is a plain non-atomic add to the slot owned by
+*   the current core, so it is safe to use from an ISR.
+*
+*   Usage:
+*       DEBUG_COUNTER_DEFINE (2, RmtThresIsr, "rmt.isr.thres", DEBUG_COUNTER_MAX_INSTANCES);
+*       DEBUG_COUNTER_INC    (2, RmtThresIsr, PortId);
+*/
+
+#include "ESPixelStick.h"
+
+#ifndef DEBUG_COUNTER_LEVEL
+#   define DEBUG_COUNTER_LEVEL 0
+#endif // ndef DEBUG_COUNTER_LEVEL
+
+// Large enough to index by output port id on all supported platforms
+#define DEBUG_COUNTER_MAX_INSTANCES 16
+
+#ifdef ARDUINO_ARCH_ESP32
+#   define DEBUG_COUNTER_NUM_CORES portNUM_PROCESSORS
+#   define DEBUG_COUNTER_CORE_ID   xPortGetCoreID()
+#else
+#   define DEBUG_COUNTER_NUM_CORES 1
+#   define DEBUG_COUNTER_CORE_ID   0
+#endif // def ARDUINO_ARCH_ESP32
+
+class c_DebugCounter
+{
+public:
+    enum CounterType_t
+    {
+        Counter = 0,    ///< incremented. Reported as the sum across all cores
+        Gauge,          ///< set to the latest value
+    };
+
+    c_DebugCounter (const char * Name, CounterType_t Type, uint32_t NumInstances, uint32_t * pValues);
+
+    inline void IRAM_ATTR Add (uint32_t Instance, uint32_t Value)
+    {
+        if (Instance < NumInstances)
+        {
+            pValues[(Instance * DEBUG_COUNTER_NUM_CORES) + DEBUG_COUNTER_CORE_ID] += Value;
+        }
+    }
+
+    inline void IRAM_ATTR Set (uint32_t Instance, uint32_t Value)
+    {
+        if (Instance < NumInstances)
+        {
+            pValues[Instance * DEBUG_COUNTER_NUM_CORES] = Value;
+        }
+    }
+
+    static void GetStatus (JsonObject & jsonStatus);
+    static void ClearAll  ();
+
+private:
+    uint32_t Get (uint32_t Instance);
+
+    const char        * Name         = nullptr;
+    CounterType_t       Type         = Counter;
+    uint32_t            NumInstances = 0;
+    uint32_t          * pValues      = nullptr;
+    c_DebugCounter    * pNext        = nullptr;
+
+    static c_DebugCounter * pFirst;
+
+}; // c_DebugCounter
+
+#define DEBUG_COUNTER_DEFINE(Level, Var, Name, NumInstances)           DEBUG_COUNTER_DEFINE_L##Level  (static, Var, Name, c_DebugCounter::Counter, NumInstances)
+#define DEBUG_GAUGE_DEFINE(Level, Var, Name, NumInstances)             DEBUG_COUNTER_DEFINE_L##Level  (static, Var, Name, c_DebugCounter::Gauge,   NumInstances)
+#define DEBUG_COUNTER_INC(Level, Var, Instance)                        DEBUG_COUNTER_ADD_L##Level     (Var, Instance, 1)
+#define DEBUG_COUNTER_ADD(Level, Var, Instance, Value)                 DEBUG_COUNTER_ADD_L##Level     (Var, Instance, Value)
+#define DEBUG_GAUGE_SET(Level, Var, Instance, Value)                   DEBUG_GAUGE_SET_L##Level       (Var, Instance, Value)
+
+// Counters used from more than one file are defined once and declared in a header
+#define DEBUG_COUNTER_DEFINE_SHARED(Level, Var, Name, NumInstances)    DEBUG_COUNTER_DEFINE_L##Level  ( , Var, Name, c_DebugCounter::Counter, NumInstances)
+#define DEBUG_COUNTER_DECLARE(Level, Var)                              DEBUG_COUNTER_DECLARE_L##Level (Var)
+
+#define DEBUG_COUNTER_DEFINE_ENABLED(Linkage, Var, Name, Type, NumInstances) \
+    static uint32_t Var##_Values[(NumInstances) * DEBUG_COUNTER_NUM_CORES]; \
+    Linkage c_DebugCounter Var (Name, Type, NumInstances, Var##_Values)
+
+#if DEBUG_COUNTER_LEVEL >= 1
+#   define DEBUG_COUNTER_DEFINE_L1(Linkage, Var, Name, Type, NumInstances)  DEBUG_COUNTER_DEFINE_ENABLED (Linkage, Var, Name, Type, NumInstances)
+#   define DEBUG_COUNTER_DECLARE_L1(Var)                                     extern c_DebugCounter Var
+#   define DEBUG_COUNTER_ADD_L1(Var, Instance, Value)                        Var.Add (Instance, Value)
+#   define DEBUG_GAUGE_SET_L1(Var, Instance, Value)                          Var.Set (Instance, Value)
+#else
+#   define DEBUG_COUNTER_DEFINE_L1(Linkage, Var, Name, Type, NumInstances)
+#   define DEBUG_COUNTER_DECLARE_L1(Var)
+#   define DEBUG_COUNTER_ADD_L1(Var, Instance, Value)
+#   define DEBUG_GAUGE_SET_L1(Var, Instance, Value)
+#endif // DEBUG_COUNTER_LEVEL >= 1
+
+#if DEBUG_COUNTER_LEVEL >= 2
+#   define DEBUG_COUNTER_DEFINE_L2(Linkage, Var, Name, Type, NumInstances)  DEBUG_COUNTER_DEFINE_ENABLED (Linkage, Var, Name, Type, NumInstances)
+#   define DEBUG_COUNTER_DECLARE_L2(Var)                                     extern c_DebugCounter Var
+#   define DEBUG_COUNTER_ADD_L2(Var, Instance, Value)                        Var.Add (Instance, Value)
+#   define DEBUG_GAUGE_SET_L2(Var, Instance, Value)                          Var.Set (Instance, Value)
+#else
+#   define DEBUG_COUNTER_DEFINE_L2(Linkage, Var, Name, Type, NumInstances)
+#   define DEBUG_COUNTER_DECLARE_L2(Var)
+#   define DEBUG_COUNTER_ADD_L2(Var, Instance, Value)
+#   define DEBUG_GAUGE_SET_L2(Var, Instance, Value)
+#endif // DEBUG_COUNTER_LEVEL >= 2
@@ -0,0 +1,136 @@
+#pragma once
+/*
+* EventTrace.hpp - Ring buffer of timestamped trace events
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Tracing is off at boot and the ring is only allocated the first time it
+*   is turned on. While it is off, a trace point costs a single load and
+*   branch. While it is on, a trace point reserves a slot and writes 12
+*   bytes, so it can be used from the output ISRs. When the ring is full,
+*   the oldest events are overwritten.
+*
+*   The ring is downloaded from /trace in Chrome trace event format, which
+*   can be loaded directly into Perfetto or chrome://tracing.
+*/
+
+#include "ESPixelStick.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#   define EVENT_TRACE_NUM_ENTRIES 1024
+#else
+#   define EVENT_TRACE_NUM_ENTRIES 256
+#endif // def ARDUINO_ARCH_ESP32
+
+class c_EventTrace
+{
+public:
+    enum TraceEventType_t : uint8_t
+    {
+        PacketRx = 0,   ///< Id: input channel.  Arg16: universe.       Arg32: destination offset
+        ChannelData,    ///< Id: output port.    Arg16: channel count.  Arg32: start channel
+        FrameStart,     ///< Id: output port
+        Refill,         ///< Id: output port.                           Arg32: slack in us (negative on underrun)
+        FrameDone,      ///< Id: output port
+        SdReadStart,    ///<                                            Arg32: bytes requested
+        SdReadEnd,      ///<                                            Arg32: bytes read
+        MultiSync,      ///<                     Arg16: sync action.    Arg32: ms elapsed
+        NumTraceEventTypes,
+    };
+
+    struct TraceEntry_t
+    {
+        uint32_t            TimeUs;
+        TraceEventType_t    Type;
+        uint8_t             Id;
+        uint16_t            Arg16;
+        uint32_t            Arg32;
+    };
+
+    c_EventTrace ();
+    virtual ~c_EventTrace ();
+
+    inline void IRAM_ATTR Add (TraceEventType_t Type, uint8_t Id, uint16_t Arg16, uint32_t Arg32)
+    {
+        if (Enabled)
+        {
+            TraceEntry_t & Entry = pEntries[ReserveIndex () & (EVENT_TRACE_NUM_ENTRIES - 1)];
+            Entry.TimeUs = micros ();
+            Entry.Type   = Type;
+            Entry.Id     = Id;
+            Entry.Arg16  = Arg16;
+            Entry.Arg32  = Arg32;
+        }
+    }
+
+    void    SetEnabled  (bool NewState);
+    bool    IsEnabled   () { return Enabled; }
+    void    Clear       ();
+    void    GetStatus   (JsonObject & jsonStatus);
+    void    GetDriverName (String & Name) { Name = F ("EventTrace"); }
+
+    // chunked download support. Tracing is paused for the duration of the export
+    void    BeginExport ();
+    size_t  Export      (uint8_t * Buffer, size_t MaxLen);
+    void    EndExport   ();
+
+private:
+    inline uint32_t IRAM_ATTR ReserveIndex ()
+    {
+#ifdef ARDUINO_ARCH_ESP32
+        return __atomic_fetch_add (&WriteIndex, 1, __ATOMIC_RELAXED);
+#else
+        uint32_t SavedPS = xt_rsil (15);
+        uint32_t Response = WriteIndex++;
+        xt_wsr_ps (SavedPS);
+        return Response;
+#endif // def ARDUINO_ARCH_ESP32
+    }
+
+    size_t  FormatEntry      (char * Buffer, size_t MaxLen, TraceEntry_t & Entry);
+    size_t  FormatNextRecord (char * Buffer, size_t MaxLen);
+
+    TraceEntry_t      * pEntries        = nullptr;
+    volatile bool       Enabled         = false;
+    volatile uint32_t   WriteIndex      = 0;
+
+    enum ExportState_t
+    {
+        ExportIdle = 0,
+        ExportHeader,
+        ExportEvents,
+        ExportMetadata,
+        ExportFooter,
+        ExportDone,
+    };
+
+    ExportState_t   ExportState         = ExportIdle;
+    bool            EnabledBeforeExport = false;
+    uint32_t        ExportIndex         = 0;
+    uint32_t        ExportEnd           = 0;
+    uint32_t        ExportBaseTimeUs    = 0;
+    uint32_t        ExportOutputsSeen   = 0;    ///< one bit per output port that appears in the trace
+    uint32_t        ExportInputsSeen    = 0;    ///< one bit per input channel that appears in the trace
+    uint32_t        ExportMetadataIndex = 0;
+    bool            ExportFirstRecord   = true;
+    char            ExportRecord[192];
+    uint32_t        ExportRecordLen     = 0;
+    uint32_t        ExportRecordOffset  = 0;
+
+}; // c_EventTrace
+
+extern c_EventTrace EventTrace;
+
+#define EVENT_TRACE(Type, Id, Arg16, Arg32) EventTrace.Add (c_EventTrace::Type, uint8_t(Id), uint16_t(Arg16), uint32_t(Arg32))
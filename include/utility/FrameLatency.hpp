@@ -0,0 +1,132 @@
+#pragma once
+/*
+* FrameLatency.hpp - Packet to output frame latency per input channel
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The E1.31, Art-Net and DDP receive callbacks take a time stamp when a
+*   packet arrives and hand it over once its data is in the output buffer.
+*   Only the oldest stamp that has not been sent is kept per input channel.
+*   The next frame any output port starts carries that data, so the time
+*   from the stamp to the frame start is one sample. A frame that collects
+*   several packets is charged with the one that waited longest.
+*
+*   Samples go into a log histogram with four steps per power of two, the
+*   reported percentiles are the upper edge of their bucket (at most 25%
+*   high) and never above the largest sample.
+*
+*   FrameStarted runs in the ISR of the UART driver. It does not lock, a
+*   stamp that arrives while it clears the previous one can be lost.
+*
+*   Define LATENCY_GPIO to pulse a pin at the start of every frame that
+*   carries new input data, to line the data pin up with the network on
+*   a scope.
+*/
+
+#include "ESPixelStick.h"
+
+#define FRAME_LATENCY_MAX_INPUTS        2
+#define FRAME_LATENCY_SUB_BUCKET_BITS   2
+#define FRAME_LATENCY_MAX_EXPONENT      24      // 16.7 seconds. Anything longer goes into the last bucket
+#define FRAME_LATENCY_NUM_BUCKETS       ((FRAME_LATENCY_MAX_EXPONENT - FRAME_LATENCY_SUB_BUCKET_BITS + 2) << FRAME_LATENCY_SUB_BUCKET_BITS)
+
+class c_FrameLatency
+{
+public:
+    c_FrameLatency ();
+    virtual ~c_FrameLatency ();
+
+    void        Begin           ();
+    void        Clear           ();
+    void        GetStatus       (JsonObject & jsonStatus, uint32_t InputId);
+    uint32_t    GetPercentile   (uint32_t InputId, uint32_t Percent);
+    uint32_t    GetMax          (uint32_t InputId) { return (InputId < FRAME_LATENCY_MAX_INPUTS) ? Inputs[InputId].Max : 0; }
+    uint32_t    GetCount        (uint32_t InputId) { return (InputId < FRAME_LATENCY_MAX_INPUTS) ? Inputs[InputId].Count : 0; }
+    void        GetDriverName   (String & Name) { Name = F ("Latency"); }
+
+    inline void IRAM_ATTR DataArrived (uint32_t InputId, uint32_t ArrivalTimeUs)
+    {
+        // zero means nothing is waiting
+        if ((InputId < FRAME_LATENCY_MAX_INPUTS) && (0 == Inputs[InputId].PendingTimeUs))
+        {
+            Inputs[InputId].PendingTimeUs = ArrivalTimeUs | 1;
+        }
+    }
+
+    inline void IRAM_ATTR FrameStarted (uint32_t FrameStartTimeUs)
+    {
+        bool NewData = false;
+        for (auto & CurrentInput : Inputs)
+        {
+            uint32_t PendingTimeUs = CurrentInput.PendingTimeUs;
+            // a stamp taken on the other core after this frame started waits for the next frame
+            if ((0 == PendingTimeUs) || (0 > int32_t (FrameStartTimeUs - PendingTimeUs)))
+            {
+                continue;
+            }
+            CurrentInput.PendingTimeUs = 0;
+            CurrentInput.Add (FrameStartTimeUs - PendingTimeUs);
+            NewData = true;
+        }
+
+#ifdef LATENCY_GPIO
+        if (NewData)
+        {
+            digitalWrite (LATENCY_GPIO, HIGH);
+            digitalWrite (LATENCY_GPIO, LOW);
+        }
+#else
+        (void)NewData;
+#endif // def LATENCY_GPIO
+    }
+
+private:
+    struct Input_t
+    {
+        volatile uint32_t   PendingTimeUs;
+        uint32_t            Count;
+        uint32_t            Max;
+        uint32_t            Buckets[FRAME_LATENCY_NUM_BUCKETS];
+
+        inline void IRAM_ATTR Add (uint32_t LatencyUs)
+        {
+            ++Count;
+            Max = max (Max, LatencyUs);
+            ++Buckets[GetBucket (LatencyUs)];
+        }
+    };
+
+    static inline uint32_t IRAM_ATTR GetBucket (uint32_t Value)
+    {
+        if (Value < (1 << FRAME_LATENCY_SUB_BUCKET_BITS))
+        {
+            return Value;
+        }
+        uint32_t Exponent = 31 - __builtin_clz (Value);
+        if (FRAME_LATENCY_MAX_EXPONENT < Exponent)
+        {
+            return FRAME_LATENCY_NUM_BUCKETS - 1;
+        }
+        uint32_t Shift = Exponent - FRAME_LATENCY_SUB_BUCKET_BITS;
+        return ((Shift + 1) << FRAME_LATENCY_SUB_BUCKET_BITS) + ((Value >> Shift) & ((1 << FRAME_LATENCY_SUB_BUCKET_BITS) - 1));
+    }
+
+    static uint32_t GetBucketUpperEdge (uint32_t Bucket);
+
+    Input_t Inputs[FRAME_LATENCY_MAX_INPUTS];
+
+}; // c_FrameLatency
+
+extern c_FrameLatency FrameLatency;
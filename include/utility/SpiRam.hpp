@@ -0,0 +1,59 @@
+#pragma once
+/*
+* SpiRam.hpp - Placement of the large buffers in PSRAM
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Boards built with BOARD_HAS_PSRAM put the bulk channel buffer, the
+*   FSEQ read buffer and the JSON documents in PSRAM. Malloc returns PSRAM
+*   when the chip has it and falls back to the heap otherwise.
+*
+*   PSRAM is not reachable while the flash cache is off, so nothing an IRAM
+*   ISR reads may live there. InternalMalloc always returns internal RAM,
+*   even when the heap would have placed a large block in PSRAM.
+*
+*   The object is also a JSON allocator: "JsonDocument Doc (&SpiRam);"
+*   builds the document in PSRAM.
+*/
+
+#include "ESPixelStick.h"
+
+class c_SpiRam : public ArduinoJson::Allocator
+{
+public:
+    c_SpiRam ();
+    virtual ~c_SpiRam ();
+
+    void        Begin           ();
+    bool        IsPresent       () { return Present; }
+    uint32_t    GetFreeSize     ();
+    uint32_t    GetMaxAllocSize ();
+    void *      Malloc          (size_t Size);
+    void *      InternalMalloc  (size_t Size);
+    void        Free            (void * pMemory) { free (pMemory); }
+    void        GetStatus       (JsonObject & jsonStatus);
+    void        GetDriverName   (String & Name) { Name = F ("SpiRam"); }
+
+    // ArduinoJson::Allocator
+    void *      allocate        (size_t Size) override { return Malloc (Size); }
+    void        deallocate      (void * pMemory) override { Free (pMemory); }
+    void *      reallocate      (void * pMemory, size_t NewSize) override;
+
+private:
+    bool        Present = false;
+
+}; // c_SpiRam
+
+extern c_SpiRam SpiRam;
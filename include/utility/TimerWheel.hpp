@@ -0,0 +1,101 @@
+#pragma once
+/*
+* TimerWheel.hpp - Deadline scheduler for the jobs run by the main loop
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   The subsystems add their periodic work as jobs while setup() runs. A
+*   job returns the number of ms until it wants to run again, or
+*   TIMER_WHEEL_STOP to wait until it is scheduled. loop() runs the jobs
+*   that are due and then sleeps until the next deadline.
+*
+*   The wheel has one slot per ms. A job sits in the slot its deadline
+*   falls in and is passed over until the wheel comes round to the right
+*   revolution. Run only visits the slots of the ms that went by since the
+*   previous call.
+*
+*   Add, Run and Sleep belong to the main task. Schedule and Cancel may be
+*   called from any task, they leave a request that the next Run applies
+*   and wake the main task. The ESP8266 cannot be woken early, the sleep
+*   is never longer than TIMER_WHEEL_MAX_SLEEP_MS.
+*
+*   Every run is timed. A run that takes longer than the budget of its
+*   job is counted, and logged when it is also the longest so far. A
+*   budget of 0 is never overrun.
+*/
+
+#include "ESPixelStick.h"
+
+#define TIMER_WHEEL_NUM_SLOTS       128     // must be a power of two
+#define TIMER_WHEEL_MAX_JOBS        16
+#define TIMER_WHEEL_MAX_SLEEP_MS    100
+#define TIMER_WHEEL_STOP            uint32_t(-1)
+#define TIMER_WHEEL_NO_JOB          uint8_t(-1)
+
+typedef uint32_t (*TimerWheelJob_t) (void * pContext);  ///< returns the ms until the next run
+
+class c_TimerWheel
+{
+public:
+    typedef uint8_t JobId_t;
+
+    c_TimerWheel ();
+    virtual ~c_TimerWheel ();
+
+    void        Begin           ();
+    JobId_t     Add             (const __FlashStringHelper * Name, TimerWheelJob_t Job, void * pContext, uint32_t FirstRunMs, uint32_t BudgetUs);
+    void        Schedule        (JobId_t JobId, uint32_t DelayMs);
+    void        Cancel          (JobId_t JobId) { Schedule (JobId, TIMER_WHEEL_STOP); }
+    uint32_t    Run             ();
+    void        Sleep           (uint32_t DelayMs);
+    void        Wake            ();
+    void        GetStatus       (JsonObject & jsonStatus);
+    void        GetDriverName   (String & Name) { Name = F ("Sched"); }
+
+private:
+    struct Job_t
+    {
+        const __FlashStringHelper * Name;
+        TimerWheelJob_t     Job;
+        void *              pContext;
+        uint32_t            BudgetUs;
+        uint32_t            DeadlineMs;
+        JobId_t             Next;
+        bool                Armed;
+        volatile uint32_t   RequestedDelayMs;
+        volatile bool       Requested;
+        uint32_t            Runs;
+        uint32_t            Overruns;
+        uint32_t            MaxUs;
+        uint64_t            TotalUs;
+    };
+
+    void        Insert          (JobId_t JobId, uint32_t DeadlineMs);
+    void        Remove          (JobId_t JobId);
+    void        ApplyRequests   ();
+    void        RunJob          (JobId_t JobId);
+
+    Job_t               Jobs[TIMER_WHEEL_MAX_JOBS];
+    uint32_t            NumJobs = 0;
+    JobId_t             Slots[TIMER_WHEEL_NUM_SLOTS];
+    uint32_t            CurrentMs = 0;
+    volatile bool       RequestPending = false;
+#ifdef ARDUINO_ARCH_ESP32
+    TaskHandle_t        MainTaskHandle = nullptr;
+#endif // def ARDUINO_ARCH_ESP32
+
+}; // c_TimerWheel
+
+extern c_TimerWheel TimerWheel;
@@ -48,6 +48,8 @@ const CN_PROGMEM char CN_cfgver                   [] = "cfgver";
 const CN_PROGMEM char CN_channels                 [] = "channels";
 const CN_PROGMEM char CN_clean                    [] = "clean";
 const CN_PROGMEM char CN_clock_pin                [] = "clock_pin";
+const CN_PROGMEM char CN_clone_of                 [] = "clone_of";
+const CN_PROGMEM char CN_clone_reverse            [] = "clone_reverse";
 const CN_PROGMEM char CN_cmd                      [] = "cmd";
 const CN_PROGMEM char CN_color                    [] = "color";
 const CN_PROGMEM char CN_color_order              [] = "color_order";
@@ -64,6 +66,7 @@ const CN_PROGMEM char CN_Default                  [] = "Default";
 const CN_PROGMEM char CN_device                   [] = "device";
 const CN_PROGMEM char CN_dhcp                     [] = "dhcp";
 const CN_PROGMEM char CN_Disabled                 [] = "Disabled";
+const CN_PROGMEM char CN_dither                   [] = "dither";
 const CN_PROGMEM char CN_dnsp                     [] = "dnsp";
 const CN_PROGMEM char CN_dnss                     [] = "dnss";
 const CN_PROGMEM char CN_DMX                      [] = "DMX";
@@ -120,6 +123,7 @@ const CN_PROGMEM char CN_gen_ser_hdr              [] = "gen_ser_hdr";
 const CN_PROGMEM char CN_gen_ser_ftr              [] = "gen_ser_ftr";
 const CN_PROGMEM char CN_gid                      [] = "gid";
 const CN_PROGMEM char CN_group_size               [] = "group_size";
+const CN_PROGMEM char CN_group_store              [] = "group_store";
 const CN_PROGMEM char CN_groups                   [] = "groups";
 const CN_PROGMEM char CN_GS8208                   [] = "GS8208";
 const CN_PROGMEM char CN_Heap_colon               [] = "Heap: ";
@@ -137,6 +141,8 @@ const CN_PROGMEM char CN_ip                       [] = "ip";
 const CN_PROGMEM char CN_input                    [] = "input";
 const CN_PROGMEM char CN_input_config             [] = "input_config";
 const CN_PROGMEM char CN_last_clientIP            [] = "last_clientIP";
+const CN_PROGMEM char CN_level                    [] = "level";
+const CN_PROGMEM char CN_log                      [] = "log";
 const CN_PROGMEM char CN_long                     [] = "long";
 const CN_PROGMEM char CN_lwt                      [] = "lwt";
 const CN_PROGMEM char CN_mac                      [] = "mac";
@@ -146,6 +152,7 @@ const CN_PROGMEM char CN_mdio_pin                 [] = "mdio_pin";
 const CN_PROGMEM char CN_Max                      [] = "Max";
 const CN_PROGMEM char CN_MaxChannels              [] = "MaxChannels";
 const CN_PROGMEM char CN_Min                      [] = "Min";
+const CN_PROGMEM char CN_minframetime             [] = "minframetime";
 const CN_PROGMEM char CN_minussigns               [] = "-----";
 const CN_PROGMEM char CN_mirror                   [] = "mirror";
 const CN_PROGMEM char CN_miso_pin                 [] = "miso_pin";
@@ -213,12 +220,14 @@ const CN_PROGMEM char CN_speed                    [] = "speed";
 const CN_PROGMEM char CN_ssid                     [] = "ssid";
 const CN_PROGMEM char CN_sta_timeout              [] = "sta_timeout";
 const CN_PROGMEM char CN_stars                    [] = "***";
+const CN_PROGMEM char CN_startcolor               [] = "startcolor";
 const CN_PROGMEM char CN_state                    [] = "state";
 const CN_PROGMEM char CN_status                   [] = "status";
 const CN_PROGMEM char CN_status_name              [] = "status_name";
 const CN_PROGMEM char CN_StayInApMode             [] = "StayInApMode";
 const CN_PROGMEM char CN_subnet                   [] = "subnet";
 const CN_PROGMEM char CN_SyncOffset               [] = "SyncOffset";
+const CN_PROGMEM char CN_syslog                   [] = "syslog";
 const CN_PROGMEM char CN_system                   [] = "system";
 const CN_PROGMEM char CN_textSLASHplain           [] = "text/plain";
 const CN_PROGMEM char CN_time                     [] = "time";
@@ -252,6 +261,8 @@ const CN_PROGMEM char CN_version                  [] = "version";
 const CN_PROGMEM char CN_Version                  [] = "Version";
 const CN_PROGMEM char CN_w                        [] = "w";
 const CN_PROGMEM char CN_weus                     [] = "weus";
+const CN_PROGMEM char CN_white_extract            [] = "white_extract";
+const CN_PROGMEM char CN_white_temp               [] = "white_temp";
 const CN_PROGMEM char CN_wifi                     [] = "wifi";
 const CN_PROGMEM char CN_WiFiDrv                  [] = "WiFiDrv";
 const CN_PROGMEM char CN_WS2801                   [] = "WS2801";
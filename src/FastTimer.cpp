@@ -86,6 +86,8 @@ void FastTimer::CancelTimer()
 //-----------------------------------------------------------------------------
 uint32_t FastTimer::GetTimeRemaining()
 {
-    return (IsExpired()) ? 0 : uint32_t(EndTimeMS - (uint64_t(millis()) + uint64_t(OffsetMS)));
+    // does not use IsExpired(). Asking must not restart a continuous timer.
+    uint64_t now = uint64_t(millis()) + uint64_t(OffsetMS);
+    return (now >= EndTimeMS) ? 0 : uint32_t(EndTimeMS - now);
 
 } // GetTimeRemaining
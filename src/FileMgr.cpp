@@ -26,6 +26,11 @@
 #include "output/OutputMgr.hpp"
 #include "input/InputMgr.hpp"
 #include "UnzipFiles.hpp"
+#include "utility/EventTrace.hpp"
+#include "utility/TimerWheel.hpp"
+#include "utility/SpiRam.hpp"
+#include "utility/ConfigSnapshot.hpp"
+#include "utility/BootTimeline.hpp"
 
 SdFs sd;
 const int8_t DISABLE_CS_PIN = -1;
@@ -176,7 +181,7 @@ void c_FileMgr::Begin ()
         if (!LittleFS.begin ())
         {
             String msg = String(CN_stars) + F (" Flash file system did not initialize correctly ") + CN_stars;
-            RequestReboot(msg, 1000, true);
+            RequestReboot(msg, 40, true);
             break;
         }
 
@@ -192,30 +197,84 @@ void c_FileMgr::Begin ()
 
     } while (false);
 
+    TimerWheel.Add (F ("File"), [] (void * pThis) -> uint32_t { return ((c_FileMgr*)pThis)->Poll (); }, this, 0, 20000);
+
     // DEBUG_END;
 } // begin
 
 //-----------------------------------------------------------------------------
-void c_FileMgr::StartSdCard ()
+/*
+    Runs from Poll once setup() is done so the outputs and the network do
+    not wait for the card. Each call does one step and returns the ms
+    until the next one.
+*/
+uint32_t c_FileMgr::StartSdCard ()
 {
     // DEBUG_START;
 
-    SetSpiIoPins ();
-    #ifdef SUPPORT_UNZIP
-    // DEBUG_V(String("FoundZipFile: ") + String(FoundZipFile))
-    if(FoundZipFile)
+    uint32_t Response = 0;
+
+    switch (SdStartState)
     {
-        // DEBUG_V("Start Unzipping");
-        FeedWDT();
-        UnzipFiles * Unzipper = new UnzipFiles();
-        Unzipper->Run();
-        delete Unzipper;
-        String Reason = F("Requesting reboot after unzipping files");
-        RequestReboot(Reason, 1, true);
-    }
-    #endif // def SUPPORT_UNZIP
+        case SdStart_PowerOff:
+        {
+            #ifdef DEFAULT_SD_POWER_PIN
+            pinMode(sd_pwr_pin, OUTPUT);
+            digitalWrite(sd_pwr_pin, !sd_pwr_on);
+            Response = sd_pwr_dly;
+            #endif // def DEFAULT_SD_POWER_PIN
+            SdStartState = SdStart_Mount;
+            break;
+        }
+
+        case SdStart_Mount:
+        {
+            #ifdef DEFAULT_SD_POWER_PIN
+            digitalWrite(sd_pwr_pin, sd_pwr_on);
+            #endif // def DEFAULT_SD_POWER_PIN
+            SetSpiIoPins ();
+            BootTimeline.Mark (F ("SD card"));
+            SdStartState = SdStart_BuildFseqList;
+            break;
+        }
+
+        case SdStart_BuildFseqList:
+        {
+            BuildFseqList(true);
+            BootTimeline.Mark (F ("FSEQ list"));
+            SdStartState = SdStart_Idle;
+
+            // the users of the card that started before it was mounted
+            NetworkMgr.ReadSdConfig ();
+            UpdateFtp ();
+
+            #ifdef SUPPORT_UNZIP
+            // DEBUG_V(String("FoundZipFile: ") + String(FoundZipFile))
+            if(FoundZipFile)
+            {
+                // DEBUG_V("Start Unzipping");
+                FeedWDT();
+                UnzipFiles * Unzipper = new UnzipFiles();
+                Unzipper->Run();
+                delete Unzipper;
+                String Reason = F("Requesting reboot after unzipping files");
+                RequestReboot(Reason, 0, true);
+            }
+            #endif // def SUPPORT_UNZIP
+            break;
+        }
+
+        default:
+        {
+            SdStartState = SdStart_Idle;
+            Response = TIMER_WHEEL_MAX_SLEEP_MS;
+            break;
+        }
+    } // switch SdStartState
 
     // DEBUG_END;
+    return Response;
+
 } // StartSdCard
 
 //-----------------------------------------------------------------------------
@@ -257,17 +316,25 @@ void c_FileMgr::NetworkStateChanged (bool NewState)
 } // NetworkStateChanged
 
 //-----------------------------------------------------------------------------
-void c_FileMgr::Poll()
+uint32_t c_FileMgr::Poll()
  {
     // xDEBUG_START;
+    // the FTP server polls its sockets and the SD card is started here after boot
+    uint32_t Response = TIMER_WHEEL_MAX_SLEEP_MS;
+    if (SdStart_Idle != SdStartState)
+    {
+        Response = StartSdCard ();
+    }
 #ifdef SUPPORT_FTP
     if(FtpEnabled)
     {
         FeedWDT();
         ftpSrv.handleFTP();
+        Response = min (Response, uint32_t (10));
     }
 #endif // def SUPPORT_FTP
     // xDEBUG_END;
+    return Response;
  } // Poll
 
 //-----------------------------------------------------------------------------
@@ -323,14 +390,15 @@ bool c_FileMgr::SetConfig (JsonObject & json)
     if(IsBooting)
     {
         // DEBUG_V("We are booting");
-        StartSdCard ();
+        // Poll mounts the card once setup() is done
+        SdStartState = SdStart_PowerOff;
         SpiConfigChanged = false;
     }
 
     else if (SpiConfigChanged)
     {
         String msg = "SD Card gpio change requires reboot";
-        RequestReboot(msg,1000);
+        RequestReboot(msg,40);
     }
 
     if (ConfigChanged)
@@ -378,6 +446,8 @@ void c_FileMgr::GetStatus (JsonObject& json)
     json[F ("size")] = LittleFS.totalBytes ();
     json[F ("used")] = LittleFS.usedBytes ();
 #endif // def ARDUINO_ARCH_ESP32
+    ConfigSnapshot.GetStatus (json);
+    BootTimeline.GetStatus (json);
 
     // DEBUG_END;
 
@@ -428,7 +498,6 @@ void c_FileMgr::SetSpiIoPins ()
 
     SdCardInstalled = true;
     SetSdSpeed();
-    BuildFseqList(true);
 
 #elif defined (SUPPORT_SD) || defined(SUPPORT_SD_MMC)
     if (SdCardInstalled)
@@ -436,9 +505,6 @@ void c_FileMgr::SetSpiIoPins ()
         // DEBUG_V("Terminate current SD session");
         ESP_SD.end ();
     }
-    #ifdef DEFAULT_SD_POWER_PIN
-    PowerCycleSdCard();
-    #endif // def DEFAULT_SD_POWER_PIN
 
     FsDateTime::setCallback(dateTime);
 #ifdef ARDUINO_ARCH_ESP32
@@ -526,10 +592,6 @@ void c_FileMgr::SetSpiIoPins ()
             DescribeSdCardToUser ();
             // DEBUG_V();
         }
-
-        // DEBUG_V();
-        BuildFseqList(true);
-        // DEBUG_V();
     }
 #ifdef ARDUINO_ARCH_ESP32
     catch (const std::exception &e)
@@ -650,6 +712,7 @@ void c_FileMgr::DeleteFlashFile (String FileName)
     ConnrectFilename(FileName);
 
     if(LittleFS.exists(FileName)) { LittleFS.remove (FileName); }
+    DeleteConfigSnapshot (FileName);
 
     if(!FileName.equals(CN_fseqfilelist))
     {
@@ -672,6 +735,7 @@ void c_FileMgr::RenameFlashFile (String OldName, String NewName)
      // DEBUG_V(String("NewName: ") + NewName);
 
     DeleteFlashFile(NewName);
+    DeleteConfigSnapshot (OldName);
     if(!LittleFS.rename(OldName, NewName))
     {
         logcon(String(CN_stars) + F("Could not rename '") + OldName + F("' to '") + NewName + F("'") + CN_stars);
@@ -750,6 +814,7 @@ bool c_FileMgr::LoadFlashFile (const String& FileName, DeserializationHandler Ha
         logcon(RawFileData);
 */
         // DEBUG_V();
+        uint32_t StartTimeUs = micros ();
         fs::File file = LittleFS.open (FileName.c_str (), CN_r);
         // DEBUG_V();
         if (!file)
@@ -758,12 +823,19 @@ bool c_FileMgr::LoadFlashFile (const String& FileName, DeserializationHandler Ha
             break;
         }
 
-        JsonDocument jsonDoc;
+        JsonDocument jsonDoc (&SpiRam);
         jsonDoc.to<JsonObject>();
 
-        // DEBUG_V ("Convert File to JSON document");
-        DeserializationError error = deserializeJson (jsonDoc, file);
+        // the binary copy saves parsing the text
+        DeserializationError error;
+        bool FromSnapshot = LoadConfigSnapshot (FileName, file.size (), uint32_t (file.getLastWrite ()), jsonDoc);
+        if (!FromSnapshot)
+        {
+            // DEBUG_V ("Convert File to JSON document");
+            error = deserializeJson (jsonDoc, file);
+        }
         file.close ();
+        uint32_t LoadTimeUs = micros () - StartTimeUs;
 
         // DEBUG_V ("Error Check");
         if (error)
@@ -778,7 +850,12 @@ bool c_FileMgr::LoadFlashFile (const String& FileName, DeserializationHandler Ha
         }
 
         // DEBUG_V ();
-        logcon (CfgFileMessagePrefix + String (F ("loaded.")));
+        ConfigSnapshot.CountLoad (FromSnapshot, LoadTimeUs);
+        logcon (CfgFileMessagePrefix + String (FromSnapshot ? F ("loaded from snapshot in ") : F ("loaded in ")) + String (LoadTimeUs) + F (" us."));
+        if (!FromSnapshot)
+        {
+            SaveConfigSnapshot (FileName, jsonDoc);
+        }
 
         // DEBUG_V ();
         Handler (jsonDoc);
@@ -793,6 +870,120 @@ bool c_FileMgr::LoadFlashFile (const String& FileName, DeserializationHandler Ha
 
 } // LoadFlashFile
 
+//-----------------------------------------------------------------------------
+bool c_FileMgr::LoadConfigSnapshot (const String & FileName, uint32_t JsonFileSize, uint32_t JsonFileTime, JsonDocument & Doc)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+    uint8_t * pData = nullptr;
+
+    do // once
+    {
+        if (!ConfigSnapshot.IsCached (FileName))
+        {
+            break;
+        }
+
+        fs::File file = LittleFS.open (ConfigSnapshot.GetFileName (FileName).c_str (), CN_r);
+        if (!file)
+        {
+            break;
+        }
+
+        size_t Length = file.size ();
+        pData = (uint8_t *)SpiRam.Malloc (Length);
+        if (nullptr != pData)
+        {
+            Length = file.read (pData, Length);
+        }
+        file.close ();
+
+        if (nullptr == pData)
+        {
+            break;
+        }
+
+        Response = ConfigSnapshot.Decode (pData, Length, JsonFileSize, JsonFileTime, Doc);
+
+    } while (false);
+
+    SpiRam.Free (pData);
+
+    // DEBUG_END;
+    return Response;
+
+} // LoadConfigSnapshot
+
+//-----------------------------------------------------------------------------
+void c_FileMgr::SaveConfigSnapshot (const String & FileName, JsonDocument & Doc)
+{
+    // DEBUG_START;
+
+    uint8_t * pData = nullptr;
+
+    do // once
+    {
+        if (!ConfigSnapshot.IsCached (FileName))
+        {
+            break;
+        }
+
+        // the copy is tied to the JSON file as it is on the flash now
+        fs::File file = LittleFS.open (FileName.c_str (), CN_r);
+        if (!file)
+        {
+            break;
+        }
+        uint32_t JsonFileSize = file.size ();
+        uint32_t JsonFileTime = uint32_t (file.getLastWrite ());
+        file.close ();
+
+        size_t Length;
+        pData = ConfigSnapshot.Encode (Doc, JsonFileSize, JsonFileTime, Length);
+        if (nullptr == pData)
+        {
+            DeleteConfigSnapshot (FileName);
+            break;
+        }
+
+        file = LittleFS.open (ConfigSnapshot.GetFileName (FileName).c_str (), CN_w);
+        if (!file)
+        {
+            break;
+        }
+        bool Written = (Length == file.write (pData, Length));
+        file.close ();
+
+        if (!Written)
+        {
+            DeleteConfigSnapshot (FileName);
+        }
+
+    } while (false);
+
+    SpiRam.Free (pData);
+
+    // DEBUG_END;
+} // SaveConfigSnapshot
+
+//-----------------------------------------------------------------------------
+void c_FileMgr::DeleteConfigSnapshot (const String & FileName)
+{
+    // DEBUG_START;
+
+    if (ConfigSnapshot.IsCached (FileName))
+    {
+        String SnapshotFileName = ConfigSnapshot.GetFileName (FileName);
+        if (LittleFS.exists (SnapshotFileName))
+        {
+            LittleFS.remove (SnapshotFileName);
+        }
+    }
+
+    // DEBUG_END;
+} // DeleteConfigSnapshot
+
 //-----------------------------------------------------------------------------
 bool c_FileMgr::SaveFlashFile (const String& FileName, String& FileData)
 {
@@ -823,6 +1014,7 @@ bool c_FileMgr::SaveFlashFile (const String& FileName, const char * FileData)
         file.seek (0, SeekSet);
         file.print (FileData);
         file.close ();
+        DeleteConfigSnapshot (FileName);
 
         file = LittleFS.open (FileName.c_str (), CN_r);
         logcon (CfgFileMessagePrefix + String (F ("saved ")) + String (file.size ()) + F (" bytes."));
@@ -868,6 +1060,12 @@ bool c_FileMgr::SaveFlashFile(const String &FileName, JsonDocument &FileData)
 
         file.close();
 
+        // keep the binary copy of a config file in step
+        if (ConfigSnapshot.IsCached (FileName) && FlashFileExists (ConfigSnapshot.GetFileName (FileName)))
+        {
+            SaveConfigSnapshot (FileName, FileData);
+        }
+
         logcon(CfgFileMessagePrefix + String(F("saved ")) + String(NumBytesSaved) + F(" bytes."));
 
         Response = true;
@@ -917,6 +1115,7 @@ bool c_FileMgr::SaveFlashFile(const String & FileName, uint32_t index, uint8_t *
         // DEBUG_V("");
 
         file.close();
+        DeleteConfigSnapshot (FileName);
 
         logcon(CfgFileMessagePrefix + String(F("saved ")) + String(NumBytesSaved) + F(" bytes."));
 
@@ -1586,6 +1785,7 @@ uint64_t c_FileMgr::ReadSdFile (const FileId& FileHandle, byte* FileData, uint64
         uint64_t ActualBytesToRead = min(NumBytesToRead, BytesRemaining);
         // DEBUG_V(String("   BytesRemaining: ") + String(BytesRemaining));
         // DEBUG_V(String("ActualBytesToRead: ") + String(ActualBytesToRead));
+        EVENT_TRACE(SdReadStart, 0, 0, ActualBytesToRead);
         LockSd();
         FileList[FileListIndex].fsFile.seek(StartingPosition);
         #ifdef SIMULATE_SD
@@ -1594,6 +1794,7 @@ uint64_t c_FileMgr::ReadSdFile (const FileId& FileHandle, byte* FileData, uint64
         response = FileList[FileListIndex].fsFile.readBytes(FileData, ActualBytesToRead);
         #endif // def SIMULATE_SD
         UnLockSd();
+        EVENT_TRACE(SdReadEnd, 0, 0, response);
         // DEBUG_V(String("         response: ") + String64(response));
     }
     else
@@ -1903,7 +2104,7 @@ void c_FileMgr::BuildFseqList(bool DisplayFileNames)
 
         FeedWDT();
 
-        JsonDocument jsonDoc;
+        JsonDocument jsonDoc (&SpiRam);
         jsonDoc.to<JsonObject>();
 
         JsonWrite(jsonDoc, "totalBytes", SdCardSize);
@@ -2217,7 +2418,7 @@ bool c_FileMgr::handleFileUpload (
     bool response = false;
 
     // try to keep a reboot from causing a corrupted file
-    // DelayReboot(10000);
+    // DelayReboot(400);
 
     // DEBUG_V (String ("filename: ") + filename);
     // DEBUG_V (String ("   index: ") + String (index));
@@ -2320,7 +2521,7 @@ bool c_FileMgr::handleFileUpload (
         if(IsCompressed(fsUploadFileName))
         {
             // String reason = F("Reboot after receiving a compressed file");
-            // RequestReboot(reason, 100000);
+            // RequestReboot(reason, 4000);
         }
 
         fsUploadFileName.clear();
@@ -2384,7 +2585,7 @@ void c_FileMgr::BuildDefaultFseqList ()
 {
     // DEBUG_START;
 
-    JsonDocument jsonDoc;
+    JsonDocument jsonDoc (&SpiRam);
     jsonDoc.to<JsonObject>();
     JsonWrite(jsonDoc, "SdCardPresent", false);
     JsonWrite(jsonDoc, "totalBytes", 0);
@@ -2512,20 +2713,5 @@ void c_FileMgr::GetSdInfo(SdInfo & Response)
 
 } // GetSdInfo
 
-#ifdef DEFAULT_SD_POWER_PIN
-//-----------------------------------------------------------------------------
-void c_FileMgr::PowerCycleSdCard()
-{
-    // DEBUG_START;
-
-    pinMode(sd_pwr_pin, OUTPUT);
-    digitalWrite(sd_pwr_pin, !sd_pwr_on);
-    delay(sd_pwr_dly);
-    digitalWrite(sd_pwr_pin, sd_pwr_on);
-
-    // DEBUG_END;
-}
-#endif // def DEFAULT_SD_POWER_PIN
-
 // create a global instance of the File Manager
 c_FileMgr FileMgr;
@@ -23,6 +23,12 @@
 #include "input/InputMgr.hpp"
 #include "service/FPPDiscovery.h"
 #include "network/NetworkMgr.hpp"
+#include "utility/DebugCounters.hpp"
+#include "utility/EventTrace.hpp"
+#include "utility/CpuLoad.hpp"
+#include "utility/TimerWheel.hpp"
+#include "utility/AsyncLog.hpp"
+#include "utility/SpiRam.hpp"
 #ifdef ARDUINO_ARCH_ESP8266
 #   include <ESPAsyncTCP.h>
 #endif // def ARDUINO_ARCH_ESP8266
@@ -111,6 +117,8 @@ void c_WebMgr::Begin (config_t* /* NewConfig */)
             init();
         }
 
+        TimerWheel.Add (F ("Web"), [] (void * pThis) -> uint32_t { return ((c_WebMgr*)pThis)->Process (); }, this, 0, 5000);
+
     } while (false);
 
     // DEBUG_END;
@@ -162,6 +170,18 @@ void c_WebMgr::init ()
             ProcessHeapRequest (request);
         });
 
+        // Debug counter handler
+    	webServer.on ("/counters", HTTP_GET | HTTP_OPTIONS, [this](AsyncWebServerRequest* request)
+        {
+            ProcessCountersRequest (request);
+        });
+
+        // Event trace. GET downloads the trace, POST changes the trace settings
+    	webServer.on ("/trace", HTTP_GET | HTTP_POST | HTTP_OPTIONS, [this](AsyncWebServerRequest* request)
+        {
+            ProcessTraceRequest (request);
+        });
+
     	webServer.on ("/XJ", HTTP_POST | HTTP_GET | HTTP_OPTIONS, [this](AsyncWebServerRequest* request)
         {
             ProcessXJRequest (request);
@@ -204,7 +224,7 @@ void c_WebMgr::init ()
                 request->send (200, CN_applicationSLASHjson, F("{\"status\":\"Rebooting\"}"));
 
                 String Reason = F("Browser X6 Reboot requested.");
-                RequestReboot(Reason, 100000);
+                RequestReboot(Reason, 4000);
             }
         });
 
@@ -227,7 +247,7 @@ void c_WebMgr::init ()
                 request->send (200, CN_applicationSLASHjson, F("{\"status\":\"Rebooting\"}"));
                 // DEBUG_V ("");
                 String Reason = F("Browser requested Reboot");
-                RequestReboot(Reason, 100000);;
+                RequestReboot(Reason, 4000);;
             }
         });
 
@@ -280,6 +300,7 @@ void c_WebMgr::init ()
                 // DEBUG_V(String("url: ") + request->url ());
                 InputMgr.ClearStatistics();
                 OutputMgr.ClearStatistics();
+                c_DebugCounter::ClearAll();
 
                 request->send (200, CN_textSLASHplain);
             }
@@ -406,7 +427,7 @@ void c_WebMgr::init ()
                     if(RequestReadConfigFile(RequestFileName))
                     {
                         request->send (200, CN_applicationSLASHjson, F("{\"status\":\"XFER Complete\"}"));
-                        DelayReboot(10000);
+                        DelayReboot(400);
                     }
                     else
                     {
@@ -431,7 +452,7 @@ void c_WebMgr::init ()
                 // DEBUG_V(String("  sum: ") + String(index + len));
                 // DEBUG_V(String(" file: ") + filename);
                 // DEBUG_V(String("final: ") + String(final));
-                DelayReboot(10000);
+                DelayReboot(400);
                 if(0 == index)
                 {
                     // DEBUG_V("Deleting config file.");
@@ -459,7 +480,7 @@ void c_WebMgr::init ()
             {
                 // DEBUG_V("Save Data Chunk - Start");
                 String UploadFileName = request->url().substring(5);
-                DelayReboot(10000);
+                DelayReboot(400);
 
                 // DEBUG_V(String("  url: ") + request->url());
                 // DEBUG_V(String("  len: ") + String(len));
@@ -510,7 +531,7 @@ void c_WebMgr::init ()
                     // DEBUG_V ("efupdate.hasError == false");
                     String Reason = F("EFU Update Success");
                     request->send (200, CN_applicationSLASHjson, F("{\"status\":\"EFU Update Success\"}"));
-                    RequestReboot(Reason, 100000);
+                    RequestReboot(Reason, 4000);
                 }
             },
             [](AsyncWebServerRequest* request, String filename, uint32_t index, uint8_t* data, uint32_t len, bool final)
@@ -732,7 +753,7 @@ void c_WebMgr::CreateAdminInfoFile ()
 {
     // DEBUG_START;
 
-    JsonDocument AdminJsonDoc;
+    JsonDocument AdminJsonDoc (&SpiRam);
     AdminJsonDoc.to<JsonObject>();
     JsonObject jsonAdmin = AdminJsonDoc[F ("admin")].to<JsonObject> ();
 
@@ -765,13 +786,21 @@ void c_WebMgr::ProcessXJRequest (AsyncWebServerRequest* client)
 {
     // DEBUG_START;
 
+    // selftest=<seconds> starts the output self test. selftest=0 stops it
+    const AsyncWebParameter * pSelfTest = client->hasParam(F("selftest"), true) ? client->getParam(F("selftest"), true) : client->getParam(F("selftest"));
+    if(pSelfTest)
+    {
+        OutputMgr.ScheduleSelfTest (uint32_t(pSelfTest->value().toInt()) * 1000);
+    }
+
     // WebJsonDoc.clear ();
-    JsonDocument WebJsonDoc;
+    JsonDocument WebJsonDoc (&SpiRam);
     WebJsonDoc.to<JsonObject>();
     JsonObject status = WebJsonDoc[(char*)CN_status].to<JsonObject> ();
     JsonObject system = status[(char*)CN_system].to<JsonObject> ();
 
     JsonWrite(system, F ("freeheap"), ESP.getFreeHeap ());
+    SpiRam.GetStatus (system);
     JsonWrite(system, F ("uptime"), millis ());
     JsonWrite(system, F ("currenttime"), now ());
     JsonWrite(system, F ("SDinstalled"), FileMgr.SdCardIsInstalled ());
@@ -802,6 +831,17 @@ void c_WebMgr::ProcessXJRequest (AsyncWebServerRequest* client)
     // DEBUG_V ("FPPDiscovery.GetStatus");
     FPPDiscovery.GetStatus (system);
 
+    // DEBUG_V ("CpuLoad.GetStatus");
+    // idle time and per task load since the previous request
+    CpuLoad.GetStatus (system);
+
+    // DEBUG_V ("TimerWheel.GetStatus");
+    // run time of the main loop jobs
+    TimerWheel.GetStatus (system);
+
+    // DEBUG_V ("AsyncLog.GetStatus");
+    AsyncLog.GetStatus (system);
+
     // DEBUG_V ("InputMgr.GetStatus");
     // Ask Input Stats
     InputMgr.GetStatus (status);
@@ -831,7 +871,7 @@ void c_WebMgr::ProcessHeapRequest (AsyncWebServerRequest* client)
     // DEBUG_START;
 
     // WebJsonDoc.clear ();
-    JsonDocument WebJsonDoc;
+    JsonDocument WebJsonDoc (&SpiRam);
     WebJsonDoc.to<JsonObject>();
     JsonObject status = WebJsonDoc[(char*)CN_Heap_colon].to<JsonObject> ();
     // DEBUG_V();
@@ -867,6 +907,87 @@ void c_WebMgr::ProcessHeapRequest (AsyncWebServerRequest* client)
 
 } // ProcessXJRequest
 
+//-----------------------------------------------------------------------------
+void c_WebMgr::ProcessCountersRequest (AsyncWebServerRequest* client)
+{
+    // DEBUG_START;
+
+    if(HTTP_OPTIONS == client->method())
+    {
+        client->send (200);
+    }
+    else
+    {
+        JsonDocument WebJsonDoc (&SpiRam);
+        JsonObject status = WebJsonDoc.to<JsonObject>();
+        c_DebugCounter::GetStatus (status);
+
+        String Result;
+        serializeJson(WebJsonDoc, Result);
+        client->send (200, CN_applicationSLASHjson, Result);
+    }
+
+    // DEBUG_END;
+
+} // ProcessCountersRequest
+
+//-----------------------------------------------------------------------------
+void c_WebMgr::ProcessTraceRequest (AsyncWebServerRequest* client)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if(HTTP_OPTIONS == client->method())
+        {
+            client->send (200);
+            break;
+        }
+
+        if(HTTP_GET == client->method())
+        {
+            EventTrace.BeginExport ();
+            AsyncWebServerResponse *response = client->beginChunkedResponse(CN_applicationSLASHjson,
+                [](uint8_t *buffer, size_t MaxChunkLen, size_t index) -> size_t
+                {
+                    return EventTrace.Export (buffer, MaxChunkLen);
+                });
+            response->addHeader(F("Content-Disposition"), F("attachment; filename=\"trace.json\""));
+            // resume tracing even if the client goes away part way through the download
+            client->onDisconnect ([]()
+                {
+                    EventTrace.EndExport ();
+                });
+            client->send(response);
+            break;
+        }
+
+        // POST: enable=0|1 turns tracing on or off. clear empties the ring
+        if(client->hasParam(F("clear"), true) || client->hasParam(F("clear")))
+        {
+            EventTrace.Clear ();
+        }
+
+        const AsyncWebParameter * pEnable = client->hasParam(F("enable"), true) ? client->getParam(F("enable"), true) : client->getParam(F("enable"));
+        if(pEnable)
+        {
+            EventTrace.SetEnabled (pEnable->value().equals(F("1")) || pEnable->value().equalsIgnoreCase(F("true")));
+        }
+
+        JsonDocument WebJsonDoc (&SpiRam);
+        JsonObject status = WebJsonDoc.to<JsonObject>();
+        EventTrace.GetStatus (status);
+
+        String Result;
+        serializeJson(WebJsonDoc, Result);
+        client->send (200, CN_applicationSLASHjson, Result);
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // ProcessTraceRequest
+
 //-----------------------------------------------------------------------------
 void c_WebMgr::ProcessSetTimeRequest (time_t EpochTime)
 {
@@ -971,7 +1092,7 @@ void c_WebMgr::FirmwareUpload (AsyncWebServerRequest* request,
                 String ErrorMsg;
                 WebMgr.efupdate.getError (ErrorMsg);
                 request->send (500, CN_applicationSLASHjson, String(F("{\"status\":\"Update Error: ")) + ErrorMsg + F("\"}"));
-                RequestReboot(ErrorMsg, 100000);
+                RequestReboot(ErrorMsg, 4000);
                 break;
             }
         }
@@ -988,7 +1109,7 @@ void c_WebMgr::FirmwareUpload (AsyncWebServerRequest* request,
             String ErrorMsg;
             WebMgr.efupdate.getError (ErrorMsg);
             request->send (500, CN_applicationSLASHjson, String(F("{\"status\":\"Update Error: ")) + ErrorMsg + F("\"}"));
-            RequestReboot(ErrorMsg, 100000);
+            RequestReboot(ErrorMsg, 4000);
             break;
         }
         // DEBUG_V ("No EFUpdate Error");
@@ -998,7 +1119,7 @@ void c_WebMgr::FirmwareUpload (AsyncWebServerRequest* request,
             request->send (200, CN_applicationSLASHjson, F("{\"status\":\"Update Finished\""));
             efupdate.end ();
             String Reason = (F ("EFU Upload Finished. Rebooting"));
-            RequestReboot(Reason, 100000);
+            RequestReboot(Reason, 4000);
         }
 
     } while (false);
@@ -1009,19 +1130,23 @@ void c_WebMgr::FirmwareUpload (AsyncWebServerRequest* request,
 
 //-----------------------------------------------------------------------------
 /*
- * This function is called as part of the Arduino "loop" and does things that need
+ * This function is run by the main loop timer wheel and does things that need
  * periodic poking.
  *
  */
-void c_WebMgr::Process ()
+uint32_t c_WebMgr::Process ()
 {
+    // Alexa discovery is polled. Nothing else here needs to run
+    uint32_t Response = TIMER_WHEEL_MAX_SLEEP_MS;
     if(HasBeenInitialized)
     {
         if (true == IsAlexaCallbackValid())
         {
         	espalexa.loop ();
+            Response = 10;
         }
     }
+    return Response;
 } // Process
 
 //-----------------------------------------------------------------------------
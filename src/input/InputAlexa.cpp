@@ -113,6 +113,22 @@ void c_InputAlexa::Process ()
 
 } // process
 
+//-----------------------------------------------------------------------------
+uint32_t c_InputAlexa::GetPollPeriodUs ()
+{
+    // DEBUG_START;
+
+    uint32_t Response = INPUT_POLL_NOT_NEEDED;
+    if (IsInputChannelActive && (nullptr != pEffectsEngine))
+    {
+        Response = pEffectsEngine->GetPollPeriodUs ();
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // GetPollPeriodUs
+
 //-----------------------------------------------------------------------------
 void c_InputAlexa::SetBufferInfo (uint32_t BufferSize)
 {
@@ -186,6 +202,9 @@ void c_InputAlexa::onMessage(EspalexaDevice * pDevice)
         pEffectsEngine->SetOperationalState (pDevice->getState ());
         pEffectsEngine->SetConfig (JsonConfig);
 
+        // the effect timer has been restarted
+        InputMgr.SignalWork ();
+
         // DEBUG_V ("");
 
     } while (false);
@@ -20,6 +20,8 @@
 #include "input/InputArtnet.hpp"
 #include "input/externalInput.h"
 #include "network/NetworkMgr.hpp"
+#include "utility/EventTrace.hpp"
+#include "utility/FrameLatency.hpp"
 
 //-----------------------------------------------------------------------------
 c_InputArtnet::c_InputArtnet (c_InputMgr::e_InputChannelIds NewInputChannelId,
@@ -54,10 +56,15 @@ void c_InputArtnet::Begin ()
 
         // DEBUG_V ("InputDataBufferSize: " + String(InputDataBufferSize));
 
+        if (nullptr == pArtnet)
+        {
+            CreateReceiver ();
+        }
+
         validateConfiguration ();
         // DEBUG_V ();
 
-        NetworkStateChanged (NetworkMgr.IsConnected (), false);
+        NetworkStateChanged (NetworkMgr.IsConnected ());
 
         // DEBUG_V ();
         HasBeenInitialized = true;
@@ -97,6 +104,7 @@ void c_InputArtnet::GetStatus (JsonObject & jsonStatus)
     JsonWrite(ArtnetStatus, CN_packet_errors, packet_errors);
     JsonWrite(ArtnetStatus, CN_last_clientIP, pArtnet->getRemoteIP().toString ());
     JsonWrite(ArtnetStatus, CN_PollCounter,   PollCounter);
+    GetRebindStatus (ArtnetStatus);
 
     JsonArray ArtnetUniverseStatus = ArtnetStatus[(char*)CN_channels].to<JsonArray> ();
 
@@ -139,6 +147,7 @@ void c_InputArtnet::onDmxFrame (uint16_t  CurrentUniverseId,
                                 IPAddress remoteIP)
 {
     // DEBUG_START;
+    uint32_t ArrivalTimeUs = micros ();
     if(!IsInputChannelActive)
     {}
     else if ((startUniverse <= CurrentUniverseId) && (LastUniverse >= CurrentUniverseId))
@@ -168,10 +177,12 @@ void c_InputArtnet::onDmxFrame (uint16_t  CurrentUniverseId,
         // DEBUG_V (String ("data[0]: ") + String (data[0], HEX));
 
         lastData = data[0];
+        EVENT_TRACE(PacketRx, GetInputChannelId (), CurrentUniverseId, CurrentUniverse.DestinationOffset);
         OutputMgr.WriteChannelData( CurrentUniverse.DestinationOffset,
                                  min(CurrentUniverse.BytesToCopy, length),
                                  &data[CurrentUniverse.SourceDataOffset]);
 
+        FrameLatency.DataArrived (GetInputChannelId (), ArrivalTimeUs);
         InputMgr.RestartBlankTimer (GetInputChannelId ());
     }
     else
@@ -252,7 +263,7 @@ void c_InputArtnet::SetBufferTranslation ()
 
     if (0 != BytesLeftToMap)
     {
-        logcon (String (F ("ERROR: Universe configuration is too small to fill output buffer. Outputs have been truncated.")));
+        logerr (String (F ("ERROR: Universe configuration is too small to fill output buffer. Outputs have been truncated.")));
     }
 
     // DEBUG_END;
@@ -280,33 +291,56 @@ bool c_InputArtnet::SetConfig (ArduinoJson::JsonObject& jsonConfig)
 static c_InputArtnet * fMe = nullptr;
 
 //-----------------------------------------------------------------------------
-// Subscribe to "n" universes, starting at "universe"
-void c_InputArtnet::SetUpArtnet ()
+void c_InputArtnet::CreateReceiver ()
 {
     // DEBUG_START;
 
-    if (nullptr == pArtnet)
-    {
-        // DEBUG_V ();
-        pArtnet = new(_Artnet) Artnet ();
-        pArtnet->begin ();
+    pArtnet = new(_Artnet) Artnet ();
 
-        byte broadcast[] = { 10, 0, 1, 255 };
-        pArtnet->setBroadcast (broadcast);
-        logcon (String (F ("Subscribed to broadcast")));
+    byte broadcast[] = { 10, 0, 1, 255 };
+    pArtnet->setBroadcast (broadcast);
 
-        // DEBUG_V ();
+    // DEBUG_V ();
 
-        fMe = this; // hate this
-        pArtnet->setArtDmxCallback ([](uint16_t UniverseId, uint16_t length, uint8_t sequence, uint8_t* data, IPAddress remoteIP)
+    fMe = this; // hate this
+    pArtnet->setArtDmxCallback ([](uint16_t UniverseId, uint16_t length, uint8_t sequence, uint8_t* data, IPAddress remoteIP)
+    {
+        if (fMe->EnterPacketCallback ())
         {
             fMe->onDmxFrame (UniverseId, length, sequence, data, remoteIP);
-        });
+            fMe->LeavePacketCallback ();
+        }
+    });
 
-        pArtnet->setArtPollCallback ([](IPAddress BroadcastIP)
+    pArtnet->setArtPollCallback ([](IPAddress BroadcastIP)
+    {
+        if (fMe->EnterPacketCallback ())
         {
             fMe->onDmxPoll (BroadcastIP);
-        });
+            fMe->LeavePacketCallback ();
+        }
+    });
+
+    // DEBUG_END;
+} // CreateReceiver
+
+//-----------------------------------------------------------------------------
+// Subscribe to "n" universes, starting at "universe"
+void c_InputArtnet::SetUpArtnet ()
+{
+    // DEBUG_START;
+
+    uint32_t StartTimeUs = micros ();
+
+    // Art-Net listens to every universe on one port. An open socket is left alone
+    if (!Listening)
+    {
+        // DEBUG_V ();
+        pArtnet->begin ();
+        Listening = true;
+        logcon (String (F ("Subscribed to broadcast")));
+
+        NetworkRecovered (StartTimeUs);
     }
     // DEBUG_V ();
 
@@ -317,6 +351,30 @@ void c_InputArtnet::SetUpArtnet ()
 
 } // SubscribeToBroadcastDomain
 
+//-----------------------------------------------------------------------------
+// The library cannot close its socket. Replacing it with an idle receiver does
+void c_InputArtnet::StopListening ()
+{
+    // DEBUG_START;
+
+    if (Listening)
+    {
+        // packets may still be arriving. Nothing can be in a callback while the receiver goes away
+        PausePacketCallbacks ();
+        pArtnet->setArtDmxCallback (nullptr);
+        pArtnet->setArtPollCallback (nullptr);
+
+        pArtnet->~Artnet ();
+        CreateReceiver ();
+        Listening = false;
+
+        // the new receiver has no socket until begin()
+        ResumePacketCallbacks ();
+    }
+
+    // DEBUG_END;
+} // StopListening
+
 //-----------------------------------------------------------------------------
 void c_InputArtnet::validateConfiguration ()
 {
@@ -369,22 +427,17 @@ void c_InputArtnet::NetworkStateChanged (bool IsConnected)
 {
     // DEBUG_START;
 
-    // NetworkStateChanged (IsConnected, true);
-    NetworkStateChanged (IsConnected, false);
-
-    // DEBUG_END;
-
-} // NetworkStateChanged
-
-//-----------------------------------------------------------------------------
-void c_InputArtnet::NetworkStateChanged (bool IsConnected, bool ReBootAllowed)
-{
-    // DEBUG_START;
-
     if (IsConnected)
     {
         SetUpArtnet ();
     }
+    else if (Listening)
+    {
+        // the outputs keep the last frame until the listener is back
+        logcon (F ("Network lost. Closing the listener"));
+        NetworkLost ();
+        StopListening ();
+    }
 
     // DEBUG_END;
 
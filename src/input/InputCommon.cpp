@@ -46,6 +46,112 @@ c_InputCommon::~c_InputCommon ()
 
 } // ~c_InputMgr
 
+//----------------------------------------------------------------------------
+void c_InputCommon::NetworkLost ()
+{
+    // DEBUG_START;
+
+    if (!NetworkIsLost)
+    {
+        NetworkIsLost     = true;
+        NetworkLostTimeMs = millis ();
+    }
+
+    // DEBUG_END;
+} // NetworkLost
+
+//----------------------------------------------------------------------------
+void c_InputCommon::NetworkRecovered (uint32_t RebindStartUs)
+{
+    // DEBUG_START;
+
+    LastRebindUs = micros () - RebindStartUs;
+
+    if (NetworkIsLost)
+    {
+        NetworkIsLost  = false;
+        LastRecoveryMs = millis () - NetworkLostTimeMs;
+        ++RebindCount;
+
+        logcon (String (F ("Listening again ")) + String (LastRecoveryMs) + F (" ms after the network was lost. Re-bind took ") + String (LastRebindUs) + F (" us"));
+    }
+
+    // DEBUG_END;
+} // NetworkRecovered
+
+//----------------------------------------------------------------------------
+void c_InputCommon::GetRebindStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    JsonObject jsonRebind = jsonStatus[F ("rebind")].to<JsonObject> ();
+    JsonWrite (jsonRebind, F ("count"),       RebindCount);
+    JsonWrite (jsonRebind, F ("recovery_ms"), LastRecoveryMs);
+    JsonWrite (jsonRebind, F ("rebind_us"),   LastRebindUs);
+
+    // DEBUG_END;
+} // GetRebindStatus
+
+//----------------------------------------------------------------------------
+/*
+    The packet callbacks run on the async UDP task. The receiver must not be
+    destroyed while one of them is running. Each side stores its own flag,
+    fences, then reads the other one, so at least one of them backs off.
+*/
+bool c_InputCommon::EnterPacketCallback ()
+{
+    // DEBUG_START;
+
+    bool Response = true;
+
+    __atomic_store_n (&PacketCallbackActive, true, __ATOMIC_RELAXED);
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+    if (__atomic_load_n (&PacketCallbacksPaused, __ATOMIC_RELAXED))
+    {
+        __atomic_store_n (&PacketCallbackActive, false, __ATOMIC_RELEASE);
+        Response = false;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // EnterPacketCallback
+
+//----------------------------------------------------------------------------
+void c_InputCommon::LeavePacketCallback ()
+{
+    // DEBUG_START;
+
+    __atomic_store_n (&PacketCallbackActive, false, __ATOMIC_RELEASE);
+
+    // DEBUG_END;
+} // LeavePacketCallback
+
+//----------------------------------------------------------------------------
+void c_InputCommon::PausePacketCallbacks ()
+{
+    // DEBUG_START;
+
+    __atomic_store_n (&PacketCallbacksPaused, true, __ATOMIC_RELAXED);
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+    while (__atomic_load_n (&PacketCallbackActive, __ATOMIC_ACQUIRE))
+    {
+        delay (1);
+    }
+
+    // DEBUG_END;
+} // PausePacketCallbacks
+
+//----------------------------------------------------------------------------
+void c_InputCommon::ResumePacketCallbacks ()
+{
+    // DEBUG_START;
+
+    __atomic_store_n (&PacketCallbacksPaused, false, __ATOMIC_RELEASE);
+
+    // DEBUG_END;
+} // ResumePacketCallbacks
+
 //----------------------------------------------------------------------------
  void  c_InputCommon::ClearStatistics (void)
  {
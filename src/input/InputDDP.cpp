@@ -19,6 +19,8 @@
 #include "input/InputDDP.h"
 #include "network/NetworkMgr.hpp"
 #include "service/FPPDiscovery.h"
+#include "utility/EventTrace.hpp"
+#include "utility/FrameLatency.hpp"
 #include <string.h>
 
 #ifdef ARDUINO_ARCH_ESP32
@@ -101,6 +103,7 @@ void c_InputDDP::GetStatus (JsonObject& jsonStatus)
     JsonWrite(ddpStatus, CN_errors,           stats.errors);
     JsonWrite(ddpStatus, CN_id,               InputChannelId);
     JsonWrite(ddpStatus, F("lasterror"),      lastError);
+    GetRebindStatus (ddpStatus);
 
     // DEBUG_END;
 
@@ -153,6 +156,7 @@ void c_InputDDP::NetworkStateChanged (bool IsConnected)
     if (IsConnected && !HasBeenInitialized)
     {
         // DEBUG_V ();
+        uint32_t StartTimeUs = micros ();
 
         if (udp->listen (DDP_PORT))
         {
@@ -162,6 +166,15 @@ void c_InputDDP::NetworkStateChanged (bool IsConnected)
         HasBeenInitialized = true;
 
         logcon (String (F ("Listening on port ")) + DDP_PORT);
+        NetworkRecovered (StartTimeUs);
+    }
+    else if (!IsConnected && HasBeenInitialized)
+    {
+        // the outputs keep the last frame until the listener is back
+        logcon (F ("Network lost. Closing the listener"));
+        NetworkLost ();
+        udp->close ();
+        HasBeenInitialized = false;
     }
 } // NetworkStateChanged
 
@@ -202,8 +215,12 @@ void c_InputDDP::ProcessReceivedUdpPacket(AsyncUDPPacket ReceivedPacket)
 
         PacketBuffer.ResponseAddress = ReceivedPacket.remoteIP ();
         PacketBuffer.ResponsePort = ReceivedPacket.remotePort ();
-        memcpy ((void*)&PacketBuffer.Packet, ReceivedPacket.data (), sizeof (PacketBuffer.Packet));
+        // a query is much shorter than the buffer. Do not read past the end of it
+        size_t PacketLength = min (ReceivedPacket.length (), sizeof (PacketBuffer.Packet));
+        memcpy ((void*)&PacketBuffer.Packet, ReceivedPacket.data (), PacketLength);
+        memset ((uint8_t*)&PacketBuffer.Packet + PacketLength, 0x00, sizeof (PacketBuffer.Packet) - PacketLength);
         PacketBuffer.PacketBufferStatus = PacketBufferStatus_t::BufferIsFilled;
+        InputMgr.SignalWork ();
 
     } while (false);
 
@@ -256,11 +273,30 @@ void c_InputDDP::Process ()
 
 } // Process
 
+//-----------------------------------------------------------------------------
+uint32_t c_InputDDP::GetPollPeriodUs ()
+{
+    // DEBUG_START;
+
+    // data packets are handled in the receive callback. Queries wait in the buffer
+    uint32_t Response = INPUT_POLL_NOT_NEEDED;
+    if (IsInputChannelActive && (PacketBuffer.PacketBufferStatus == PacketBufferStatus_t::BufferIsFilled))
+    {
+        Response = 0;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // GetPollPeriodUs
+
 //-----------------------------------------------------------------------------
 void c_InputDDP::ProcessReceivedData (DDP_packet_t & Packet)
 {
     // DEBUG_START;
 
+    uint32_t ArrivalTimeUs = micros ();
+
     do // once
     {
         DDP_Header_t & header = Packet.header;
@@ -297,8 +333,11 @@ void c_InputDDP::ProcessReceivedData (DDP_packet_t & Packet)
         byte* Data = (IsTime(header.flags1)) ? &((DDP_TimeCode_packet_t&)Packet).data[0] : &Packet.data[0];
         // DEBUG_V (String ("                Data: 0x") + String (uint32_t (Data), HEX));
         // DEBUG_V (String ("   InputBufferOffset: ") + String (InputBufferOffset));
+        // DDP has no universes. The sequence number (low nibble of flags2) is traced in its place
+        EVENT_TRACE(PacketRx, GetInputChannelId (), (header.flags2 & 0x0F), InputBufferOffset);
         OutputMgr.WriteChannelData(InputBufferOffset, AdjPacketDataLength, &Data[0]);
 
+        FrameLatency.DataArrived (GetInputChannelId (), ArrivalTimeUs);
         InputMgr.RestartBlankTimer (GetInputChannelId ());
 
     } while (false);
@@ -19,6 +19,8 @@
 
 #include "input/InputE131.hpp"
 #include "network/NetworkMgr.hpp"
+#include "utility/EventTrace.hpp"
+#include "utility/FrameLatency.hpp"
 
 //-----------------------------------------------------------------------------
 c_InputE131::c_InputE131 (c_InputMgr::e_InputChannelIds NewInputChannelId,
@@ -61,20 +63,13 @@ void c_InputE131::Begin ()
         // DEBUG_V ("InputDataBufferSize: " + String(InputDataBufferSize));
         if(nullptr == pE131)
         {
-            pE131 = new(&_e131[0]) ESPAsyncE131(0);
-            // DEBUG_V ("");
-            pE131->registerCallback ( (void*)this, [] (e131_packet_t* Packet, void * pThis)
-                {
-                    // DEBUG_V ("");
-                    ((c_InputE131*)pThis)->ProcessIncomingE131Data (Packet);
-                });
-            // DEBUG_V ("");
+            CreateReceiver ();
         }
 
         // DEBUG_V ("");
         validateConfiguration ();
 
-        NetworkStateChanged (NetworkMgr.IsConnected (), false);
+        NetworkStateChanged (NetworkMgr.IsConnected ());
 
         HasBeenInitialized = true;
         // DEBUG_V ("HasBeenInitialized: " + String(HasBeenInitialized));
@@ -125,6 +120,7 @@ void c_InputE131::GetStatus (JsonObject & jsonStatus)
     }
 
     JsonWrite(e131Status, CN_packet_errors, TotalErrors);
+    GetRebindStatus (e131Status);
 
     // DEBUG_END;
 
@@ -163,6 +159,7 @@ void c_InputE131::ProcessIncomingE131Data (e131_packet_t * packet)
 {
     // DEBUG_START;
 
+    uint32_t    ArrivalTimeUs = micros ();
     uint8_t   * E131Data;
     uint16_t    CurrentUniverseId;
 
@@ -201,6 +198,7 @@ void c_InputE131::ProcessIncomingE131Data (e131_packet_t * packet)
             ++CurrentUniverse.SequenceNumber;
 
             uint32_t NumBytesOfE131Data = uint32_t(ntohs (packet->property_value_count) - 1);
+            EVENT_TRACE(PacketRx, GetInputChannelId (), CurrentUniverseId, CurrentUniverse.DestinationOffset);
             OutputMgr.WriteChannelData(CurrentUniverse.DestinationOffset,
                                     min(CurrentUniverse.BytesToCopy, NumBytesOfE131Data),
                                     &E131Data[CurrentUniverse.SourceDataOffset]);
@@ -209,6 +207,7 @@ void c_InputE131::ProcessIncomingE131Data (e131_packet_t * packet)
                    &E131Data[CurrentUniverse.SourceDataOffset],
                    min(CurrentUniverse.BytesToCopy, NumBytesOfE131Data));
 */
+            FrameLatency.DataArrived (GetInputChannelId (), ArrivalTimeUs);
             InputMgr.RestartBlankTimer (GetInputChannelId ());
         }
         else
@@ -282,7 +281,7 @@ void c_InputE131::SetBufferTranslation ()
 
     if (0 != BytesLeftToMap)
     {
-        logcon (String (F ("ERROR: Universe configuration is too small to fill output buffer. Outputs have been truncated.")));
+        logerr (String (F ("ERROR: Universe configuration is too small to fill output buffer. Outputs have been truncated.")));
     }
 
     // DEBUG_END;
@@ -294,22 +293,19 @@ bool c_InputE131::SetConfig (ArduinoJson::JsonObject& jsonConfig)
 {
     // DEBUG_START;
 
-    ESPAsyncE131PortId OldPortId = PortId;
-
     setFromJSON (startUniverse,              jsonConfig, CN_universe);
     setFromJSON (ChannelsPerUniverse,        jsonConfig, CN_universe_limit);
     setFromJSON (FirstUniverseChannelOffset, jsonConfig, CN_universe_start);
     setFromJSON (PortId,                     jsonConfig, CN_port);
 
-    if ((OldPortId != PortId) && (ESPAsyncE131Initialized))
+    validateConfiguration ();
+
+    // move the listeners to the new port and multicast groups
+    if (ESPAsyncE131Initialized)
     {
-        // ask for a reboot.
-        String Reason = (String (F ("Requesting reboot on change of UDP port.")));
-        RequestReboot(Reason, 100000);
+        StartListening ();
     }
 
-    validateConfiguration ();
-
     // Update the config fields in case the validator changed them
     GetConfig (jsonConfig);
 
@@ -377,18 +373,76 @@ void c_InputE131::validateConfiguration ()
 } // validateConfiguration
 
 //-----------------------------------------------------------------------------
-void c_InputE131::NetworkStateChanged (bool IsConnected)
+void c_InputE131::CreateReceiver ()
 {
-    NetworkStateChanged (IsConnected, false);
-} // NetworkStateChanged
+    // DEBUG_START;
+
+    pE131 = new(&_e131[0]) ESPAsyncE131(0);
+    // DEBUG_V ("");
+    pE131->registerCallback ( (void*)this, [] (e131_packet_t* Packet, void * pThis)
+        {
+            // DEBUG_V ("");
+            c_InputE131 * pInput = (c_InputE131*)pThis;
+            if (pInput->EnterPacketCallback ())
+            {
+                pInput->ProcessIncomingE131Data (Packet);
+                pInput->LeavePacketCallback ();
+            }
+        });
+
+    // DEBUG_END;
+} // CreateReceiver
 
 //-----------------------------------------------------------------------------
-void c_InputE131::NetworkStateChanged (bool IsConnected, bool ReBootAllowed)
+/*
+    The library has no way to close its socket. Replacing the receiver with
+    an idle one closes the unicast and multicast listeners. The statistics
+    are carried over.
+*/
+void c_InputE131::StopListening ()
 {
     // DEBUG_START;
 
-    if (IsConnected)
+    if (ESPAsyncE131Initialized)
     {
+        // packets may still be arriving. Nothing can be in the callback while the receiver goes away
+        PausePacketCallbacks ();
+        pE131->registerCallback (nullptr, nullptr);
+
+        e131_stats_t Stats = pE131->stats;
+        pE131->~ESPAsyncE131 ();
+        CreateReceiver ();
+        pE131->stats = Stats;
+        ESPAsyncE131Initialized = false;
+
+        // the new receiver has no socket until begin()
+        ResumePacketCallbacks ();
+    }
+
+    // DEBUG_END;
+} // StopListening
+
+//-----------------------------------------------------------------------------
+void c_InputE131::StartListening ()
+{
+    // DEBUG_START;
+
+    uint32_t StartTimeUs = micros ();
+
+    do // once
+    {
+        if (ESPAsyncE131Initialized &&
+            (ListenPortId == PortId) &&
+            (ListenStartUniverse == startUniverse) &&
+            (ListenLastUniverse == LastUniverse))
+        {
+            // DEBUG_V ("already listening on the right port and groups");
+            break;
+        }
+
+        // a second begin() on an open receiver would leave the old socket behind
+        StopListening ();
+
         // Get on with business
         if (pE131->begin (e131_listen_t::E131_MULTICAST, PortId, startUniverse, LastUniverse - startUniverse + 1))
         {
@@ -396,7 +450,7 @@ void c_InputE131::NetworkStateChanged (bool IsConnected, bool ReBootAllowed)
         }
         else
         {
-            logcon (String (CN_stars) + F (" E1.31 MULTICAST INIT FAILED ") + CN_stars);
+            logerr (String (CN_stars) + F (" E1.31 MULTICAST INIT FAILED ") + CN_stars);
         }
 
         // DEBUG_V ("");
@@ -407,7 +461,7 @@ void c_InputE131::NetworkStateChanged (bool IsConnected, bool ReBootAllowed)
         }
         else
         {
-            logcon (CN_stars + String (F (" E1.31 UNICAST INIT FAILED ")) + CN_stars);
+            logerr (CN_stars + String (F (" E1.31 UNICAST INIT FAILED ")) + CN_stars);
         }
 
         logcon (String (F ("Listening for ")) + InputDataBufferSize +
@@ -416,13 +470,32 @@ void c_InputE131::NetworkStateChanged (bool IsConnected, bool ReBootAllowed)
                         F (" on port ") + PortId);
 
         ESPAsyncE131Initialized = true;
+        ListenPortId            = PortId;
+        ListenStartUniverse     = startUniverse;
+        ListenLastUniverse      = LastUniverse;
+
+        NetworkRecovered (StartTimeUs);
+
+    } while (false);
+
+    // DEBUG_END;
+} // StartListening
+
+//-----------------------------------------------------------------------------
+void c_InputE131::NetworkStateChanged (bool IsConnected)
+{
+    // DEBUG_START;
+
+    if (IsConnected)
+    {
+        StartListening ();
     }
-    else if (ReBootAllowed)
+    else if (ESPAsyncE131Initialized)
     {
-        // handle a disconnect
-        // E1.31 does not do this gracefully. A loss of connection needs a reboot
-        String Reason = (String (F ("Input requesting reboot on loss of WiFi connection.")));
-        RequestReboot(Reason, 100000);
+        // the outputs keep the last frame until the listeners are back
+        logcon (F ("Network lost. Closing the listeners"));
+        NetworkLost ();
+        StopListening ();
     }
 
     // DEBUG_END;
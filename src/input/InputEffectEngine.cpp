@@ -376,6 +376,53 @@ void c_InputEffectEngine::Process ()
 
 } // process
 
+//-----------------------------------------------------------------------------
+uint32_t c_InputEffectEngine::GetPollPeriodUs ()
+{
+    // DEBUG_START;
+
+    uint32_t Response = INPUT_POLL_NOT_NEEDED;
+
+    do // once
+    {
+        // same checks as Process()
+        if (!HasBeenInitialized || (0 == PixelCount))
+        {
+            break;
+        }
+
+        // time to the next step of the effect
+        uint32_t WaitMs = EffectDelayTimer.GetTimeRemaining ();
+
+        if (FlashInfo.Enable)
+        {
+            uint32_t FlashDelayMs = FlashInfo.delaytimer.GetTimeRemaining ();
+            if (FlashDelayMs)
+            {
+                WaitMs = min (WaitMs, FlashDelayMs);
+            }
+            else if (FlashInfo.durationtimer.GetTimeRemaining ())
+            {
+                // a flash redraws on every pass
+                WaitMs = min (WaitMs, uint32_t (FPP_TICKER_PERIOD_MS));
+            }
+            else
+            {
+                // set up the next flash
+                WaitMs = 0;
+            }
+        }
+
+        // a very long wait is cut short rather than mistaken for "not needed"
+        Response = uint32_t (min (uint64_t (WaitMs) * MicroSecondsInAmilliSecond, uint64_t (INPUT_POLL_NOT_NEEDED - 1)));
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // GetPollPeriodUs
+
 //-----------------------------------------------------------------------------
 void c_InputEffectEngine::Poll ()
 {
@@ -35,7 +35,7 @@
     } \
     else \
     { \
-        logcon("ERROR: Trying to start the player when it is already running"); \
+        logerr("ERROR: Trying to start the player when it is already running"); \
     } \
 }
 
@@ -50,7 +50,7 @@
     } \
     else \
     { \
-        logcon(F("ERROR: Trying to stop player when no player is running")); \
+        logerr(F("ERROR: Trying to stop player when no player is running")); \
     } \
 }
 
@@ -754,3 +754,23 @@ void c_InputFPPRemote::SetBlankTimerIsRunning (bool BlankTimerRunning)
 
     // DEBUG_END;
 } // SetBlankTimerIsRunning
+
+//-----------------------------------------------------------------------------
+uint32_t c_InputFPPRemote::GetPollPeriodUs ()
+{
+    // DEBUG_START;
+
+    uint32_t Response = c_InputCommon::GetPollPeriodUs ();
+
+    if (!IsIdle ())
+    {
+        // poll at twice the sequence frame rate so that we never skip a frame
+        uint32_t StepPollPeriodUs = pInputFPPRemotePlayItem->GetFrameStepTimeUs () / 2;
+        StepPollPeriodUs = max (uint32_t (MicroSecondsInAmilliSecond), StepPollPeriodUs);
+        Response = min (Response, StepPollPeriodUs);
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // GetPollPeriodUs
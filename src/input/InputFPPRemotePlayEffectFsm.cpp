@@ -21,6 +21,7 @@
 #include "input/InputFPPRemotePlayEffect.hpp"
 #include "service/FPPDiscovery.h"
 #include "utility/SaferStringConversion.hpp"
+#include "utility/SpiRam.hpp"
 
 //-----------------------------------------------------------------------------
 bool fsm_PlayEffect_state_Idle::Poll ()
@@ -55,7 +56,7 @@ void fsm_PlayEffect_state_Idle::Start (String & ConfigString, float )
     p_InputFPPRemotePlayEffect->PlayEffectTimer.StartTimer(1000 * p_InputFPPRemotePlayEffect->PlayDurationSec, false);
 
     // tell the effect engine what it is supposed to be doing
-    JsonDocument EffectConfig;
+    JsonDocument EffectConfig (&SpiRam);
     DeserializationError error = deserializeJson ((EffectConfig), (const String)ConfigString);
 
     // DEBUG_V ("Error Check");
@@ -22,6 +22,7 @@
 #include "service/FPPDiscovery.h"
 #include "service/fseq.h"
 #include "utility/SaferStringConversion.hpp"
+#include "utility/SpiRam.hpp"
 
 //-----------------------------------------------------------------------------
 c_InputFPPRemotePlayFile::c_InputFPPRemotePlayFile (c_InputMgr::e_InputChannelIds InputChannelId) :
@@ -292,7 +293,7 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
                 // only output the message once
                 SafeStrncpy(LastFailedPlayStatusMsg, (String(F("ParseFseqFile:: Could not open file: filename: '")) + FileControl[CurrentFile].FileName + "'").c_str(), sizeof(LastFailedPlayStatusMsg));
                 SafeStrncpy(LastFailedFilename, FileControl[CurrentFile].FileName, sizeof(LastFailedFilename));
-                logcon (LastFailedPlayStatusMsg);
+                logerr (LastFailedPlayStatusMsg);
             }
             else
             {
@@ -312,7 +313,7 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
         if (BytesRead != sizeof (fsqRawHeader))
         {
             SafeStrncpy(LastFailedPlayStatusMsg, FileControl[CurrentFile].FileName, sizeof(LastFailedFilename));
-            logcon (LastFailedPlayStatusMsg);
+            logerr (LastFailedPlayStatusMsg);
             // DEBUG_FILE_HANDLE (FileControl[CurrentFile].FileHandleForFileBeingPlayed);
             FileMgr.CloseSdFile(FileControl[CurrentFile].FileHandleForFileBeingPlayed);
             break;
@@ -354,7 +355,7 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
         if (fsqParsedHeader.majorVersion != 2 || fsqParsedHeader.compressionType != 0)
         {
             SafeStrncpy(LastFailedPlayStatusMsg, (String (F ("ParseFseqFile:: Could not start. ")) + FileControl[CurrentFile].FileName + F (" is not a v2 uncompressed sequence")).c_str(), sizeof(LastFailedFilename));
-            logcon (LastFailedPlayStatusMsg);
+            logerr (LastFailedPlayStatusMsg);
             // DEBUG_FILE_HANDLE (FileControl[CurrentFile].FileHandleForFileBeingPlayed);
             FileMgr.CloseSdFile(FileControl[CurrentFile].FileHandleForFileBeingPlayed);
             break;
@@ -369,13 +370,13 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
             SafeStrncpy(LastFailedPlayStatusMsg, (String (F ("ParseFseqFile:: Could not start: ")) + FileControl[CurrentFile].FileName +
                                       F (" File does not contain enough data to meet the Stated Channel Count * Number of Frames value. Need: ") +
                                       String (NeededDataSize) + F (", SD File Size: ") + String (ActualDataSize)).c_str(), sizeof(LastFailedPlayStatusMsg));
-            logcon (LastFailedPlayStatusMsg);
+            logerr (LastFailedPlayStatusMsg);
             // DEBUG_FILE_HANDLE (FileControl[CurrentFile].FileHandleForFileBeingPlayed);
             FileMgr.CloseSdFile(FileControl[CurrentFile].FileHandleForFileBeingPlayed);
             break;
         }
 
-        FileControl[CurrentFile].FrameStepTimeMS = max ((uint8_t)25, fsqParsedHeader.stepTime);
+        FileControl[CurrentFile].FrameStepTimeMS = max (uint32_t(FSEQ_MIN_FRAME_STEP_TIME_MS), uint32_t(fsqParsedHeader.stepTime));
         FileControl[CurrentFile].TotalNumberOfFramesInSequence = fsqParsedHeader.TotalNumberOfFramesInSequence;
 
         FileControl[CurrentFile].DataOffset = fsqParsedHeader.dataOffset;
@@ -387,7 +388,7 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
             if (MAX_NUM_SPARSE_RANGES < fsqParsedHeader.numSparseRanges)
             {
                 SafeStrncpy(LastFailedPlayStatusMsg, (String (F ("ParseFseqFile:: Could not start. ")) + FileControl[CurrentFile].FileName + F (" Too many sparse ranges defined in file header.")).c_str(), sizeof(LastFailedPlayStatusMsg));
-                logcon (LastFailedPlayStatusMsg);
+                logerr (LastFailedPlayStatusMsg);
                 // DEBUG_FILE_HANDLE (FileControl[CurrentFile].FileHandleForFileBeingPlayed);
                 FileMgr.CloseSdFile(FileControl[CurrentFile].FileHandleForFileBeingPlayed);
                 break;
@@ -435,7 +436,7 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
             if (0 == TotalChannels)
             {
                 SafeStrncpy(LastFailedPlayStatusMsg, (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + FileControl[CurrentFile].FileName + F (" No channels defined in Sparse Ranges.")).c_str(), sizeof(LastFailedPlayStatusMsg));
-                logcon (LastFailedPlayStatusMsg);
+                logerr (LastFailedPlayStatusMsg);
                 memset ((void*)&SparseRanges, 0x00, sizeof (SparseRanges));
                 SparseRanges[0].ChannelCount = fsqParsedHeader.channelCount;
             }
@@ -443,7 +444,7 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
             else if (TotalChannels > fsqParsedHeader.channelCount)
             {
                 SafeStrncpy(LastFailedPlayStatusMsg, (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + FileControl[CurrentFile].FileName + F (" Too many channels defined in Sparse Ranges.")).c_str(), sizeof(LastFailedPlayStatusMsg));
-                logcon (LastFailedPlayStatusMsg);
+                logerr (LastFailedPlayStatusMsg);
                 memset ((void*)&SparseRanges, 0x00, sizeof (SparseRanges));
                 SparseRanges[0].ChannelCount = fsqParsedHeader.channelCount;
             }
@@ -451,7 +452,7 @@ bool c_InputFPPRemotePlayFile::ParseFseqFile ()
             else if (LargestBlock > fsqParsedHeader.channelCount)
             {
                 SafeStrncpy(LastFailedPlayStatusMsg, (String (F ("ParseFseqFile:: Ignoring Range Info. ")) + FileControl[CurrentFile].FileName + F (" Sparse Range Frame offset + Num channels is larger than frame size.")).c_str(), sizeof(LastFailedPlayStatusMsg));
-                logcon (LastFailedPlayStatusMsg);
+                logerr (LastFailedPlayStatusMsg);
                 memset ((void*)&SparseRanges, 0x00, sizeof (SparseRanges));
                 SparseRanges[0].ChannelCount = fsqParsedHeader.channelCount;
             }
@@ -517,12 +518,12 @@ uint64_t c_InputFPPRemotePlayFile::ReadFile(uint64_t DestinationIntensityId, uin
 
         if(nullptr == LocalIntensityBuffer)
         {
-            LocalIntensityBuffer = (byte*)malloc(LocalIntensityBufferSize);
+            LocalIntensityBuffer = (byte*)SpiRam.Malloc(LocalIntensityBufferSize);
             //xDEBUG_V("Allocating local buffer.");
             if(nullptr == LocalIntensityBuffer)
             {
                 String Reason = F("Could not allocate a buffer to read SD files. Rebooting. ");
-                RequestReboot(Reason, 1, true);
+                RequestReboot(Reason, 0, true);
                 break;
             }
         }
@@ -538,7 +539,7 @@ uint64_t c_InputFPPRemotePlayFile::ReadFile(uint64_t DestinationIntensityId, uin
             // DEBUG_FILE_HANDLE(FileControl[CurrentFile].FileHandleForFileBeingPlayed);
             if(0 == NumBytesReadThisPass)
             {
-                logcon(F("Could not read FSEQ file header"));
+                logerr(F("Could not read FSEQ file header"));
                 // DEBUG_V(String (" n804_Free_Tot: ") + String(heap_caps_get_free_size(0x804)));
                 // DEBUG_V(String (" n804_Free_Max: ") + String(heap_caps_get_largest_free_block(0x804)));
                 // DEBUG_V(String (" n80C_Free_Tot: ") + String(heap_caps_get_free_size(0x80c)));
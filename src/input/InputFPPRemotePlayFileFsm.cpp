@@ -338,7 +338,7 @@ bool fsm_PlayFile_state_PlayingFile::Poll ()
                 // DEBUG_V (String ("                 CurrentFrame: ") + String (CurrentFrame));
                 // DEBUG_V (String ("            ActualBytesToRead: ") + String (ActualBytesToRead));
                 // DEBUG_V (String ("              ActualBytesRead: ") + String (ActualBytesRead));
-                logcon (F ("File Playback Failed to read enough data"));
+                logerr (F ("File Playback Failed to read enough data"));
                 Stop ();
             }
         }
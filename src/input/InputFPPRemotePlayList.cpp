@@ -20,6 +20,7 @@
 
 #include "input/InputFPPRemotePlayList.hpp"
 #include "service/FPPDiscovery.h"
+#include "utility/SpiRam.hpp"
 
 //-----------------------------------------------------------------------------
 c_InputFPPRemotePlayList::c_InputFPPRemotePlayList (c_InputMgr::e_InputChannelIds InputChannelId) :
@@ -137,7 +138,7 @@ bool c_InputFPPRemotePlayList::ProcessPlayListEntry ()
 
     bool response = false;
 
-    JsonDocument JsonPlayListDoc;
+    JsonDocument JsonPlayListDoc (&SpiRam);
     JsonPlayListDoc.to<JsonObject>();
 
     do // once
@@ -177,6 +177,31 @@ void c_InputMQTT::Process ()
 
 } // process
 
+//-----------------------------------------------------------------------------
+uint32_t c_InputMQTT::GetPollPeriodUs ()
+{
+    // DEBUG_START;
+
+    // nothing to do until a message starts an effect or a file
+    uint32_t Response = INPUT_POLL_NOT_NEEDED;
+
+    if (IsInputChannelActive)
+    {
+        if (nullptr != pEffectsEngine)
+        {
+            Response = pEffectsEngine->GetPollPeriodUs ();
+        }
+        else if (nullptr != pPlayFileEngine)
+        {
+            Response = c_InputCommon::GetPollPeriodUs ();
+        }
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // GetPollPeriodUs
+
 //-----------------------------------------------------------------------------
 void c_InputMQTT::SetBufferInfo (uint32_t BufferSize)
 {
@@ -459,6 +484,9 @@ void c_InputMQTT::onMqttMessage(
 
         publishState ();
 
+        // the new effect or file needs a first pass
+        InputMgr.SignalWork ();
+
         // DEBUG_V ("");
     } while (false);
 
@@ -772,7 +800,7 @@ void c_InputMQTT::NetworkStateChanged (bool IsConnected, bool ReBootAllowed)
     {
         // handle a disconnect
         String Reason = (String (F ("Requesting reboot on loss of network connection.")));
-        RequestReboot(Reason, 100000);
+        RequestReboot(Reason, 4000);
     }
 
     // DEBUG_END;
@@ -35,6 +35,10 @@
 #include "input/InputArtnet.hpp"
 // needs to be last
 #include "input/InputMgr.hpp"
+#include "RtConfig.hpp"
+#include "utility/CpuLoad.hpp"
+#include "utility/FrameLatency.hpp"
+#include "utility/SpiRam.hpp"
 
 #define AllocateInput(ClassType, Input, ChannelIndex, InputType, InputDataBufferSize) \
 { \
@@ -78,8 +82,6 @@ static const InputTypeXlateMap_t InputTypeXlateMap[c_InputMgr::e_InputType::Inpu
     {c_InputMgr::e_InputType::InputType_Disabled, "Disabled",   c_InputMgr::e_InputChannelIds::InputChannelId_ALL}
 };
 
-uint32_t DeltaTime = 0;
-
 #if defined ARDUINO_ARCH_ESP32
 #   include <functional>
 
@@ -89,34 +91,24 @@ void InputMgrTask (void *arg)
 {
     // DEBUG_V(String("Current CPU ID: ") + String(xPortGetCoreID()));
     // DEBUG_V(String("Current Task Priority: ") + String(uxTaskPriorityGet(NULL)));
-    const uint32_t MinPollTimeMs = FPP_TICKER_PERIOD_MS;
-    uint32_t PollStartTime = millis();
-    uint32_t PollEndTime = PollStartTime;
-    uint32_t PollTime = pdMS_TO_TICKS(MinPollTimeMs);
+    const uint32_t MicroSecondsPerTick = portTICK_PERIOD_MS * MicroSecondsInAmilliSecond;
 
     while(1)
     {
-        DeltaTime = PollEndTime - PollStartTime;
-
-        if (DeltaTime < MinPollTimeMs)
-        {
-            PollTime = pdMS_TO_TICKS(MinPollTimeMs - DeltaTime);
-        }
-        else
+        // the inputs tell us when they next need to be serviced. Anything
+        // that happens before then (packet, button, state change) is signalled.
+        uint32_t WaitTimeUs = InputMgr.GetPollPeriodUs();
+        TickType_t WaitTime = portMAX_DELAY;
+        if (INPUT_POLL_NOT_NEEDED != WaitTimeUs)
         {
-            // DEBUG_V(String("handle time wrap and long frames. DeltaTime:") + String(DeltaTime));
-            PollTime = pdMS_TO_TICKS(MinPollTimeMs);
+            // round up. Waking early only costs an extra pass
+            WaitTime = max(TickType_t(1), TickType_t((WaitTimeUs + MicroSecondsPerTick - 1) / MicroSecondsPerTick));
         }
-        vTaskDelay(PollTime);
+        ulTaskNotifyTake(pdTRUE, WaitTime);
         FeedWDT();
 
-        PollStartTime = millis();
-
         InputMgr.Process();
         FeedWDT();
-
-        // record the loop end time
-        PollEndTime = millis();
     }
 } // InputMgrTask
 #else
@@ -158,6 +150,7 @@ c_InputMgr::~c_InputMgr ()
     if(PollTaskHandle)
     {
         logcon("Stop Input Task");
+        CpuLoad.RemoveTask(PollTaskHandle);
         vTaskDelete(PollTaskHandle);
         PollTaskHandle = NULL;
     }
@@ -201,10 +194,16 @@ void c_InputMgr::Begin (uint32_t BufferSize)
 
     // CreateNewConfig();
 
+    // keep the startup frame until the network is up. Then it gets the usual blank delay
+    HoldLastFrame = true;
+    HeldBlankTimers[InputSecondaryChannelId] = true;
+
 #if defined ARDUINO_ARCH_ESP32
-    xTaskCreatePinnedToCore(InputMgrTask, "InputMgrTask", 4096, NULL, INPUTMGR_TASK_PRIORITY, &PollTaskHandle, 0);
+    xTaskCreatePinnedToCore(InputMgrTask, "InputMgrTask", RT_INPUT_TASK_STACK, NULL, RT_INPUT_TASK_PRIORITY, &PollTaskHandle, RT_INPUT_TASK_CORE);
+    CpuLoad.AddTask(PollTaskHandle);
 #else
-    MsTicker.attach_ms (uint32_t (FPP_TICKER_PERIOD_MS), &TimerPollHandler); // Add Timer Function
+    // first pass. Process() arms the next one
+    MsTicker.once_ms (FPP_TICKER_PERIOD_MS, &TimerPollHandler);
 #endif // ! defined ARDUINO_ARCH_ESP32
 
     HasBeenInitialized = true;
@@ -310,7 +309,7 @@ void c_InputMgr::CreateNewConfig ()
     // create a place to save the config
     // DEBUG_V(String("Heap: ") + String(ESP.getFreeHeap()));
 
-    JsonDocument JsonConfigDoc;
+    JsonDocument JsonConfigDoc (&SpiRam);
     JsonConfigDoc.to<JsonObject>();
     // DEBUG_V("");
 
@@ -386,6 +385,7 @@ void c_InputMgr::GetStatus (JsonObject& jsonStatus)
 
         JsonObject channelStatus = InputStatus.add<JsonObject> ();
         ((c_InputCommon*)(CurrentInput.InputDriver))->GetStatus (channelStatus);
+        FrameLatency.GetStatus (channelStatus, ((c_InputCommon*)(CurrentInput.InputDriver))->GetInputChannelId ());
         // DEBUG_V("");
     }
 
@@ -399,6 +399,7 @@ void c_InputMgr::ClearStatistics ()
     logcon(F("Process reset statistics request"));
 
     ExternalInput.ClearStatistics ();
+    FrameLatency.Clear ();
 
     for (auto & CurrentInput : InputChannelDrivers)
     {
@@ -709,7 +710,7 @@ void c_InputMgr::LoadConfig ()
         else
         {
             String Reason = (CN_stars + String (F (" Error loading Input Manager Config File. Rebooting ")) + CN_stars);
-            RequestReboot(Reason, 100000);
+            RequestReboot(Reason, 4000);
         }
     }
 
@@ -775,7 +776,7 @@ void c_InputMgr::Process ()
             }
         }
 
-        if (false == aBlankTimerIsRunning && config.BlankDelay != 0)
+        if (false == aBlankTimerIsRunning && config.BlankDelay != 0 && !HoldLastFrame)
         {
             // DEBUG_V("Clear Input Buffer");
             OutputMgr.ClearBuffer ();
@@ -785,14 +786,126 @@ void c_InputMgr::Process ()
         if (RebootNeeded)
         {
             // DEBUG_V("Requesting Reboot");
-            RequestReboot(InputRebootReason, 10000);
+            RequestReboot(InputRebootReason, 400);
         }
 
     } while (false);
 
+#ifdef ARDUINO_ARCH_ESP8266
+    // the ticker is one shot. Arm it for the next time an input needs us
+    WorkSignaled = false;
+    MsTicker.detach ();
+    uint32_t WaitTimeUs = GetPollPeriodUs ();
+    if (INPUT_POLL_NOT_NEEDED != WaitTimeUs)
+    {
+        uint32_t WaitTimeMs = (WaitTimeUs + MicroSecondsInAmilliSecond - 1) / MicroSecondsInAmilliSecond;
+        MsTicker.once_ms (max (uint32_t (1), WaitTimeMs), &TimerPollHandler);
+    }
+#endif // def ARDUINO_ARCH_ESP8266
+
     // DEBUG_END;
 } // Process
 
+//-----------------------------------------------------------------------------
+///< How long Process() can wait before it has to run again
+uint32_t c_InputMgr::GetPollPeriodUs ()
+{
+    // DEBUG_START;
+
+    uint32_t Response = INPUT_POLL_NOT_NEEDED;
+
+    do // once
+    {
+        if (PauseProcessing)
+        {
+            // SetOperationalState wakes us up
+            break;
+        }
+
+        if (configInProgress || (NO_CONFIG_NEEDED != ConfigLoadNeeded) || RebootNeeded || RebootInProgress())
+        {
+            // waiting for something that is not signalled
+            Response = FPP_TICKER_PERIOD_MS * MicroSecondsInAmilliSecond;
+            break;
+        }
+
+        Response = ExternalInput.GetPollPeriodUs ();
+
+        // same order as Process(). An input behind a running blank timer is not processed
+        bool aBlankTimerIsRunning = false;
+        for (auto & CurrentInput : InputChannelDrivers)
+        {
+            if(!CurrentInput.DriverInUse)
+            {
+                continue;
+            }
+
+            c_InputCommon * pInput = (c_InputCommon*)(CurrentInput.InputDriver);
+            if(!aBlankTimerIsRunning)
+            {
+                Response = min (Response, pInput->GetPollPeriodUs ());
+            }
+
+            // wake up when the blank timer runs out
+            uint32_t BlankTimeRemainingMs = BlankEndTime[pInput->GetInputChannelId ()].GetTimeRemaining ();
+            if (BlankTimeRemainingMs)
+            {
+                aBlankTimerIsRunning = true;
+                uint64_t BlankTimeRemainingUs = min (uint64_t (BlankTimeRemainingMs) * MicroSecondsInAmilliSecond, uint64_t (INPUT_POLL_NOT_NEEDED - 1));
+                Response = min (Response, uint32_t (BlankTimeRemainingUs));
+            }
+        }
+
+        if (false == aBlankTimerIsRunning && config.BlankDelay != 0 && !HoldLastFrame)
+        {
+            // Process() clears the buffer and restarts the blank timer
+            Response = 0;
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // GetPollPeriodUs
+
+//-----------------------------------------------------------------------------
+///< Called from the network callbacks (and other tasks) when an input has work
+void c_InputMgr::SignalWork ()
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (PollTaskHandle)
+    {
+        xTaskNotifyGive (PollTaskHandle);
+    }
+#else
+    // callbacks and the ticker share the same context. Process() clears the flag
+    if (HasBeenInitialized && !WorkSignaled)
+    {
+        WorkSignaled = true;
+        MsTicker.once_ms (1, &TimerPollHandler);
+    }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+} // SignalWork
+
+//-----------------------------------------------------------------------------
+///< Called from a GPIO interrupt (ESP32 only)
+void IRAM_ATTR c_InputMgr::ISR_SignalWork ()
+{
+#ifdef ARDUINO_ARCH_ESP32
+    if (PollTaskHandle)
+    {
+        BaseType_t HigherPriorityTaskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR (PollTaskHandle, &HigherPriorityTaskWoken);
+        portYIELD_FROM_ISR (HigherPriorityTaskWoken);
+    }
+#endif // def ARDUINO_ARCH_ESP32
+} // ISR_SignalWork
+
 //-----------------------------------------------------------------------------
 void c_InputMgr::ProcessButtonActions (c_ExternalInput::InputValue_t value)
 {
@@ -1097,6 +1210,9 @@ void c_InputMgr::SetOperationalState (bool ActiveFlag)
         }
     }
 
+    // the inputs may have work that was held while we were paused
+    SignalWork ();
+
     // DEBUG_END;
 
 } // SetOutputState
@@ -1106,6 +1222,29 @@ void c_InputMgr::NetworkStateChanged (bool _IsConnected)
 {
     // DEBUG_START;
 
+    // the outputs hold the last frame while the network inputs re-bind
+    if (IsConnected && !_IsConnected)
+    {
+        HoldLastFrame = true;
+        for (int ChannelIndex = 0; ChannelIndex < int (InputChannelId_End); ++ChannelIndex)
+        {
+            HeldBlankTimers[ChannelIndex] = !BlankEndTime[ChannelIndex].IsExpired ();
+        }
+    }
+    else if (_IsConnected && HoldLastFrame)
+    {
+        // the inputs that had data get a full blank delay to hear from their senders again
+        HoldLastFrame = false;
+        for (int ChannelIndex = 0; ChannelIndex < int (InputChannelId_End); ++ChannelIndex)
+        {
+            if (HeldBlankTimers[ChannelIndex])
+            {
+                RestartBlankTimer (e_InputChannelIds (ChannelIndex));
+            }
+        }
+        SignalWork ();
+    }
+
     IsConnected = _IsConnected;
 
     if (HasBeenInitialized)
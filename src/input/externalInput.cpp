@@ -34,6 +34,15 @@ fsm_ExternalInput_off_state           fsm_ExternalInput_off_state_imp;
 fsm_ExternalInput_on_wait_long_state  fsm_ExternalInput_on_wait_long_state_imp;
 fsm_ExternalInput_wait_for_off_state  fsm_ExternalInput_wait_for_off_state_imp;
 
+#ifdef ARDUINO_ARCH_ESP32
+/*****************************************************************************/
+// any edge on the button wakes up the input task
+static void IRAM_ATTR ExternalInput_isr ()
+{
+	InputMgr.ISR_SignalWork ();
+} // ExternalInput_isr
+#endif // def ARDUINO_ARCH_ESP32
+
 /*****************************************************************************/
 /* Code                                                                      */
 /*****************************************************************************/
@@ -124,6 +133,20 @@ void c_ExternalInput::ProcessConfig (JsonObject JsonData)
 		fsm_ExternalInput_boot_imp.Init (*this);
 	}
 
+#ifdef ARDUINO_ARCH_ESP32
+	if (InterruptAttached)
+	{
+		detachInterrupt (oldInputId);
+		InterruptAttached = false;
+	}
+
+	if (Enabled)
+	{
+		attachInterrupt (GpioId, ExternalInput_isr, CHANGE);
+		InterruptAttached = true;
+	}
+#endif // def ARDUINO_ARCH_ESP32
+
 	// DEBUG_V (String ("m_iPinId: ") + String (m_iPinId));
 
 	// DEBUG_END;
@@ -141,6 +164,32 @@ void c_ExternalInput::Poll ()
 
 } // Poll
 
+/*****************************************************************************/
+uint32_t c_ExternalInput::GetPollPeriodUs ()
+{
+	// DEBUG_START;
+
+	uint32_t Response = FPP_TICKER_PERIOD_MS * MicroSecondsInAmilliSecond;
+
+	if (!Enabled)
+	{
+		// the boot state waits for a config
+		Response = INPUT_POLL_NOT_NEEDED;
+	}
+	else if (InterruptAttached &&
+	         (CurrentFsmState == &fsm_ExternalInput_off_state_imp) &&
+	         (MIN_INPUT_STABLE_VALUE == InputDebounceCount))
+	{
+		// released and stable. Only an edge can change that
+		Response = INPUT_POLL_NOT_NEEDED;
+	}
+	// debouncing and held buttons are sampled
+
+	// DEBUG_END;
+	return Response;
+
+} // GetPollPeriodUs
+
 /*****************************************************************************/
 bool c_ExternalInput::ReadInput (void)
 {
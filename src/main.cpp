@@ -46,6 +46,14 @@
 #include "service/SensorDS18B20.h"
 #endif // def SUPPORT_SENSOR_DS18B20
 
+// Utilities
+#include "utility/CpuLoad.hpp"
+#include "utility/FrameLatency.hpp"
+#include "utility/TimerWheel.hpp"
+#include "utility/AsyncLog.hpp"
+#include "utility/SpiRam.hpp"
+#include "utility/BootTimeline.hpp"
+
 #ifdef ARDUINO_ARCH_ESP8266
 #include <Hash.h>
 extern "C"
@@ -98,6 +106,8 @@ String GlobalRebootReason = emptyString;
 config_t config;                    // Current configuration
 static const uint32_t NotRebootingValue = uint32_t(-1);
 uint32_t RebootCount = NotRebootingValue;
+static FastTimer RebootTimer;
+static c_TimerWheel::JobId_t RebootJob = TIMER_WHEEL_NO_JOB;
 uint32_t lastUpdate;                // Update timeout tracker
 bool     ResetWiFi = false;
 bool     IsBooting = true;  // Configuration initialization flag
@@ -117,6 +127,9 @@ uint32_t DiscardedRxData = 0;
 
 void ScheduleLoadConfig() {ConfigLoadNeeded = now(); }
 void LoadConfig();
+static uint32_t DiscardConsoleInput (void * pContext);
+static uint32_t ProcessConfigRequests (void * pContext);
+static uint32_t RebootWhenDue (void * pContext);
 void GetConfig (JsonObject & json);
 void GetDriverName (String & Name) { Name = F("ESP"); }
 
@@ -172,6 +185,10 @@ void setup()
     digitalWrite(DEBUG_GPIO, HIGH);
 #endif // def DEBUG_GPIO
 
+    // the subsystems add their jobs as they start. A reboot can be requested before any of them runs
+    TimerWheel.Begin();
+    RebootJob = TimerWheel.Add(F("Reboot"), RebootWhenDue, nullptr, TIMER_WHEEL_STOP, 0);
+
     SafeStrncpy(config.id, String(F("ESPixelStick")).c_str(), sizeof(config.id));
 
     config.BlankDelay = 5;
@@ -209,27 +226,41 @@ void setup()
 
     // DEBUG_V(String("Configured Stack Size: ") + String(getArduinoLoopTaskStackSize()));
     // DEBUG_V(String("Remaining Stack Space: ") + String(uxTaskGetStackHighWaterMark(NULL)));
+
+    // start counting before the real time tasks are created
+    CpuLoad.Begin();
 #endif // def ARDUINO_ARCH_ESP32
+    FrameLatency.Begin();
+    AsyncLog.Begin();
+    // before anything allocates its buffers
+    SpiRam.Begin();
 
     FileMgr.Begin();
     // Load configuration from the File System and set Hostname
     // TestHeap(uint32_t(15));
     // DEBUG_V(String("LoadConfig Heap: ") + String(ESP.getFreeHeap()));
     LoadConfig();
+    BootTimeline.Mark(F("config"));
 
     // TestHeap(uint32_t(20));
-    // DEBUG_V(String("InputMgr Heap: ") + String(ESP.getFreeHeap()));
-    // connect the input processing to the output processing.
-    InputMgr.Begin (0);
-
-    // TestHeap(uint32_t(30));
     // DEBUG_V(String("OutputMgr Heap: ") + String(ESP.getFreeHeap()));
-    // Set up the output manager to start sending data to the serial ports
+    // Set up the output manager to start sending data to the serial ports.
+    // The startup frame goes out now. The SD card, the FSEQ list and the
+    // network finish in the background.
     OutputMgr.Begin();
+    OutputMgr.Poll();
+    BootTimeline.Mark(F("outputs"));
+
+    // TestHeap(uint32_t(30));
+    // DEBUG_V(String("InputMgr Heap: ") + String(ESP.getFreeHeap()));
+    // connect the input processing to the output processing.
+    InputMgr.Begin (OutputMgr.GetBufferUsedSize());
+    BootTimeline.Mark(F("inputs"));
 
     // TestHeap(uint32_t(40));
     // DEBUG_V(String("NetworkMgr Heap: ") + String(ESP.getFreeHeap()));
     NetworkMgr.Begin();
+    BootTimeline.Mark(F("network start"));
 
     // TestHeap(uint32_t(50));
     // DEBUG_V(String("WebMgr Heap: ") + String(ESP.getFreeHeap()));
@@ -244,6 +275,7 @@ void setup()
 
     // DEBUG_V(String("FPPDiscovery Heap: ") + String(ESP.getFreeHeap()));
     FPPDiscovery.begin ();
+    BootTimeline.Mark(F("services"));
 
     // DEBUG_V(String("Final Heap: ") + String(ESP.getFreeHeap()));
 
@@ -264,8 +296,12 @@ void setup()
 
     WebMgr.CreateAdminInfoFile();
 
+    TimerWheel.Add(F("Console"), DiscardConsoleInput,   nullptr, 0, 1000);
+    TimerWheel.Add(F("Config"),  ProcessConfigRequests, nullptr, 0, 100000);
+
     // Done with initialization
     IsBooting = false;
+    BootTimeline.Mark(F("setup done"));
 
     // DEBUG_END;
 
@@ -313,6 +349,7 @@ bool dsDevice(JsonObject & json)
 //TODO: Add configuration upgrade handling - cfgver moved to root level
         ConfigChanged |= setFromJSON (config.id,         JsonDeviceConfig, CN_id);
         ConfigChanged |= setFromJSON (config.BlankDelay, JsonDeviceConfig, CN_blanktime);
+        ConfigChanged |= setFromJSON (config.StartColor, JsonDeviceConfig, CN_startcolor);
     }
     else
     {
@@ -415,6 +452,8 @@ bool deserializeCore (JsonObject & json)
         // DEBUG_V("");
         ConfigSaveNeeded |= NetworkMgr.SetConfig(DeviceConfig);
         // DEBUG_V("");
+        ConfigSaveNeeded |= AsyncLog.SetConfig(DeviceConfig);
+        // DEBUG_V("");
         #ifdef SUPPORT_SENSOR_DS18B20
         ConfigSaveNeeded |= SensorDS18B20.SetConfig(DeviceConfig);
         #endif // def SUPPORT_SENSOR_DS18B20
@@ -448,7 +487,7 @@ void SaveConfig()
     ConfigSaveNeeded = false;
 
     // Create buffer and root object
-    JsonDocument jsonConfigDoc;
+    JsonDocument jsonConfigDoc (&SpiRam);
     jsonConfigDoc.to<JsonObject>();
     JsonObject JsonConfig = jsonConfigDoc[(char*)CN_system].to<JsonObject>();
 
@@ -515,6 +554,7 @@ void GetConfig (JsonObject & json)
     JsonObject device = json[(char*)CN_device].to<JsonObject>();
     JsonWrite(device, CN_id,        config.id);
     JsonWrite(device, CN_blanktime, config.BlankDelay);
+    JsonWrite(device, CN_startcolor, config.StartColor);
 
     // PrettyPrint(device, "device");
 
@@ -522,6 +562,8 @@ void GetConfig (JsonObject & json)
 
     NetworkMgr.GetConfig (json);
 
+    AsyncLog.GetConfig (json);
+
 #ifdef SUPPORT_SENSOR_DS18B20
     SensorDS18B20.GetConfig(json);
 #endif // def SUPPORT_SENSOR_DS18B20
@@ -535,7 +577,7 @@ String serializeCore(bool pretty)
     // DEBUG_START;
 
     // Create buffer and root object
-    JsonDocument jsonConfigDoc;
+    JsonDocument jsonConfigDoc (&SpiRam);
     jsonConfigDoc.to<JsonObject>();
     JsonObject JsonConfig = jsonConfigDoc.add<JsonObject>();
 
@@ -559,14 +601,16 @@ String serializeCore(bool pretty)
     return jsonConfigString;
 } // serializeCore
 
-void DelayReboot(uint32_t MinDelay)
+void DelayReboot(uint32_t MinDelayMs)
 {
     // DEBUG_START;
 
-    if (NotRebootingValue != RebootCount)
+    if ((NotRebootingValue != RebootCount) && (RebootTimer.GetTimeRemaining() < MinDelayMs))
     {
         // DEBUG_V("Recalc delay");
-        RebootCount = (RebootCount < MinDelay) ? MinDelay: RebootCount;
+        RebootCount = MinDelayMs;
+        RebootTimer.StartTimer(MinDelayMs, false);
+        TimerWheel.Schedule(RebootJob, MinDelayMs);
     }
 
     // DEBUG_END;
@@ -579,41 +623,21 @@ void DelayReboot(uint32_t MinDelay)
 /////////////////////////////////////////////////////////
 /// Main Loop
 /** Arduino based main loop */
-// uint32_t HeapTime = 100;
 void loop()
 {
     // DEBUG_START;
-/*
-    if(millis() > HeapTime)
-    {
-        // DEBUG_V(String("Heap: ") + String(ESP.getFreeHeap()));
-        HeapTime += 5000;
-    }
-*/
-    FeedWDT ();
-
-    // Keep the Network Open
-    NetworkMgr.Poll ();
-    // DEBUG_V();
 
-    // Poll output
-    OutputMgr.Poll ();
-    // DEBUG_V();
-
-    WebMgr.Process ();
-    // DEBUG_V();
-
-    FileMgr.Poll ();
-    // DEBUG_V();
+    FeedWDT ();
 
-    FPPDiscovery.Poll ();
-    // DEBUG_V();
+    // run the jobs that are due and sleep until the next one is
+    TimerWheel.Sleep (TimerWheel.Run ());
 
-#ifdef SUPPORT_SENSOR_DS18B20
-    SensorDS18B20.Poll();
-    // DEBUG_V();
-#endif // def SUPPORT_SENSOR_DS18B20
+    // DEBUG_END;
+} // loop
 
+//-----------------------------------------------------------------------------
+static uint32_t DiscardConsoleInput (void * pContext)
+{
     // need to keep the rx pipeline empty
     size_t BytesToDiscard = min (100, LOG_PORT.available ());
     DiscardedRxData += BytesToDiscard;
@@ -625,19 +649,13 @@ void loop()
         BytesToDiscard--;
         LOG_PORT.read();
     } // end discard loop
-    // DEBUG_V();
 
-    // Reboot handler
-    if (NotRebootingValue != RebootCount)
-    {
-        if(0 == --RebootCount)
-        {
-            logcon (String(CN_stars) + CN_minussigns + F ("Internal Reboot Requested: '") + GlobalRebootReason + F("' Rebooting Now"));
-            delay (REBOOT_DELAY);
-            ESP.restart ();
-        }
-    }
+    return 20;
+} // DiscardConsoleInput
 
+//-----------------------------------------------------------------------------
+static uint32_t ProcessConfigRequests (void * pContext)
+{
     if (NO_CONFIG_NEEDED != ConfigLoadNeeded)
     {
         if(abs(now() - ConfigLoadNeeded) > LOAD_CONFIG_DELAY)
@@ -652,18 +670,38 @@ void loop()
         FeedWDT ();
         SaveConfig ();
     }
-    // DEBUG_END;
-} // loop
+
+    return TIMER_WHEEL_MAX_SLEEP_MS;
+} // ProcessConfigRequests
+
+//-----------------------------------------------------------------------------
+static uint32_t RebootWhenDue (void * pContext)
+{
+    // a later DelayReboot may have moved the deadline
+    if (!RebootTimer.IsExpired ())
+    {
+        return RebootTimer.GetTimeRemaining ();
+    }
+
+    logcon (String(CN_stars) + CN_minussigns + F ("Internal Reboot Requested: '") + GlobalRebootReason + F("' Rebooting Now"));
+    AsyncLog.Flush ();
+    delay (REBOOT_DELAY);
+    ESP.restart ();
+
+    return TIMER_WHEEL_STOP;
+} // RebootWhenDue
 
 bool RebootInProgress()
 {
     return RebootCount != NotRebootingValue;
 }
 
-void RequestReboot(String & Reason, uint32_t LoopDelay, bool SkipDisable /* = false */)
+void RequestReboot(String & Reason, uint32_t DelayMs, bool SkipDisable /* = false */)
 {
     GlobalRebootReason = Reason;
-    RebootCount = LoopDelay;
+    RebootCount = DelayMs;
+    RebootTimer.StartTimer(DelayMs, false);
+    TimerWheel.Schedule(RebootJob, DelayMs);
     if(!SkipDisable)
     {
         InputMgr.SetOperationalState(false);
@@ -674,26 +712,6 @@ void RequestReboot(String & Reason, uint32_t LoopDelay, bool SkipDisable /* = fa
 
 bool ConsoleUartIsActive = true;
 
-void _logcon (String & DriverName, String Message)
-{
-    if(ConsoleUartIsActive)
-    {
-        char Spaces[7];
-        memset(Spaces, ' ', sizeof(Spaces));
-        if (DriverName.length() < (sizeof(Spaces)-1))
-        {
-            Spaces[(sizeof (Spaces) - 1) - DriverName.length ()] = '\0';
-        }
-        else
-        {
-            Spaces[0] = '\0';
-        }
-
-        LOG_PORT.println (String(F("[")) + String (Spaces) + DriverName + F("] ") + Message);
-        LOG_PORT.flush ();
-    }
-} // logcon
-
 void FeedWDT ()
 {
 #ifdef ARDUINO_ARCH_ESP32
@@ -0,0 +1,40 @@
+/*
+* NativeArduino.cpp - Arduino core objects for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "Arduino.h"
+
+const String    emptyString;
+HardwareSerial  Serial  (0);
+HardwareSerial  Serial1 (1);
+HardwareSerial  Serial2 (2);
+EspClass        ESP;
+
+//----------------------------------------------------------------------------
+esp_err_t gpio_reset_pin (gpio_num_t gpio_num)
+{
+    if (!GPIO_IS_VALID_GPIO (gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    NativeSim.DetachSignal (gpio_num, false);
+    NativeSim.SetPinMode (gpio_num, INPUT);
+    return ESP_OK;
+
+} // gpio_reset_pin
@@ -0,0 +1,440 @@
+/*
+* NativeBench.cpp - Output hot path benchmarks for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "NativeBench.hpp"
+#include "output/OutputMgr.hpp"
+#include "input/InputEffectEngine.hpp"
+#include <chrono>
+
+#if defined(USE_UART_OUTPUT_DRIVERS)
+    #define BENCH_OUTPUT_DRIVERS    "uart"
+#else
+    #define BENCH_OUTPUT_DRIVERS    "rmt"
+#endif // defined(USE_UART_OUTPUT_DRIVERS)
+
+#define BENCH_NUM_BATCHES   5
+
+static volatile uint32_t BenchSink = 0;     ///< keeps the compiler from dropping results nobody reads
+
+// one port per driver so each one has its own RMT channel / UART
+static OM_OutputPortDefinition_t BenchPortDefinitions[] =
+{
+    {OM_PortId_t(0), OM_PortType_t::OM_SERIAL, {gpio_num_t::GPIO_NUM_2,  gpio_num_t(-1), gpio_num_t(-1)}, 0},
+    {OM_PortId_t(1), OM_PortType_t::OM_SERIAL, {gpio_num_t::GPIO_NUM_13, gpio_num_t(-1), gpio_num_t(-1)}, 1},
+    {OM_PortId_t(2), OM_PortType_t::OM_SERIAL, {gpio_num_t::GPIO_NUM_12, gpio_num_t(-1), gpio_num_t(-1)}, 2},
+};
+
+//----------------------------------------------------------------------------
+c_NativeBench::c_NativeBench () :
+    PixelDriver  (BenchPortDefinitions[0], c_OutputMgr::e_OutputProtocolType::OutputProtocol_WS2811),
+    GECEDriver   (BenchPortDefinitions[1], c_OutputMgr::e_OutputProtocolType::OutputProtocol_GECE),
+    RenardDriver (BenchPortDefinitions[2], c_OutputMgr::e_OutputProtocolType::OutputProtocol_Renard)
+{
+    // same order as c_OutputMgr::InstantiateNewOutputChannel. SetConfig comes later.
+    PixelDriver.Begin ();
+    GECEDriver.Begin ();
+    RenardDriver.Begin ();
+
+    // channel data that changes from one channel to the next
+    for (uint32_t ChannelId = 0; ChannelId < sizeof (SourceData); ++ChannelId)
+    {
+        SourceData[ChannelId] = uint8_t (ChannelId * 7);
+    }
+
+} // c_NativeBench
+
+//----------------------------------------------------------------------------
+c_NativeBench::~c_NativeBench ()
+{
+} // ~c_NativeBench
+
+//----------------------------------------------------------------------------
+bool c_NativeBench::IsSelected (const String & Name)
+{
+    return Filter.equals (F ("all")) || (-1 != Name.indexOf (Filter));
+
+} // IsSelected
+
+//----------------------------------------------------------------------------
+void c_NativeBench::Measure (const String & Name, uint32_t Pixels, uint32_t Bytes, std::function<void ()> Kernel)
+{
+    // DEBUG_START;
+
+    typedef std::chrono::steady_clock Clock_t;
+
+    do // once
+    {
+        if (!IsSelected (Name))
+        {
+            break;
+        }
+
+        // warm up the caches and the branch predictors
+        Kernel ();
+
+        // find an iteration count that fills one batch
+        uint64_t BatchNs = (uint64_t (MinMs) * 1000000) / BENCH_NUM_BATCHES;
+        uint64_t Iterations = 1;
+        while (true)
+        {
+            Clock_t::time_point Start = Clock_t::now ();
+            for (uint64_t Count = 0; Count < Iterations; ++Count)
+            {
+                Kernel ();
+            }
+            uint64_t ElapsedNs = uint64_t (std::chrono::duration_cast<std::chrono::nanoseconds> (Clock_t::now () - Start).count ());
+            if ((ElapsedNs >= (BatchNs / 4)) || (Iterations >= (uint64_t (1) << 40)))
+            {
+                Iterations = max (uint64_t (1), (Iterations * BatchNs) / max (ElapsedNs, uint64_t (1)));
+                break;
+            }
+            Iterations *= 2;
+        }
+
+        double BestNs = 0.0;
+        for (uint32_t Batch = 0; Batch < BENCH_NUM_BATCHES; ++Batch)
+        {
+            Clock_t::time_point Start = Clock_t::now ();
+            for (uint64_t Count = 0; Count < Iterations; ++Count)
+            {
+                Kernel ();
+            }
+            double ElapsedNs = double (std::chrono::duration_cast<std::chrono::nanoseconds> (Clock_t::now () - Start).count ());
+            if ((0 == Batch) || (ElapsedNs < BestNs))
+            {
+                BestNs = ElapsedNs;
+            }
+        }
+
+        Result_t Result;
+        Result.Name             = Name;
+        Result.Pixels           = Pixels;
+        Result.Bytes            = Bytes;
+        Result.Iterations       = Iterations;
+        Result.NsPerIteration   = BestNs / double (Iterations);
+        Results.push_back (Result);
+
+        String NsPerPixel = Pixels ? String (Result.NsPerIteration / double (Pixels), 2) : String (F ("-"));
+        LOG_PORT.printf ("%-48s %12.1f ns/iter %9s ns/pixel %12.0f bytes/s\n",
+                         Name.c_str (),
+                         Result.NsPerIteration,
+                         NsPerPixel.c_str (),
+                         (double (Bytes) * 1e9) / Result.NsPerIteration);
+
+    } while (false);
+
+    // DEBUG_END;
+} // Measure
+
+//----------------------------------------------------------------------------
+void c_NativeBench::ConfigurePixel (c_OutputPixel & Driver, const PixelCase_t & Case)
+{
+    // DEBUG_START;
+
+    // start from the driver defaults so every field is present
+    JsonDocument ConfigDoc;
+    JsonObject   Config = ConfigDoc.to<JsonObject> ();
+    Driver.GetConfig (Config);
+
+    JsonWrite (Config, CN_color_order,        Case.ColorOrder);
+    JsonWrite (Config, CN_pixel_count,        Case.PixelCount);
+    JsonWrite (Config, CN_group_size,         Case.GroupSize);
+    JsonWrite (Config, CN_zig_size,           Case.ZigSize);
+    JsonWrite (Config, CN_prependnullcount,   Case.NullPixels);
+    JsonWrite (Config, CN_appendnullcount,    Case.NullPixels);
+    JsonWrite (Config, CN_dither,             Case.Dither);
+    JsonWrite (Config, CN_white_extract,      Case.WhiteExtract);
+    JsonWrite (Config, CN_gamma,              2.2);
+    JsonWrite (Config, CN_brightness,         100);
+    Driver.SetConfig (Config);
+
+    // same buffer hand off as c_OutputMgr::UpdateDisplayBufferReferences for port 0
+    Driver.SetOutputBufferAddress (OutputMgr.GetBufferAddress ());
+    Driver.SetOutputBufferSize (Driver.GetNumOutputBufferBytesNeeded ());
+
+    // DEBUG_END;
+} // ConfigurePixel
+
+//----------------------------------------------------------------------------
+void c_NativeBench::BenchPixel (const PixelCase_t & Case)
+{
+    // DEBUG_START;
+
+    auto & Driver = PixelDriver;
+    ConfigurePixel (Driver, Case);
+
+    uint32_t NumChannels    = Driver.GetNumOutputBufferChannelsServiced ();
+    uint32_t NumIntensities = Driver.GetNumOutputBufferBytesNeeded ();
+    String   CaseName       = String (F ("/")) + Case.Name;
+
+    Measure (String (F ("WriteChannelData")) + CaseName, Case.PixelCount, NumChannels,
+        [&] ()
+        {
+            Driver.WriteChannelData (0, NumChannels, SourceData);
+        });
+
+    // CalculateIntensityOffset is inline in OutputPixel.cpp. ReadChannelData
+    // is that plus one load and one divide per channel.
+    Measure (String (F ("ReadChannelData")) + CaseName, Case.PixelCount, NumChannels,
+        [&] ()
+        {
+            Driver.ReadChannelData (0, NumChannels, TargetData);
+            BenchSink = TargetData[0];
+        });
+
+    Driver.WriteChannelData (0, NumChannels, SourceData);
+
+    Measure (String (F ("ISR_GetNextIntensityToSend")) + CaseName, Case.PixelCount, NumIntensities,
+        [&] ()
+        {
+            uint32_t Data;
+            uint32_t Sum = 0;
+            Driver.c_OutputPixel::StartNewFrame ();
+            while (Driver.ISR_MoreDataToSend ())
+            {
+                Driver.ISR_GetNextIntensityToSend (Data);
+                Sum += Data;
+            }
+            BenchSink = Sum;
+        });
+
+#if !defined(USE_UART_OUTPUT_DRIVERS)
+    Measure (String (F ("WS2811Rmt::ISR_GetNextBitToSend")) + CaseName, Case.PixelCount, NumIntensities,
+        [&] ()
+        {
+            rmt_item32_t Item;
+            uint32_t Sum = 0;
+            Driver.StartNewDataFrame ();
+            while (Driver.ISR_GetNextBitToSend (Item))
+            {
+                Sum += Item.val;
+            }
+            BenchSink = Sum;
+        });
+#endif // !defined(USE_UART_OUTPUT_DRIVERS)
+
+    // DEBUG_END;
+} // BenchPixel
+
+//----------------------------------------------------------------------------
+void c_NativeBench::BenchGECE ()
+{
+    // DEBUG_START;
+
+    static const PixelCase_t Case = { "gece", "rgb", GECE_PIXEL_LIMIT, 1, 1, 0, false, false };
+
+    auto & Driver = GECEDriver;
+    ConfigurePixel (Driver, Case);
+
+    uint32_t NumChannels    = Driver.GetNumOutputBufferChannelsServiced ();
+    uint32_t NumIntensities = Driver.GetNumOutputBufferBytesNeeded ();
+    Driver.WriteChannelData (0, NumChannels, SourceData);
+
+    Measure (String (F ("ISR_GetNextIntensityToSend/gece")), Case.PixelCount, NumIntensities,
+        [&] ()
+        {
+            uint32_t Data;
+            uint32_t Sum = 0;
+            Driver.c_OutputPixel::StartNewFrame ();
+            while (Driver.ISR_MoreDataToSend ())
+            {
+                Driver.ISR_GetNextIntensityToSend (Data);
+                Sum += Data;
+            }
+            BenchSink = Sum;
+        });
+
+    // DEBUG_END;
+} // BenchGECE
+
+//----------------------------------------------------------------------------
+void c_NativeBench::BenchRenard ()
+{
+    // DEBUG_START;
+
+    #define BENCH_RENARD_CHANNELS 512
+
+    auto & Driver = RenardDriver;
+
+    JsonDocument ConfigDoc;
+    JsonObject   Config = ConfigDoc.to<JsonObject> ();
+    Driver.GetConfig (Config);
+    JsonWrite (Config, CN_num_chan, BENCH_RENARD_CHANNELS);
+    Driver.SetConfig (Config);
+    Driver.SetOutputBufferAddress (OutputMgr.GetBufferAddress ());
+    Driver.SetOutputBufferSize (Driver.GetNumOutputBufferBytesNeeded ());
+
+    auto Kernel = [&] ()
+        {
+            uint32_t Data;
+            uint32_t Sum = 0;
+            Driver.c_OutputSerial::StartNewFrame ();
+            while (Driver.ISR_MoreDataToSend ())
+            {
+                Driver.ISR_GetNextIntensityToSend (Data);
+                Sum += Data;
+            }
+            BenchSink = Sum;
+        };
+
+    // a ramp hits the escape path for 3 of every 256 values
+    Driver.WriteChannelData (0, BENCH_RENARD_CHANNELS, SourceData);
+    Measure (String (F ("Renard/ramp")), 0, BENCH_RENARD_CHANNELS, Kernel);
+
+    // every value needs the escape sequence
+    uint8_t EscapedData[BENCH_RENARD_CHANNELS];
+    memset (EscapedData, 0x7E, sizeof (EscapedData));
+    Driver.WriteChannelData (0, BENCH_RENARD_CHANNELS, EscapedData);
+    Measure (String (F ("Renard/escaped")), 0, BENCH_RENARD_CHANNELS, Kernel);
+
+    // DEBUG_END;
+} // BenchRenard
+
+//----------------------------------------------------------------------------
+void c_NativeBench::BenchEffects ()
+{
+    // DEBUG_START;
+
+    // The effects write through OutputMgr. No output port is configured in
+    // the benchmark, so this measures the effect itself plus the dispatch.
+    #define BENCH_EFFECT_PIXELS 1000
+
+    struct EffectCase_t
+    {
+        const char *                        Name;
+        c_InputEffectEngine::EffectFunc     Func;
+    };
+
+    static const EffectCase_t EffectCases[] =
+    {
+        { "Solid",          &c_InputEffectEngine::effectSolidColor  },
+        { "Blink",          &c_InputEffectEngine::effectBlink       },
+        { "Flash",          &c_InputEffectEngine::effectFlash       },
+        { "Rainbow",        &c_InputEffectEngine::effectRainbow     },
+        { "Chase",          &c_InputEffectEngine::effectChase       },
+        { "FireFlicker",    &c_InputEffectEngine::effectFireFlicker },
+        { "Lightning",      &c_InputEffectEngine::effectLightning   },
+        { "Breathe",        &c_InputEffectEngine::effectBreathe     },
+        { "Random",         &c_InputEffectEngine::effectRandom      },
+        { "Transition",     &c_InputEffectEngine::effectTransition  },
+        { "Marquee",        &c_InputEffectEngine::effectMarquee     },
+    };
+
+    c_InputEffectEngine Effects (c_InputMgr::e_InputChannelIds::InputPrimaryChannelId,
+                                 c_InputMgr::e_InputType::InputType_Effects,
+                                 BENCH_EFFECT_PIXELS * 3);
+    Effects.Begin ();
+
+    for (auto & CurrentEffect : EffectCases)
+    {
+        Measure (String (F ("Effect/")) + CurrentEffect.Name, BENCH_EFFECT_PIXELS, BENCH_EFFECT_PIXELS * 3,
+            [&] ()
+            {
+                BenchSink = (Effects.*CurrentEffect.Func) ();
+            });
+    }
+
+    // DEBUG_END;
+} // BenchEffects
+
+//----------------------------------------------------------------------------
+void c_NativeBench::Report (const String & JsonFileName)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (JsonFileName.isEmpty ())
+        {
+            break;
+        }
+
+        JsonDocument ReportDoc;
+        JsonWrite (ReportDoc, F ("version"),        ConstConfig.Version);
+        JsonWrite (ReportDoc, F ("built"),          ConstConfig.BuildDate);
+        JsonWrite (ReportDoc, F ("board"),          BOARD_NAME);
+        JsonWrite (ReportDoc, F ("output_drivers"), BENCH_OUTPUT_DRIVERS);
+        JsonWrite (ReportDoc, F ("min_ms"),         MinMs);
+
+        JsonArray Benchmarks = ReportDoc["benchmarks"].to<JsonArray> ();
+        for (auto & CurrentResult : Results)
+        {
+            JsonObject Entry = Benchmarks.add<JsonObject> ();
+            JsonWrite (Entry, F ("name"),             CurrentResult.Name);
+            JsonWrite (Entry, F ("iterations"),       CurrentResult.Iterations);
+            JsonWrite (Entry, F ("ns_per_iteration"), CurrentResult.NsPerIteration);
+            JsonWrite (Entry, F ("pixels"),           CurrentResult.Pixels);
+            if (CurrentResult.Pixels)
+            {
+                JsonWrite (Entry, F ("ns_per_pixel"), CurrentResult.NsPerIteration / double (CurrentResult.Pixels));
+            }
+            JsonWrite (Entry, F ("bytes"),            CurrentResult.Bytes);
+            JsonWrite (Entry, F ("bytes_per_s"),      (double (CurrentResult.Bytes) * 1e9) / CurrentResult.NsPerIteration);
+        }
+
+        String Data;
+        serializeJsonPretty (ReportDoc, Data);
+
+        FILE * file = fopen (JsonFileName.c_str (), "w");
+        if (nullptr == file)
+        {
+            logcon (String (F ("Could not open '")) + JsonFileName + F ("' for writing."));
+            break;
+        }
+        fwrite (Data.c_str (), 1, Data.length (), file);
+        fclose (file);
+
+    } while (false);
+
+    // DEBUG_END;
+} // Report
+
+//----------------------------------------------------------------------------
+void c_NativeBench::Run (const String & _Filter, uint32_t _MinMs, const String & JsonFileName)
+{
+    // DEBUG_START;
+
+    static const PixelCase_t PixelCases[] =
+    {
+        //  Name            Order   Pixels  Group   Zig     Nulls   Dither  White
+        { "rgb",            "rgb",  1000,   1,      1,      0,      false,  false   },
+        { "grbw",           "grbw", 750,    1,      1,      0,      false,  false   },
+        { "grbw_white",     "grbw", 1000,   1,      1,      0,      false,  true    },
+        { "rgb_group4",     "rgb",  1000,   4,      1,      0,      false,  false   },
+        { "rgb_zig16",      "rgb",  1000,   1,      16,     0,      false,  false   },
+        { "rgb_nulls",      "rgb",  1000,   1,      1,      16,     false,  false   },
+        { "rgb_dither",     "rgb",  1000,   1,      1,      0,      true,   false   },
+    };
+
+    Filter = _Filter;
+    MinMs  = max (uint32_t (BENCH_NUM_BATCHES), _MinMs);
+    Results.clear ();
+
+    for (auto & CurrentCase : PixelCases)
+    {
+        BenchPixel (CurrentCase);
+    }
+    BenchGECE ();
+    BenchRenard ();
+    BenchEffects ();
+
+    Report (JsonFileName);
+
+    // DEBUG_END;
+} // Run
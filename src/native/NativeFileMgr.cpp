@@ -0,0 +1,369 @@
+/*
+* NativeFileMgr.cpp - Flash file access for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Stands in for the flash file functions of FileMgr.cpp. The flash file
+*   system is the host directory named by ESPS_NATIVE_FS (default: the
+*   current directory). There is no SD card.
+*/
+
+#include "ESPixelStick.h"
+#include "FileMgr.hpp"
+#include "utility/ConfigSnapshot.hpp"
+#include "utility/SpiRam.hpp"
+#include <sys/stat.h>
+
+//-----------------------------------------------------------------------------
+static String HostPath (const String & FileName)
+{
+    const char * Root = getenv ("ESPS_NATIVE_FS");
+    String Response = (Root && *Root) ? String (Root) : String (".");
+    if (!FileName.startsWith ("/"))
+    {
+        Response += "/";
+    }
+    Response += FileName;
+    return Response;
+
+} // HostPath
+
+//-----------------------------------------------------------------------------
+c_FileMgr::c_FileMgr ()
+{
+} // c_FileMgr
+
+//-----------------------------------------------------------------------------
+c_FileMgr::~c_FileMgr ()
+{
+} // ~c_FileMgr
+
+//-----------------------------------------------------------------------------
+void c_FileMgr::DeleteFlashFile (String FileName)
+{
+    // DEBUG_START;
+
+    remove (HostPath (FileName).c_str ());
+    DeleteConfigSnapshot (FileName);
+
+    // DEBUG_END;
+} // DeleteFlashFile
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::LoadFlashFile (const String & FileName, DeserializationHandler Handler)
+{
+    // DEBUG_START;
+
+    bool retval = false;
+
+    do // once
+    {
+        String CfgFileMessagePrefix = String (CN_Configuration_File_colon) + "'" + FileName + "' ";
+
+        uint32_t StartTimeUs = micros ();
+        struct stat FileInfo;
+        if (0 != stat (HostPath (FileName).c_str (), &FileInfo))
+        {
+            logcon (String (CN_stars) + CfgFileMessagePrefix + String (F (" Could not read file ")) + CN_stars);
+            break;
+        }
+
+        JsonDocument jsonDoc;
+        bool FromSnapshot = LoadConfigSnapshot (FileName, uint32_t (FileInfo.st_size), uint32_t (FileInfo.st_mtime), jsonDoc);
+        if (!FromSnapshot && !ReadFlashFile (FileName, jsonDoc))
+        {
+            logcon (String (CN_stars) + CfgFileMessagePrefix + String (F (" Could not read file ")) + CN_stars);
+            break;
+        }
+        uint32_t LoadTimeUs = micros () - StartTimeUs;
+
+        ConfigSnapshot.CountLoad (FromSnapshot, LoadTimeUs);
+        logcon (CfgFileMessagePrefix + String (FromSnapshot ? F ("loaded from snapshot in ") : F ("loaded in ")) + String (LoadTimeUs) + F (" us."));
+        if (!FromSnapshot)
+        {
+            SaveConfigSnapshot (FileName, jsonDoc);
+        }
+        Handler (jsonDoc);
+        retval = true;
+
+    } while (false);
+
+    // DEBUG_END;
+    return retval;
+
+} // LoadFlashFile
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::LoadConfigSnapshot (const String & FileName, uint32_t JsonFileSize, uint32_t JsonFileTime, JsonDocument & Doc)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+    uint8_t * pData = nullptr;
+
+    do // once
+    {
+        if (!ConfigSnapshot.IsCached (FileName))
+        {
+            break;
+        }
+
+        String SnapshotPath = HostPath (ConfigSnapshot.GetFileName (FileName));
+        struct stat FileInfo;
+        if (0 != stat (SnapshotPath.c_str (), &FileInfo))
+        {
+            break;
+        }
+
+        FILE * file = fopen (SnapshotPath.c_str (), "rb");
+        if (nullptr == file)
+        {
+            break;
+        }
+
+        size_t Length = size_t (FileInfo.st_size);
+        pData = (uint8_t *)SpiRam.Malloc (Length);
+        if (nullptr != pData)
+        {
+            Length = fread (pData, 1, Length, file);
+        }
+        fclose (file);
+
+        if (nullptr == pData)
+        {
+            break;
+        }
+
+        Response = ConfigSnapshot.Decode (pData, Length, JsonFileSize, JsonFileTime, Doc);
+
+    } while (false);
+
+    SpiRam.Free (pData);
+
+    // DEBUG_END;
+    return Response;
+
+} // LoadConfigSnapshot
+
+//-----------------------------------------------------------------------------
+void c_FileMgr::SaveConfigSnapshot (const String & FileName, JsonDocument & Doc)
+{
+    // DEBUG_START;
+
+    uint8_t * pData = nullptr;
+
+    do // once
+    {
+        if (!ConfigSnapshot.IsCached (FileName))
+        {
+            break;
+        }
+
+        struct stat FileInfo;
+        if (0 != stat (HostPath (FileName).c_str (), &FileInfo))
+        {
+            break;
+        }
+
+        size_t Length;
+        pData = ConfigSnapshot.Encode (Doc, uint32_t (FileInfo.st_size), uint32_t (FileInfo.st_mtime), Length);
+        if (nullptr == pData)
+        {
+            DeleteConfigSnapshot (FileName);
+            break;
+        }
+
+        FILE * file = fopen (HostPath (ConfigSnapshot.GetFileName (FileName)).c_str (), "wb");
+        if (nullptr == file)
+        {
+            break;
+        }
+        bool Written = (Length == fwrite (pData, 1, Length, file));
+        fclose (file);
+
+        if (!Written)
+        {
+            DeleteConfigSnapshot (FileName);
+        }
+
+    } while (false);
+
+    SpiRam.Free (pData);
+
+    // DEBUG_END;
+} // SaveConfigSnapshot
+
+//-----------------------------------------------------------------------------
+void c_FileMgr::DeleteConfigSnapshot (const String & FileName)
+{
+    if (ConfigSnapshot.IsCached (FileName))
+    {
+        remove (HostPath (ConfigSnapshot.GetFileName (FileName)).c_str ());
+    }
+
+} // DeleteConfigSnapshot
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::SaveFlashFile (const String & FileName, String & FileData)
+{
+    return SaveFlashFile (FileName, FileData.c_str ());
+
+} // SaveFlashFile
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::SaveFlashFile (const String & FileName, const char * FileData)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+    String FileDataString = FileData;
+
+    JsonDocument jsonDoc;
+    DeserializationError error = deserializeJson (jsonDoc, FileDataString);
+    if (error)
+    {
+        logcon (String (CN_stars) + F ("Configuration for '") + FileName + F ("' was not valid JSON: ") + error.c_str () + CN_stars);
+    }
+    else
+    {
+        Response = SaveFlashFile (FileName, jsonDoc);
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // SaveFlashFile
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::SaveFlashFile (const String & FileName, JsonDocument & FileData)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        String Data;
+        serializeJson (FileData, Data);
+
+        FILE * file = fopen (HostPath (FileName).c_str (), "wb");
+        if (nullptr == file)
+        {
+            logcon (String (CN_stars) + F ("Could not open '") + HostPath (FileName) + F ("' for writing.") + CN_stars);
+            break;
+        }
+
+        Response = (Data.length () == fwrite (Data.c_str (), 1, Data.length (), file));
+        fclose (file);
+
+        // keep the binary copy of a config file in step
+        if (ConfigSnapshot.IsCached (FileName) && FlashFileExists (ConfigSnapshot.GetFileName (FileName)))
+        {
+            SaveConfigSnapshot (FileName, FileData);
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // SaveFlashFile
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::ReadFlashFile (const String & FileName, String & FileData)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+    FileData = emptyString;
+
+    FILE * file = fopen (HostPath (FileName).c_str (), "rb");
+    if (nullptr != file)
+    {
+        char Buffer[512];
+        size_t NumBytesRead;
+        while (0 != (NumBytesRead = fread (Buffer, 1, sizeof (Buffer), file)))
+        {
+            FileData.concat (Buffer, NumBytesRead);
+        }
+        fclose (file);
+        Response = true;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // ReadFlashFile
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::ReadFlashFile (const String & FileName, JsonDocument & FileData)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        String RawFileData;
+        if (!ReadFlashFile (FileName, RawFileData))
+        {
+            break;
+        }
+
+        DeserializationError error = deserializeJson (FileData, RawFileData);
+        if (error)
+        {
+            logcon (String (CN_stars) + F ("Configuration File: '") + FileName + F ("' Deserialzation Error. Error code = ") + error.c_str () + CN_stars);
+            break;
+        }
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // ReadFlashFile
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::ReadFlashFile (const String & FileName, byte * FileData, size_t maxlen)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    String RawFileData;
+    if (ReadFlashFile (FileName, RawFileData) && (RawFileData.length () < maxlen))
+    {
+        memcpy (FileData, RawFileData.c_str (), RawFileData.length () + 1);
+        Response = true;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // ReadFlashFile
+
+//-----------------------------------------------------------------------------
+bool c_FileMgr::FlashFileExists (const String & FileName)
+{
+    struct stat FileInfo;
+    return (0 == stat (HostPath (FileName).c_str (), &FileInfo));
+
+} // FlashFileExists
+
+// create a global instance of the File Manager
+c_FileMgr FileMgr;
@@ -0,0 +1,89 @@
+/*
+* NativeInputMgr.cpp - Input manager for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Stands in for InputMgr.cpp. No input drivers are instantiated, the
+*   simulator writes the channel data straight into the output buffer.
+*/
+
+#include "input/InputMgr.hpp"
+
+//-----------------------------------------------------------------------------
+c_InputMgr::c_InputMgr ()
+{
+    SafeStrncpy(ConfigFileName, (String (F ("/")) + String (CN_input_config) + F (".json")).c_str(), sizeof(ConfigFileName));
+
+    int InputChannelDriversIndex = 0;
+    for (auto & CurrentInput : InputChannelDrivers)
+    {
+        memset(CurrentInput.InputDriver, 0x0, sizeof(CurrentInput.InputDriver));
+        CurrentInput.DriverInUse = false;
+        CurrentInput.DriverId = InputChannelDriversIndex;
+
+        EffectEngineIsConfiguredToRun[InputChannelDriversIndex] = false;
+        ++InputChannelDriversIndex;
+    }
+
+} // c_InputMgr
+
+//-----------------------------------------------------------------------------
+c_InputMgr::~c_InputMgr ()
+{
+} // ~c_InputMgr
+
+//-----------------------------------------------------------------------------
+void c_InputMgr::ProcessButtonActions (c_ExternalInput::InputValue_t value)
+{
+    // DEBUG_START;
+
+    (void)value;
+
+    // DEBUG_END;
+} // ProcessButtonActions
+
+//-----------------------------------------------------------------------------
+void c_InputMgr::SetBufferInfo (uint32_t BufferSize)
+{
+    // DEBUG_START;
+
+    InputDataBufferSize = BufferSize;
+
+    // DEBUG_END;
+} // SetBufferInfo
+
+//-----------------------------------------------------------------------------
+void c_InputMgr::SetOperationalState (bool ActiveFlag)
+{
+    // DEBUG_START;
+
+    PauseProcessing = !ActiveFlag;
+
+    // DEBUG_END;
+} // SetOperationalState
+
+//-----------------------------------------------------------------------------
+void c_InputMgr::SignalWork ()
+{
+    // no input task to wake
+} // SignalWork
+
+//-----------------------------------------------------------------------------
+void IRAM_ATTR c_InputMgr::ISR_SignalWork ()
+{
+} // ISR_SignalWork
+
+// create a global instance of the Input channel factory
+c_InputMgr InputMgr;
@@ -0,0 +1,559 @@
+/*
+* NativeMain.cpp - Entry point for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Replaces main.cpp. Starts the output manager against the simulated
+*   peripherals, selects the output protocols, sends a number of frames of
+*   test data through WriteChannelData (or replays a network capture
+*   through the input drivers) and writes the captured bitstreams as CSV
+*   files. With --verify it checks the waveform of every pixel protocol
+*   against its datasheet timing instead. With --selftest it runs the
+*   output self test and prints its report.
+*
+*   .pio/build/native/program [options]
+*       --fs <dir>          directory that holds the flash files (default .)
+*       --port <id>=<type>  run output protocol <type> on port <id>
+*       --frames <n>        number of frames to send (default 10)
+*       --frame-ms <n>      time between frames (default 25)
+*       --out <prefix>      prefix for the capture files (default capture)
+*       --bench <filter>    run the benchmarks whose name contains <filter>
+*                           ("all" runs every one) instead of the simulation
+*       --bench-ms <n>      minimum time spent measuring each benchmark (default 200)
+*       --bench-json <file> also write the benchmark results as JSON
+*       --replay <file>     replay a pcap or packet log through the E1.31,
+*                           Art-Net and DDP inputs instead of sending frames
+*       --replay-speed <x>  1 = recorded timing (default), 0 = as fast as possible
+*       --universe <n>      first universe of the replay inputs (default 1)
+*       --universe-limit <n>
+*                           channels per universe of the replay inputs (default 512)
+*       --verify <filter>   verify the waveform of the pixel protocols whose name
+*                           contains <filter> ("all" checks every one) on port 0
+*       --verify-json <file>
+*                           also write the verifier results as JSON
+*       --selftest <n>      run the output self test for <n> seconds on the
+*                           configured ports instead of sending frames
+*
+*   Captures:
+*       <prefix>_gpio<n>.csv    time_ns,level       every edge on the pin
+*       <prefix>_rmt<n>.csv     time_ns,level0,duration0,level1,duration1,tick_ps
+*       <prefix>_uart<n>.csv    time_ns,value,bit_ps
+*/
+
+#include "ESPixelStick.h"
+#include "input/InputMgr.hpp"
+#include "output/OutputMgr.hpp"
+#include "FileMgr.hpp"
+#include "NativeRmt.hpp"
+#include "NativeUart.hpp"
+#include "NativeBench.hpp"
+#include "NativeReplay.hpp"
+#include "NativeVerify.hpp"
+#include <map>
+
+ConstConfig_t ConstConfig =
+{
+    "configFoundHere",
+#ifdef ESPS_VERSION
+    STRING(ESPS_VERSION),
+#else
+    "4.x-dev",
+#endif // ESPS_VERSION,
+    __DATE__ " - " __TIME__,
+    "/config.json",
+    1
+};
+
+String GlobalRebootReason = emptyString;
+
+config_t config;                    // Current configuration
+static const uint32_t NotRebootingValue = uint32_t(-1);
+uint32_t RebootCount = NotRebootingValue;
+bool     ResetWiFi = false;
+bool     IsBooting = true;  // Configuration initialization flag
+bool     ConfigSaveNeeded = false;
+bool     ConsoleUartIsActive = true;
+
+uint32_t DiscardedRxData = 0;
+
+void GetDriverName (String & Name) { Name = F("Native"); }
+
+//-----------------------------------------------------------------------------
+bool RebootInProgress()
+{
+    return RebootCount != NotRebootingValue;
+}
+
+//-----------------------------------------------------------------------------
+void RequestReboot(String & Reason, uint32_t DelayMs, bool SkipDisable /* = false */)
+{
+    GlobalRebootReason = Reason;
+    RebootCount = DelayMs;
+    if(!SkipDisable)
+    {
+        InputMgr.SetOperationalState(false);
+        OutputMgr.PauseOutputs(true);
+    }
+
+} // RequestReboot
+
+//-----------------------------------------------------------------------------
+void DelayReboot(uint32_t MinDelayMs)
+{
+    if (NotRebootingValue != RebootCount)
+    {
+        RebootCount = (RebootCount < MinDelayMs) ? MinDelayMs: RebootCount;
+    }
+} // DelayReboot
+
+//-----------------------------------------------------------------------------
+void FeedWDT ()
+{
+} // FeedWDT
+
+//-----------------------------------------------------------------------------
+void PrettyPrint(JsonDocument &jsonStuff, String Name)
+{
+    LOG_PORT.println (String (F ("---- Pretty Print: '")) + Name + "'");
+    serializeJson (jsonStuff, LOG_PORT);
+    LOG_PORT.println ("");
+
+} // PrettyPrint
+
+//-----------------------------------------------------------------------------
+void PrettyPrint (JsonArray& jsonStuff, String Name)
+{
+    LOG_PORT.println (String (F ("---- Pretty Print: '")) + Name + "'");
+    serializeJson (jsonStuff, LOG_PORT);
+    LOG_PORT.println ("");
+
+} // PrettyPrint
+
+//-----------------------------------------------------------------------------
+void PrettyPrint (JsonObject& jsonStuff, String Name)
+{
+    LOG_PORT.println (String (F ("---- Pretty Print: '")) + Name + "'");
+    serializeJson (jsonStuff, LOG_PORT);
+    LOG_PORT.println ("");
+
+} // PrettyPrint
+
+//-----------------------------------------------------------------------------
+struct NativeOptions_t
+{
+    uint32_t    NumFrames       = 10;
+    uint32_t    FramePeriodMs   = 25;
+    String      CapturePrefix   = F("capture");
+    String      BenchFilter;
+    uint32_t    BenchMinMs      = 200;
+    String      BenchJsonFile;
+    String      ReplayFile;
+    double      ReplaySpeed     = 1.0;
+    uint16_t    FirstUniverse   = 1;
+    uint16_t    ChannelsPerUniverse = 512;
+    String      VerifyFilter;
+    String      VerifyJsonFile;
+    uint32_t    SelfTestSec     = 0;
+    std::map<uint32_t, int32_t> PortTypes;  ///< port id, output protocol
+};
+
+//-----------------------------------------------------------------------------
+static void Usage (const char * ProgramName)
+{
+    fprintf (stderr, "usage: %s [--fs <dir>] [--port <id>=<type>]... [--frames <n>] [--frame-ms <n>] [--out <prefix>]\n", ProgramName);
+    fprintf (stderr, "       %s --bench <filter> [--bench-ms <n>] [--bench-json <file>]\n", ProgramName);
+    fprintf (stderr, "       %s [--fs <dir>] [--port <id>=<type>]... --replay <file> [--replay-speed <x>] [--universe <n>] [--universe-limit <n>]\n", ProgramName);
+    fprintf (stderr, "       %s [--fs <dir>] [--frames <n>] --verify <filter> [--verify-json <file>]\n", ProgramName);
+    fprintf (stderr, "       %s [--fs <dir>] [--port <id>=<type>]... --selftest <n>\n", ProgramName);
+    NativeSim.Exit (2);
+
+} // Usage
+
+//-----------------------------------------------------------------------------
+static void ParseCommandLine (int argc, char ** argv, NativeOptions_t & Options)
+{
+    for (int index = 1; index < argc; ++index)
+    {
+        String Option = argv[index];
+        if ((index + 1) >= argc)
+        {
+            Usage (argv[0]);
+        }
+        const char * Value = argv[++index];
+
+        if (Option.equals (F("--fs")))
+        {
+            setenv ("ESPS_NATIVE_FS", Value, 1);
+        }
+        else if (Option.equals (F("--port")))
+        {
+            unsigned PortId;
+            int      PortType;
+            if (2 != sscanf (Value, "%u=%d", &PortId, &PortType))
+            {
+                Usage (argv[0]);
+            }
+            Options.PortTypes[PortId] = PortType;
+        }
+        else if (Option.equals (F("--frames")))
+        {
+            Options.NumFrames = strtoul (Value, nullptr, 0);
+        }
+        else if (Option.equals (F("--frame-ms")))
+        {
+            Options.FramePeriodMs = max (1UL, strtoul (Value, nullptr, 0));
+        }
+        else if (Option.equals (F("--out")))
+        {
+            Options.CapturePrefix = Value;
+        }
+        else if (Option.equals (F("--bench")))
+        {
+            Options.BenchFilter = Value;
+        }
+        else if (Option.equals (F("--bench-ms")))
+        {
+            Options.BenchMinMs = strtoul (Value, nullptr, 0);
+        }
+        else if (Option.equals (F("--bench-json")))
+        {
+            Options.BenchJsonFile = Value;
+        }
+        else if (Option.equals (F("--replay")))
+        {
+            Options.ReplayFile = Value;
+        }
+        else if (Option.equals (F("--replay-speed")))
+        {
+            Options.ReplaySpeed = max (0.0, strtod (Value, nullptr));
+        }
+        else if (Option.equals (F("--universe")))
+        {
+            Options.FirstUniverse = uint16_t (strtoul (Value, nullptr, 0));
+        }
+        else if (Option.equals (F("--universe-limit")))
+        {
+            Options.ChannelsPerUniverse = uint16_t (strtoul (Value, nullptr, 0));
+        }
+        else if (Option.equals (F("--verify")))
+        {
+            Options.VerifyFilter = Value;
+        }
+        else if (Option.equals (F("--verify-json")))
+        {
+            Options.VerifyJsonFile = Value;
+        }
+        else if (Option.equals (F("--selftest")))
+        {
+            Options.SelfTestSec = max (1UL, strtoul (Value, nullptr, 0));
+        }
+        else
+        {
+            Usage (argv[0]);
+        }
+    }
+
+} // ParseCommandLine
+
+//-----------------------------------------------------------------------------
+static void SelectOutputProtocols (NativeOptions_t & Options)
+{
+    do // once
+    {
+        bool ConfigChanged = false;
+        String ConfigFileName = String ("/") + String (CN_output_config) + CN_Dotjson;
+
+        JsonDocument JsonConfigDoc;
+        if (!FileMgr.ReadFlashFile (ConfigFileName, JsonConfigDoc))
+        {
+            logcon (String (F ("Could not read ")) + ConfigFileName);
+            break;
+        }
+
+        JsonObject JsonChannels = JsonConfigDoc[(char*)CN_output_config][(char*)CN_channels];
+        for (auto & CurrentPortType : Options.PortTypes)
+        {
+            JsonObject JsonChannel = JsonChannels[String (CurrentPortType.first)];
+            if (!JsonChannel || !JsonChannel[String (CurrentPortType.second)])
+            {
+                logcon (String (F ("Port ")) + String (CurrentPortType.first) + F (" does not support output type ") + String (CurrentPortType.second));
+                continue;
+            }
+
+            JsonWrite (JsonChannel, CN_type, CurrentPortType.second);
+            ConfigChanged = true;
+        }
+
+        if (ConfigChanged)
+        {
+            OutputMgr.SetConfig (JsonConfigDoc);
+            OutputMgr.LoadConfig ();
+        }
+
+    } while (false);
+
+} // SelectOutputProtocols
+
+//-----------------------------------------------------------------------------
+/*
+    A config created on a clean file system must not make any port a clone.
+    The UI numbers the outputs from 1, clone_of 0 means not a clone.
+*/
+static void CheckNewOutputConfig ()
+{
+    String ConfigFileName = String ("/") + String (CN_output_config) + CN_Dotjson;
+
+    JsonDocument JsonConfigDoc;
+    if (!FileMgr.ReadFlashFile (ConfigFileName, JsonConfigDoc))
+    {
+        logcon (String (F ("Could not read ")) + ConfigFileName);
+        NativeSim.Exit (1);
+    }
+
+    bool Passed = true;
+    JsonObject JsonChannels = JsonConfigDoc[(char*)CN_output_config][(char*)CN_channels];
+    for (JsonPair CurrentChannel : JsonChannels)
+    {
+        JsonObject JsonChannel = CurrentChannel.value ();
+        for (JsonPair CurrentType : JsonChannel)
+        {
+            JsonObject JsonTypeConfig = CurrentType.value ();
+            uint32_t CloneOf = JsonTypeConfig[(char*)CN_clone_of].as<uint32_t> ();
+            if (0 != CloneOf)
+            {
+                logcon (String (F ("New config: port ")) + CurrentChannel.key ().c_str () + F (" type ") + CurrentType.key ().c_str () +
+                        F (" is a clone of output ") + String (CloneOf));
+                Passed = false;
+            }
+        }
+    }
+
+    if (!Passed)
+    {
+        NativeSim.Exit (1);
+    }
+
+} // CheckNewOutputConfig
+
+//-----------------------------------------------------------------------------
+static void WriteCaptures (NativeOptions_t & Options, uint64_t CaptureStartPs, const uint8_t * StartLevels)
+{
+    for (uint32_t Pin = 0; Pin < NATIVE_SIM_NUM_GPIO; ++Pin)
+    {
+        auto & Edges = NativeSim.GetEdges (Pin);
+        if (Edges.empty ())
+        {
+            continue;
+        }
+
+        String FileName = Options.CapturePrefix + F ("_gpio") + String (Pin) + F (".csv");
+        FILE * file = fopen (FileName.c_str (), "w");
+        if (nullptr == file)
+        {
+            continue;
+        }
+        fprintf (file, "time_ns,level\n%.3f,%u\n", double (CaptureStartPs) / 1000.0, StartLevels[Pin]);
+        for (auto & CurrentEdge : Edges)
+        {
+            fprintf (file, "%.3f,%u\n", double (CurrentEdge.TimePs) / 1000.0, CurrentEdge.Level);
+        }
+        fclose (file);
+        LOG_PORT.printf ("gpio%-2u %8u edges  %s\n", unsigned (Pin), unsigned (Edges.size ()), FileName.c_str ());
+    }
+
+    for (uint32_t Channel = 0; Channel < RMT_LL_NUM_CHANNELS; ++Channel)
+    {
+        auto & Items = NativeRmt.GetItems (Channel);
+        if (Items.empty ())
+        {
+            continue;
+        }
+
+        String FileName = Options.CapturePrefix + F ("_rmt") + String (Channel) + F (".csv");
+        FILE * file = fopen (FileName.c_str (), "w");
+        if (nullptr == file)
+        {
+            continue;
+        }
+        fprintf (file, "time_ns,level0,duration0,level1,duration1,tick_ps\n");
+        uint64_t TickPs = NativeRmt.GetTickPs (Channel);
+        for (auto & CurrentItem : Items)
+        {
+            fprintf (file, "%.3f,%u,%u,%u,%u,%u\n", double (CurrentItem.TimePs) / 1000.0,
+                     CurrentItem.Item.level0, CurrentItem.Item.duration0,
+                     CurrentItem.Item.level1, CurrentItem.Item.duration1,
+                     unsigned (TickPs));
+        }
+        fclose (file);
+        LOG_PORT.printf ("rmt%-3u %8u items  %s\n", unsigned (Channel), unsigned (Items.size ()), FileName.c_str ());
+    }
+
+    for (uint32_t UartId = 0; UartId < UART_NUM_MAX; ++UartId)
+    {
+        auto & Bytes = NativeUart[UartId].GetBytes ();
+        if (Bytes.empty ())
+        {
+            continue;
+        }
+
+        String FileName = Options.CapturePrefix + F ("_uart") + String (UartId) + F (".csv");
+        FILE * file = fopen (FileName.c_str (), "w");
+        if (nullptr == file)
+        {
+            continue;
+        }
+        fprintf (file, "time_ns,value,bit_ps\n");
+        uint64_t BitPs = NativeUart[UartId].GetBitPs ();
+        for (auto & CurrentByte : Bytes)
+        {
+            fprintf (file, "%.3f,%u,%u\n", double (CurrentByte.TimePs) / 1000.0, CurrentByte.Value, unsigned (BitPs));
+        }
+        fclose (file);
+        LOG_PORT.printf ("uart%-2u %8u bytes  %s\n", unsigned (UartId), unsigned (Bytes.size ()), FileName.c_str ());
+    }
+
+} // WriteCaptures
+
+//-----------------------------------------------------------------------------
+[[noreturn]] static void RunSelfTest (uint32_t DurationSec)
+{
+    OutputMgr.ScheduleSelfTest (DurationSec * 1000);
+
+    // the request is picked up by the first poll
+    do
+    {
+        OutputMgr.Poll ();
+        delay (1);
+    } while (OutputMgr.SelfTestIsRunning ());
+
+    JsonDocument JsonStatusDoc;
+    JsonObject JsonStatus = JsonStatusDoc.to<JsonObject> ();
+    OutputMgr.GetStatus (JsonStatus);
+    serializeJsonPretty (JsonStatus[F ("selftest")], LOG_PORT);
+    LOG_PORT.println ("");
+
+    NativeSim.Exit (JsonStatus[F ("selftest")] ? 0 : 1);
+
+} // RunSelfTest
+
+//-----------------------------------------------------------------------------
+int main (int argc, char ** argv)
+{
+    NativeOptions_t Options;
+    ParseCommandLine (argc, argv, Options);
+
+    c_NativeVerify * pVerify = nullptr;
+    if (!Options.VerifyFilter.isEmpty ())
+    {
+        // only the children return, each one runs the protocol it is given on port 0
+        pVerify = new c_NativeVerify ();
+        int32_t OutputType = pVerify->Fork (Options.VerifyFilter, Options.VerifyJsonFile);
+        Options.PortTypes.clear ();
+        Options.PortTypes[0] = OutputType;
+    }
+
+    NativeRmt.Begin ();
+    for (uint32_t UartId = 0; UartId < UART_NUM_MAX; ++UartId)
+    {
+        NativeUart[UartId].Begin (uart_port_t (UartId));
+    }
+
+    if (!Options.BenchFilter.isEmpty ())
+    {
+        // the benchmark builds its own drivers, the output manager is not started
+        c_NativeBench * pBench = new c_NativeBench ();
+        pBench->Run (Options.BenchFilter, Options.BenchMinMs, Options.BenchJsonFile);
+        NativeSim.Exit (0);
+    }
+
+    SafeStrncpy(config.id, String(F("ESPixelStick")).c_str(), sizeof(config.id));
+    logcon (String(CN_ESPixelStick) + " v" + ConstConfig.Version + " (" + ConstConfig.BuildDate + ") on " + BOARD_NAME);
+
+    InputMgr.SetBufferInfo (0);
+    bool NewOutputConfig = !FileMgr.FlashFileExists (String ("/") + String (CN_output_config) + CN_Dotjson);
+    OutputMgr.Begin ();
+    if (NewOutputConfig)
+    {
+        CheckNewOutputConfig ();
+    }
+    SelectOutputProtocols (Options);
+    IsBooting = false;
+
+    if (nullptr != pVerify)
+    {
+        pVerify->Run (Options.NumFrames);
+    }
+
+    if (Options.SelfTestSec)
+    {
+        RunSelfTest (Options.SelfTestSec);
+    }
+
+    // only capture what the frames produce
+    uint8_t StartLevels[NATIVE_SIM_NUM_GPIO];
+    for (uint32_t Pin = 0; Pin < NATIVE_SIM_NUM_GPIO; ++Pin)
+    {
+        StartLevels[Pin] = NativeSim.DigitalRead (Pin);
+    }
+    uint64_t CaptureStartPs = NativeSim.NowPs ();
+    NativeSim.ClearCapture ();
+    NativeRmt.ClearCapture ();
+    for (auto & CurrentUart : NativeUart)
+    {
+        CurrentUart.ClearCapture ();
+    }
+
+    if (!Options.ReplayFile.isEmpty ())
+    {
+        // the inputs keep their sockets, so the replay object is never deleted
+        c_NativeReplay * pReplay = new c_NativeReplay ();
+        if (!pReplay->Run (Options.ReplayFile, Options.ReplaySpeed, Options.FirstUniverse, Options.ChannelsPerUniverse))
+        {
+            NativeSim.Exit (1);
+        }
+    }
+    else
+    {
+        uint32_t NumChannels = OutputMgr.GetBufferUsedSize ();
+        logcon (String (F ("Sending ")) + String (Options.NumFrames) + F (" frames of ") + String (NumChannels) + F (" channels"));
+
+        uint8_t * FrameData = (uint8_t*)malloc (max (NumChannels, uint32_t (1)));
+        for (uint32_t FrameId = 0; FrameId < Options.NumFrames; ++FrameId)
+        {
+            // a ramp that moves one step per frame
+            for (uint32_t ChannelId = 0; ChannelId < NumChannels; ++ChannelId)
+            {
+                FrameData[ChannelId] = uint8_t (ChannelId + FrameId);
+            }
+            OutputMgr.WriteChannelData (0, NumChannels, FrameData);
+
+            for (uint32_t Ms = 0; Ms < Options.FramePeriodMs; ++Ms)
+            {
+                OutputMgr.Poll ();
+                delay (1);
+            }
+        }
+        free (FrameData);
+
+        // let the last frame drain
+        delay (Options.FramePeriodMs);
+    }
+
+    logcon (String (F ("Simulated time: ")) + String (double (NativeSim.NowPs () - CaptureStartPs) / double (NATIVE_SIM_PS_PER_MS), 3) + F (" ms"));
+    WriteCaptures (Options, CaptureStartPs, StartLevels);
+
+    NativeSim.Exit (0);
+
+} // main
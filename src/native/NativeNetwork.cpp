@@ -0,0 +1,419 @@
+/*
+* NativeNetwork.cpp - Loopback network for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*   Stands in for NetworkMgr.cpp, WiFiDriver.cpp and FPPDiscovery.cpp and
+*   provides the AsyncUDP, ESPAsyncE131 and Artnet libraries on top of the
+*   loopback network. The network manager reports a connection as soon as
+*   it is started.
+*/
+
+#include "ESPixelStick.h"
+#include "network/NetworkMgr.hpp"
+#include "service/FPPDiscovery.h"
+#include "FileMgr.hpp"
+#include "utility/TimerWheel.hpp"
+#include <ESPAsyncE131.h>
+#include <Artnet.h>
+
+WiFiClass WiFi;
+
+//-----------------------------------------------------------------------------
+// AsyncUDP
+//-----------------------------------------------------------------------------
+std::vector<AsyncUDP *> AsyncUDP::Sockets;
+uint32_t                AsyncUDP::TxCount = 0;
+
+//-----------------------------------------------------------------------------
+AsyncUDP::AsyncUDP ()
+{
+} // AsyncUDP
+
+//-----------------------------------------------------------------------------
+AsyncUDP::~AsyncUDP ()
+{
+    close ();
+} // ~AsyncUDP
+
+//-----------------------------------------------------------------------------
+bool AsyncUDP::listen (const IPAddress addr, uint16_t port)
+{
+    // DEBUG_START;
+
+    (void)addr;
+
+    if (0 == Port)
+    {
+        Sockets.push_back (this);
+    }
+    Port = port;
+
+    // DEBUG_END;
+    return true;
+
+} // listen
+
+//-----------------------------------------------------------------------------
+bool AsyncUDP::listenMulticast (const IPAddress addr, uint16_t port, uint8_t ttl)
+{
+    (void)ttl;
+    return listen (addr, port);
+
+} // listenMulticast
+
+//-----------------------------------------------------------------------------
+void AsyncUDP::close ()
+{
+    // DEBUG_START;
+
+    auto Socket = std::find (Sockets.begin (), Sockets.end (), this);
+    if (Socket != Sockets.end ())
+    {
+        Sockets.erase (Socket);
+    }
+    Port = 0;
+
+    // DEBUG_END;
+} // close
+
+//-----------------------------------------------------------------------------
+size_t AsyncUDP::sendTo (AsyncUDPMessage & message, const IPAddress addr, uint16_t port)
+{
+    return writeTo (message.data (), message.length (), addr, port);
+
+} // sendTo
+
+//-----------------------------------------------------------------------------
+size_t AsyncUDP::writeTo (const uint8_t * data, size_t len, const IPAddress addr, uint16_t port)
+{
+    (void)data;
+    (void)addr;
+    (void)port;
+
+    ++TxCount;
+    return len;
+
+} // writeTo
+
+//-----------------------------------------------------------------------------
+uint32_t AsyncUDP::Deliver (uint8_t * data, size_t len, IPAddress remoteIP, uint16_t remotePort, IPAddress localIP, uint16_t localPort)
+{
+    // DEBUG_START;
+
+    uint32_t NumListeners = 0;
+
+    // a handler may close its socket, so walk a copy of the list
+    std::vector<AsyncUDP *> Listeners = Sockets;
+    for (auto CurrentSocket : Listeners)
+    {
+        if ((localPort != CurrentSocket->Port) || !CurrentSocket->Handler)
+        {
+            continue;
+        }
+
+        AsyncUDPPacket Packet (CurrentSocket, data, len, remoteIP, remotePort, localIP, localPort);
+        CurrentSocket->Handler (Packet);
+        ++NumListeners;
+    }
+
+    // DEBUG_END;
+    return NumListeners;
+
+} // Deliver
+
+//-----------------------------------------------------------------------------
+size_t AsyncUDPPacket::send (AsyncUDPMessage & message)
+{
+    return Udp->sendTo (message, RemoteIP, RemotePort);
+
+} // send
+
+//-----------------------------------------------------------------------------
+// ESPAsyncE131
+//-----------------------------------------------------------------------------
+static const uint8_t  E131_ACN_ID[12]   = { 0x41, 0x53, 0x43, 0x2d, 0x45, 0x31, 0x2e, 0x31, 0x37, 0x00, 0x00, 0x00 };
+static const uint32_t E131_VECTOR_ROOT  = 4;
+static const uint32_t E131_VECTOR_FRAME = 2;
+static const uint8_t  E131_VECTOR_DMP   = 2;
+
+//-----------------------------------------------------------------------------
+ESPAsyncE131::ESPAsyncE131 (uint8_t buffers)
+{
+    (void)buffers;
+    memset ((void*)&stats, 0x00, sizeof (stats));
+
+} // ESPAsyncE131
+
+//-----------------------------------------------------------------------------
+bool ESPAsyncE131::begin (e131_listen_t type, ESPAsyncE131PortId UdpPortId, uint16_t universe, uint8_t n)
+{
+    // DEBUG_START;
+
+    (void)n;
+    bool Response;
+
+    if (E131_MULTICAST == type)
+    {
+        Response = udp.listenMulticast (IPAddress (239, 255, uint8_t (universe >> 8), uint8_t (universe)), UdpPortId);
+    }
+    else
+    {
+        Response = udp.listen (UdpPortId);
+    }
+
+    if (Response)
+    {
+        udp.onPacket (std::bind (&ESPAsyncE131::parsePacket, this, std::placeholders::_1));
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // begin
+
+//-----------------------------------------------------------------------------
+void ESPAsyncE131::parsePacket (AsyncUDPPacket & _packet)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        // the layers are read in place, so a short datagram is padded with zeros
+        size_t Length = min (_packet.length (), sizeof (Packet));
+        memcpy (Packet.raw, _packet.data (), Length);
+        memset (&Packet.raw[Length], 0x00, sizeof (Packet) - Length);
+
+        if ((0 != memcmp (Packet.acn_id, E131_ACN_ID, sizeof (Packet.acn_id))) ||
+            (E131_VECTOR_ROOT  != ntohl (Packet.root_vector)) ||
+            (E131_VECTOR_FRAME != ntohl (Packet.frame_vector)) ||
+            (E131_VECTOR_DMP   != Packet.dmp_vector))
+        {
+            stats.packet_errors++;
+            break;
+        }
+
+        if (0 != Packet.property_values[0])
+        {
+            // not DMX data. Ignored without an error
+            break;
+        }
+
+        if (PacketCallback)
+        {
+            PacketCallback (&Packet, UserInfo);
+        }
+
+        stats.num_packets++;
+        stats.last_clientIP   = _packet.remoteIP ();
+        stats.last_clientPort = _packet.remotePort ();
+        stats.last_seen       = millis ();
+
+    } while (false);
+
+    // DEBUG_END;
+} // parsePacket
+
+//-----------------------------------------------------------------------------
+// Artnet
+//-----------------------------------------------------------------------------
+static const uint8_t ART_NET_ID[8] = { 'A', 'r', 't', '-', 'N', 'e', 't', 0x00 };
+
+//-----------------------------------------------------------------------------
+Artnet::Artnet ()
+{
+    memset (artnetPacket, 0x00, sizeof (artnetPacket));
+
+} // Artnet
+
+//-----------------------------------------------------------------------------
+void Artnet::begin ()
+{
+    // DEBUG_START;
+
+    if (udp.listen (ART_NET_PORT))
+    {
+        udp.onPacket (std::bind (&Artnet::parsePacket, this, std::placeholders::_1));
+    }
+
+    // DEBUG_END;
+} // begin
+
+//-----------------------------------------------------------------------------
+void Artnet::parsePacket (AsyncUDPPacket & _packet)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        size_t Length = _packet.length ();
+        if ((Length <= ART_DMX_START) || (Length > sizeof (artnetPacket)))
+        {
+            break;
+        }
+
+        memcpy (artnetPacket, _packet.data (), Length);
+        memset (&artnetPacket[Length], 0x00, sizeof (artnetPacket) - Length);
+        if (0 != memcmp (artnetPacket, ART_NET_ID, sizeof (ART_NET_ID)))
+        {
+            break;
+        }
+
+        remoteIP = _packet.remoteIP ();
+        opcode   = artnetPacket[8] | artnetPacket[9] << 8;
+
+        if (ART_DMX == opcode)
+        {
+            uint8_t  sequence         = artnetPacket[12];
+            uint16_t incomingUniverse = artnetPacket[14] | artnetPacket[15] << 8;
+            uint16_t dmxDataLength    = min (uint16_t (artnetPacket[17] | artnetPacket[16] << 8), uint16_t (MAX_BUFFER_ARTNET - ART_DMX_START));
+
+            if (artDmxCallback)
+            {
+                (*artDmxCallback) (incomingUniverse, dmxDataLength, sequence, &artnetPacket[ART_DMX_START], remoteIP);
+            }
+        }
+        else if (ART_POLL == opcode)
+        {
+            if (artPollCallback)
+            {
+                (*artPollCallback) (broadcast);
+            }
+        }
+        else if (ART_SYNC == opcode)
+        {
+            if (artSyncCallback)
+            {
+                (*artSyncCallback) (remoteIP);
+            }
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+} // parsePacket
+
+//-----------------------------------------------------------------------------
+// Network manager
+//-----------------------------------------------------------------------------
+c_NetworkMgr::c_NetworkMgr ()
+{
+    memset(hostname, 0x0, sizeof(hostname));
+} // c_NetworkMgr
+
+//-----------------------------------------------------------------------------
+c_NetworkMgr::~c_NetworkMgr ()
+{
+} // ~c_NetworkMgr
+
+//-----------------------------------------------------------------------------
+void c_NetworkMgr::Begin ()
+{
+    // DEBUG_START;
+
+    SafeStrncpy (hostname, config.id, sizeof (hostname));
+    IsWiFiConnected = true;
+    PreviousState   = true;
+    HasBeenInitialized = true;
+    logcon (String (F ("Connected to the loopback network as ")) + WiFi.localIP ().toString ());
+
+    // DEBUG_END;
+} // Begin
+
+//-----------------------------------------------------------------------------
+void c_NetworkMgr::GetConfig (JsonObject & json)
+{
+    (void)json;
+} // GetConfig
+
+//-----------------------------------------------------------------------------
+void c_NetworkMgr::GetStatus (JsonObject & json)
+{
+    // DEBUG_START;
+
+    JsonObject NetworkStatus = json[(char*)CN_network].to<JsonObject> ();
+    JsonWrite(NetworkStatus, CN_hostname, String (hostname));
+
+    // DEBUG_END;
+} // GetStatus
+
+//-----------------------------------------------------------------------------
+bool c_NetworkMgr::SetConfig (JsonObject & json)
+{
+    (void)json;
+    return false;
+} // SetConfig
+
+//-----------------------------------------------------------------------------
+uint32_t c_NetworkMgr::Poll ()
+{
+    return TIMER_WHEEL_MAX_SLEEP_MS;
+} // Poll
+
+//-----------------------------------------------------------------------------
+void c_NetworkMgr::SetWiFiIsConnected (bool newState)
+{
+    IsWiFiConnected = newState;
+} // SetWiFiIsConnected
+
+//-----------------------------------------------------------------------------
+void c_NetworkMgr::SetEthernetIsConnected (bool newState)
+{
+    IsEthernetConnected = newState;
+} // SetEthernetIsConnected
+
+//-----------------------------------------------------------------------------
+IPAddress c_NetworkMgr::GetlocalIP ()
+{
+    return WiFi.localIP ();
+} // GetlocalIP
+
+//-----------------------------------------------------------------------------
+c_WiFiDriver::c_WiFiDriver ()
+{
+} // c_WiFiDriver
+
+//-----------------------------------------------------------------------------
+c_WiFiDriver::~c_WiFiDriver ()
+{
+} // ~c_WiFiDriver
+
+c_NetworkMgr NetworkMgr;
+
+//-----------------------------------------------------------------------------
+// FPP discovery
+//-----------------------------------------------------------------------------
+void c_FPPDiscovery::GetSysInfoJSON (JsonObject & jsonResponse)
+{
+    // DEBUG_START;
+
+    String Hostname;
+    NetworkMgr.GetHostname (Hostname);
+
+    JsonWrite(jsonResponse, CN_HostName,           Hostname);
+    JsonWrite(jsonResponse, F ("HostDescription"), config.id);
+    JsonWrite(jsonResponse, CN_Platform,           String(CN_ESPixelStick));
+    JsonWrite(jsonResponse, F ("Variant"),         String(CN_ESPixelStick) + "-" + BOARD_NAME);
+    JsonWrite(jsonResponse, F ("Mode"),            String(CN_bridge));
+    JsonWrite(jsonResponse, CN_Version,            ConstConfig.Version);
+    JsonWrite(jsonResponse, F ("UUID"),            NetworkMgr.GetWiFiMacAddress());
+
+    JsonArray jsonResponseIpAddresses = jsonResponse[F ("IPS")].to<JsonArray> ();
+    jsonResponseIpAddresses.add(NetworkMgr.GetlocalIP ().toString ());
+
+    // DEBUG_END;
+} // GetSysInfoJSON
+
+c_FPPDiscovery FPPDiscovery;
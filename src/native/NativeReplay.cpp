@@ -0,0 +1,517 @@
+/*
+* NativeReplay.cpp - Replays recorded E1.31 / Art-Net / DDP traffic in the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "NativeReplay.hpp"
+#include "input/InputE131.hpp"
+#include "input/InputArtnet.hpp"
+#include "input/InputDDP.h"
+#include "network/NetworkMgr.hpp"
+#include "output/OutputMgr.hpp"
+#include "utility/FrameLatency.hpp"
+#include <AsyncUDP.h>
+#include <chrono>
+
+static const uint32_t PCAP_MAGIC_US         = 0xa1b2c3d4;
+static const uint32_t PCAP_MAGIC_NS         = 0xa1b23c4d;
+static const uint32_t LINKTYPE_NULL         = 0;
+static const uint32_t LINKTYPE_ETHERNET     = 1;
+static const uint32_t LINKTYPE_RAW          = 101;
+static const uint32_t LINKTYPE_LINUX_SLL    = 113;
+static const uint32_t LINKTYPE_IPV4         = 228;
+static const uint32_t LINKTYPE_LINUX_SLL2   = 276;
+static const uint16_t ETHERTYPE_IPV4        = 0x0800;
+static const uint16_t ETHERTYPE_VLAN        = 0x8100;
+static const uint8_t  IP_PROTOCOL_UDP       = 17;
+
+static const IPAddress ReplaySourceIp (192, 168, 1, 100);
+
+//-----------------------------------------------------------------------------
+static inline uint16_t GetBe16 (const uint8_t * Data) { return uint16_t ((Data[0] << 8) | Data[1]); }
+
+//-----------------------------------------------------------------------------
+c_NativeReplay::c_NativeReplay ()
+{
+} // c_NativeReplay
+
+//-----------------------------------------------------------------------------
+c_NativeReplay::~c_NativeReplay ()
+{
+} // ~c_NativeReplay
+
+//-----------------------------------------------------------------------------
+bool c_NativeReplay::LoadCapture (const String & FileName)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        FILE * file = fopen (FileName.c_str (), "rb");
+        if (nullptr == file)
+        {
+            logcon (String (F ("Could not open ")) + FileName);
+            break;
+        }
+
+        uint32_t Magic = 0;
+        bool IsPcap = (sizeof (Magic) == fread (&Magic, 1, sizeof (Magic), file)) &&
+                      ((PCAP_MAGIC_US == Magic) || (PCAP_MAGIC_NS == Magic) ||
+                       (__builtin_bswap32 (PCAP_MAGIC_US) == Magic) || (__builtin_bswap32 (PCAP_MAGIC_NS) == Magic));
+        rewind (file);
+
+        Response = IsPcap ? LoadPcap (file) : LoadLog (file);
+        fclose (file);
+
+        logcon (String (F ("Loaded ")) + String (Packets.size ()) + F (" UDP packets from ") + FileName);
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // LoadCapture
+
+//-----------------------------------------------------------------------------
+bool c_NativeReplay::LoadPcap (FILE * file)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        uint8_t Header[24];
+        if (sizeof (Header) != fread (Header, 1, sizeof (Header), file))
+        {
+            logcon (F ("Truncated pcap header"));
+            break;
+        }
+
+        uint32_t Magic;
+        memcpy (&Magic, Header, sizeof (Magic));
+        bool Swapped    = (PCAP_MAGIC_US != Magic) && (PCAP_MAGIC_NS != Magic);
+        bool NanoSecond = (PCAP_MAGIC_NS == (Swapped ? __builtin_bswap32 (Magic) : Magic));
+        auto Get32      = [Swapped] (const uint8_t * Data)
+        {
+            uint32_t Value;
+            memcpy (&Value, Data, sizeof (Value));
+            return Swapped ? __builtin_bswap32 (Value) : Value;
+        };
+
+        uint32_t LinkType = Get32 (&Header[20]) & 0x0fffffff;
+        std::vector<uint8_t> Frame;
+        uint8_t RecordHeader[16];
+
+        while (sizeof (RecordHeader) == fread (RecordHeader, 1, sizeof (RecordHeader), file))
+        {
+            uint64_t TimeUs   = uint64_t (Get32 (&RecordHeader[0])) * MicroSecondsInASecond;
+            uint32_t Fraction = Get32 (&RecordHeader[4]);
+            TimeUs += NanoSecond ? (Fraction / 1000) : Fraction;
+
+            uint32_t CapturedLength = Get32 (&RecordHeader[8]);
+            if (CapturedLength > (256 * 1024))
+            {
+                logcon (String (F ("Corrupt pcap record of ")) + String (CapturedLength) + F (" bytes"));
+                break;
+            }
+
+            Frame.resize (CapturedLength);
+            if (CapturedLength != fread (Frame.data (), 1, CapturedLength, file))
+            {
+                // truncated capture. Keep what was read
+                break;
+            }
+
+            ParseFrame (LinkType, Frame.data (), CapturedLength, TimeUs);
+        }
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // LoadPcap
+
+//-----------------------------------------------------------------------------
+bool c_NativeReplay::ParseFrame (uint32_t LinkType, const uint8_t * Frame, uint32_t Length, uint64_t TimeUs)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        uint32_t Offset;
+        uint16_t EtherType = ETHERTYPE_IPV4;
+
+        switch (LinkType)
+        {
+            case LINKTYPE_ETHERNET:
+            {
+                Offset = 14;
+                if (Length < Offset) { break; }
+                EtherType = GetBe16 (&Frame[12]);
+                if ((ETHERTYPE_VLAN == EtherType) && (Length >= 18))
+                {
+                    EtherType = GetBe16 (&Frame[16]);
+                    Offset = 18;
+                }
+                break;
+            }
+
+            case LINKTYPE_LINUX_SLL:
+            {
+                Offset = 16;
+                if (Length >= Offset) { EtherType = GetBe16 (&Frame[14]); }
+                break;
+            }
+
+            case LINKTYPE_LINUX_SLL2:
+            {
+                Offset = 20;
+                if (Length >= Offset) { EtherType = GetBe16 (&Frame[0]); }
+                break;
+            }
+
+            case LINKTYPE_NULL:
+            {
+                Offset = 4;
+                break;
+            }
+
+            case LINKTYPE_RAW:
+            case LINKTYPE_IPV4:
+            {
+                Offset = 0;
+                break;
+            }
+
+            default:
+            {
+                Offset = Length;
+                break;
+            }
+        }
+
+        if ((ETHERTYPE_IPV4 != EtherType) || ((Offset + 20) > Length))
+        {
+            break;
+        }
+
+        const uint8_t * Ip = &Frame[Offset];
+        uint32_t IpHeaderLength = uint32_t (Ip[0] & 0x0f) * 4;
+        if ((0x40 != (Ip[0] & 0xf0)) || (IP_PROTOCOL_UDP != Ip[9]) || (0 != (GetBe16 (&Ip[6]) & 0x3fff)))
+        {
+            // not IPv4 UDP or a fragment
+            break;
+        }
+
+        const uint8_t * Udp = &Ip[IpHeaderLength];
+        if ((IpHeaderLength < 20) || ((Offset + IpHeaderLength + 8) > Length) || (GetBe16 (&Udp[4]) < 8))
+        {
+            break;
+        }
+
+        uint32_t PayloadLength = min (uint32_t (GetBe16 (&Udp[4])), Length - Offset - IpHeaderLength) - 8;
+
+        Packets.emplace_back ();
+        Packet_t & Packet       = Packets.back ();
+        Packet.TimeUs           = TimeUs;
+        Packet.SourceIp         = IPAddress (Ip[12], Ip[13], Ip[14], Ip[15]);
+        Packet.DestinationIp    = IPAddress (Ip[16], Ip[17], Ip[18], Ip[19]);
+        Packet.SourcePort       = GetBe16 (&Udp[0]);
+        Packet.DestinationPort  = GetBe16 (&Udp[2]);
+        Packet.Payload.assign (&Udp[8], &Udp[8] + PayloadLength);
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // ParseFrame
+
+//-----------------------------------------------------------------------------
+bool c_NativeReplay::LoadLog (FILE * file)
+{
+    // DEBUG_START;
+
+    char * Line = nullptr;
+    size_t LineSize = 0;
+    uint32_t LineNumber = 0;
+
+    while (0 < getline (&Line, &LineSize, file))
+    {
+        ++LineNumber;
+
+        double   Seconds;
+        unsigned Port;
+        int      PayloadStart = 0;
+        if (('#' == Line[0]) || (2 != sscanf (Line, "%lf %u %n", &Seconds, &Port, &PayloadStart)) || (0 == PayloadStart))
+        {
+            continue;
+        }
+
+        Packet_t Packet;
+        Packet.TimeUs          = uint64_t (Seconds * double (MicroSecondsInASecond) + 0.5);
+        Packet.SourceIp        = ReplaySourceIp;
+        Packet.SourcePort      = uint16_t (Port);
+        Packet.DestinationIp   = WiFi.localIP ();
+        Packet.DestinationPort = uint16_t (Port);
+
+        const char * Hex = &Line[PayloadStart];
+        while (isxdigit (Hex[0]) && isxdigit (Hex[1]))
+        {
+            unsigned Value;
+            sscanf (Hex, "%2x", &Value);
+            Packet.Payload.push_back (uint8_t (Value));
+            Hex += 2;
+        }
+
+        if (!isxdigit (Hex[0]) && !isspace (Hex[0]) && ('\0' != Hex[0]))
+        {
+            logcon (String (F ("Line ")) + String (LineNumber) + F (": bad payload ignored"));
+            continue;
+        }
+
+        Packets.push_back (Packet);
+    }
+    free (Line);
+
+    // DEBUG_END;
+    return true;
+
+} // LoadLog
+
+//-----------------------------------------------------------------------------
+uint32_t c_NativeReplay::CountChannels (const Packet_t & Packet)
+{
+    const uint8_t * Data = Packet.Payload.data ();
+    uint32_t Length = Packet.Payload.size ();
+    uint32_t Response = 0;
+
+    if ((E131_DEFAULT_PORT == Packet.DestinationPort) && (Length >= 126))
+    {
+        Response = max (1, int (GetBe16 (&Data[123]))) - 1;
+    }
+    else if ((ART_NET_PORT == Packet.DestinationPort) && (Length >= ART_DMX_START) && (ART_DMX == (Data[8] | (Data[9] << 8))))
+    {
+        Response = GetBe16 (&Data[16]);
+    }
+    else if ((DDP_PORT == Packet.DestinationPort) && (Length >= 10) && (0 == (Data[0] & DDP_FLAGS1_DATAMASK)))
+    {
+        Response = GetBe16 (&Data[8]);
+    }
+
+    return Response;
+
+} // CountChannels
+
+//-----------------------------------------------------------------------------
+void c_NativeReplay::PollOnce ()
+{
+    for (auto CurrentInput : Inputs)
+    {
+        CurrentInput->Process ();
+    }
+    OutputMgr.Poll ();
+
+} // PollOnce
+
+//-----------------------------------------------------------------------------
+void c_NativeReplay::AdvanceTo (uint64_t TimePs)
+{
+    // same 1 ms cadence as the simulation loop in main
+    while (NativeSim.NowPs () < TimePs)
+    {
+        if (NativeSim.NowPs () >= NextPollPs)
+        {
+            PollOnce ();
+            NextPollPs += NATIVE_SIM_PS_PER_MS;
+        }
+        NativeSim.Sleep (min (TimePs, NextPollPs) - NativeSim.NowPs ());
+    }
+
+} // AdvanceTo
+
+//-----------------------------------------------------------------------------
+uint32_t c_NativeReplay::GetFramesPresented ()
+{
+    uint32_t Response = 0;
+
+    JsonDocument StatusDoc;
+    JsonObject Status = StatusDoc.to<JsonObject> ();
+    OutputMgr.GetStatus (Status);
+
+    JsonArray Ports = Status[(char*)CN_output];
+    for (JsonObject CurrentPort : Ports)
+    {
+        Response += CurrentPort[F ("FrameCount")].as<uint32_t> ();
+    }
+
+    return Response;
+
+} // GetFramesPresented
+
+//-----------------------------------------------------------------------------
+void c_NativeReplay::ReportUniverses (JsonObject & Status)
+{
+    // the status lists every universe slot, only the configured ones are in use
+    JsonArray Universes = Status[(char*)CN_channels];
+    uint32_t FirstUniverse = Status[(char*)CN_unifirst].as<uint32_t> ();
+    uint32_t LastUniverse  = Status[(char*)CN_unilast].as<uint32_t> ();
+
+    for (uint32_t UniverseId = FirstUniverse; (UniverseId <= LastUniverse) && ((UniverseId - FirstUniverse) < Universes.size ()); ++UniverseId)
+    {
+        JsonObject CurrentUniverse = Universes[UniverseId - FirstUniverse];
+        LOG_PORT.printf ("    universe %-5u %8u sequence errors\n", unsigned (UniverseId), CurrentUniverse[(char*)CN_errors].as<uint32_t> ());
+    }
+
+} // ReportUniverses
+
+//-----------------------------------------------------------------------------
+bool c_NativeReplay::Run (const String & FileName, double Speed, uint16_t FirstUniverse, uint16_t ChannelsPerUniverse)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        if (!LoadCapture (FileName) || Packets.empty ())
+        {
+            break;
+        }
+
+        NetworkMgr.Begin ();
+
+        uint32_t BufferSize = OutputMgr.GetBufferUsedSize ();
+        Inputs.push_back (new c_InputE131   (c_InputMgr::e_InputChannelIds::InputPrimaryChannelId, c_InputMgr::e_InputType::InputType_E1_31,  BufferSize));
+        Inputs.push_back (new c_InputArtnet (c_InputMgr::e_InputChannelIds::InputPrimaryChannelId, c_InputMgr::e_InputType::InputType_Artnet, BufferSize));
+        Inputs.push_back (new c_InputDDP    (c_InputMgr::e_InputChannelIds::InputPrimaryChannelId, c_InputMgr::e_InputType::InputType_DDP,    BufferSize));
+
+        for (auto CurrentInput : Inputs)
+        {
+            JsonDocument ConfigDoc;
+            JsonObject Config = ConfigDoc.to<JsonObject> ();
+            JsonWrite (Config, CN_universe,       FirstUniverse);
+            JsonWrite (Config, CN_universe_limit, ChannelsPerUniverse);
+            JsonWrite (Config, CN_universe_start, 1);
+            JsonWrite (Config, CN_port,           E131_DEFAULT_PORT);
+
+            CurrentInput->SetConfig (Config);
+            CurrentInput->Begin ();
+            CurrentInput->SetBufferInfo (BufferSize);
+        }
+
+        OutputMgr.ClearStatistics ();
+        FrameLatency.Clear ();
+        uint32_t TxCountAtStart = AsyncUDP::GetTxCount ();
+        uint64_t StartPs        = NativeSim.NowPs ();
+        uint64_t FirstTimeUs    = Packets.front ().TimeUs;
+        NextPollPs              = StartPs;
+
+        uint64_t NumChannels    = 0;
+        uint64_t NumUnclaimed   = 0;
+        std::chrono::steady_clock::duration HostTime (0);
+
+        for (auto & CurrentPacket : Packets)
+        {
+            if (0.0 < Speed)
+            {
+                uint64_t OffsetUs = (CurrentPacket.TimeUs > FirstTimeUs) ? (CurrentPacket.TimeUs - FirstTimeUs) : 0;
+                AdvanceTo (StartPs + uint64_t (double (OffsetUs) * double (NATIVE_SIM_PS_PER_US) / Speed));
+            }
+
+            auto HostStart = std::chrono::steady_clock::now ();
+            if (0 == AsyncUDP::Deliver (CurrentPacket.Payload.data (), CurrentPacket.Payload.size (),
+                                        CurrentPacket.SourceIp, CurrentPacket.SourcePort,
+                                        CurrentPacket.DestinationIp, CurrentPacket.DestinationPort))
+            {
+                ++NumUnclaimed;
+            }
+            HostTime += std::chrono::steady_clock::now () - HostStart;
+
+            NumChannels += CountChannels (CurrentPacket);
+
+            if (0.0 >= Speed)
+            {
+                PollOnce ();
+            }
+        }
+
+        uint64_t ReplayPs = NativeSim.NowPs () - StartPs;
+
+        // let the last frame drain
+        AdvanceTo (NativeSim.NowPs () + (50 * NATIVE_SIM_PS_PER_MS));
+
+        double HostSeconds = std::chrono::duration<double> (HostTime).count ();
+        double SimSeconds  = double (ReplayPs) / double (NATIVE_SIM_PS_PER_MS * MilliSecondsInASecond);
+        uint64_t NumPackets = Packets.size ();
+
+        LOG_PORT.printf ("replay: %llu packets, %llu channels, %llu not claimed by an input, %u replies sent\n",
+                         (unsigned long long)NumPackets, (unsigned long long)NumChannels,
+                         (unsigned long long)NumUnclaimed, unsigned (AsyncUDP::GetTxCount () - TxCountAtStart));
+        if (0.0 < SimSeconds)
+        {
+            LOG_PORT.printf ("simulated: %.3f s  %.1f packets/s  %.0f channels/s\n",
+                             SimSeconds, double (NumPackets) / SimSeconds, double (NumChannels) / SimSeconds);
+        }
+        if (0.0 < HostSeconds)
+        {
+            LOG_PORT.printf ("host input path: %.3f ms  %.0f packets/s  %.0f channels/s\n",
+                             HostSeconds * 1000.0, double (NumPackets) / HostSeconds, double (NumChannels) / HostSeconds);
+        }
+        LOG_PORT.printf ("frames presented: %u\n", GetFramesPresented ());
+        uint32_t InputId = c_InputMgr::e_InputChannelIds::InputPrimaryChannelId;
+        LOG_PORT.printf ("packet to frame latency: %u samples  p50 %u us  p95 %u us  p99 %u us  max %u us\n",
+                         FrameLatency.GetCount (InputId), FrameLatency.GetPercentile (InputId, 50),
+                         FrameLatency.GetPercentile (InputId, 95), FrameLatency.GetPercentile (InputId, 99),
+                         FrameLatency.GetMax (InputId));
+
+        JsonDocument StatusDoc;
+        JsonObject Status = StatusDoc.to<JsonObject> ();
+        for (auto CurrentInput : Inputs)
+        {
+            CurrentInput->GetStatus (Status);
+        }
+
+        JsonObject E131Status = Status[F ("e131")];
+        LOG_PORT.printf ("e1.31:   %u packets\n", E131Status[(char*)CN_num_packets].as<uint32_t> ());
+        ReportUniverses (E131Status);
+
+        JsonObject ArtnetStatus = Status[F ("Artnet")];
+        LOG_PORT.printf ("art-net: %u packets, %u polls\n", ArtnetStatus[(char*)CN_num_packets].as<uint32_t> (), ArtnetStatus[(char*)CN_PollCounter].as<uint32_t> ());
+        ReportUniverses (ArtnetStatus);
+
+        JsonObject DdpStatus = Status[F ("ddp")];
+        LOG_PORT.printf ("ddp:     %u packets, %u errors %s\n", DdpStatus[F ("packetsreceived")].as<uint32_t> (),
+                         DdpStatus[(char*)CN_errors].as<uint32_t> (), DdpStatus[F ("lasterror")].as<String> ().c_str ());
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // Run
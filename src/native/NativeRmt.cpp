@@ -0,0 +1,269 @@
+/*
+* NativeRmt.cpp - RMT transmitter model for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "Arduino.h"
+#include "NativeRmt.hpp"
+
+rmt_dev_t   RMT;
+rmt_mem_t   RMTMEM;
+c_NativeRmt NativeRmt;
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::Begin ()
+{
+    // DEBUG_START;
+
+    if (!HasBeenInitialized)
+    {
+        HasBeenInitialized = true;
+        NativeSim.AddPeripheral (this);
+    }
+
+    // DEBUG_END;
+} // Begin
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::Config (const rmt_config_t & Config)
+{
+    // DEBUG_START;
+
+    uint32_t Channel = uint32_t (Config.channel) % RMT_LL_NUM_CHANNELS;
+
+    RMT.conf_ch[Channel].conf0.div_cnt     = Config.clk_div;
+    RMT.conf_ch[Channel].conf0.mem_size    = Config.mem_block_num;
+    RMT.conf_ch[Channel].conf1.idle_out_lv = Config.tx_config.idle_level;
+    RMT.conf_ch[Channel].conf1.idle_out_en = Config.tx_config.idle_output_en;
+
+    SetOutput (Channel, Config.tx_config.idle_level, NativeSim.NowPs ());
+    NativeSim.AttachSignal (Config.gpio_num, RMT_SIG_OUT0_IDX + Channel, false);
+
+    // DEBUG_END;
+} // Config
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::TxStart (uint32_t Channel)
+{
+    // DEBUG_START;
+
+    Channel_t & CurrentChannel = Channels[Channel % RMT_LL_NUM_CHANNELS];
+    CurrentChannel.Active          = true;
+    CurrentChannel.Phase           = ItemStart;
+    CurrentChannel.ItemsSinceThres = 0;
+    CurrentChannel.NextEventPs     = NativeSim.NowPs ();
+
+    // DEBUG_END;
+} // TxStart
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::TxStop (uint32_t Channel)
+{
+    // DEBUG_START;
+
+    Channel_t & CurrentChannel = Channels[Channel % RMT_LL_NUM_CHANNELS];
+    CurrentChannel.Active      = false;
+    CurrentChannel.NextEventPs = NATIVE_SIM_NEVER;
+
+    // DEBUG_END;
+} // TxStop
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::ResetReadPointer (uint32_t Channel)
+{
+    // DEBUG_START;
+
+    Channels[Channel % RMT_LL_NUM_CHANNELS].ReadIndex = 0;
+
+    // DEBUG_END;
+} // ResetReadPointer
+
+//----------------------------------------------------------------------------
+uint64_t c_NativeRmt::GetTickPs (uint32_t Channel)
+{
+    // a divider of zero means 256
+    uint32_t Divider = RMT.conf_ch[Channel % RMT_LL_NUM_CHANNELS].conf0.div_cnt;
+    return NATIVE_SIM_PS_PER_APB_TICK * (Divider ? Divider : 256);
+
+} // GetTickPs
+
+//----------------------------------------------------------------------------
+uint64_t c_NativeRmt::NextEventPs ()
+{
+    // DEBUG_START;
+
+    uint64_t Response = NATIVE_SIM_NEVER;
+
+    rmt_ll_sync_interrupts (&RMT);
+    if (RMT.int_st.val)
+    {
+        Response = NativeSim.NowPs ();
+    }
+
+    for (Channel_t & CurrentChannel : Channels)
+    {
+        Response = min (Response, CurrentChannel.NextEventPs);
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // NextEventPs
+
+//----------------------------------------------------------------------------
+static void DispatchInterrupts ()
+{
+    rmt_ll_sync_interrupts (&RMT);
+    if (RMT.int_st.val)
+    {
+        NativeSim.CallInterrupt (ETS_RMT_INTR_SOURCE);
+    }
+
+} // DispatchInterrupts
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::Service (uint64_t NowPs)
+{
+    // DEBUG_START;
+
+    DispatchInterrupts ();
+
+    for (uint32_t Channel = 0; Channel < RMT_LL_NUM_CHANNELS; ++Channel)
+    {
+        Channel_t & CurrentChannel = Channels[Channel];
+
+        while (CurrentChannel.Active && (CurrentChannel.NextEventPs <= NowPs))
+        {
+            uint64_t EventPs = CurrentChannel.NextEventPs;
+            uint64_t TickPs  = GetTickPs (Channel);
+
+            if (ItemStart == CurrentChannel.Phase)
+            {
+                CurrentChannel.CurrentItem.val = RMTMEM.chan[Channel].data32[CurrentChannel.ReadIndex].val;
+                if (0 == CurrentChannel.CurrentItem.duration0)
+                {
+                    EndOfTransmission (Channel, EventPs);
+                    break;
+                }
+
+                CurrentChannel.Items.push_back ({EventPs, CurrentChannel.CurrentItem});
+                SetOutput (Channel, CurrentChannel.CurrentItem.level0, EventPs);
+                CurrentChannel.Phase       = ItemLevel1;
+                CurrentChannel.NextEventPs = EventPs + (CurrentChannel.CurrentItem.duration0 * TickPs);
+                CurrentChannel.ReadIndex   = (CurrentChannel.ReadIndex + 1) % RMT_LL_MEM_ITEMS;
+
+                // the threshold fires as the item is read so the ISR can refill the slots already sent
+                uint32_t Limit = RMT.tx_lim_ch[Channel].limit;
+                if (Limit && (++CurrentChannel.ItemsSinceThres >= Limit))
+                {
+                    CurrentChannel.ItemsSinceThres = 0;
+                    RMT.int_raw.val |= (1U << (24 + Channel));
+                    DispatchInterrupts ();
+                }
+            }
+            else
+            {
+                // a zero second half also ends the transmission
+                if (0 == CurrentChannel.CurrentItem.duration1)
+                {
+                    EndOfTransmission (Channel, EventPs);
+                    break;
+                }
+
+                SetOutput (Channel, CurrentChannel.CurrentItem.level1, EventPs);
+                CurrentChannel.Phase       = ItemStart;
+                CurrentChannel.NextEventPs = EventPs + (CurrentChannel.CurrentItem.duration1 * TickPs);
+            }
+        }
+    }
+
+    // DEBUG_END;
+} // Service
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::EndOfTransmission (uint32_t Channel, uint64_t TimePs)
+{
+    // DEBUG_START;
+
+    Channel_t & CurrentChannel = Channels[Channel];
+    CurrentChannel.Active      = false;
+    CurrentChannel.NextEventPs = NATIVE_SIM_NEVER;
+
+    if (RMT.conf_ch[Channel].conf1.idle_out_en)
+    {
+        SetOutput (Channel, RMT.conf_ch[Channel].conf1.idle_out_lv, TimePs);
+    }
+
+    RMT.conf_ch[Channel].conf1.tx_start = 0;
+    RMT.int_raw.val |= (1U << (Channel * 3));
+    DispatchInterrupts ();
+
+    // DEBUG_END;
+} // EndOfTransmission
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::SetOutput (uint32_t Channel, uint8_t Level, uint64_t TimePs)
+{
+    NativeSim.SetSignal (RMT_SIG_OUT0_IDX + Channel, Level, TimePs);
+
+} // SetOutput
+
+//----------------------------------------------------------------------------
+void c_NativeRmt::ClearCapture ()
+{
+    // DEBUG_START;
+
+    for (Channel_t & CurrentChannel : Channels)
+    {
+        CurrentChannel.Items.clear ();
+    }
+
+    // DEBUG_END;
+} // ClearCapture
+
+//----------------------------------------------------------------------------
+// hooks called by hal/rmt_ll.h
+void NativeRmtTxStart (uint32_t channel)        { NativeRmt.TxStart (channel); }
+void NativeRmtTxStop (uint32_t channel)         { NativeRmt.TxStop (channel); }
+void NativeRmtTxResetPointer (uint32_t channel) { NativeRmt.ResetReadPointer (channel); }
+
+//----------------------------------------------------------------------------
+esp_err_t rmt_config (const rmt_config_t * rmt_param)
+{
+    if ((nullptr == rmt_param) || (rmt_param->channel >= RMT_CHANNEL_MAX) || !GPIO_IS_VALID_OUTPUT_GPIO (rmt_param->gpio_num))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    NativeRmt.Config (*rmt_param);
+    return ESP_OK;
+
+} // rmt_config
+
+//----------------------------------------------------------------------------
+esp_err_t rmt_isr_register (void (*fn)(void *), void * arg, int intr_alloc_flags, rmt_isr_handle_t * handle)
+{
+    return esp_intr_alloc (ETS_RMT_INTR_SOURCE, intr_alloc_flags, fn, arg, handle);
+
+} // rmt_isr_register
+
+//----------------------------------------------------------------------------
+esp_err_t rmt_isr_deregister (rmt_isr_handle_t handle)
+{
+    return esp_intr_free (handle);
+
+} // rmt_isr_deregister
@@ -0,0 +1,688 @@
+/*
+* NativeSim.cpp - Virtual clock, task scheduler and GPIO model for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "Arduino.h"
+#include "NativeSim.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// an ISR that keeps its own interrupt pending would otherwise hang the simulation
+#define MAX_SERVICE_PASSES_PER_STEP 10000
+
+struct NativeTask_t
+{
+    const char            * Name        = "";
+    uint32_t                Priority    = 0;
+    void                 (* Function)(void *) = nullptr;
+    void                  * Arg         = nullptr;
+    std::condition_variable Wakeup;
+    bool                    Deleted     = false;
+    uint32_t                NotifyValue = 0;
+    uint64_t                LastRunSeq  = 0;
+
+    // what the task is waiting for while it is blocked
+    uint64_t                WakePs      = NATIVE_SIM_NEVER;
+    bool                 (* IsReady)(void * Context) = nullptr;
+    void                  * Context     = nullptr;
+    NativeTask_t          * pNext       = nullptr;
+};
+
+struct NativeSemaphore_t
+{
+    uint32_t    Count = 0;
+    uint32_t    MaxCount = 1;
+};
+
+struct NativeIntr_t
+{
+    int             Source  = -1;
+    NativeIsr_t     Handler = nullptr;
+    void          * Arg     = nullptr;
+    NativeIntr_t  * pNext   = nullptr;
+};
+
+// Only the task that owns pRunningTask touches the simulator state. The
+// mutex just protects the hand off from one host thread to the next.
+static std::mutex               HandOffLock;
+static NativeTask_t           * pRunningTask    = nullptr;
+static NativeTask_t           * pTasks          = nullptr;
+static NativeIntr_t           * pInterrupts     = nullptr;
+static uint64_t                 RunSeq          = 0;
+static thread_local NativeTask_t * pThisTask    = nullptr;
+
+c_NativeSim NativeSim;
+
+//----------------------------------------------------------------------------
+c_NativeSim::c_NativeSim ()
+{
+    // DEBUG_START;
+
+    memset (SignalLevels, 0x00, sizeof (SignalLevels));
+
+    // DEBUG_END;
+} // c_NativeSim
+
+//----------------------------------------------------------------------------
+static NativeTask_t * RegisterTask (const char * Name, uint32_t Priority)
+{
+    NativeTask_t * pTask = new NativeTask_t ();
+    pTask->Name     = Name;
+    pTask->Priority = Priority;
+    pTask->pNext    = pTasks;
+    pTasks          = pTask;
+    return pTask;
+
+} // RegisterTask
+
+//----------------------------------------------------------------------------
+static NativeTask_t * CurrentTask ()
+{
+    if (nullptr == pThisTask)
+    {
+        // the first caller is the host main thread. It plays the Arduino loop task.
+        pThisTask    = RegisterTask ("loopTask", 1);
+        pRunningTask = pThisTask;
+    }
+    return pThisTask;
+
+} // CurrentTask
+
+//----------------------------------------------------------------------------
+static void HandOff (NativeTask_t * pFrom, NativeTask_t * pTo)
+{
+    std::unique_lock<std::mutex> Lock (HandOffLock);
+    pRunningTask = pTo;
+    pTo->Wakeup.notify_one ();
+    pFrom->Wakeup.wait (Lock, [pFrom] { return pRunningTask == pFrom; });
+
+} // HandOff
+
+//----------------------------------------------------------------------------
+static void TaskEntry (NativeTask_t * pTask)
+{
+    {
+        std::unique_lock<std::mutex> Lock (HandOffLock);
+        pTask->Wakeup.wait (Lock, [pTask] { return pRunningTask == pTask; });
+    }
+    pThisTask = pTask;
+
+    pTask->Function (pTask->Arg);
+
+    // a FreeRTOS task must not return. Treat it as deleting itself.
+    NativeSim.DeleteTask (nullptr);
+
+} // TaskEntry
+
+//----------------------------------------------------------------------------
+TaskHandle_t c_NativeSim::CreateTask (void (*Function)(void *), const char * Name, uint32_t Priority, void * Arg)
+{
+    // DEBUG_START;
+
+    CurrentTask ();
+
+    NativeTask_t * pTask = RegisterTask (Name, Priority);
+    pTask->Function = Function;
+    pTask->Arg      = Arg;
+    pTask->WakePs   = CurrentTimePs;
+    std::thread (TaskEntry, pTask).detach ();
+
+    // DEBUG_END;
+    return pTask;
+
+} // CreateTask
+
+//----------------------------------------------------------------------------
+void c_NativeSim::DeleteTask (TaskHandle_t Task)
+{
+    // DEBUG_START;
+
+    NativeTask_t * pSelf = CurrentTask ();
+    NativeTask_t * pTask = (nullptr == Task) ? pSelf : Task;
+
+    pTask->Deleted = true;
+
+    if (pTask == pSelf)
+    {
+        // give the cpu away and never come back
+        HandOff (pSelf, PickNextTask ());
+    }
+
+    // DEBUG_END;
+} // DeleteTask
+
+//----------------------------------------------------------------------------
+void c_NativeSim::SetPriority (TaskHandle_t Task, uint32_t Priority)
+{
+    // DEBUG_START;
+
+    ((nullptr == Task) ? CurrentTask () : Task)->Priority = Priority;
+
+    // DEBUG_END;
+} // SetPriority
+
+//----------------------------------------------------------------------------
+TaskHandle_t c_NativeSim::GetCurrentTask ()
+{
+    return CurrentTask ();
+
+} // GetCurrentTask
+
+//----------------------------------------------------------------------------
+TaskHandle_t c_NativeSim::FindTask (const char * Name)
+{
+    // DEBUG_START;
+
+    NativeTask_t * pTask = pTasks;
+    while (pTask && (pTask->Deleted || strcmp (pTask->Name, Name)))
+    {
+        pTask = pTask->pNext;
+    }
+
+    // DEBUG_END;
+    return pTask;
+
+} // FindTask
+
+//----------------------------------------------------------------------------
+const char * c_NativeSim::GetTaskName (TaskHandle_t Task)
+{
+    return ((nullptr == Task) ? CurrentTask () : Task)->Name;
+
+} // GetTaskName
+
+//----------------------------------------------------------------------------
+uint32_t c_NativeSim::GetPriority (TaskHandle_t Task)
+{
+    return ((nullptr == Task) ? CurrentTask () : Task)->Priority;
+
+} // GetPriority
+
+//----------------------------------------------------------------------------
+void c_NativeSim::Block (bool (*IsReady)(void * Context), void * Context, uint64_t WakePs)
+{
+    // DEBUG_START;
+
+    NativeTask_t * pSelf = CurrentTask ();
+
+    pSelf->IsReady = IsReady;
+    pSelf->Context = Context;
+    pSelf->WakePs  = WakePs;
+
+    NativeTask_t * pNextTask = PickNextTask ();
+    if (pNextTask != pSelf)
+    {
+        HandOff (pSelf, pNextTask);
+    }
+
+    pSelf->IsReady = nullptr;
+    pSelf->Context = nullptr;
+    pSelf->WakePs  = NATIVE_SIM_NEVER;
+
+    // DEBUG_END;
+} // Block
+
+//----------------------------------------------------------------------------
+NativeTask_t * c_NativeSim::PickNextTask ()
+{
+    // DEBUG_START;
+
+    NativeTask_t * pBestTask = nullptr;
+
+    do
+    {
+        ServicePeripherals ();
+
+        uint64_t NextEventPs = NATIVE_SIM_NEVER;
+
+        for (NativeTask_t * pTask = pTasks; nullptr != pTask; pTask = pTask->pNext)
+        {
+            if (pTask->Deleted)
+            {
+                continue;
+            }
+
+            bool Ready = (pTask->WakePs <= CurrentTimePs) ||
+                         ((nullptr != pTask->IsReady) && pTask->IsReady (pTask->Context));
+            if (!Ready)
+            {
+                NextEventPs = min (NextEventPs, pTask->WakePs);
+                continue;
+            }
+
+            // highest priority wins. Equal priorities take turns.
+            if ((nullptr == pBestTask) ||
+                (pTask->Priority > pBestTask->Priority) ||
+                ((pTask->Priority == pBestTask->Priority) && (pTask->LastRunSeq < pBestTask->LastRunSeq)))
+            {
+                pBestTask = pTask;
+            }
+        }
+
+        if (nullptr != pBestTask)
+        {
+            break;
+        }
+
+        for (c_NativePeripheral * pPeripheral = pPeripherals; nullptr != pPeripheral; pPeripheral = pPeripheral->pNext)
+        {
+            NextEventPs = min (NextEventPs, pPeripheral->NextEventPs ());
+        }
+
+        if (NATIVE_SIM_NEVER == NextEventPs)
+        {
+            fprintf (stderr, "NativeSim: deadlock at %llu ps. Every task is waiting forever:\n", (unsigned long long)CurrentTimePs);
+            for (NativeTask_t * pTask = pTasks; nullptr != pTask; pTask = pTask->pNext)
+            {
+                fprintf (stderr, "    %-16s prio %2u %s\n", pTask->Name, pTask->Priority, pTask->Deleted ? "deleted" : "blocked");
+            }
+            Exit (1);
+        }
+
+        CurrentTimePs = max (CurrentTimePs, NextEventPs);
+
+    } while (true);
+
+    pBestTask->LastRunSeq = ++RunSeq;
+
+    // DEBUG_END;
+    return pBestTask;
+
+} // PickNextTask
+
+//----------------------------------------------------------------------------
+void c_NativeSim::ServicePeripherals ()
+{
+    // DEBUG_START;
+
+    uint32_t PassCount = 0;
+    bool     DidSomething;
+
+    do
+    {
+        DidSomething = false;
+        for (c_NativePeripheral * pPeripheral = pPeripherals; nullptr != pPeripheral; pPeripheral = pPeripheral->pNext)
+        {
+            if (pPeripheral->NextEventPs () <= CurrentTimePs)
+            {
+                pPeripheral->Service (CurrentTimePs);
+                DidSomething = true;
+            }
+        }
+
+        if (++PassCount > MAX_SERVICE_PASSES_PER_STEP)
+        {
+            fprintf (stderr, "NativeSim: peripheral event storm at %llu ps\n", (unsigned long long)CurrentTimePs);
+            Exit (1);
+        }
+    } while (DidSomething);
+
+    // DEBUG_END;
+} // ServicePeripherals
+
+//----------------------------------------------------------------------------
+void c_NativeSim::Sleep (uint64_t DurationPs)
+{
+    // DEBUG_START;
+
+    uint64_t WakePs = (NATIVE_SIM_NEVER - CurrentTimePs > DurationPs) ? (CurrentTimePs + DurationPs) : NATIVE_SIM_NEVER;
+    Block (nullptr, nullptr, WakePs);
+
+    // DEBUG_END;
+} // Sleep
+
+//----------------------------------------------------------------------------
+static bool IsNotified (void * Context)
+{
+    return 0 != ((NativeTask_t *)Context)->NotifyValue;
+
+} // IsNotified
+
+//----------------------------------------------------------------------------
+uint32_t c_NativeSim::NotifyTake (bool ClearOnExit, uint64_t TimeoutPs)
+{
+    // DEBUG_START;
+
+    NativeTask_t * pSelf = CurrentTask ();
+
+    if (0 == pSelf->NotifyValue)
+    {
+        uint64_t WakePs = (NATIVE_SIM_NEVER - CurrentTimePs > TimeoutPs) ? (CurrentTimePs + TimeoutPs) : NATIVE_SIM_NEVER;
+        Block (IsNotified, pSelf, WakePs);
+    }
+
+    uint32_t Response = pSelf->NotifyValue;
+    if (Response)
+    {
+        pSelf->NotifyValue = ClearOnExit ? 0 : (Response - 1);
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // NotifyTake
+
+//----------------------------------------------------------------------------
+void c_NativeSim::NotifyGive (TaskHandle_t Task)
+{
+    // DEBUG_START;
+
+    if (nullptr != Task)
+    {
+        ++Task->NotifyValue;
+    }
+
+    // DEBUG_END;
+} // NotifyGive
+
+//----------------------------------------------------------------------------
+SemaphoreHandle_t c_NativeSim::CreateSemaphore (uint32_t MaxCount, uint32_t InitialCount)
+{
+    // DEBUG_START;
+
+    NativeSemaphore_t * pSemaphore = new NativeSemaphore_t ();
+    pSemaphore->MaxCount = MaxCount;
+    pSemaphore->Count    = min (InitialCount, MaxCount);
+
+    // DEBUG_END;
+    return pSemaphore;
+
+} // CreateSemaphore
+
+//----------------------------------------------------------------------------
+void c_NativeSim::DeleteSemaphore (SemaphoreHandle_t Semaphore)
+{
+    delete Semaphore;
+
+} // DeleteSemaphore
+
+//----------------------------------------------------------------------------
+static bool SemaphoreIsAvailable (void * Context)
+{
+    return 0 != ((NativeSemaphore_t *)Context)->Count;
+
+} // SemaphoreIsAvailable
+
+//----------------------------------------------------------------------------
+bool c_NativeSim::SemaphoreTake (SemaphoreHandle_t Semaphore, uint64_t TimeoutPs)
+{
+    // DEBUG_START;
+
+    uint64_t WakePs = (NATIVE_SIM_NEVER - CurrentTimePs > TimeoutPs) ? (CurrentTimePs + TimeoutPs) : NATIVE_SIM_NEVER;
+
+    // a higher priority task may get to the semaphore first. Keep waiting until the timeout.
+    while ((0 == Semaphore->Count) && (CurrentTimePs < WakePs))
+    {
+        Block (SemaphoreIsAvailable, Semaphore, WakePs);
+    }
+
+    bool Response = (0 != Semaphore->Count);
+    if (Response)
+    {
+        --Semaphore->Count;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // SemaphoreTake
+
+//----------------------------------------------------------------------------
+bool c_NativeSim::SemaphoreGive (SemaphoreHandle_t Semaphore)
+{
+    // DEBUG_START;
+
+    bool Response = (Semaphore->Count < Semaphore->MaxCount);
+    if (Response)
+    {
+        ++Semaphore->Count;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // SemaphoreGive
+
+//----------------------------------------------------------------------------
+void c_NativeSim::Exit (int Status)
+{
+    // the other host threads are parked on condition variables. Do not run destructors under them.
+    fflush (stdout);
+    fflush (stderr);
+    _Exit (Status);
+
+} // Exit
+
+//----------------------------------------------------------------------------
+void c_NativeSim::AddPeripheral (c_NativePeripheral * pPeripheral)
+{
+    // DEBUG_START;
+
+    pPeripheral->pNext = pPeripherals;
+    pPeripherals       = pPeripheral;
+
+    // DEBUG_END;
+} // AddPeripheral
+
+//----------------------------------------------------------------------------
+intr_handle_t c_NativeSim::AllocInterrupt (int Source, NativeIsr_t Handler, void * Arg)
+{
+    // DEBUG_START;
+
+    NativeIntr_t * pIntr = new NativeIntr_t ();
+    pIntr->Source  = Source;
+    pIntr->Handler = Handler;
+    pIntr->Arg     = Arg;
+    pIntr->pNext   = pInterrupts;
+    pInterrupts    = pIntr;
+
+    // DEBUG_END;
+    return pIntr;
+
+} // AllocInterrupt
+
+//----------------------------------------------------------------------------
+void c_NativeSim::FreeInterrupt (intr_handle_t Handle)
+{
+    // DEBUG_START;
+
+    for (NativeIntr_t ** ppIntr = &pInterrupts; nullptr != *ppIntr; ppIntr = &(*ppIntr)->pNext)
+    {
+        if (*ppIntr == Handle)
+        {
+            *ppIntr = Handle->pNext;
+            delete Handle;
+            break;
+        }
+    }
+
+    // DEBUG_END;
+} // FreeInterrupt
+
+//----------------------------------------------------------------------------
+void c_NativeSim::CallInterrupt (int Source)
+{
+    // DEBUG_START;
+
+    // shared interrupts call every handler attached to the source
+    for (NativeIntr_t * pIntr = pInterrupts; nullptr != pIntr; )
+    {
+        NativeIntr_t * pNextIntr = pIntr->pNext;
+        if (Source == pIntr->Source)
+        {
+            pIntr->Handler (pIntr->Arg);
+        }
+        pIntr = pNextIntr;
+    }
+
+    // DEBUG_END;
+} // CallInterrupt
+
+//----------------------------------------------------------------------------
+uint32_t c_NativeSim::ReadReg (uint32_t Address)
+{
+    // DEBUG_START;
+
+    uint32_t Response = 0;
+    c_NativePeripheral * pPeripheral = pPeripherals;
+
+    while ((nullptr != pPeripheral) && !pPeripheral->ReadReg (Address, Response))
+    {
+        pPeripheral = pPeripheral->pNext;
+    }
+
+    if (nullptr == pPeripheral)
+    {
+        fprintf (stderr, "NativeSim: read from unmapped register 0x%08x\n", Address);
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // ReadReg
+
+//----------------------------------------------------------------------------
+void c_NativeSim::WriteReg (uint32_t Address, uint32_t Value)
+{
+    // DEBUG_START;
+
+    c_NativePeripheral * pPeripheral = pPeripherals;
+
+    while ((nullptr != pPeripheral) && !pPeripheral->WriteReg (Address, Value))
+    {
+        pPeripheral = pPeripheral->pNext;
+    }
+
+    if (nullptr == pPeripheral)
+    {
+        fprintf (stderr, "NativeSim: write to unmapped register 0x%08x\n", Address);
+    }
+
+    // DEBUG_END;
+} // WriteReg
+
+//----------------------------------------------------------------------------
+void c_NativeSim::SetPinMode (uint32_t Pin, uint8_t Mode)
+{
+    // DEBUG_START;
+
+    Pins[Pin % NATIVE_SIM_NUM_GPIO].IsOutput = (OUTPUT == (Mode & OUTPUT));
+
+    // DEBUG_END;
+} // SetPinMode
+
+//----------------------------------------------------------------------------
+void c_NativeSim::DigitalWrite (uint32_t Pin, uint8_t Level)
+{
+    // DEBUG_START;
+
+    Pins[Pin % NATIVE_SIM_NUM_GPIO].GpioLevel = Level ? HIGH : LOW;
+    UpdatePin (Pin % NATIVE_SIM_NUM_GPIO, CurrentTimePs);
+
+    // DEBUG_END;
+} // DigitalWrite
+
+//----------------------------------------------------------------------------
+int c_NativeSim::DigitalRead (uint32_t Pin)
+{
+    return Pins[Pin % NATIVE_SIM_NUM_GPIO].Level;
+
+} // DigitalRead
+
+//----------------------------------------------------------------------------
+void c_NativeSim::AttachSignal (uint32_t Pin, uint32_t Signal, bool Invert)
+{
+    // DEBUG_START;
+
+    Pin_t & CurrentPin = Pins[Pin % NATIVE_SIM_NUM_GPIO];
+    CurrentPin.Signal   = Signal % NATIVE_SIM_NUM_SIGNALS;
+    CurrentPin.Invert   = Invert;
+    CurrentPin.IsOutput = true;
+    UpdatePin (Pin % NATIVE_SIM_NUM_GPIO, CurrentTimePs);
+
+    // DEBUG_END;
+} // AttachSignal
+
+//----------------------------------------------------------------------------
+void c_NativeSim::DetachSignal (uint32_t Pin, bool Invert)
+{
+    // DEBUG_START;
+
+    // the pin goes back to being driven by its gpio output register
+    Pin_t & CurrentPin = Pins[Pin % NATIVE_SIM_NUM_GPIO];
+    CurrentPin.Signal = NATIVE_SIM_NO_SIGNAL;
+    CurrentPin.Invert = Invert;
+    UpdatePin (Pin % NATIVE_SIM_NUM_GPIO, CurrentTimePs);
+
+    // DEBUG_END;
+} // DetachSignal
+
+//----------------------------------------------------------------------------
+void c_NativeSim::SetSignal (uint32_t Signal, uint8_t Level, uint64_t TimePs)
+{
+    // DEBUG_START;
+
+    Signal %= NATIVE_SIM_NUM_SIGNALS;
+    if (SignalLevels[Signal] != Level)
+    {
+        SignalLevels[Signal] = Level;
+        for (uint32_t Pin = 0; Pin < NATIVE_SIM_NUM_GPIO; ++Pin)
+        {
+            if (Signal == Pins[Pin].Signal)
+            {
+                UpdatePin (Pin, TimePs);
+            }
+        }
+    }
+
+    // DEBUG_END;
+} // SetSignal
+
+//----------------------------------------------------------------------------
+void c_NativeSim::UpdatePin (uint32_t Pin, uint64_t TimePs)
+{
+    // DEBUG_START;
+
+    Pin_t & CurrentPin = Pins[Pin];
+
+    uint8_t NewLevel = (NATIVE_SIM_NO_SIGNAL == CurrentPin.Signal) ? CurrentPin.GpioLevel : SignalLevels[CurrentPin.Signal];
+    NewLevel ^= CurrentPin.Invert ? HIGH : LOW;
+
+    if (NewLevel != CurrentPin.Level)
+    {
+        CurrentPin.Level = NewLevel;
+        CurrentPin.Edges.push_back ({TimePs, NewLevel});
+    }
+
+    // DEBUG_END;
+} // UpdatePin
+
+//----------------------------------------------------------------------------
+void c_NativeSim::ClearCapture ()
+{
+    // DEBUG_START;
+
+    for (Pin_t & CurrentPin : Pins)
+    {
+        CurrentPin.Edges.clear ();
+    }
+
+    // DEBUG_END;
+} // ClearCapture
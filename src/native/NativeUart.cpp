@@ -0,0 +1,462 @@
+/*
+* NativeUart.cpp - UART transmitter model for the native build
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "Arduino.h"
+#include "NativeUart.hpp"
+
+c_NativeUart NativeUart[UART_NUM_MAX];
+
+// register values after reset (115200 8N1)
+#define UART_RESET_CLKDIV       0x000002B6
+#define UART_RESET_CONF0        0x0000001C
+#define UART_RESET_CONF1        0x00006060
+#define UART_RESET_IDLE_CONF    ((0xA << UART_TX_BRK_NUM_S) | (0x100 << UART_TX_IDLE_NUM_S) | (0xA << UART_RX_IDLE_THRHD_S))
+
+//----------------------------------------------------------------------------
+void c_NativeUart::Begin (uart_port_t _UartId)
+{
+    // DEBUG_START;
+
+    if (!HasBeenInitialized)
+    {
+        HasBeenInitialized = true;
+        UartId   = _UartId;
+        ClkDiv   = UART_RESET_CLKDIV;
+        Conf0    = UART_RESET_CONF0;
+        Conf1    = UART_RESET_CONF1;
+        IdleConf = UART_RESET_IDLE_CONF;
+        snprintf (Name, sizeof (Name), "UART%d", int (UartId));
+        NativeSim.AddPeripheral (this);
+    }
+
+    // DEBUG_END;
+} // Begin
+
+//----------------------------------------------------------------------------
+uint32_t c_NativeUart::GetSignal ()
+{
+    return (UART_NUM_0 == UartId) ? U0TXD_OUT_IDX : ((UART_NUM_1 == UartId) ? U1TXD_OUT_IDX : U2TXD_OUT_IDX);
+
+} // GetSignal
+
+//----------------------------------------------------------------------------
+void c_NativeUart::SetTxPin (int Pin)
+{
+    // DEBUG_START;
+
+    SetLine (LineLevel, NativeSim.NowPs ());
+    NativeSim.AttachSignal (Pin, GetSignal (), false);
+
+    // DEBUG_END;
+} // SetTxPin
+
+//----------------------------------------------------------------------------
+uint64_t c_NativeUart::GetBitPs ()
+{
+    // the divider is in 1/16ths of an APB clock
+    uint64_t Divider = (uint64_t (ClkDiv & UART_CLKDIV_V) << 4) | ((ClkDiv >> UART_CLKDIV_FRAG_S) & UART_CLKDIV_FRAG_V);
+    return max (uint64_t (1), (Divider * NATIVE_SIM_PS_PER_APB_TICK) / 16);
+
+} // GetBitPs
+
+//----------------------------------------------------------------------------
+bool c_NativeUart::ReadReg (uint32_t Address, uint32_t & Value)
+{
+    // DEBUG_START;
+
+    bool Response = true;
+
+    if (UART_FIFO_AHB_REG (UartId) == Address)
+    {
+        Value = 0;
+    }
+    else if (UART_INT_RAW_REG (UartId) == Address)
+    {
+        Value = IntRaw;
+    }
+    else if (UART_INT_ST_REG (UartId) == Address)
+    {
+        Value = IntRaw & IntEna;
+    }
+    else if (UART_INT_ENA_REG (UartId) == Address)
+    {
+        Value = IntEna;
+    }
+    else if (UART_CLKDIV_REG (UartId) == Address)
+    {
+        Value = ClkDiv;
+    }
+    else if (UART_STATUS_REG (UartId) == Address)
+    {
+        Value = (FifoCount & UART_TXFIFO_CNT_V) << UART_TXFIFO_CNT_S;
+    }
+    else if (UART_CONF0_REG (UartId) == Address)
+    {
+        Value = Conf0;
+    }
+    else if (UART_CONF1_REG (UartId) == Address)
+    {
+        Value = Conf1;
+    }
+    else if (UART_IDLE_CONF_REG (UartId) == Address)
+    {
+        Value = IdleConf;
+    }
+    else if (UART_FIFO_REG (UartId) == Address || UART_INT_CLR_REG (UartId) == Address)
+    {
+        Value = 0;
+    }
+    else
+    {
+        Response = false;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // ReadReg
+
+//----------------------------------------------------------------------------
+bool c_NativeUart::WriteReg (uint32_t Address, uint32_t Value)
+{
+    // DEBUG_START;
+
+    bool Response = true;
+    uint64_t NowPs = NativeSim.NowPs ();
+
+    if ((UART_FIFO_AHB_REG (UartId) == Address) || (UART_FIFO_REG (UartId) == Address))
+    {
+        if (FifoCount < UART_FIFO_LEN)
+        {
+            Fifo[(FifoReadIndex + FifoCount++) % UART_FIFO_LEN] = uint8_t (Value);
+            if (TxIdle == TxState)
+            {
+                StartNextAction (NowPs);
+            }
+        }
+        else
+        {
+            fprintf (stderr, "NativeSim: %s TX FIFO overflow at %llu ps\n", Name, (unsigned long long)NowPs);
+        }
+    }
+    else if (UART_INT_ENA_REG (UartId) == Address)
+    {
+        IntEna = Value;
+    }
+    else if (UART_INT_CLR_REG (UartId) == Address)
+    {
+        IntRaw &= ~Value;
+        UpdateFifoEmpty ();
+    }
+    else if (UART_CLKDIV_REG (UartId) == Address)
+    {
+        ClkDiv = Value;
+    }
+    else if (UART_CONF0_REG (UartId) == Address)
+    {
+        uint32_t OldConf0 = Conf0;
+        Conf0 = Value & ~(UART_TXFIFO_RST | UART_RXFIFO_RST);
+
+        if (Value & UART_TXFIFO_RST)
+        {
+            FifoCount = 0;
+            UpdateFifoEmpty ();
+        }
+
+        if ((OldConf0 ^ Conf0) & UART_TXD_INV)
+        {
+            SetLine (LineLevel, NowPs);
+        }
+
+        // a break requested after the FIFO already drained
+        if ((Conf0 & UART_TXD_BRK) && (TxIdle == TxState))
+        {
+            StartNextAction (NowPs);
+        }
+    }
+    else if (UART_CONF1_REG (UartId) == Address)
+    {
+        Conf1 = Value;
+        UpdateFifoEmpty ();
+    }
+    else if (UART_IDLE_CONF_REG (UartId) == Address)
+    {
+        IdleConf = Value;
+    }
+    else if ((UART_INT_RAW_REG (UartId) == Address) ||
+             (UART_INT_ST_REG (UartId) == Address)  ||
+             (UART_STATUS_REG (UartId) == Address))
+    {
+        // read only
+    }
+    else
+    {
+        Response = false;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // WriteReg
+
+//----------------------------------------------------------------------------
+uint64_t c_NativeUart::NextEventPs ()
+{
+    return (IntRaw & IntEna) ? NativeSim.NowPs () : NextSegmentPs;
+
+} // NextEventPs
+
+//----------------------------------------------------------------------------
+void c_NativeUart::Service (uint64_t NowPs)
+{
+    // DEBUG_START;
+
+    do
+    {
+        // the ISR runs before the transmitter moves on, as it would with no interrupt latency
+        if (IntRaw & IntEna)
+        {
+            NativeSim.CallInterrupt (ETS_UART0_INTR_SOURCE + UartId);
+        }
+
+        if (NextSegmentPs > NowPs)
+        {
+            break;
+        }
+
+        uint64_t EventPs = NextSegmentPs;
+
+        if (++SegmentIndex < NumSegments)
+        {
+            SetLine (SegmentLevel[SegmentIndex], EventPs);
+            NextSegmentPs = EventPs + SegmentPs[SegmentIndex];
+        }
+        else if (TxBreak == TxState)
+        {
+            RaiseInterrupt (UART_TX_BRK_DONE_INT_RAW);
+
+            uint32_t NumIdleBits = (IdleConf >> UART_TX_IDLE_NUM_S) & UART_TX_IDLE_NUM_V;
+            TxState         = TxBreakIdle;
+            NumSegments     = 1;
+            SegmentIndex    = 0;
+            SegmentLevel[0] = HIGH;
+            SegmentPs[0]    = NumIdleBits * GetBitPs ();
+            SetLine (HIGH, EventPs);
+            NextSegmentPs   = EventPs + SegmentPs[0];
+        }
+        else
+        {
+            if (TxBreakIdle == TxState)
+            {
+                RaiseInterrupt (UART_TX_BRK_IDLE_DONE_INT_RAW);
+            }
+            StartNextAction (EventPs);
+        }
+
+    } while (true);
+
+    // DEBUG_END;
+} // Service
+
+//----------------------------------------------------------------------------
+void c_NativeUart::StartNextAction (uint64_t TimePs)
+{
+    // DEBUG_START;
+
+    if (FifoCount)
+    {
+        uint8_t Value = Fifo[FifoReadIndex];
+        FifoReadIndex = (FifoReadIndex + 1) % UART_FIFO_LEN;
+        --FifoCount;
+        UpdateFifoEmpty ();
+
+        TxState        = TxSending;
+        SentSinceBreak = true;
+        StartCharacter (Value, TimePs);
+    }
+    else if ((Conf0 & UART_TXD_BRK) && SentSinceBreak)
+    {
+        uint32_t NumBreakBits = (IdleConf >> UART_TX_BRK_NUM_S) & UART_TX_BRK_NUM_V;
+        TxState         = TxBreak;
+        SentSinceBreak  = false;
+        NumSegments     = 1;
+        SegmentIndex    = 0;
+        SegmentLevel[0] = LOW;
+        SegmentPs[0]    = NumBreakBits * GetBitPs ();
+        SetLine (LOW, TimePs);
+        NextSegmentPs   = TimePs + SegmentPs[0];
+    }
+    else
+    {
+        if (TxIdle != TxState)
+        {
+            RaiseInterrupt (UART_TX_DONE_INT_RAW);
+        }
+        TxState       = TxIdle;
+        NumSegments   = 0;
+        NextSegmentPs = NATIVE_SIM_NEVER;
+        SetLine (HIGH, TimePs);
+    }
+
+    // DEBUG_END;
+} // StartNextAction
+
+//----------------------------------------------------------------------------
+void c_NativeUart::StartCharacter (uint8_t Value, uint64_t TimePs)
+{
+    // DEBUG_START;
+
+    Bytes.push_back ({TimePs, Value});
+
+    uint64_t BitPs       = GetBitPs ();
+    uint32_t NumDataBits = 5 + ((Conf0 >> UART_BIT_NUM_S) & UART_BIT_NUM_V);
+    uint32_t StopBitsId  = (Conf0 >> UART_STOP_BIT_NUM_S) & UART_STOP_BIT_NUM_V;
+
+    NumSegments = 0;
+
+    // start bit
+    SegmentLevel[NumSegments] = LOW;
+    SegmentPs[NumSegments++]  = BitPs;
+
+    // data bits, lsb first
+    uint32_t NumOnes = 0;
+    for (uint32_t BitIndex = 0; BitIndex < NumDataBits; ++BitIndex)
+    {
+        uint8_t Level = (Value >> BitIndex) & 0x1;
+        NumOnes += Level;
+        SegmentLevel[NumSegments] = Level;
+        SegmentPs[NumSegments++]  = BitPs;
+    }
+
+    if (Conf0 & UART_PARITY_EN)
+    {
+        // UART_PARITY set means odd parity
+        SegmentLevel[NumSegments] = uint8_t ((NumOnes & 0x1) ^ ((Conf0 & UART_PARITY) ? 1 : 0));
+        SegmentPs[NumSegments++]  = BitPs;
+    }
+
+    // stop bits. 1 = 1 bit, 2 = 1.5 bits, 3 = 2 bits
+    SegmentLevel[NumSegments] = HIGH;
+    SegmentPs[NumSegments++]  = (2 == StopBitsId) ? ((BitPs * 3) / 2) : ((3 == StopBitsId) ? (BitPs * 2) : BitPs);
+
+    SegmentIndex  = 0;
+    SetLine (SegmentLevel[0], TimePs);
+    NextSegmentPs = TimePs + SegmentPs[0];
+
+    // DEBUG_END;
+} // StartCharacter
+
+//----------------------------------------------------------------------------
+void c_NativeUart::SetLine (uint8_t Level, uint64_t TimePs)
+{
+    LineLevel = Level;
+    NativeSim.SetSignal (GetSignal (), Level ^ ((Conf0 & UART_TXD_INV) ? HIGH : LOW), TimePs);
+
+} // SetLine
+
+//----------------------------------------------------------------------------
+void c_NativeUart::UpdateFifoEmpty ()
+{
+    if (FifoCount < ((Conf1 >> UART_TXFIFO_EMPTY_THRHD_S) & UART_TXFIFO_EMPTY_THRHD_V))
+    {
+        RaiseInterrupt (UART_TXFIFO_EMPTY_INT_RAW);
+    }
+
+} // UpdateFifoEmpty
+
+//----------------------------------------------------------------------------
+void c_NativeUart::RaiseInterrupt (uint32_t Mask)
+{
+    IntRaw |= Mask;
+
+} // RaiseInterrupt
+
+//----------------------------------------------------------------------------
+esp_err_t uart_param_config (uart_port_t uart_num, const uart_config_t * uart_config)
+{
+    if ((uart_num < 0) || (uart_num >= UART_NUM_MAX) || (nullptr == uart_config) || (0 == uart_config->baud_rate))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t Divider = uint32_t ((uint64_t (APB_CLK_FREQ) << 4) / uint32_t (uart_config->baud_rate));
+    WRITE_PERI_REG (UART_CLKDIV_REG (uart_num), ((Divider >> 4) & UART_CLKDIV_V) | ((Divider & UART_CLKDIV_FRAG_V) << UART_CLKDIV_FRAG_S));
+
+    SET_PERI_REG_BITS (UART_CONF0_REG (uart_num), UART_BIT_NUM_V, uart_config->data_bits, UART_BIT_NUM_S);
+    SET_PERI_REG_BITS (UART_CONF0_REG (uart_num), UART_STOP_BIT_NUM_V, uart_config->stop_bits, UART_STOP_BIT_NUM_S);
+    CLEAR_PERI_REG_MASK (UART_CONF0_REG (uart_num), UART_PARITY_EN | UART_PARITY);
+    SET_PERI_REG_MASK (UART_CONF0_REG (uart_num), uint32_t (uart_config->parity) & (UART_PARITY_EN | UART_PARITY));
+
+    return ESP_OK;
+
+} // uart_param_config
+
+//----------------------------------------------------------------------------
+esp_err_t uart_set_pin (uart_port_t uart_num, int tx_io_num, int rx_io_num, int rts_io_num, int cts_io_num)
+{
+    (void)rx_io_num;
+    (void)rts_io_num;
+    (void)cts_io_num;
+
+    if ((uart_num < 0) || (uart_num >= UART_NUM_MAX))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (UART_PIN_NO_CHANGE != tx_io_num)
+    {
+        if (!GPIO_IS_VALID_OUTPUT_GPIO (tx_io_num))
+        {
+            return ESP_ERR_INVALID_ARG;
+        }
+        NativeUart[uart_num].SetTxPin (tx_io_num);
+    }
+
+    return ESP_OK;
+
+} // uart_set_pin
+
+//----------------------------------------------------------------------------
+esp_err_t uart_set_hw_flow_ctrl (uart_port_t uart_num, uart_hw_flowcontrol_t flow_ctrl, uint8_t rx_thresh)
+{
+    (void)rx_thresh;
+    return ((uart_num < 0) || (uart_num >= UART_NUM_MAX) || (UART_HW_FLOWCTRL_DISABLE != flow_ctrl)) ? ESP_ERR_INVALID_ARG : ESP_OK;
+
+} // uart_set_hw_flow_ctrl
+
+//----------------------------------------------------------------------------
+esp_err_t uart_set_sw_flow_ctrl (uart_port_t uart_num, bool enable, uint8_t rx_thresh_xon, uint8_t rx_thresh_xoff)
+{
+    (void)rx_thresh_xon;
+    (void)rx_thresh_xoff;
+    return ((uart_num < 0) || (uart_num >= UART_NUM_MAX) || enable) ? ESP_ERR_INVALID_ARG : ESP_OK;
+
+} // uart_set_sw_flow_ctrl
+
+//----------------------------------------------------------------------------
+esp_err_t uart_isr_register (uart_port_t uart_num, void (*fn)(void *), void * arg, int intr_alloc_flags, intr_handle_t * handle)
+{
+    if ((uart_num < 0) || (uart_num >= UART_NUM_MAX))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return esp_intr_alloc (ETS_UART0_INTR_SOURCE + uart_num, intr_alloc_flags, fn, arg, handle);
+
+} // uart_isr_register
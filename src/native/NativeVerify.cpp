@@ -0,0 +1,681 @@
+/*
+* NativeVerify.cpp - Waveform timing verifier for the pixel protocol encoders
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "NativeVerify.hpp"
+#include "output/OutputMgr.hpp"
+#include "NativeRmt.hpp"
+#include "NativeUart.hpp"
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(USE_UART_OUTPUT_DRIVERS)
+    #define VERIFY_OUTPUT_DRIVERS   "uart"
+#else
+    #define VERIFY_OUTPUT_DRIVERS   "rmt"
+#endif // defined(USE_UART_OUTPUT_DRIVERS)
+
+#define VERIFY_FRAME_MS             100     ///< 63 GECE pixels take about 55 ms
+#define VERIFY_MAX_LOGGED           5
+
+//----------------------------------------------------------------------------
+/*
+    Windows at the pixel, in ns. Where a datasheet only gives a nominal value
+    and a tolerance the window is nominal +/- tolerance. GECE has no public
+    datasheet, its windows cover the published G-35 timing (10 us / 20 us
+    bit halves, 30 us between packets) and the shorter halves this firmware
+    has always used.
+*/
+static const c_NativeVerify::Protocol_t Protocols[] =
+{
+#ifdef SUPPORT_OutputProtocol_WS2811
+    // WS2813 family: T0H 220-380, T1H 580-1600, T0L 580-1600, T1L 220-420, reset > 280 us
+    { "WS2811",  c_OutputMgr::OutputProtocol_WS2811,  c_NativeVerify::PulseWidth, LOW,
+        {{220, 380}, {580, 1600}},  {{580, 1600}, {220, 420}},  {0, 0},     280000 },
+#endif // def SUPPORT_OutputProtocol_WS2811
+#ifdef SUPPORT_OutputProtocol_GS8208
+    // T0H 250 +/- 150, T1H 600 +/- 150, reset 300 us
+    { "GS8208",  c_OutputMgr::OutputProtocol_GS8208,  c_NativeVerify::PulseWidth, LOW,
+        {{100, 400}, {450, 750}},   {{0, 0}, {0, 0}},           {0, 0},     300000 },
+#endif // def SUPPORT_OutputProtocol_GS8208
+#ifdef SUPPORT_OutputProtocol_UCS1903
+    // T0H 250 +/- 150, T1H 1000 +/- 150, reset 24 us
+    { "UCS1903", c_OutputMgr::OutputProtocol_UCS1903, c_NativeVerify::PulseWidth, LOW,
+        {{100, 400}, {850, 1150}},  {{0, 0}, {0, 0}},           {0, 0},     24000 },
+#endif // def SUPPORT_OutputProtocol_UCS1903
+#ifdef SUPPORT_OutputProtocol_TM1814
+    // idles high. T0L 360 +/- 50, T1L 720 -70 / +280, reset 500 us
+    { "TM1814",  c_OutputMgr::OutputProtocol_TM1814,  c_NativeVerify::PulseWidth, HIGH,
+        {{310, 410}, {650, 1000}},  {{0, 0}, {0, 0}},           {0, 0},     500000 },
+#endif // def SUPPORT_OutputProtocol_TM1814
+#ifdef SUPPORT_OutputProtocol_UCS8903
+    // T0H 400 +/- 40, T1H 800 +/- 150, T0L >= 800, T1L >= 400, reset > 24 us
+    { "UCS8903", c_OutputMgr::OutputProtocol_UCS8903, c_NativeVerify::PulseWidth, LOW,
+        {{360, 440}, {650, 950}},   {{800, 0}, {400, 0}},       {0, 0},     24000 },
+#endif // def SUPPORT_OutputProtocol_UCS8903
+#ifdef SUPPORT_OutputProtocol_GECE
+    // one frame per 26 bit packet. Bit 0 is a short low and a long high, bit 1 the reverse
+    { "GECE",    c_OutputMgr::OutputProtocol_GECE,    c_NativeVerify::SpaceFirst, LOW,
+        {{18000, 30000}, {4000, 12000}}, {{4000, 12000}, {18000, 30000}}, {6000, 12000}, 30000 },
+#endif // def SUPPORT_OutputProtocol_GECE
+#ifdef SUPPORT_OutputProtocol_TLS3001
+    // Manchester at 1 Mbit/s, +/- 20 %. Reset, sync and data frames are all checked
+    { "TLS3001", c_OutputMgr::OutputProtocol_TLS3001, c_NativeVerify::Manchester, LOW,
+        {{400, 600}, {800, 1200}},  {{400, 600}, {800, 1200}},  {0, 0},     50000 },
+#endif // def SUPPORT_OutputProtocol_TLS3001
+};
+
+//----------------------------------------------------------------------------
+c_NativeVerify::c_NativeVerify ()
+{
+    memset (&Result, 0, sizeof (Result));
+
+} // c_NativeVerify
+
+//----------------------------------------------------------------------------
+c_NativeVerify::~c_NativeVerify ()
+{
+} // ~c_NativeVerify
+
+//----------------------------------------------------------------------------
+bool c_NativeVerify::IsSelected (const Protocol_t & Protocol)
+{
+    String Name = Protocol.Name;
+    String Wanted = Filter;
+    Name.toLowerCase ();
+    Wanted.toLowerCase ();
+
+    return Wanted.equals (F ("all")) || (-1 != Name.indexOf (Wanted));
+
+} // IsSelected
+
+//----------------------------------------------------------------------------
+bool c_NativeVerify::InWindow (const Window_t & Window, uint64_t DurationPs)
+{
+    uint64_t DurationNs = (DurationPs + (NATIVE_SIM_PS_PER_NS / 2)) / NATIVE_SIM_PS_PER_NS;
+
+    return (DurationNs >= Window.MinNs) && ((0 == Window.MaxNs) || (DurationNs <= Window.MaxNs));
+
+} // InWindow
+
+//----------------------------------------------------------------------------
+static String WindowToString (const c_NativeVerify::Window_t & Window)
+{
+    if (0 == Window.MaxNs)
+    {
+        return String (F (">= ")) + String (Window.MinNs);
+    }
+    return String (Window.MinNs) + F ("-") + String (Window.MaxNs);
+
+} // WindowToString
+
+//----------------------------------------------------------------------------
+void c_NativeVerify::Violation (const String & Message)
+{
+    // DEBUG_START;
+
+    if (0 == Result.Violations)
+    {
+        SafeStrncpy (Result.FirstViolation, Message.c_str (), sizeof (Result.FirstViolation));
+    }
+    if (Result.Violations < VERIFY_MAX_LOGGED)
+    {
+        logcon (Message);
+    }
+    ++Result.Violations;
+
+    // DEBUG_END;
+} // Violation
+
+//----------------------------------------------------------------------------
+/*
+    Frame holds the pulses between two resets, with the levels as the pixel
+    sees them. A pulse width frame ends with an active pulse, the idle half
+    of its last bit is part of the reset.
+*/
+void c_NativeVerify::DecodeFrame (const std::vector<Pulse_t> & Frame, uint64_t FrameStartPs)
+{
+    // DEBUG_START;
+
+    uint8_t  ActiveLevel = !pProtocol->IdleLevel;
+    uint64_t MinResetPs = uint64_t (pProtocol->MinResetNs) * NATIVE_SIM_PS_PER_NS;
+    uint32_t NumBits = 0;
+    uint64_t FramePs = 0;
+    String   FrameName = String (F ("frame ")) + String (Result.Frames) + F (" (") +
+                         String (double (FrameStartPs) / double (NATIVE_SIM_PS_PER_US), 3) + F (" us)");
+
+    for (auto & CurrentPulse : Frame)
+    {
+        FramePs += CurrentPulse.DurationPs;
+    }
+
+    switch (pProtocol->Coding)
+    {
+        case PulseWidth:
+        {
+            for (size_t index = 0; index < Frame.size (); index += 2)
+            {
+                const Pulse_t & ActivePulse = Frame[index];
+                if (ActivePulse.Level != ActiveLevel)
+                {
+                    Violation (FrameName + F (": bit ") + String (NumBits) + F (" starts at the idle level"));
+                    break;
+                }
+                ++NumBits;
+
+                bool HasIdlePulse = (index + 1) < Frame.size ();
+                if ((0 == index) && (ActivePulse.DurationPs >= MinResetPs))
+                {
+                    // the gap ran into the first bit, the pixel never saw a reset
+                    ++Result.ActiveGaps;
+                    Violation (FrameName + F (": the gap in front of the frame is at the active level"));
+                    continue;
+                }
+
+                // a bit out of its window still took its time on the wire
+                if (HasIdlePulse)
+                {
+                    SumBitPs += double (ActivePulse.DurationPs + Frame[index + 1].DurationPs);
+                    ++SumBits;
+                }
+
+                uint32_t Bit;
+                if (InWindow (pProtocol->Active[0], ActivePulse.DurationPs))
+                {
+                    Bit = 0;
+                }
+                else if (InWindow (pProtocol->Active[1], ActivePulse.DurationPs))
+                {
+                    Bit = 1;
+                }
+                else
+                {
+                    Violation (FrameName + F (": bit ") + String (NumBits - 1) + F (" active ") +
+                               String (uint32_t (ActivePulse.DurationPs / NATIVE_SIM_PS_PER_NS)) +
+                               F (" ns, T0 ") + WindowToString (pProtocol->Active[0]) +
+                               F (", T1 ") + WindowToString (pProtocol->Active[1]));
+                    continue;
+                }
+
+                if (!HasIdlePulse)
+                {
+                    // the idle half of the last bit is the reset
+                    break;
+                }
+
+                const Pulse_t & IdlePulse = Frame[index + 1];
+                const Window_t & IdleWindow = pProtocol->Idle[Bit];
+                if ((0 != IdleWindow.MinNs || 0 != IdleWindow.MaxNs) && !InWindow (IdleWindow, IdlePulse.DurationPs))
+                {
+                    Violation (FrameName + F (": bit ") + String (NumBits - 1) + F (" idle ") +
+                               String (uint32_t (IdlePulse.DurationPs / NATIVE_SIM_PS_PER_NS)) +
+                               F (" ns, T") + String (Bit) + F ("L ") + WindowToString (IdleWindow));
+                    continue;
+                }
+            }
+            break;
+        }
+
+        case SpaceFirst:
+        {
+            if (!Frame.empty () && (Frame[0].DurationPs >= MinResetPs))
+            {
+                // the gap ran into the start pulse
+                ++Result.ActiveGaps;
+                Violation (FrameName + F (": the gap in front of the frame is at the active level"));
+            }
+            else if (Frame.empty () || !InWindow (pProtocol->Start, Frame[0].DurationPs))
+            {
+                Violation (FrameName + F (": start pulse ") +
+                           String (Frame.empty () ? 0 : uint32_t (Frame[0].DurationPs / NATIVE_SIM_PS_PER_NS)) +
+                           F (" ns, window ") + WindowToString (pProtocol->Start));
+            }
+
+            for (size_t index = 1; (index + 1) < Frame.size (); index += 2)
+            {
+                const Pulse_t & IdlePulse   = Frame[index];
+                const Pulse_t & ActivePulse = Frame[index + 1];
+
+                uint32_t Bit = InWindow (pProtocol->Active[0], ActivePulse.DurationPs) ? 0 : 1;
+                SumBitPs += double (IdlePulse.DurationPs + ActivePulse.DurationPs);
+                ++SumBits;
+                if (!InWindow (pProtocol->Active[Bit], ActivePulse.DurationPs) ||
+                    !InWindow (pProtocol->Idle[Bit],   IdlePulse.DurationPs))
+                {
+                    Violation (FrameName + F (": bit ") + String (NumBits) + F (" ") +
+                               String (uint32_t (IdlePulse.DurationPs / NATIVE_SIM_PS_PER_NS)) + F (" ns idle, ") +
+                               String (uint32_t (ActivePulse.DurationPs / NATIVE_SIM_PS_PER_NS)) + F (" ns active. T0 ") +
+                               WindowToString (pProtocol->Idle[0]) + F (" / ") + WindowToString (pProtocol->Active[0]) + F (", T1 ") +
+                               WindowToString (pProtocol->Idle[1]) + F (" / ") + WindowToString (pProtocol->Active[1]));
+                }
+                ++NumBits;
+            }
+
+            if (0 == (Frame.size () & 1))
+            {
+                Violation (FrameName + F (": ends at the active level"));
+            }
+            break;
+        }
+
+        case Manchester:
+        {
+            uint32_t NumHalfBits = 0;
+            for (auto & CurrentPulse : Frame)
+            {
+                if (InWindow (pProtocol->Active[0], CurrentPulse.DurationPs))
+                {
+                    NumHalfBits += 1;
+                }
+                else if (InWindow (pProtocol->Active[1], CurrentPulse.DurationPs))
+                {
+                    NumHalfBits += 2;
+                }
+                else
+                {
+                    Violation (FrameName + F (": half bit ") + String (NumHalfBits) + F (" ") +
+                               String (uint32_t (CurrentPulse.DurationPs / NATIVE_SIM_PS_PER_NS)) +
+                               F (" ns, half ") + WindowToString (pProtocol->Active[0]) +
+                               F (", full ") + WindowToString (pProtocol->Active[1]));
+                    NumHalfBits += 1;
+                }
+            }
+
+            // a last half at the idle level is part of the reset
+            NumBits = (NumHalfBits + 1) / 2;
+            SumBitPs += double (FramePs) * double (NumHalfBits) / double (NumBits * 2);
+            SumBits  += NumBits;
+            break;
+        }
+    } // switch Coding
+
+    if (0 == Result.Frames)
+    {
+        Result.MinBits = NumBits;
+    }
+    Result.MinBits = min (Result.MinBits, NumBits);
+    Result.MaxBits = max (Result.MaxBits, NumBits);
+    Result.FrameUs = max (Result.FrameUs, double (FramePs) / double (NATIVE_SIM_PS_PER_US));
+    ++Result.Frames;
+
+    // DEBUG_END;
+} // DecodeFrame
+
+//----------------------------------------------------------------------------
+/*
+    Runs in the child after the output manager has been started with the
+    protocol Fork returned. Never returns, the exit status tells the parent
+    whether the waveform passed.
+*/
+void c_NativeVerify::Run (uint32_t NumFrames)
+{
+    // DEBUG_START;
+
+    // a port that does not support the protocol keeps its old one
+    String ConfigData;
+    JsonDocument ConfigDoc;
+    OutputMgr.GetConfig (ConfigData);
+    deserializeJson (ConfigDoc, ConfigData);
+    int32_t PortType = ConfigDoc[(char*)CN_output_config][(char*)CN_channels][String (0)][(char*)CN_type].as<int32_t> ();
+    if (PortType != pProtocol->OutputType)
+    {
+        Violation (String (F ("Port 0 could not be set to ")) + pProtocol->Name);
+        if (-1 != ResultFd)
+        {
+            write (ResultFd, &Result, sizeof (Result));
+        }
+        NativeSim.Exit (1);
+    }
+
+    uint32_t NumChannels = OutputMgr.GetBufferUsedSize ();
+    uint8_t * FrameData = (uint8_t*)malloc (max (NumChannels, uint32_t (1)));
+
+    // let the driver start before anything is recorded
+    memset (FrameData, 0x00, NumChannels);
+    OutputMgr.WriteChannelData (0, NumChannels, FrameData);
+    for (uint32_t Ms = 0; Ms < VERIFY_FRAME_MS; ++Ms)
+    {
+        OutputMgr.Poll ();
+        delay (1);
+    }
+
+    uint8_t StartLevels[NATIVE_SIM_NUM_GPIO];
+    for (uint32_t Pin = 0; Pin < NATIVE_SIM_NUM_GPIO; ++Pin)
+    {
+        StartLevels[Pin] = NativeSim.DigitalRead (Pin);
+    }
+    uint64_t CaptureStartPs = NativeSim.NowPs ();
+    NativeSim.ClearCapture ();
+
+    // all zeros and all ones hold a bit for a whole frame, the ramp mixes them
+    for (uint32_t FrameId = 0; FrameId < NumFrames; ++FrameId)
+    {
+        for (uint32_t ChannelId = 0; ChannelId < NumChannels; ++ChannelId)
+        {
+            FrameData[ChannelId] = (0 == FrameId) ? 0x00 : (1 == FrameId) ? 0xff : uint8_t (ChannelId + FrameId);
+        }
+        OutputMgr.WriteChannelData (0, NumChannels, FrameData);
+
+        for (uint32_t Ms = 0; Ms < VERIFY_FRAME_MS; ++Ms)
+        {
+            OutputMgr.Poll ();
+            delay (1);
+        }
+    }
+    free (FrameData);
+    uint64_t CaptureEndPs = NativeSim.NowPs ();
+
+    do // once
+    {
+        // the data pin is the one that moved the most
+        Result.Pin = 0;
+        for (uint32_t Pin = 0; Pin < NATIVE_SIM_NUM_GPIO; ++Pin)
+        {
+            if (NativeSim.GetEdges (Pin).size () > NativeSim.GetEdges (Result.Pin).size ())
+            {
+                Result.Pin = Pin;
+            }
+        }
+
+        auto & Edges = NativeSim.GetEdges (Result.Pin);
+        if (Edges.size () < 2)
+        {
+            Violation (String (F ("No output on any pin")));
+            break;
+        }
+        Result.Ran = true;
+
+        std::vector<Pulse_t> Pulses;
+        Pulses.push_back ({StartLevels[Result.Pin], Edges.front ().TimePs - CaptureStartPs});
+        for (size_t index = 0; index < Edges.size (); ++index)
+        {
+            uint64_t EndPs = ((index + 1) < Edges.size ()) ? Edges[index + 1].TimePs : CaptureEndPs;
+            Pulses.push_back ({Edges[index].Level, EndPs - Edges[index].TimePs});
+        }
+
+        // the pin rests at the level most of the resets are at. A driver that
+        // refreshes all the time may stop in the middle of a frame, and a
+        // driver may hold the other level between frames
+        uint64_t MinResetPs = uint64_t (pProtocol->MinResetNs) * NATIVE_SIM_PS_PER_NS;
+        uint32_t ResetCount[2] = {0, 0};
+        uint64_t ResetPs[2] = {0, 0};
+        for (auto & CurrentPulse : Pulses)
+        {
+            if (CurrentPulse.DurationPs >= MinResetPs)
+            {
+                ++ResetCount[CurrentPulse.Level & 1];
+                ResetPs[CurrentPulse.Level & 1] += CurrentPulse.DurationPs;
+            }
+        }
+        uint8_t RestLevel = (ResetCount[1] != ResetCount[0]) ? (ResetCount[1] > ResetCount[0]) : (ResetPs[1] > ResetPs[0]);
+        Result.Inverted = (RestLevel != pProtocol->IdleLevel);
+        for (auto & CurrentPulse : Pulses)
+        {
+            CurrentPulse.Level ^= Result.Inverted;
+        }
+
+        uint64_t NowPs = CaptureStartPs;
+        uint64_t FrameStartPs = 0;
+        bool     SeenReset = false;
+        std::vector<Pulse_t> Frame;
+        Result.MinResetUs = 0.0;
+
+        for (auto & CurrentPulse : Pulses)
+        {
+            if ((CurrentPulse.Level == pProtocol->IdleLevel) && (CurrentPulse.DurationPs >= MinResetPs))
+            {
+                if (!Frame.empty ())
+                {
+                    // a frame before the first reset may have started before the capture
+                    if (SeenReset)
+                    {
+                        DecodeFrame (Frame, FrameStartPs - CaptureStartPs);
+                    }
+                    Frame.clear ();
+
+                    double ResetUs = double (CurrentPulse.DurationPs) / double (NATIVE_SIM_PS_PER_US);
+                    if (&CurrentPulse != &Pulses.back ())
+                    {
+                        Result.MinResetUs = (0.0 == Result.MinResetUs) ? ResetUs : min (Result.MinResetUs, ResetUs);
+                    }
+                }
+                SeenReset = true;
+            }
+            else
+            {
+                if (Frame.empty ())
+                {
+                    FrameStartPs = NowPs;
+                }
+                Frame.push_back (CurrentPulse);
+            }
+            NowPs += CurrentPulse.DurationPs;
+        }
+
+        // a frame still open here was cut short by the end of the capture
+        if (0 == Result.Frames)
+        {
+            Violation (String (F ("No complete frame was sent")));
+            break;
+        }
+        if ((pProtocol->Coding != Manchester) && (Result.MinBits != Result.MaxBits))
+        {
+            Violation (String (F ("Frames carry from ")) + String (Result.MinBits) + F (" to ") + String (Result.MaxBits) + F (" bits"));
+        }
+
+        if (SumBitPs > 0.0)
+        {
+            Result.BitsPerSecond = double (SumBits) * double (NATIVE_SIM_PS_PER_MS) * 1000.0 / SumBitPs;
+        }
+        Result.FramesPerSecond = 1000000.0 / (Result.FrameUs + double (pProtocol->MinResetNs) / 1000.0);
+
+    } while (false);
+
+    if (-1 != ResultFd)
+    {
+        if (sizeof (Result) != write (ResultFd, &Result, sizeof (Result)))
+        {
+            logcon (String (F ("Could not send the result to the parent")));
+        }
+        close (ResultFd);
+    }
+
+    // DEBUG_END;
+    NativeSim.Exit (Result.Violations ? 1 : 0);
+
+} // Run
+
+//----------------------------------------------------------------------------
+void c_NativeVerify::Report (const std::vector<Result_t> & Results, const String & JsonFileName)
+{
+    // DEBUG_START;
+
+    LOG_PORT.printf ("\n%-8s %-4s %4s %4s %7s %11s %10s %11s %11s %9s %s\n",
+                     "protocol", "drv", "pin", "inv", "frames", "bits/frame", "kbit/s", "frame_us", "reset_us", "frames/s", "violations");
+    for (auto & CurrentResult : Results)
+    {
+        if (!CurrentResult.Ran)
+        {
+            LOG_PORT.printf ("%-8s %-4s did not run: %s\n", CurrentResult.Name, VERIFY_OUTPUT_DRIVERS, CurrentResult.FirstViolation);
+            continue;
+        }
+
+        char Bits[24];
+        if (CurrentResult.MinBits == CurrentResult.MaxBits)
+        {
+            snprintf (Bits, sizeof (Bits), "%u", unsigned (CurrentResult.MinBits));
+        }
+        else
+        {
+            snprintf (Bits, sizeof (Bits), "%u-%u", unsigned (CurrentResult.MinBits), unsigned (CurrentResult.MaxBits));
+        }
+
+        LOG_PORT.printf ("%-8s %-4s %4u %4s %7u %11s %10.1f %11.1f %11.1f %9.1f %u\n",
+                         CurrentResult.Name, VERIFY_OUTPUT_DRIVERS, unsigned (CurrentResult.Pin),
+                         CurrentResult.Inverted ? "yes" : "no", unsigned (CurrentResult.Frames), Bits,
+                         CurrentResult.BitsPerSecond / 1000.0, CurrentResult.FrameUs, CurrentResult.MinResetUs,
+                         CurrentResult.FramesPerSecond, unsigned (CurrentResult.Violations));
+        if (CurrentResult.Violations)
+        {
+            LOG_PORT.printf ("         first: %s\n", CurrentResult.FirstViolation);
+        }
+        if (CurrentResult.ActiveGaps)
+        {
+            LOG_PORT.printf ("         %u frames start with the gap at the active level\n", unsigned (CurrentResult.ActiveGaps));
+        }
+    }
+
+    do // once
+    {
+        if (JsonFileName.isEmpty ())
+        {
+            break;
+        }
+
+        JsonDocument ReportDoc;
+        JsonWrite (ReportDoc, F ("version"),        ConstConfig.Version);
+        JsonWrite (ReportDoc, F ("built"),          ConstConfig.BuildDate);
+        JsonWrite (ReportDoc, F ("board"),          BOARD_NAME);
+        JsonWrite (ReportDoc, F ("output_drivers"), VERIFY_OUTPUT_DRIVERS);
+
+        JsonArray Entries = ReportDoc["protocols"].to<JsonArray> ();
+        for (auto & CurrentResult : Results)
+        {
+            JsonObject Entry = Entries.add<JsonObject> ();
+            JsonWrite (Entry, F ("name"),               String (CurrentResult.Name));
+            JsonWrite (Entry, F ("ran"),                CurrentResult.Ran);
+            JsonWrite (Entry, F ("pin"),                CurrentResult.Pin);
+            JsonWrite (Entry, F ("inverted"),           CurrentResult.Inverted);
+            JsonWrite (Entry, F ("frames"),             CurrentResult.Frames);
+            JsonWrite (Entry, F ("min_bits"),           CurrentResult.MinBits);
+            JsonWrite (Entry, F ("max_bits"),           CurrentResult.MaxBits);
+            JsonWrite (Entry, F ("bits_per_s"),         CurrentResult.BitsPerSecond);
+            JsonWrite (Entry, F ("frame_us"),           CurrentResult.FrameUs);
+            JsonWrite (Entry, F ("min_reset_us"),       CurrentResult.MinResetUs);
+            JsonWrite (Entry, F ("frames_per_s"),       CurrentResult.FramesPerSecond);
+            JsonWrite (Entry, F ("active_gaps"),        CurrentResult.ActiveGaps);
+            JsonWrite (Entry, F ("violations"),         CurrentResult.Violations);
+            if (CurrentResult.Violations)
+            {
+                JsonWrite (Entry, F ("first_violation"), String (CurrentResult.FirstViolation));
+            }
+        }
+
+        String Data;
+        serializeJsonPretty (ReportDoc, Data);
+
+        FILE * file = fopen (JsonFileName.c_str (), "w");
+        if (nullptr == file)
+        {
+            logcon (String (F ("Could not open '")) + JsonFileName + F ("' for writing."));
+            break;
+        }
+        fwrite (Data.c_str (), 1, Data.length (), file);
+        fclose (file);
+
+    } while (false);
+
+    // DEBUG_END;
+} // Report
+
+//----------------------------------------------------------------------------
+/*
+    Must be called before the simulated peripherals and the output manager
+    start, a fork only copies the calling thread.
+*/
+int32_t c_NativeVerify::Fork (const String & _Filter, const String & JsonFileName)
+{
+    // DEBUG_START;
+
+    Filter = _Filter;
+    std::vector<Result_t> Results;
+
+    for (auto & CurrentProtocol : Protocols)
+    {
+        if (!IsSelected (CurrentProtocol))
+        {
+            continue;
+        }
+
+        memset (&Result, 0, sizeof (Result));
+        SafeStrncpy (Result.Name, CurrentProtocol.Name, sizeof (Result.Name));
+
+        int Pipe[2];
+        if (0 != pipe (Pipe))
+        {
+            logcon (String (F ("Could not create a pipe for ")) + CurrentProtocol.Name);
+            NativeSim.Exit (1);
+        }
+
+        // anything still buffered would be written by both processes
+        LOG_PORT.flush ();
+        fflush (nullptr);
+
+        pid_t Child = fork ();
+        if (0 == Child)
+        {
+            close (Pipe[0]);
+            ResultFd  = Pipe[1];
+            pProtocol = &CurrentProtocol;
+            logcon (String (F ("Verifying ")) + CurrentProtocol.Name);
+            // DEBUG_END;
+            return CurrentProtocol.OutputType;
+        }
+        close (Pipe[1]);
+
+        if (-1 == Child)
+        {
+            SafeStrncpy (Result.FirstViolation, "fork failed", sizeof (Result.FirstViolation));
+        }
+        else
+        {
+            Result_t ChildResult;
+            int      Status = 0;
+            if (sizeof (ChildResult) == read (Pipe[0], &ChildResult, sizeof (ChildResult)))
+            {
+                Result = ChildResult;
+            }
+            else
+            {
+                SafeStrncpy (Result.FirstViolation, "the verifier stopped without a result", sizeof (Result.FirstViolation));
+            }
+            waitpid (Child, &Status, 0);
+        }
+        close (Pipe[0]);
+
+        Results.push_back (Result);
+    }
+
+    if (Results.empty ())
+    {
+        logcon (String (F ("No protocol matches '")) + Filter + F ("'"));
+        NativeSim.Exit (2);
+    }
+
+    Report (Results, JsonFileName);
+
+    bool Passed = true;
+    for (auto & CurrentResult : Results)
+    {
+        Passed = Passed && CurrentResult.Ran && (0 == CurrentResult.Violations);
+    }
+
+    // DEBUG_END;
+    NativeSim.Exit (Passed ? 0 : 1);
+
+} // Fork
@@ -332,7 +332,7 @@ void c_EthernetDriver::onEventHandler (const WiFiEvent_t event, const WiFiEventI
 } // onEventHandler
 
 //-----------------------------------------------------------------------------
-void c_EthernetDriver::Poll ()
+uint32_t c_EthernetDriver::Poll ()
 {
     // DEBUG_START;
 
@@ -344,6 +344,7 @@ void c_EthernetDriver::Poll ()
     }
 
     // DEBUG_END;
+    return NextPollTimer.GetTimeRemaining ();
 
 } // Poll
 
@@ -421,7 +422,7 @@ bool c_EthernetDriver::SetConfig (JsonObject & json)
     if (ConfigChanged && HasBeenPreviouslyConfigured)
     {
         String Reason = (F ("Ethernet Configuration change requires system reboot."));
-        RequestReboot(Reason, 100000);
+        RequestReboot(Reason, 4000);
     }
 
     HasBeenPreviouslyConfigured = true;
@@ -26,6 +26,8 @@
 #include "input/InputMgr.hpp"
 #include "service/FPPDiscovery.h"
 #include "WebMgr.hpp"
+#include "utility/TimerWheel.hpp"
+#include "utility/BootTimeline.hpp"
 #include <Int64String.h>
 #ifdef ARDUINO_ARCH_ESP8266
 #include <ESP8266mDNS.h>
@@ -61,6 +63,10 @@ void c_NetworkMgr::AdvertiseNewState ()
     {
         // DEBUG_V ("Sending Advertisments");
         PreviousState = IsConnected ();
+        if (IsConnected ())
+        {
+            BootTimeline.Mark (F ("network up"));
+        }
         InputMgr.NetworkStateChanged (IsConnected ());
         WebMgr.NetworkStateChanged (IsConnected ());
         FileMgr.NetworkStateChanged (IsConnected ());
@@ -90,6 +96,8 @@ void c_NetworkMgr::Begin ()
     EthernetDriver.Begin ();
 #endif // def SUPPORT_ETHERNET
 
+    TimerWheel.Add (F ("Network"), [] (void * pThis) -> uint32_t { return ((c_NetworkMgr*)pThis)->Poll (); }, this, 0, 10000);
+
     // DEBUG_END;
 
 } // begin
@@ -145,23 +153,20 @@ void c_NetworkMgr::GetStatus (JsonObject & json)
 } // GetStatus
 
 //-----------------------------------------------------------------------------
-///< Called from loop()
-void c_NetworkMgr::Poll ()
+///< Called from the timer wheel
+uint32_t c_NetworkMgr::Poll ()
 {
     // DEBUG_START;
 
-    do // once
-    {
-        WiFiDriver.Poll ();
+    uint32_t Response = WiFiDriver.Poll ();
 
 #ifdef SUPPORT_ETHERNET
-        EthernetDriver.Poll ();
+    Response = min (Response, EthernetDriver.Poll ());
 #endif // def SUPPORT_ETHERNET
 
-    } while (false);
-
     // DEBUG_END;
-} // Process
+    return Response;
+} // Poll
 
 //-----------------------------------------------------------------------------
 bool c_NetworkMgr::SetConfig (JsonObject & json)
@@ -351,7 +356,7 @@ void c_NetworkMgr::UpdateMdns(bool NetworkIsUp)
         else
         {
             logcon (F("Error setting up MDNS responder!"));
-            // RequestReboot(msg, 10000);
+            // RequestReboot(msg, 400);
         }
     }
     else
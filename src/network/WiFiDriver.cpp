@@ -131,30 +131,7 @@ void c_WiFiDriver::Begin ()
     // DEBUG_V ("      default_ssid: '" + default_ssid + "'");
     // DEBUG_V ("default_passphrase: '" + default_passphrase + "'");
 
-    if (FileMgr.SdCardIsInstalled())
-    {
-        JsonDocument jsonConfigDoc;
-        jsonConfigDoc.to<JsonObject>();
-        // DEBUG_V ("read the sdcard config");
-        if (FileMgr.ReadSdFile (F("wificonfig.json"), jsonConfigDoc))
-        {
-            // DEBUG_V ("Process the sdcard config");
-            JsonObject jsonConfig = jsonConfigDoc.as<JsonObject> ();
-            ApCredentials.SetConfig(jsonConfig);
-
-            // copy the fields of interest into the local structure
-            setFromJSON (ap_ssid,       jsonConfig, CN_ap_ssid);
-            setFromJSON (ap_passphrase, jsonConfig, CN_ap_passphrase);
-
-            ConfigSaveNeeded = true;
-
-            FileMgr.DeleteSdFile (F ("wificonfig.json"));
-        }
-        else
-        {
-            // DEBUG_V ("ERROR: Could not read SD card config");
-        }
-    }
+    ReadSdConfig ();
 
     // Disable persistant credential storage and configure SDK params
     WiFi.persistent (false);
@@ -431,7 +408,7 @@ void c_WiFiDriver::onWiFiDisconnect (const WiFiEvent_t event, const WiFiEventInf
 } // onWiFiDisconnect
 
 //-----------------------------------------------------------------------------
-void c_WiFiDriver::Poll ()
+uint32_t c_WiFiDriver::Poll ()
 {
     // DEBUG_START;
 
@@ -452,6 +429,7 @@ void c_WiFiDriver::Poll ()
     }
 
     // DEBUG_END;
+    return NextPoll.GetTimeRemaining ();
 
 } // Poll
 
@@ -476,6 +454,40 @@ void c_WiFiDriver::reset ()
     // DEBUG_END;
 } // reset
 
+//-----------------------------------------------------------------------------
+/*
+    The SD card is mounted in the background after boot, usually after the
+    WiFi has started. SetConfig cycles the connection when the card has
+    new credentials.
+*/
+void c_WiFiDriver::ReadSdConfig ()
+{
+    // DEBUG_START;
+
+    if (FileMgr.SdCardIsInstalled())
+    {
+        JsonDocument jsonConfigDoc;
+        jsonConfigDoc.to<JsonObject>();
+        // DEBUG_V ("read the sdcard config");
+        if (FileMgr.ReadSdFile (F("wificonfig.json"), jsonConfigDoc))
+        {
+            // DEBUG_V ("Process the sdcard config");
+            JsonObject jsonConfig = jsonConfigDoc.as<JsonObject> ();
+            SetConfig (jsonConfig);
+
+            ConfigSaveNeeded = true;
+
+            FileMgr.DeleteSdFile (F ("wificonfig.json"));
+        }
+        else
+        {
+            // DEBUG_V ("ERROR: Could not read SD card config");
+        }
+    }
+
+    // DEBUG_END;
+} // ReadSdConfig
+
 //-----------------------------------------------------------------------------
 bool c_WiFiDriver::SetConfig (JsonObject & json)
 {
@@ -1037,7 +1049,7 @@ void fsm_WiFi_state_ConnectionFailed::Init ()
     if (true == pWiFiDriver->Get_RebootOnWiFiFailureToConnect())
     {
         String Reason = (F ("WiFi Requesting Reboot"));
-        RequestReboot(Reason, 100000);
+        RequestReboot(Reason, 4000);
     }
     else
     {
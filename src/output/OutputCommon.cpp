@@ -22,6 +22,9 @@
 
 #include "ESPixelStick.h"
 #include "output/OutputCommon.hpp"
+#include "utility/EventTrace.hpp"
+#include "utility/FrameLatency.hpp"
+#include "utility/SpiRam.hpp"
 
 //-------------------------------------------------------------------------------
 ///< Start up the driver and put it into a safe mode
@@ -33,6 +36,7 @@ c_OutputCommon::c_OutputCommon (OM_OutputPortDefinition_t & _OutputPortDefinitio
 	OutputPortDefinition     = _OutputPortDefinition;
     OutputType               = outputProtocol;
     pOutputBuffer            = OutputMgr.GetBufferAddress ();
+    pFrameBuffer             = pOutputBuffer;
     FrameStartTimeInMicroSec = 0;
 
 	// logcon (String ("UartId:          '") + UartId + "'");
@@ -47,6 +51,13 @@ c_OutputCommon::~c_OutputCommon ()
 {
     // DEBUG_START;
 
+    pFrameBuffer = pOutputBuffer;
+    if (pStagingBuffer)
+    {
+        SpiRam.Free (pStagingBuffer);
+        pStagingBuffer = nullptr;
+    }
+
     // DEBUG_END;
 } // ~c_OutputCommon
 
@@ -59,9 +70,29 @@ void c_OutputCommon::BaseGetStatus (JsonObject & jsonStatus)
     JsonWrite(jsonStatus, F("framerefreshrate"), int(MicroSecondsInASecond / FrameDurationInMicroSec));
     JsonWrite(jsonStatus, F("FrameCount"),       FrameCount);
 
+    if (pTimingStats)
+    {
+        pTimingStats->GetStatus(jsonStatus);
+    }
+
     // DEBUG_END;
 } // GetStatus
 
+//----------------------------------------------------------------------------
+uint32_t c_OutputCommon::GetPollPeriodUs ()
+{
+    // DEBUG_START;
+
+    // canRefresh() wants the frame time to be exceeded, hence the extra us
+    uint32_t FrameTimeDeltaInMicroSec = micros () - FrameStartTimeInMicroSec;
+    uint32_t MinFrameDurationInMicroSec = Unthrottled ? ActualFrameDurationMicroSec : FrameDurationInMicroSec;
+    uint32_t Response = (FrameTimeDeltaInMicroSec > MinFrameDurationInMicroSec) ? 0 : (MinFrameDurationInMicroSec - FrameTimeDeltaInMicroSec + 1);
+
+    // DEBUG_END;
+    return Response;
+
+} // GetPollPeriodUs
+
 //----------------------------------------------------------------------------
 void c_OutputCommon::ReportNewFrame ()
 {
@@ -70,10 +101,75 @@ void c_OutputCommon::ReportNewFrame ()
     FrameStartTimeInMicroSec = micros ();
     FrameCount++;
 
+    if (pTimingStats)
+    {
+        pTimingStats->ISR_FrameStart(FrameStartTimeInMicroSec);
+    }
+    FrameLatency.FrameStarted(FrameStartTimeInMicroSec);
+    EVENT_TRACE(FrameStart, OutputPortDefinition.PortId, 0, 0);
+
     // DEBUG_END;
 
 } // ReportNewFrame
 
+//----------------------------------------------------------------------------
+void c_OutputCommon::UpdateFrameBuffer ()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        // the ISR can read the output buffer directly
+        if (!IsrReadsFrameBuffer || !OutputMgr.BufferIsInSpiRam () || (0 == OutputBufferSize))
+        {
+            pFrameBuffer = pOutputBuffer;
+            break;
+        }
+
+        if (StagingBufferSize < OutputBufferSize)
+        {
+            uint8_t * pNewStagingBuffer = (uint8_t*)SpiRam.InternalMalloc (OutputBufferSize);
+            if (nullptr == pNewStagingBuffer)
+            {
+                // keep sending from PSRAM. A frame sent while the flash cache is off will fault
+                logerr (String (F ("No internal RAM to stage the output data. Port: ")) + String (OutputPortDefinition.PortId));
+                pFrameBuffer = pOutputBuffer;
+                break;
+            }
+            memset (pNewStagingBuffer, 0x00, OutputBufferSize);
+
+            // the ISR uses pFrameBuffer. Move it before releasing the memory
+            uint8_t * pTemp   = pStagingBuffer;
+            pFrameBuffer      = pNewStagingBuffer;
+            pStagingBuffer    = pNewStagingBuffer;
+            StagingBufferSize = OutputBufferSize;
+            if (pTemp)
+            {
+                SpiRam.Free (pTemp);
+            }
+        }
+
+        pFrameBuffer = pStagingBuffer;
+
+    } while (false);
+
+    // DEBUG_END;
+} // UpdateFrameBuffer
+
+//----------------------------------------------------------------------------
+void c_OutputCommon::StageFrame ()
+{
+    // DEBUG_START;
+
+    // called from task context before the ISR starts on the frame
+    if (pFrameBuffer != pOutputBuffer)
+    {
+        memcpy (pFrameBuffer, pOutputBuffer, OutputBufferSize);
+    }
+
+    // DEBUG_END;
+} // StageFrame
+
 //----------------------------------------------------------------------------
 bool c_OutputCommon::SetConfig (JsonObject & jsonConfig)
 {
@@ -156,6 +252,11 @@ bool c_OutputCommon::ValidateGpio (gpio_num_t ConsoleTxGpio, gpio_num_t ConsoleR
     // DEBUG_START;
 
     FrameCount = 0;
+
+    if (pTimingStats)
+    {
+        pTimingStats->Clear();
+    }
     
     // DEBUG_END;
  } // ClearStatistics
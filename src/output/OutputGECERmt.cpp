@@ -112,19 +112,6 @@ void c_OutputGECERmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     c_OutputGECE::GetStatus (jsonStatus);
     Rmt.GetStatus (jsonStatus);
 
-    #ifdef GECE_RMT_DEBUG_COUNTERS
-    JsonObject JsonCounters = jsonStatus["JsonCounters"].to<JsonObject>();
-    JsonWrite(JsonCounters, "GetNextBit",  RmtDebugCounters.GetNextBit);
-    JsonWrite(JsonCounters, "FrameStarts", RmtDebugCounters.FrameStarts);
-    JsonWrite(JsonCounters, "FrameEnds",   RmtDebugCounters.FrameEnds);
-    JsonWrite(JsonCounters, "BreakBits",   RmtDebugCounters.BreakBits);
-    JsonWrite(JsonCounters, "MabBits",     RmtDebugCounters.MabBits);
-    JsonWrite(JsonCounters, "StartBits",   RmtDebugCounters.StartBits);
-    JsonWrite(JsonCounters, "DataBits",    RmtDebugCounters.DataBits);
-    JsonWrite(JsonCounters, "StopBits",    RmtDebugCounters.StopBits);
-    JsonWrite(JsonCounters, "Underrun",    RmtDebugCounters.Underrun);
-    #endif // def GECE_RMT_DEBUG_COUNTERS
-
 } // GetStatus
 
 //----------------------------------------------------------------------------
@@ -172,7 +159,7 @@ void c_OutputGECERmt::StartNewDataFrame()
 {
     // DEBUG_START;
     // DEBUG_V(String("frame started on ") + String(OutputPortDefinition.gpios.data));
-    INC_GECE_RMT_DEBUG_COUNTERS(FrameStarts);
+    RMT_BIT_COUNTER(FrameStarts);
     StartBitCount = 1;
     StartNewFrame();
 
@@ -182,11 +169,11 @@ void c_OutputGECERmt::StartNewDataFrame()
 //----------------------------------------------------------------------------
 bool IRAM_ATTR c_OutputGECERmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSend)
 {
-    INC_GECE_RMT_DEBUG_COUNTERS(GetNextBit);
+    RMT_BIT_COUNTER(GetNextBit);
     bool Response = true;
     if(StartBitCount)
     {
-        INC_GECE_RMT_DEBUG_COUNTERS(StartBits);
+        RMT_BIT_COUNTER(StartBits);
         StartBitCount = 0;
         DataToSend = StartBit;
         // set up for the next data byte
@@ -196,13 +183,13 @@ bool IRAM_ATTR c_OutputGECERmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSend)
     }
     else if(CurrentDataMask)
     {
-        INC_GECE_RMT_DEBUG_COUNTERS(DataBits);
+        RMT_BIT_COUNTER(DataBits);
         DataToSend = (DataPattern & CurrentDataMask) ? OneBit : ZeroBit ;
         CurrentDataMask = CurrentDataMask >> 1;
     }
     else if(StopBitCount)
     {
-        INC_GECE_RMT_DEBUG_COUNTERS(StopBits);
+        RMT_BIT_COUNTER(StopBits);
         StopBitCount = 0;
         DataToSend = StopBit;
 
@@ -212,13 +199,13 @@ bool IRAM_ATTR c_OutputGECERmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSend)
         }
         else
         {
-            INC_GECE_RMT_DEBUG_COUNTERS(FrameEnds);
+            RMT_BIT_COUNTER(FrameEnds);
             Response = false;
         }
     }
     else
     {
-        INC_GECE_RMT_DEBUG_COUNTERS(Underrun);
+        RMT_BIT_COUNTER(Underrun);
         // nothing to send
         DataToSend.val = 0x0;
         Response = false;
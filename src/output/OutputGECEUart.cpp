@@ -78,6 +78,7 @@ void c_OutputGECEUart::Begin ()
     OutputUartConfig.NumInterIntensityBreakBits     = GECE_UART_BREAK_BITS; // number of bit times to delay
     OutputUartConfig.TriggerIsrExternally           = false;
     OutputUartConfig.NumInterIntensityMABbits       = uint32_t((float(GECE_PIXEL_START_TIME_NS / NanoSecondsInAMicroSecond) / float(GECE_UART_USEC_PER_BIT)) + 0.5);
+    OutputUartConfig.FrameStartMarkAfterBreakUS     = GECE_PIXEL_START_TIME_NS / NanoSecondsInAMicroSecond; // start pulse of the first packet
     OutputUartConfig.CitudsArray                    = ConvertIntensityToUartDataStream;
     Uart.Begin(OutputUartConfig);
 
@@ -123,13 +124,6 @@ void c_OutputGECEUart::GetStatus(ArduinoJson::JsonObject &jsonStatus)
     c_OutputGECE::GetStatus(jsonStatus);
     Uart.GetStatus(jsonStatus);
 
-#ifdef GECE_UART_DEBUG_COUNTERS
-    JsonObject debugStatus = jsonStatus["GECE UART Debug"].to<JsonObject>();
-    debugStatus["NewFrameCounter"]          = NewFrameCounter;
-    debugStatus["TimeSinceLastFrameMS"]     = TimeSinceLastFrameMS;
-    debugStatus["TimeLastFrameStartedMS"]   = TimeLastFrameStartedMS;
-#endif // def GECE_UART_DEBUG_COUNTERS
-
     // DEBUG_END;
 
 } // GetStatus
@@ -157,12 +151,6 @@ uint32_t c_OutputGECEUart::Poll ()
         }
 
         // DEBUG_V("get the next frame started");
-#ifdef GECE_UART_DEBUG_COUNTERS
-        NewFrameCounter++;
-        TimeSinceLastFrameMS = millis() - TimeLastFrameStartedMS;
-        TimeLastFrameStartedMS = millis();
-#endif // def GECE_UART_DEBUG_COUNTERS
-
         Uart.StartNewFrame();
 
         // DEBUG_V();
@@ -118,19 +118,6 @@ void c_OutputGS8208Rmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     c_OutputGS8208::GetStatus (jsonStatus);
     Rmt.GetStatus (jsonStatus);
 
-        #ifdef GS8208_RMT_DEBUG_COUNTERS
-    JsonObject JsonCounters = jsonStatus["JsonCounters"].to<JsonObject>();
-    JsonWrite(JsonCounters, "GetNextBit",  RmtDebugCounters.GetNextBit);
-    JsonWrite(JsonCounters, "FrameStarts", RmtDebugCounters.FrameStarts);
-    JsonWrite(JsonCounters, "FrameEnds",   RmtDebugCounters.FrameEnds);
-    JsonWrite(JsonCounters, "BreakBits",   RmtDebugCounters.BreakBits);
-    JsonWrite(JsonCounters, "MabBits",     RmtDebugCounters.MabBits);
-    JsonWrite(JsonCounters, "StartBits",   RmtDebugCounters.StartBits);
-    JsonWrite(JsonCounters, "DataBits",    RmtDebugCounters.DataBits);
-    JsonWrite(JsonCounters, "StopBits",    RmtDebugCounters.StopBits);
-    JsonWrite(JsonCounters, "Underrun",    RmtDebugCounters.Underrun);
-    #endif // def GS8208_RMT_DEBUG_COUNTERS
-
 } // GetStatus
 
 //----------------------------------------------------------------------------
@@ -178,7 +165,7 @@ void c_OutputGS8208Rmt::StartNewDataFrame()
 {
     // DEBUG_START;
     // DEBUG_V(String("frame started on ") + String(OutputPortDefinition.gpios.data));
-    INC_GS8208_RMT_DEBUG_COUNTERS(FrameStarts);
+    RMT_BIT_COUNTER(FrameStarts);
     ifgBitCurrentCount = ifgBitCount;
     StartNewFrame();
 
@@ -188,11 +175,11 @@ void c_OutputGS8208Rmt::StartNewDataFrame()
 //----------------------------------------------------------------------------
 bool IRAM_ATTR c_OutputGS8208Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSend)
 {
-    INC_GS8208_RMT_DEBUG_COUNTERS(GetNextBit);
+    RMT_BIT_COUNTER(GetNextBit);
     bool Response = true;
     if(ifgBitCurrentCount)
     {
-        INC_GS8208_RMT_DEBUG_COUNTERS(StartBits);
+        RMT_BIT_COUNTER(StartBits);
         --ifgBitCurrentCount;
         DataToSend = ifgBit;
         // set up for the next data byte
@@ -201,7 +188,7 @@ bool IRAM_ATTR c_OutputGS8208Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSen
     }
     else if(DataPatternMask)
     {
-        INC_GS8208_RMT_DEBUG_COUNTERS(DataBits);
+        RMT_BIT_COUNTER(DataBits);
         DataToSend = (DataPattern & DataPatternMask) ? OneBit : ZeroBit ;
         DataPatternMask = DataPatternMask >> 1;
         if(0 == DataPatternMask)
@@ -213,14 +200,14 @@ bool IRAM_ATTR c_OutputGS8208Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSen
             }
             else
             {
-                INC_GS8208_RMT_DEBUG_COUNTERS(FrameEnds);
+                RMT_BIT_COUNTER(FrameEnds);
                 Response = false;
             }
         }
     }
     else
     {
-        INC_GS8208_RMT_DEBUG_COUNTERS(Underrun);
+        RMT_BIT_COUNTER(Underrun);
         // nothing to send
         DataToSend.val = 0x0;
         Response = false;
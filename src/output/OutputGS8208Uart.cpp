@@ -65,7 +65,7 @@ void c_OutputGS8208Uart::Begin ()
     SetIntensityBitTimeInUS(float(GS8208_PIXEL_NS_BIT_TOTAL) / float(NanoSecondsInAMicroSecond));
 
     c_OutputUart::OutputUartConfig_t OutputUartConfig;
-    OutputUartConfig.OutputPortId                   = OutputPortDefinition.PortType;
+    OutputUartConfig.OutputPortId                   = OutputPortDefinition.PortId;
     OutputUartConfig.UartId                         = uart_port_t(OutputPortDefinition.DeviceId);
     OutputUartConfig.DataPin                        = OutputPortDefinition.gpios.data;
     OutputUartConfig.IntensityDataWidth             = GS8208_PIXEL_BITS_PER_INTENSITY;
@@ -124,13 +124,6 @@ void c_OutputGS8208Uart::GetStatus(ArduinoJson::JsonObject &jsonStatus)
     c_OutputGS8208::GetStatus(jsonStatus);
     Uart.GetStatus(jsonStatus);
 
-#ifdef GS8208_UART_DEBUG_COUNTERS
-    JsonObject debugStatus = jsonStatus["GS8208 UART Debug"].to<JsonObject>();
-    debugStatus["NewFrameCounter"] = NewFrameCounter;
-    debugStatus["TimeSinceLastFrameMS"] = TimeSinceLastFrameMS;
-    debugStatus["TimeLastFrameStartedMS"] = TimeLastFrameStartedMS;
-#endif // def GS8208_UART_DEBUG_COUNTERS
-
     // DEBUG_END;
 
 } // GetStatus
@@ -158,12 +151,6 @@ uint32_t c_OutputGS8208Uart::Poll()
         }
 
         // DEBUG_V("get the next frame started");
-#ifdef GS8208_UART_DEBUG_COUNTERS
-        NewFrameCounter++;
-        TimeSinceLastFrameMS = millis() - TimeLastFrameStartedMS;
-        TimeLastFrameStartedMS = millis();
-#endif // def GS8208_UART_DEBUG_COUNTERS
-
         Uart.StartNewFrame();
 
         // DEBUG_V();
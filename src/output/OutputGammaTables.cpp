@@ -0,0 +1,241 @@
+/*
+* OutputGammaTables.cpp - Gamma / brightness tables shared by the pixel ports
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "output/OutputGammaTables.hpp"
+
+#define GAMMA_LOG_FRACTION_BITS     20
+
+// 2^-(2^-N) for N = 1 .. GAMMA_LOG_FRACTION_BITS. 1.31 fixed point
+static const uint32_t Exp2Steps[GAMMA_LOG_FRACTION_BITS] =
+{
+    0x5A82799A,    0x6BA27E65,    0x75606374,    0x7A92BE8B,
+    0x7D41D96E,    0x7E9F0606,    0x7F4F08AE,    0x7FA765AD,
+    0x7FD3AB29,    0x7FE9D3A9,    0x7FF4E959,    0x7FFA748E,
+    0x7FFD3A3F,    0x7FFE9D1E,    0x7FFF4E8E,    0x7FFFA747,
+    0x7FFFD3A4,    0x7FFFE9D2,    0x7FFFF4E9,    0x7FFFFA74,
+};
+
+//----------------------------------------------------------------------------
+// log2 (Value) with GAMMA_LOG_FRACTION_BITS fraction bits. Value > 0
+static uint32_t Log2Fixed (uint32_t Value)
+{
+    uint32_t Msb = 31 - __builtin_clz (Value);
+    uint32_t Response = Msb << GAMMA_LOG_FRACTION_BITS;
+
+    // mantissa in [1, 2) as 2.30 fixed point. Each squaring yields one bit
+    uint64_t Mantissa = uint64_t (Value) << (30 - Msb);
+    for (uint32_t Bit = 1 << (GAMMA_LOG_FRACTION_BITS - 1); Bit; Bit >>= 1)
+    {
+        Mantissa = (Mantissa * Mantissa) >> 30;
+        if (Mantissa >= (uint64_t (2) << 30))
+        {
+            Mantissa >>= 1;
+            Response |= Bit;
+        }
+    }
+
+    return Response;
+
+} // Log2Fixed
+
+//----------------------------------------------------------------------------
+// 2^-Exponent as 1.31 fixed point. Exponent has GAMMA_LOG_FRACTION_BITS fraction bits
+static uint32_t Exp2NegFixed (uint64_t Exponent)
+{
+    uint32_t Whole = uint32_t (Exponent >> GAMMA_LOG_FRACTION_BITS);
+    if (Whole > 31)
+    {
+        return 0;
+    }
+
+    uint64_t Response = uint64_t (1) << 31;
+    uint32_t Fraction = uint32_t (Exponent) & ((1 << GAMMA_LOG_FRACTION_BITS) - 1);
+    for (uint32_t Step = 0; Fraction; ++Step)
+    {
+        uint32_t Bit = 1 << (GAMMA_LOG_FRACTION_BITS - 1 - Step);
+        if (Fraction & Bit)
+        {
+            Response = (Response * Exp2Steps[Step]) >> 31;
+            Fraction &= ~Bit;
+        }
+    }
+
+    return uint32_t (Response >> Whole);
+
+} // Exp2NegFixed
+
+//----------------------------------------------------------------------------
+c_OutputGammaTables::c_OutputGammaTables ()
+{
+} // c_OutputGammaTables
+
+//----------------------------------------------------------------------------
+c_OutputGammaTables::~c_OutputGammaTables ()
+{
+} // ~c_OutputGammaTables
+
+//----------------------------------------------------------------------------
+const uint8_t * c_OutputGammaTables::Acquire8 (float Gamma, uint8_t Brightness)
+{
+    return (const uint8_t *)Acquire (Gamma, Brightness, 8);
+} // Acquire8
+
+//----------------------------------------------------------------------------
+const uint16_t * c_OutputGammaTables::Acquire16 (float Gamma, uint8_t Brightness)
+{
+    return (const uint16_t *)Acquire (Gamma, Brightness, 16);
+} // Acquire16
+
+//----------------------------------------------------------------------------
+void * c_OutputGammaTables::Acquire (float Gamma, uint8_t Brightness, uint8_t BitDepth)
+{
+    // DEBUG_START;
+
+    void * Response = nullptr;
+    uint32_t GammaHundredths = uint32_t ((Gamma * 100.0) + 0.5);
+    Brightness = min (Brightness, uint8_t (100));
+
+    do // once
+    {
+        Table_t * pTable = pTables;
+        while (pTable)
+        {
+            if ((pTable->GammaHundredths == GammaHundredths) &&
+                (pTable->Brightness == Brightness) &&
+                (pTable->BitDepth == BitDepth))
+            {
+                ++pTable->RefCount;
+                Response = pTable->GetData ();
+                break;
+            }
+            pTable = pTable->pNext;
+        }
+
+        if (Response)
+        {
+            break;
+        }
+
+        pTable = (Table_t *)malloc (sizeof (Table_t) + (OUTPUT_GAMMA_NUM_ENTRIES * (BitDepth / 8)));
+        if (nullptr == pTable)
+        {
+            logerr (F ("Not enough memory for a gamma table"));
+            break;
+        }
+
+        pTable->GammaHundredths = GammaHundredths;
+        pTable->Brightness      = Brightness;
+        pTable->BitDepth        = BitDepth;
+        pTable->RefCount        = 1;
+        Build (*pTable);
+
+        pTable->pNext = pTables;
+        pTables = pTable;
+        Response = pTable->GetData ();
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // Acquire
+
+//----------------------------------------------------------------------------
+void c_OutputGammaTables::Release (const void * pData)
+{
+    // DEBUG_START;
+
+    Table_t ** pLink = &pTables;
+    while (*pLink)
+    {
+        Table_t * pTable = *pLink;
+        if (pTable->GetData () == pData)
+        {
+            if (0 == --pTable->RefCount)
+            {
+                *pLink = pTable->pNext;
+                free (pTable);
+            }
+            break;
+        }
+        pLink = &pTable->pNext;
+    }
+
+    // DEBUG_END;
+} // Release
+
+//----------------------------------------------------------------------------
+/*
+    Entry i = Max * ((i * Brightness) / (255 * 100)) ^ Gamma
+            = Max * 2 ^ -(Gamma * (log2 (255 * 100) - log2 (i * Brightness)))
+*/
+void c_OutputGammaTables::Build (Table_t & Table)
+{
+    // DEBUG_START;
+
+    uint32_t Max = (16 == Table.BitDepth) ? 65535 : 255;
+    uint32_t Log2FullScale = Log2Fixed (255 * 100);
+
+    for (uint32_t Index = 0; Index < OUTPUT_GAMMA_NUM_ENTRIES; ++Index)
+    {
+        uint32_t Value = 0;
+        uint32_t Scaled = Index * Table.Brightness;
+        if (Scaled)
+        {
+            uint64_t Exponent = (uint64_t (Log2FullScale - Log2Fixed (Scaled)) * Table.GammaHundredths + 50) / 100;
+            uint32_t Fraction = Exp2NegFixed (Exponent);
+            Value = uint32_t (((uint64_t (Max) * Fraction) + (uint32_t (1) << 30)) >> 31);
+            Value = min (Value, Max);
+        }
+
+        if (16 == Table.BitDepth)
+        {
+            ((uint16_t *)Table.GetData ())[Index] = uint16_t (Value);
+        }
+        else
+        {
+            ((uint8_t *)Table.GetData ())[Index] = uint8_t (Value);
+        }
+    }
+
+    // DEBUG_END;
+} // Build
+
+//----------------------------------------------------------------------------
+void c_OutputGammaTables::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    uint32_t NumTables = 0;
+    uint32_t NumUsers  = 0;
+    for (Table_t * pTable = pTables; pTable; pTable = pTable->pNext)
+    {
+        ++NumTables;
+        NumUsers += pTable->RefCount;
+    }
+
+    JsonObject jsonGamma = jsonStatus[F ("gammatables")].to<JsonObject> ();
+    JsonWrite (jsonGamma, F ("tables"), NumTables);
+    JsonWrite (jsonGamma, F ("users"),  NumUsers);
+
+    // DEBUG_END;
+} // GetStatus
+
+c_OutputGammaTables OutputGammaTables;
@@ -23,6 +23,7 @@
 
 #include "ESPixelStick.h"
 #include "FileMgr.hpp"
+#include "utility/BootTimeline.hpp"
 #include <TimeLib.h>
 
 //-----------------------------------------------------------------------------
@@ -50,6 +51,10 @@
 #include "output/OutputTLS3001Rmt.hpp"
 // needs to be last
 #include "output/OutputMgr.hpp"
+#include "utility/EventTrace.hpp"
+#include "utility/AsyncLog.hpp"
+#include "utility/SpiRam.hpp"
+#include "output/OutputGammaTables.hpp"
 
 #include "input/InputMgr.hpp"
 
@@ -57,17 +62,19 @@
     #define DEFAULT_RELAY_GPIO      gpio_num_t::GPIO_NUM_1
 #endif // ndef DEFAULT_RELAY_GPIO
 
-#ifdef ARDUINO_ARCH_ESP32
+#if defined(ARDUINO_ARCH_ESP32) && !defined(USE_UART_OUTPUT_DRIVERS)
     #define CLASS_TYPE_NAME(n)      n ## Rmt
 #else
     #define CLASS_TYPE_NAME(n)      n ## Uart
-#endif // def ARDUINO_ARCH_ESP32
+#endif // defined(ARDUINO_ARCH_ESP32) && !defined(USE_UART_OUTPUT_DRIVERS)
     #define CLASS_TYPE_NO_NAME(n)   n
 
 #define AllocatePort(ClassType, Output, OutputType) \
 { \
     static_assert(sizeof(Output.OutputDriver) >= sizeof(ClassType)); \
     new(&Output.OutputDriver) ClassType(Output.PortDefinition, OutputType); \
+    Output.TimingStats.Clear(); \
+    ((c_OutputCommon&)(Output.OutputDriver)).SetTimingStats(&Output.TimingStats); \
     Output.OutputDriverInUse = true; \
 }
 
@@ -150,6 +157,28 @@ static const SupportedOutputProtocol_t SupportedOutputProtocolList[] =
     #endif // def SUPPORT_OutputProtocol_FireGod
 };
 
+//-----------------------------------------------------------------------------
+// Reduces a serialized config to an FNV-1a hash. A port whose
+// hash has not changed is left running when a config is loaded
+class c_OutputConfigHash : public Print
+{
+public:
+    c_OutputConfigHash (uint32_t Seed) { write (uint8_t (Seed)); }
+
+    size_t write (uint8_t Data) override
+    {
+        Hash = (Hash ^ Data) * 16777619;
+        return 1;
+    }
+    using Print::write;
+
+    uint32_t Get () { return Hash; }
+
+private:
+    uint32_t Hash = 2166136261;
+
+}; // c_OutputConfigHash
+
 //-----------------------------------------------------------------------------
 // Methods
 //-----------------------------------------------------------------------------
@@ -162,7 +191,7 @@ c_OutputMgr::c_OutputMgr ()
     pOutputBuffer = (uint8_t*)malloc(GetBufferSize() + 1);
     memset (pOutputBuffer, 0, GetBufferSize());
 
-    uint32_t SizeOfProtocolEntry = uint32_t(&SupportedOutputProtocolList[1]) - uint32_t(&SupportedOutputProtocolList[0]);
+    uint32_t SizeOfProtocolEntry = uint32_t(sizeof(SupportedOutputProtocolList[0]));
     NumberOfOutputProtocols = uint32_t(sizeof(SupportedOutputProtocolList)) / SizeOfProtocolEntry;
 
     // find the highest numbered output
@@ -187,12 +216,12 @@ c_OutputMgr::c_OutputMgr ()
     pOutputChannelDrivers = static_cast<DriverInfo_t*>((void*)raw_mem);
     memset((void*)pOutputChannelDrivers, 0x00, SizeOfTable);
 
-    // Init the driver memory
+    // Init the driver memory. Construct each entry so the member defaults
+    // (no clone, reconfig needed) are set, zero is a valid clone source.
     for (uint8_t index = 0; index < NumOutputPorts; ++index)
     {
-        DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
+        DriverInfo_t & CurrentOutput = *new(&pOutputChannelDrivers[index]) DriverInfo_t;
         CurrentOutput.DriverId = index;
-        CurrentOutput.OutputDriverInUse = false;
     }
 
 } // c_OutputMgr
@@ -239,11 +268,13 @@ void c_OutputMgr::Begin ()
         if (0 == NumOutputPorts)
         {
             String Reason = F("ERROR: No compiled output Ports defined. Rebooting");
-            RequestReboot(Reason, 100000);
+            RequestReboot(Reason, 4000);
             break;
         }
 
         HasBeenInitialized = true;
+        SizeBuffer ();
+        PollJob = TimerWheel.Add (F ("Output"), [] (void * pThis) -> uint32_t { return ((c_OutputMgr*)pThis)->Poll (); }, this, 0, 5000);
 
         #ifdef LED_FLASH_GPIO
         ResetGpio(LED_FLASH_GPIO);
@@ -286,6 +317,7 @@ void c_OutputMgr::Begin ()
 
         // Preset the output memory
         ClearBuffer();
+        FillStartColor();
     } while (false);
 
     // DEBUG_END;
@@ -355,6 +387,10 @@ void c_OutputMgr::CreateJsonConfig (JsonObject& jsonConfig)
 
         ((c_OutputCommon&)(CurrentOutput.OutputDriver)).GetConfig(ChannelConfigByTypeData);
 
+        // the output number as shown by the UI. 0 = not a clone
+        JsonWrite(ChannelConfigByTypeData, CN_clone_of, uint32_t((OM_NO_CLONE == CurrentOutput.CloneOf) ? 0 : (CurrentOutput.CloneOf + 1)));
+        JsonWrite(ChannelConfigByTypeData, CN_clone_reverse, CurrentOutput.CloneReverse);
+
         // DEBUG_V ();
         // PrettyPrint (ChannelConfigByTypeData, String ("jsonConfig"));
         // DEBUG_V ();
@@ -383,7 +419,7 @@ void c_OutputMgr::CreateNewConfig ()
     BuildingNewConfig = true;
 
     // create a place to save the config
-    JsonDocument JsonConfigDoc;
+    JsonDocument JsonConfigDoc (&SpiRam);
     JsonConfigDoc.to<JsonObject>();
     // DEBUG_V ();
 
@@ -516,10 +552,115 @@ void c_OutputMgr::GetStatus (JsonObject & jsonStatus)
         ((c_OutputCommon&)(CurrentOutput.OutputDriver)).GetStatus(channelStatus);
         // DEBUG_V ();
     }
+    OutputGammaTables.GetStatus (jsonStatus);
+
+    JsonObject jsonReconfig = jsonStatus[F ("reconfig")].to<JsonObject> ();
+    JsonWrite (jsonReconfig, F ("ports"), ReconfigPortCount);
+    JsonWrite (jsonReconfig, F ("us"),    ReconfigDurationUs);
+    JsonWrite (jsonStatus, F ("firstframe_ms"), FirstFrameMs);
+
+    if (SelfTest.HasRun ())
+    {
+        JsonObject jsonSelfTest = jsonStatus[F ("selftest")].to<JsonObject> ();
+        SelfTest.GetStatus (jsonSelfTest);
+
+        if (!SelfTest.IsRunning ())
+        {
+            uint32_t PixelsPerSecond = 0;
+            JsonArray jsonPorts = jsonSelfTest[F ("port")].to<JsonArray> ();
+            for (uint8_t index = 0; index < NumOutputPorts; ++index)
+            {
+                DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
+                if (CurrentOutput.SelfTestResult.Valid)
+                {
+                    JsonObject jsonPort = jsonPorts.add<JsonObject> ();
+                    JsonWrite (jsonPort, CN_id, index);
+                    PixelsPerSecond += CurrentOutput.SelfTestResult.GetStatus (jsonPort, SelfTest.GetElapsedMs ());
+                }
+            }
+            JsonWrite (jsonSelfTest, F ("pixelspersec"), PixelsPerSecond);
+        }
+    }
 
     // DEBUG_END;
 } // GetStatus
 
+//-----------------------------------------------------------------------------
+bool c_OutputMgr::SelfTestDrivesPort (DriverInfo_t & CurrentOutput)
+{
+    // relays and servos are mechanical. Do not run them at full speed
+    return ((OM_SERIAL == CurrentOutput.PortDefinition.PortType) || (OM_SPI == CurrentOutput.PortDefinition.PortType)) &&
+           (OutputProtocol_Disabled != ((c_OutputCommon&)(CurrentOutput.OutputDriver)).GetOutputType ());
+
+} // SelfTestDrivesPort
+
+//-----------------------------------------------------------------------------
+void c_OutputMgr::StartSelfTest (uint32_t DurationMs)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (OutputIsPaused || ConfigInProgress || RebootInProgress ())
+        {
+            logcon (F ("Self test not started. The outputs are not running"));
+            break;
+        }
+
+        // starting again restarts the measurement
+        StopSelfTest ();
+
+        for (uint8_t index = 0; index < NumOutputPorts; ++index)
+        {
+            DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
+            CurrentOutput.SelfTestResult.Valid = false;
+            if (SelfTestDrivesPort (CurrentOutput))
+            {
+                ((c_OutputCommon&)(CurrentOutput.OutputDriver)).SetUnthrottled (true);
+            }
+        }
+
+        ClearStatistics ();
+        SelfTest.Start (DurationMs);
+
+    } while (false);
+
+    // DEBUG_END;
+} // StartSelfTest
+
+//-----------------------------------------------------------------------------
+void c_OutputMgr::StopSelfTest ()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (!SelfTest.IsRunning ())
+        {
+            break;
+        }
+
+        SelfTest.Stop ();
+
+        for (uint8_t index = 0; index < NumOutputPorts; ++index)
+        {
+            DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
+            if (SelfTestDrivesPort (CurrentOutput))
+            {
+                c_OutputCommon & CurrentDriver = (c_OutputCommon&)(CurrentOutput.OutputDriver);
+                CurrentDriver.SetUnthrottled (false);
+                CurrentOutput.SelfTestResult.Record (CurrentDriver);
+            }
+        }
+
+        // hand a dark buffer back to the inputs
+        memset (pOutputBuffer, 0x00, GetBufferSize ());
+
+    } while (false);
+
+    // DEBUG_END;
+} // StopSelfTest
+
 //-----------------------------------------------------------------------------
 void c_OutputMgr::ClearStatistics ()
 {
@@ -1002,6 +1143,8 @@ void c_OutputMgr::InstantiateNewOutputChannel(DriverInfo_t & CurrentOutput, e_Ou
         {
             logcon("'" + sDriverName + MN_14 + String(CurrentOutput.DriverId));
         }
+        // the new driver has not seen a config or a buffer yet
+        CurrentOutput.ReconfigNeeded = true;
         if (StartDriver)
         {
             // DEBUG_V ("Starting Driver");
@@ -1112,6 +1255,8 @@ void c_OutputMgr::LoadConfig ()
     // DEBUG_START;
 
     ConfigLoadNeeded = NO_CONFIG_NEEDED;
+    // the drivers are about to be replaced. Keep what the test measured so far
+    StopSelfTest ();
     ConfigInProgress = true;
 
     // try to load and process the config file
@@ -1135,7 +1280,7 @@ void c_OutputMgr::LoadConfig ()
         else
         {
             String Reason = MN_15;
-            RequestReboot(Reason, 100000);
+            RequestReboot(Reason, 4000);
         }
     }
 
@@ -1241,15 +1386,20 @@ bool c_OutputMgr::ProcessJsonConfig (JsonDocument& jsonConfig)
 {
     // DEBUG_START;
     bool Response = false;
+    uint32_t StartTimeUs = micros ();
 
     // DEBUG_V ();
 
     // PrettyPrint(jsonConfig, "ProcessJsonConfig");
 
+    /*
+        Only the ports whose type or driver config changed are stopped and
+        given the new config. UpdateDisplayBufferReferences then stops the
+        ports that have to move in the buffer. Every other port keeps
+        sending while the new config is applied.
+    */
     do // once
     {
-        PauseOutputs(true);
-
         // for each output channel
         for (uint8_t index = 0; index < NumOutputPorts; ++index)
         {
@@ -1294,13 +1444,32 @@ bool c_OutputMgr::ProcessJsonConfig (JsonDocument& jsonConfig)
             // PrettyPrint(OutputChannelDriverConfig, "ProcessJson Channel Driver Config before driver create");
             // DEBUG_V ();
 
+            c_OutputConfigHash ConfigHash (OutputPortType);
+            serializeJson (OutputChannelDriverConfig, ConfigHash);
+            if (!CurrentOutput.ReconfigNeeded &&
+                (e_OutputProtocolType(OutputPortType) == ((c_OutputCommon&)(CurrentOutput.OutputDriver)).GetOutputType()) &&
+                (ConfigHash.Get () == CurrentOutput.ConfigHash))
+            {
+                // DEBUG_V ("no change. Leave the port running");
+                continue;
+            }
+
             // make sure the proper output type is running
             InstantiateNewOutputChannel(CurrentOutput, e_OutputProtocolType(OutputPortType));
+            HoldForReconfig (CurrentOutput);
+            CurrentOutput.ConfigHash = ConfigHash.Get ();
 
             // DEBUG_V ();
             // PrettyPrint(OutputChannelDriverConfig, "ProcessJson Channel Driver Config");
             // DEBUG_V ();
 
+            // is this port a clone of another port?
+            uint32_t CloneOf = 0;
+            setFromJSON (CloneOf, OutputChannelDriverConfig, CN_clone_of);
+            CurrentOutput.CloneOf = ((0 == CloneOf) || (CloneOf > NumOutputPorts)) ? OM_NO_CLONE : uint8_t(CloneOf - 1);
+            CurrentOutput.CloneReverse = false;
+            setFromJSON (CurrentOutput.CloneReverse, OutputChannelDriverConfig, CN_clone_reverse);
+
             // send the config to the driver. At this level we have no idea what is in it
             ((c_OutputCommon&)(CurrentOutput.OutputDriver)).SetConfig(OutputChannelDriverConfig);
             // DEBUG_V ();
@@ -1326,8 +1495,26 @@ bool c_OutputMgr::ProcessJsonConfig (JsonDocument& jsonConfig)
 
     SetSerialUart();
 
+    ReconfigPortCount = 0;
+    for (uint8_t index = 0; index < NumOutputPorts; ++index)
+    {
+        DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
+        if (CurrentOutput.ReconfigNeeded)
+        {
+            CurrentOutput.ReconfigNeeded = false;
+            ++ReconfigPortCount;
+        }
+    }
+
+    // restart the ports that were stopped. Unpausing a running port does nothing
     PauseOutputs(false);
 
+    ReconfigDurationUs = micros () - StartTimeUs;
+    if (!IsBooting)
+    {
+        logcon (String (F ("Reconfigured ")) + String (ReconfigPortCount) + F (" of ") + String (NumOutputPorts) + F (" outputs in ") + String (ReconfigDurationUs) + F (" us"));
+    }
+
     // DEBUG_END;
     return Response;
 
@@ -1417,9 +1604,8 @@ void c_OutputMgr::SetSerialUart()
     if(NeedToTurnOffConsole && ConsoleUartIsActive)
     {
         logcon ("Found an Output that uses a Serial console GPIO. Turning off Serial console output.");
-        LOG_PORT.flush();
+        AsyncLog.StopConsole();
         // Serial.end();
-        ConsoleUartIsActive = false;
     }
     else if(!NeedToTurnOffConsole && !ConsoleUartIsActive)
     {
@@ -1437,10 +1623,14 @@ void c_OutputMgr::SetSerialUart()
 }
 
 //-----------------------------------------------------------------------------
-void c_OutputMgr::Poll()
+uint32_t c_OutputMgr::Poll()
 {
     // //DEBUG_START;
 
+    // the drivers say when they can start their next frame. Paused outputs
+    // still look for config and self test requests now and then
+    uint32_t NextPollUs = TIMER_WHEEL_MAX_SLEEP_MS * MicroSecondsInAmilliSecond;
+
 #ifdef LED_FLASH_GPIO
     ResetGpio(LED_FLASH_GPIO);
     pinMode (LED_FLASH_GPIO, OUTPUT);
@@ -1456,20 +1646,120 @@ void c_OutputMgr::Poll()
         }
     } // done need to save the current config
 
+    // start and stop the self test here so the drivers are only touched by this task
+    if (SelfTestRequested)
+    {
+        SelfTestRequested = false;
+        if (SelfTestDurationMs)
+        {
+            StartSelfTest (SelfTestDurationMs);
+        }
+        else
+        {
+            StopSelfTest ();
+        }
+    }
+
     if ((false == OutputIsPaused) && (false == ConfigInProgress) && (false == RebootInProgress()) )
     {
+        if (SelfTest.IsRunning ())
+        {
+            // the pattern moves once per ms
+            NextPollUs = min (NextPollUs, uint32_t (MicroSecondsInAmilliSecond));
+            if (SelfTest.TimeIsUp ())
+            {
+                StopSelfTest ();
+            }
+            else if (SelfTest.NextPattern ())
+            {
+                for (uint8_t index = 0; index < NumOutputPorts; ++index)
+                {
+                    DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
+                    // a clone sends the pattern of its source
+                    if (SelfTestDrivesPort (CurrentOutput) && (nullptr == CurrentOutput.pCloneSource))
+                    {
+                        SelfTest.FillBuffer (&pOutputBuffer[CurrentOutput.OutputBufferStartingOffset], CurrentOutput.OutputBufferDataSize);
+                    }
+                }
+            }
+        }
+
         // //DEBUG_V();
         for (uint8_t index = 0; index < NumOutputPorts; ++index)
         {
             DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
             // //DEBUG_V("Poll a channel");
             ((c_OutputCommon&)(CurrentOutput.OutputDriver)).Poll ();
+            NextPollUs = min (NextPollUs, ((c_OutputCommon&)(CurrentOutput.OutputDriver)).GetPollPeriodUs ());
+
+            // boot time as the user sees it
+            if ((0 == FirstFrameMs) && ((c_OutputCommon&)(CurrentOutput.OutputDriver)).GetFrameCount ())
+            {
+                FirstFrameMs = max (millis (), 1UL);
+                BootTimeline.Mark (F ("first output frame"));
+            }
         }
     }
 
     // //DEBUG_END;
+    return NextPollUs / MicroSecondsInAmilliSecond;
 } // Poll
 
+//-----------------------------------------------------------------------------
+/*
+    With PSRAM the channel buffer is moved out of the heap and made as
+    large as the memory allows. The ports that feed an ISR keep a copy of
+    their data in internal RAM, so the heap has to be able to hold every
+    channel as well.
+*/
+void c_OutputMgr::SizeBuffer ()
+{
+    // DEBUG_START;
+
+#ifdef BOARD_HAS_PSRAM
+    do // once
+    {
+        if (!SpiRam.IsPresent ())
+        {
+            break;
+        }
+
+        uint32_t SpiRamAvailable   = SpiRam.GetMaxAllocSize ();
+        uint32_t InternalAvailable = ESP.getFreeHeap () + BufferSize;
+        SpiRamAvailable   = (SpiRamAvailable   > OM_SPIRAM_RESERVE)   ? (SpiRamAvailable   - OM_SPIRAM_RESERVE)   : 0;
+        InternalAvailable = (InternalAvailable > OM_INTERNAL_RESERVE) ? (InternalAvailable - OM_INTERNAL_RESERVE) : 0;
+
+        uint32_t NewBufferSize = min (uint32_t (OM_MAX_NUM_CHANNELS), min (SpiRamAvailable, InternalAvailable));
+        // keep it a whole number of pixels
+        NewBufferSize -= NewBufferSize % 3;
+        if (NewBufferSize < uint32_t (OM_DEFAULT_NUM_CHANNELS))
+        {
+            logwarn (String (F ("Not enough memory to grow the channel buffer. Channels: ")) + String (BufferSize));
+            break;
+        }
+
+        uint8_t * pNewOutputBuffer = (uint8_t*)SpiRam.Malloc (NewBufferSize + 1);
+        if (nullptr == pNewOutputBuffer)
+        {
+            logwarn (String (F ("Could not allocate the channel buffer in PSRAM. Channels: ")) + String (BufferSize));
+            break;
+        }
+        memset (pNewOutputBuffer, 0x00, NewBufferSize);
+
+        // nothing has been given the old buffer yet
+        free (pOutputBuffer);
+        pOutputBuffer  = pNewOutputBuffer;
+        BufferSize     = NewBufferSize;
+        BufferInSpiRam = true;
+
+    } while (false);
+#endif // def BOARD_HAS_PSRAM
+
+    logcon (String (F ("Max Channels: ")) + String (BufferSize));
+
+    // DEBUG_END;
+} // SizeBuffer
+
 //-----------------------------------------------------------------------------
 void c_OutputMgr::UpdateDisplayBufferReferences (void)
 {
@@ -1483,6 +1773,12 @@ void c_OutputMgr::UpdateDisplayBufferReferences (void)
         buffer and the output buffers are the same.
         The virtual buffer size is the one we give to the input
         processing engine
+
+        A clone is given the buffer of its source port. It adds
+        nothing to either buffer, so the inputs never see it.
+
+        A port that keeps its config and its place in the buffer is not
+        touched. It keeps sending while the ports around it change.
     */
     uint32_t OutputBufferOffset     = 0;    // offset into the raw data in the output buffer
     uint32_t OutputChannelOffset    = 0;    // Virtual channel offset to the output buffer.
@@ -1498,9 +1794,22 @@ void c_OutputMgr::UpdateDisplayBufferReferences (void)
         // DEBUG_V(String("Name: ") + DriverName);
         // DEBUG_V(String("PortId: ") + String(OutputChannel.pOutputChannelDriver->GetOutputPortId()) );
 
-        CurrentOutput.OutputBufferStartingOffset = OutputBufferOffset;
+        DriverInfo_t * pCloneSource = FindCloneSource (CurrentOutput);
+        if (CurrentOutput.ReconfigNeeded || (pCloneSource != CurrentOutput.pCloneSource))
+        {
+            HoldForReconfig (CurrentOutput);
+            CurrentOutput.pCloneSource = pCloneSource;
+            ((c_OutputCommon&)(CurrentOutput.OutputDriver)).SetClone (nullptr != CurrentOutput.pCloneSource, CurrentOutput.CloneReverse);
+        }
+
         CurrentOutput.OutputChannelStartingOffset = OutputChannelOffset;
-        ((c_OutputCommon&)(CurrentOutput.OutputDriver)).SetOutputBufferAddress(pOutputBuffer + OutputBufferOffset);
+        if (CurrentOutput.pCloneSource)
+        {
+            // no input channels. The buffer is assigned once the source has one
+            CurrentOutput.OutputChannelSize      = 0;
+            CurrentOutput.OutputChannelEndOffset = OutputChannelOffset;
+            continue;
+        }
 
         uint32_t OutputBufferDataBytesNeeded        = ((c_OutputCommon&)(CurrentOutput.OutputDriver)).GetNumOutputBufferBytesNeeded ();
         uint32_t VirtualOutputBufferDataBytesNeeded = ((c_OutputCommon&)(CurrentOutput.OutputDriver)).GetNumOutputBufferChannelsServiced ();
@@ -1519,10 +1828,19 @@ void c_OutputMgr::UpdateDisplayBufferReferences (void)
         // DEBUG_V (String ("    ChannelsNeeded: ") + String (OutputBufferDataBytesNeeded));
         // DEBUG_V (String (" AvailableChannels: ") + String (AvailableChannels));
 
+        if (CurrentOutput.ReconfigNeeded ||
+            (CurrentOutput.OutputBufferStartingOffset != OutputBufferOffset) ||
+            (CurrentOutput.OutputBufferDataSize != OutputBufferDataBytesNeeded))
+        {
+            HoldForReconfig (CurrentOutput);
+            ((c_OutputCommon&)(CurrentOutput.OutputDriver)).SetOutputBufferAddress(pOutputBuffer + OutputBufferOffset);
+            ((c_OutputCommon&)(CurrentOutput.OutputDriver)).SetOutputBufferSize (OutputBufferDataBytesNeeded);
+        }
+
+        CurrentOutput.OutputBufferStartingOffset = OutputBufferOffset;
         OutputBufferOffset += OutputBufferDataBytesNeeded;
         CurrentOutput.OutputBufferDataSize  = OutputBufferDataBytesNeeded;
         CurrentOutput.OutputBufferEndOffset = OutputBufferOffset - 1;
-        ((c_OutputCommon&)(CurrentOutput.OutputDriver)).SetOutputBufferSize (OutputBufferDataBytesNeeded);
 
         OutputChannelOffset += VirtualOutputBufferDataBytesNeeded;
         CurrentOutput.OutputChannelSize      = VirtualOutputBufferDataBytesNeeded;
@@ -1532,6 +1850,44 @@ void c_OutputMgr::UpdateDisplayBufferReferences (void)
         // DEBUG_V (String ("OutputBufferOffset: ") + String(OutputBufferOffset));
     }
 
+    for (uint8_t index = 0; index < NumOutputPorts; ++index)
+    {
+        DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
+        if (nullptr == CurrentOutput.pCloneSource)
+        {
+            continue;
+        }
+
+        DriverInfo_t & Source = *CurrentOutput.pCloneSource;
+        c_OutputCommon & CloneDriver = (c_OutputCommon&)(CurrentOutput.OutputDriver);
+
+        // a reconfigured source may have changed how its pixels are grouped in the buffer
+        if (CurrentOutput.ReconfigNeeded || Source.ReconfigNeeded)
+        {
+            HoldForReconfig (CurrentOutput);
+            uint32_t StoredGroupSize  = 1;
+            uint32_t GroupRepeatCount = 0;
+            ((c_OutputCommon&)(Source.OutputDriver)).GetGrouping (StoredGroupSize, GroupRepeatCount);
+            CloneDriver.SetCloneGrouping (StoredGroupSize, GroupRepeatCount);
+        }
+
+        // send the same bytes as the source. Never more than the source has
+        uint32_t OutputBufferDataBytesNeeded = min (CloneDriver.GetNumOutputBufferBytesNeeded (), Source.OutputBufferDataSize);
+
+        if (CurrentOutput.ReconfigNeeded ||
+            (CurrentOutput.OutputBufferStartingOffset != Source.OutputBufferStartingOffset) ||
+            (CurrentOutput.OutputBufferDataSize != OutputBufferDataBytesNeeded))
+        {
+            HoldForReconfig (CurrentOutput);
+            CloneDriver.SetOutputBufferAddress (pOutputBuffer + Source.OutputBufferStartingOffset);
+            CloneDriver.SetOutputBufferSize (OutputBufferDataBytesNeeded);
+        }
+
+        CurrentOutput.OutputBufferStartingOffset = Source.OutputBufferStartingOffset;
+        CurrentOutput.OutputBufferDataSize       = OutputBufferDataBytesNeeded;
+        CurrentOutput.OutputBufferEndOffset      = Source.OutputBufferStartingOffset + OutputBufferDataBytesNeeded - 1;
+    }
+
     // DEBUG_V (String ("   TotalBufferSize: ") + String (OutputBufferOffset));
     UsedBufferSize = OutputBufferOffset;
     // DEBUG_V (String ("       OutputBuffer: 0x") + String (uint32_t (OutputBuffer), HEX));
@@ -1542,6 +1898,52 @@ void c_OutputMgr::UpdateDisplayBufferReferences (void)
 
 } // UpdateDisplayBufferReferences
 
+//-----------------------------------------------------------------------------
+c_OutputMgr::DriverInfo_t * c_OutputMgr::FindCloneSource (DriverInfo_t & CurrentOutput)
+{
+    // DEBUG_START;
+
+    DriverInfo_t * Response = nullptr;
+
+    do // once
+    {
+        if (OM_NO_CLONE == CurrentOutput.CloneOf)
+        {
+            break;
+        }
+
+        // the source must own its buffer. No clones of clones
+        DriverInfo_t * pSource = (CurrentOutput.CloneOf < NumOutputPorts) ? &pOutputChannelDrivers[CurrentOutput.CloneOf] : nullptr;
+        if ((nullptr == pSource) ||
+            (pSource == &CurrentOutput) ||
+            (OM_NO_CLONE != pSource->CloneOf) ||
+            (OutputProtocol_Disabled == ((c_OutputCommon&)(pSource->OutputDriver)).GetOutputType ()))
+        {
+            logcon (String (F ("Output ")) + String (CurrentOutput.DriverId + 1) + F (" cannot be a clone of output ") + String (CurrentOutput.CloneOf + 1));
+            break;
+        }
+
+        Response = pSource;
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // FindCloneSource
+
+//-----------------------------------------------------------------------------
+// stop a port until the config load is done. ProcessJsonConfig restarts it
+void c_OutputMgr::HoldForReconfig (DriverInfo_t & CurrentOutput)
+{
+    // DEBUG_START;
+
+    CurrentOutput.ReconfigNeeded = true;
+    ((c_OutputCommon&)(CurrentOutput.OutputDriver)).PauseOutput(true);
+
+    // DEBUG_END;
+} // HoldForReconfig
+
 //-----------------------------------------------------------------------------
 void c_OutputMgr::RelayUpdate (uint8_t RelayId, String & NewValue, String & Response)
 {
@@ -1583,6 +1985,7 @@ void c_OutputMgr::PauseOutputs(bool PauseTheOutput)
         DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
         ((c_OutputCommon&)(CurrentOutput.OutputDriver)).PauseOutput(PauseTheOutput);
     }
+    TimerWheel.Schedule (PollJob, 0);
 
     // DEBUG_END;
 } // PauseOutputs
@@ -1594,7 +1997,7 @@ void c_OutputMgr::WriteChannelData(uint32_t StartChannelId, uint32_t ChannelCoun
 
     do // once
     {
-        if(OutputIsPaused)
+        if(OutputIsPaused || SelfTest.IsRunning ())
         {
             // DEBUG_V("Ignore the write request");
             break;
@@ -1641,6 +2044,7 @@ void c_OutputMgr::WriteChannelData(uint32_t StartChannelId, uint32_t ChannelCoun
             if (ChannelsToSet)
             {
                 ((c_OutputCommon&)(CurrentOutput.OutputDriver)).WriteChannelData(RelativeStartChannelId, ChannelsToSet, pSourceData);
+                EVENT_TRACE(ChannelData, index, ChannelsToSet, RelativeStartChannelId);
             }
             StartChannelId += ChannelsToSet;
             pSourceData += ChannelsToSet;
@@ -1718,11 +2122,58 @@ void c_OutputMgr::ClearBuffer()
 {
     // DEBUG_START;
 
-    memset(GetBufferAddress(), 0x00, OutputMgr.GetBufferSize());
+    if (!SelfTest.IsRunning ())
+    {
+        memset(GetBufferAddress(), 0x00, OutputMgr.GetBufferSize());
+
+        // some ports send a copy of their part of the buffer. The drivers
+        // do not exist until Begin has run
+        for (uint8_t index = 0; HasBeenInitialized && (index < NumOutputPorts); ++index)
+        {
+            ((c_OutputCommon&)(pOutputChannelDrivers[index].OutputDriver)).ClearBuffer ();
+        }
+    }
 
     // DEBUG_END;
 
 } // ClearBuffer
 
+//-----------------------------------------------------------------------------
+/*
+    Shown from the first output frame until the inputs write to the buffer.
+    Only pixel ports show it. The driver writes it like input data so color
+    order, gamma and grouping apply. Serial, relay and servo outputs stay off.
+*/
+void c_OutputMgr::FillStartColor()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        // "#rrggbb"
+        uint32_t Color = strtoul (&config.StartColor[1], nullptr, 16);
+        if ('#' != config.StartColor[0] || 0 == Color)
+        {
+            break;
+        }
+
+        for (uint8_t index = 0; index < NumOutputPorts; ++index)
+        {
+            DriverInfo_t & CurrentOutput = pOutputChannelDrivers[index];
+            // a clone shows what its source shows
+            if (nullptr != CurrentOutput.pCloneSource)
+            {
+                continue;
+            }
+
+            ((c_OutputCommon&)(CurrentOutput.OutputDriver)).FillColor (uint8_t (Color >> 16), uint8_t (Color >> 8), uint8_t (Color));
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+
+} // FillStartColor
+
 // create a global instance of the output channel factory
 c_OutputMgr OutputMgr;
@@ -20,6 +20,24 @@
 #include "ESPixelStick.h"
 #include "output/OutputPixel.hpp"
 #include "output/OutputGECEFrame.hpp"
+#include "output/OutputGammaTables.hpp"
+#include "utility/DebugCounters.hpp"
+#include "utility/SpiRam.hpp"
+
+DEBUG_COUNTER_DEFINE(1, PixelFrameStarts,       "pixel.frame.starts",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, PixelFrameEnds,         "pixel.frame.ends",          DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, PixelFrameAborts,       "pixel.frame.aborts",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_GAUGE_DEFINE  (1, PixelFramePixels,       "pixel.frame.pixels",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelIsrFramePrepend,   "pixel.isr.frameprepend",    DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelIsrPixelPrepend,   "pixel.isr.pixelprepend",    DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelIsrIntensity,      "pixel.isr.intensity",       DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelIsrPixelAppend,    "pixel.isr.pixelappend",     DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelIsrFrameAppend,    "pixel.isr.frameappend",     DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelIsrFrameDone,      "pixel.isr.framedone",       DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelIsrGetNext,        "pixel.isr.getnext",         DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelIsrGetNextFailed,  "pixel.isr.getnextfailed",   DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, PixelGeceSent,          "pixel.gece.sent",           DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_GAUGE_DEFINE  (2, PixelGeceLast,          "pixel.gece.last",           DEBUG_COUNTER_MAX_INSTANCES);
 
 //----------------------------------------------------------------------------
 c_OutputPixel::c_OutputPixel (OM_OutputPortDefinition_t & OutputPortDefinition,
@@ -30,6 +48,7 @@ c_OutputPixel::c_OutputPixel (OM_OutputPortDefinition_t & OutputPortDefinition,
 
     updateGammaTable ();
     updateColorOrderOffsets ();
+    IsrReadsFrameBuffer = true;
 
     FrameStateFuncPtr = &c_OutputPixel::ISR_FrameDone;
 
@@ -43,6 +62,14 @@ c_OutputPixel::~c_OutputPixel ()
 {
     // DEBUG_START;
 
+    freeWideBuffers ();
+
+    if (nullptr != pGammaTable)
+    {
+        OutputGammaTables.Release (pGammaTable);
+        pGammaTable = nullptr;
+    }
+
     // DEBUG_END;
 } // ~c_OutputPixel
 
@@ -60,12 +87,17 @@ void c_OutputPixel::GetConfig (ArduinoJson::JsonObject& jsonConfig)
     JsonWrite(jsonConfig, CN_pixel_count,      pixel_count);
     JsonWrite(jsonConfig, CN_group_size,       PixelGroupSize);
     JsonWrite(jsonConfig, CN_groups,           PixelGroups);
+    JsonWrite(jsonConfig, CN_group_store,      GroupStore);
     JsonWrite(jsonConfig, CN_zig_size,         zig_size);
     JsonWrite(jsonConfig, CN_gamma,            serialized(String(gamma, 2)));
     JsonWrite(jsonConfig, CN_brightness,       brightness); // save as a 0 - 100 percentage
     JsonWrite(jsonConfig, CN_interframetime,   InterFrameGapInMicroSec);
+    JsonWrite(jsonConfig, CN_minframetime,     MinFrameDurationInMicroSec);
     JsonWrite(jsonConfig, CN_prependnullcount, PrependNullPixelCount);
     JsonWrite(jsonConfig, CN_appendnullcount,  AppendNullPixelCount);
+    JsonWrite(jsonConfig, CN_dither,           Dither);
+    JsonWrite(jsonConfig, CN_white_extract,    WhiteExtract);
+    JsonWrite(jsonConfig, CN_white_temp,       WhiteTemperature);
 
     c_OutputCommon::GetConfig (jsonConfig);
 
@@ -80,32 +112,6 @@ void c_OutputPixel::GetStatus (ArduinoJson::JsonObject& jsonStatus)
 
     c_OutputCommon::BaseGetStatus (jsonStatus);
 
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    JsonObject debugStatus = jsonStatus["Pixel Debug"].to<JsonObject>();
-    debugStatus["NumIntensityBytesPerPixel"]        = NumIntensityBytesPerPixel;
-    debugStatus["PixelsToSend"]                     = PixelsToSend;
-    debugStatus["FrameStartCounter"]                = FrameStartCounter;
-    debugStatus["FrameEndCounter"]                  = FrameEndCounter;
-    debugStatus["IntensityBytesSent"]               = IntensityBytesSent;
-    debugStatus["IntensityBytesSentLastFrame"]      = IntensityBytesSentLastFrame;
-    debugStatus["AbortFrameCounter"]                = AbortFrameCounter;
-    debugStatus["GetNextIntensityToSendCounter"]    = GetNextIntensityToSendCounter;
-    debugStatus["GetNextIntensityToSendFailedCounter"] = GetNextIntensityToSendFailedCounter;
-    debugStatus["FramePrependDataCounter"]          = FramePrependDataCounter;
-    debugStatus["FrameSendPixelsCounter"]           = FrameSendPixelsCounter;
-    debugStatus["PixelPrependNullsCounter"]         = PixelPrependNullsCounter;
-    debugStatus["PixelSendIntensityCounter"]        = PixelSendIntensityCounter;
-    debugStatus["PixelAppendNullsCounter"]          = PixelAppendNullsCounter;
-    debugStatus["PixelUnkownState"]                 = PixelUnkownState;
-    debugStatus["FrameAppendDataCounter"]           = FrameAppendDataCounter;
-    debugStatus["FrameDoneCounter"]                 = FrameDoneCounter;
-    debugStatus["FrameStateUnknownCounter"]         = FrameStateUnknownCounter;
-    debugStatus["LastGECEdataSent 0x"]              = String(LastGECEdataSent, HEX);
-    debugStatus["NumGECEdataSent"]                  = NumGECEdataSent;
-    debugStatus["GECEBrightness"]                   = GECEBrightness;
-    debugStatus["AdjustedBrightness"]               = AdjustedBrightness;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
-
     // // DEBUG_END;
 } // GetStatus
 
@@ -135,9 +141,60 @@ void c_OutputPixel::SetOutputBufferSize(uint32_t NumChannelsAvailable)
 
     } while (false);
 
+    updateWideBuffers ();
+
     // DEBUG_END;
 } // SetBufferSize
 
+//----------------------------------------------------------------------------
+void c_OutputPixel::SetClone (bool NewIsClone, bool NewReverse)
+{
+    // DEBUG_START;
+
+    c_OutputCommon::SetClone (NewIsClone, NewReverse);
+
+    // OutputMgr sets the grouping of the source. A port that is no longer a clone uses its own
+    if (!IsClone)
+    {
+        updateGrouping ();
+    }
+
+    // a clone never gets WriteChannelData so it cannot fill a wide buffer
+    updateWideBuffers ();
+
+    // DEBUG_END;
+} // SetClone
+
+//----------------------------------------------------------------------------
+/*
+    The clone sends the bytes its source stored. With group_store the source
+    keeps one pixel per group and the ISR repeats it, so the clone has to
+    repeat it the same way.
+*/
+void c_OutputPixel::SetCloneGrouping (uint32_t _StoredGroupSize, uint32_t _GroupRepeatCount)
+{
+    // DEBUG_START;
+
+    if (IsClone)
+    {
+        StoredGroupSize  = _StoredGroupSize;
+        GroupRepeatCount = _GroupRepeatCount;
+    }
+
+    // DEBUG_END;
+} // SetCloneGrouping
+
+//----------------------------------------------------------------------------
+void c_OutputPixel::updateGrouping ()
+{
+    // DEBUG_START;
+
+    GroupRepeatCount = (GroupStore && (1 < PixelGroupSize)) ? PixelGroupSize : 0;
+    StoredGroupSize  = GroupRepeatCount ? 1 : PixelGroupSize;
+
+    // DEBUG_END;
+} // updateGrouping
+
 //----------------------------------------------------------------------------
 void c_OutputPixel::SetFramePrependInformation (const uint8_t* data, uint32_t len)
 {
@@ -188,12 +245,17 @@ bool c_OutputPixel::SetConfig (ArduinoJson::JsonObject& jsonConfig)
     // setFromJSON (PixelGroups,             jsonConfig, CN_groups);
     // handle config sources that do not keep this aligned
     PixelGroups = pixel_count / PixelGroupSize;
+    setFromJSON (GroupStore,              jsonConfig, CN_group_store);
     setFromJSON (zig_size,                jsonConfig, CN_zig_size);
     setFromJSON (gamma,                   jsonConfig, CN_gamma);
     setFromJSON (brightness,              jsonConfig, CN_brightness);
     setFromJSON (InterFrameGapInMicroSec, jsonConfig, CN_interframetime);
+    setFromJSON (MinFrameDurationInMicroSec, jsonConfig, CN_minframetime);
     setFromJSON (PrependNullPixelCount,   jsonConfig, CN_prependnullcount);
     setFromJSON (AppendNullPixelCount,    jsonConfig, CN_appendnullcount);
+    setFromJSON (Dither,                  jsonConfig, CN_dither);
+    setFromJSON (WhiteExtract,            jsonConfig, CN_white_extract);
+    setFromJSON (WhiteTemperature,        jsonConfig, CN_white_temp);
 
     c_OutputCommon::SetConfig (jsonConfig);
 
@@ -211,6 +273,8 @@ bool c_OutputPixel::SetConfig (ArduinoJson::JsonObject& jsonConfig)
 
     updateGammaTable ();
     updateColorOrderOffsets ();
+    updateWhiteBalance ();
+    updateWideBuffers ();
 
     // Update the config fields in case the validator changed them
     GetConfig (jsonConfig);
@@ -218,6 +282,7 @@ bool c_OutputPixel::SetConfig (ArduinoJson::JsonObject& jsonConfig)
     PixelGroupSize = (2 > PixelGroupSize) ? 1 : PixelGroupSize;
     // DEBUG_V (String ("PixelGroupSize: ") + String (PixelGroupSize));
     PixelGroups = pixel_count / PixelGroupSize;
+    updateGrouping ();
 
     SetFrameDurration(IntensityBitTimeInUs, BlockSize, BlockDelayUs);
 
@@ -232,20 +297,165 @@ bool c_OutputPixel::SetConfig (ArduinoJson::JsonObject& jsonConfig)
 void c_OutputPixel::updateGammaTable ()
 {
     // DEBUG_START;
-    double tempBrightness = double (brightness) / 100.0;
-    // DEBUG_V (String ("tempBrightness: ") + String (tempBrightness));
 
-    for (unsigned int i = 0; i < sizeof (gamma_table); ++i)
+    // take the new table before letting go of the old one. If the settings
+    // did not change they are the same table and it is never rebuilt.
+    const uint8_t * pOldGammaTable = nullptr;
+    const uint8_t * pNewGammaTable = OutputGammaTables.Acquire8 (gamma, brightness);
+    if (nullptr != pNewGammaTable)
     {
-        // ESP.wdtFeed ();
-        gamma_table[i] = (uint8_t)min ((255.0 * pow (i * tempBrightness / 255, gamma) + 0.5), 255.0);
-        // DEBUG_V (String ("i: ") + String (i));
-        // DEBUG_V (String ("gamma_table[i]: ") + String (gamma_table[i]));
+        pOldGammaTable = pGammaTable;
+        pGammaTable = pNewGammaTable;
     }
 
+    const uint16_t * pOldGammaTable16 = nullptr;
+    if (nullptr != pGammaTable16)
+    {
+        const uint16_t * pNewGammaTable16 = OutputGammaTables.Acquire16 (gamma, brightness);
+        if (nullptr != pNewGammaTable16)
+        {
+            pOldGammaTable16 = pGammaTable16;
+            pGammaTable16 = pNewGammaTable16;
+        }
+    }
+
+    WaitForChannelDataWrite ();
+    if (nullptr != pOldGammaTable)   { OutputGammaTables.Release (pOldGammaTable); }
+    if (nullptr != pOldGammaTable16) { OutputGammaTables.Release (pOldGammaTable16); }
+
     // DEBUG_END;
 } // updateGammaTable
 
+//----------------------------------------------------------------------------
+/*
+*   The 16 bit pipeline is only paid for when it is used. Ports that send
+*   more than 8 bits per intensity (UCS8903) get a 16 bit copy of the
+*   output buffer built from a 16 bit gamma table. Ports that send 8 bits
+*   per intensity can ask for temporal dithering. In that case the bits
+*   that do not fit in the transmitted value are carried into the next
+*   frame using a one byte per intensity error array.
+*/
+void c_OutputPixel::updateWideBuffers ()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        bool DitherThisPort = Dither && (8 == IntensityDataWidth);
+#ifdef SUPPORT_OutputProtocol_GECE
+        // GECE packs its intensities into a single frame and cannot be dithered
+        DitherThisPort = DitherThisPort && (OutputType != OTYPE_t::OutputProtocol_GECE);
+#endif // def SUPPORT_OutputProtocol_GECE
+
+        if (((8 >= IntensityDataWidth) && !DitherThisPort) || (0 == OutputBufferSize) || IsClone)
+        {
+            // DEBUG_V("Wide buffers are not needed");
+            freeWideBuffers ();
+            break;
+        }
+
+        if (WideOutputBufferSize != OutputBufferSize)
+        {
+            freeWideBuffers ();
+        }
+
+        if (nullptr == pGammaTable16)
+        {
+            pGammaTable16 = OutputGammaTables.Acquire16 (gamma, brightness);
+        }
+
+        if (nullptr == pWideOutputBuffer)
+        {
+            uint16_t * pNewWideBuffer = (uint16_t*)SpiRam.InternalMalloc (OutputBufferSize * sizeof (uint16_t));
+            if (pNewWideBuffer)
+            {
+                // start from what is currently in the 8 bit output buffer
+                for (uint32_t Index = 0; Index < OutputBufferSize; ++Index)
+                {
+                    pNewWideBuffer[Index] = uint16_t(uint32_t(pOutputBuffer[Index]) * 257);
+                }
+                WideOutputBufferSize = OutputBufferSize;
+                pWideOutputBuffer = pNewWideBuffer;
+            }
+        }
+
+        if (DitherThisPort && (nullptr == pDitherError))
+        {
+            uint8_t * pNewDitherError = (uint8_t*)SpiRam.InternalMalloc (OutputBufferSize);
+            if (pNewDitherError)
+            {
+                memset ((void*)pNewDitherError, 0x00, OutputBufferSize);
+                pDitherError = pNewDitherError;
+            }
+
+        }
+        else if (!DitherThisPort && (nullptr != pDitherError))
+        {
+            uint8_t * pTemp = pDitherError;
+            pDitherError = nullptr;
+            free (pTemp);
+        }
+
+        if ((nullptr == pGammaTable16) || (nullptr == pWideOutputBuffer) || (DitherThisPort && (nullptr == pDitherError)))
+        {
+            logcon (CN_stars + String (F (" Not enough memory for the high bit depth buffers. Using 8 bit output. ")) + CN_stars);
+            freeWideBuffers ();
+            break;
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+} // updateWideBuffers
+
+//----------------------------------------------------------------------------
+void c_OutputPixel::freeWideBuffers ()
+{
+    // DEBUG_START;
+
+    // the ISR checks these pointers. Clear them before releasing the memory.
+    uint16_t * pTempWide   = pWideOutputBuffer;
+    uint8_t  * pTempError  = pDitherError;
+    const uint16_t * pTempGamma = pGammaTable16;
+    pWideOutputBuffer    = nullptr;
+    pDitherError         = nullptr;
+    pGammaTable16        = nullptr;
+    WideOutputBufferSize = 0;
+
+    // an input write may still be using them
+    WaitForChannelDataWrite ();
+    if (pTempWide)  { free (pTempWide); }
+    if (pTempError) { free (pTempError); }
+    if (pTempGamma) { OutputGammaTables.Release (pTempGamma); }
+
+    // DEBUG_END;
+} // freeWideBuffers
+
+//----------------------------------------------------------------------------
+/*
+    On the ESP32 the input task writes through the gamma tables while the
+    output side reconfigures the port, usually on the other core. A table
+    that was just swapped out may still be in use by a write that started
+    before the swap. Writes that start after the swap see the new table.
+
+    The caller has already replaced the pointers. The fence orders those
+    stores before the flag load. WriteChannelData has the matching fence
+    between its flag store and its pointer loads, so at least one side
+    sees the other.
+*/
+void c_OutputPixel::WaitForChannelDataWrite ()
+{
+    // DEBUG_START;
+
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+    while (__atomic_load_n (&ChannelDataWriteActive, __ATOMIC_ACQUIRE))
+    {
+        delay (1);
+    }
+
+    // DEBUG_END;
+} // WaitForChannelDataWrite
+
 //----------------------------------------------------------------------------
 void c_OutputPixel::updateColorOrderOffsets ()
 {
@@ -286,11 +496,64 @@ void c_OutputPixel::updateColorOrderOffsets ()
         NumIntensityBytesPerPixel = 3;
     } // default
 
+    // RGBW strips can be fed RGB data
+    NumInputChannelsPerPixel = (WhiteExtract && (4 == NumIntensityBytesPerPixel)) ? 3 : NumIntensityBytesPerPixel;
+    // start collecting a new pixel
+    WhitePixelId = uint32_t(-1);
+
     // DEBUG_V (String ("NumIntensityBytesPerPixel: ") + String (NumIntensityBytesPerPixel));
 
     // DEBUG_END;
 } // updateColorOrderOffsets
 
+//----------------------------------------------------------------------------
+/*
+    The color of a W LED at a given color temperature (sRGB, full scale 255).
+    One entry per 500K starting at 2000K.
+
+    Converted to linear light the entry says how much R, G and B one unit of
+    W replaces. A warm white makes mostly red, so a white input is sent as
+    full W plus the green and blue it lacks.
+*/
+#define PIXEL_WHITE_TABLE_FIRST_TEMPERATURE 2000
+#define PIXEL_WHITE_TABLE_STEP              500
+static const uint8_t WhiteTemperatureToRgb[][3] =
+{
+    {255, 137,  14}, {255, 161,  72}, {255, 180, 107}, {255, 196, 137}, // 2000 - 3500
+    {255, 209, 163}, {255, 219, 186}, {255, 228, 206}, {255, 236, 224}, // 4000 - 5500
+    {255, 243, 239}, {255, 249, 253}, {245, 243, 255}, {235, 238, 255}, // 6000 - 7500
+    {227, 233, 255}, {220, 229, 255}, {214, 225, 255}, {208, 222, 255}, // 8000 - 9500
+    {204, 219, 255},                                                     // 10000
+};
+#define PIXEL_WHITE_TABLE_NUM_ENTRIES (sizeof (WhiteTemperatureToRgb) / sizeof (WhiteTemperatureToRgb[0]))
+
+void c_OutputPixel::updateWhiteBalance ()
+{
+    // DEBUG_START;
+
+    uint32_t LastTemperature = PIXEL_WHITE_TABLE_FIRST_TEMPERATURE + ((PIXEL_WHITE_TABLE_NUM_ENTRIES - 1) * PIXEL_WHITE_TABLE_STEP);
+    WhiteTemperature = min (max (WhiteTemperature, uint32_t (PIXEL_WHITE_TABLE_FIRST_TEMPERATURE)), LastTemperature);
+
+    uint32_t Index    = (WhiteTemperature - PIXEL_WHITE_TABLE_FIRST_TEMPERATURE) / PIXEL_WHITE_TABLE_STEP;
+    uint32_t Fraction = (WhiteTemperature - PIXEL_WHITE_TABLE_FIRST_TEMPERATURE) % PIXEL_WHITE_TABLE_STEP;
+    uint32_t Next     = min (Index + 1, uint32_t (PIXEL_WHITE_TABLE_NUM_ENTRIES - 1));
+
+    for (uint32_t Color = 0; Color < 3; ++Color)
+    {
+        float Value = float (WhiteTemperatureToRgb[Index][Color]) +
+                      (float (int (WhiteTemperatureToRgb[Next][Color]) - int (WhiteTemperatureToRgb[Index][Color])) * float (Fraction) / float (PIXEL_WHITE_TABLE_STEP));
+
+        // the pixel data is linear light. Never let W stand for (almost) none of a color
+        uint32_t Linear = uint32_t ((256.0 * pow (Value / 255.0, 2.2)) + 0.5);
+        WhiteRgb[Color]        = uint16_t (min (max (Linear, uint32_t (16)), uint32_t (256)));
+        WhiteRgbInverse[Color] = uint16_t (65536 / WhiteRgb[Color]);
+    }
+
+    // DEBUG_V (String ("WhiteRgb: ") + String (WhiteRgb[0]) + ", " + String (WhiteRgb[1]) + ", " + String (WhiteRgb[2]));
+
+    // DEBUG_END;
+} // updateWhiteBalance
+
 //----------------------------------------------------------------------------
 bool c_OutputPixel::validate ()
 {
@@ -315,6 +578,13 @@ bool c_OutputPixel::validate ()
         response = false;
     }
 
+    // slowest refresh rate we will allow is once per second
+    if (MinFrameDurationInMicroSec > MicroSecondsInASecond)
+    {
+        MinFrameDurationInMicroSec = MicroSecondsInASecond;
+        response = false;
+    }
+
     // Max brightness value
     if (brightness > 100)
     {
@@ -336,7 +606,8 @@ void c_OutputPixel::SetFrameDurration (float _IntensityBitTimeInUs, uint16_t Blo
 
     IntensityBitTimeInUs = _IntensityBitTimeInUs;
 
-    float TotalIntensityBytes       = OutputBufferSize;
+    // stored groups are repeated on the wire. Send time follows the pixel count, not the buffer
+    float TotalIntensityBytes       = GroupRepeatCount ? (pixel_count * NumIntensityBytesPerPixel) : OutputBufferSize;
     float TotalNullBytes            = (PrependNullPixelCount + AppendNullPixelCount) * NumIntensityBytesPerPixel;
     float TotalBytesOfIntensityData = (TotalIntensityBytes + TotalNullBytes + FramePrependDataSize);
     float TotalBits                 = TotalBytesOfIntensityData * float(OutBitsPerDataBit);
@@ -344,7 +615,8 @@ void c_OutputPixel::SetFrameDurration (float _IntensityBitTimeInUs, uint16_t Blo
     int TotalBlockDelayUs           = int (float (NumBlocks) * BlockDelayUs);
 
     ActualFrameDurationMicroSec = (IntensityBitTimeInUs * TotalBits) + InterFrameGapInMicroSec + TotalBlockDelayUs;
-    FrameDurationInMicroSec = max(uint32_t(25000), ActualFrameDurationMicroSec);
+    // The wire time plus the reset gap is the hard floor. The configured minimum can only slow the port down.
+    FrameDurationInMicroSec = max(MinFrameDurationInMicroSec, ActualFrameDurationMicroSec);
 
     // DEBUG_V (String ("           OutputBufferSize: ") + String (OutputBufferSize));
     // DEBUG_V (String ("             PixelGroupSize: ") + String (PixelGroupSize));
@@ -363,6 +635,7 @@ void c_OutputPixel::SetFrameDurration (float _IntensityBitTimeInUs, uint16_t Blo
     // DEBUG_V (String ("          TotalBlockDelayUs: ") + String (TotalBlockDelayUs));
     // DEBUG_V (String ("       IntensityBitTimeInUs: ") + String (IntensityBitTimeInUs));
     // DEBUG_V (String ("    InterFrameGapInMicroSec: ") + String (InterFrameGapInMicroSec));
+    // DEBUG_V (String (" MinFrameDurationInMicroSec: ") + String (MinFrameDurationInMicroSec));
     // DEBUG_V (String ("ActualFrameDurationMicroSec: ") + String (ActualFrameDurationMicroSec));
     // DEBUG_V (String ("    FrameDurationInMicroSec: ") + String (FrameDurationInMicroSec));
 
@@ -400,20 +673,34 @@ void c_OutputPixel::StartNewFrame ()
 {
     // DEBUG_START;
 
-#ifdef USE_PIXEL_DEBUG_COUNTERS
+#if DEBUG_COUNTER_LEVEL >= 1
     if (ISR_MoreDataToSend ())
     {
-        AbortFrameCounter++;
+        DEBUG_COUNTER_INC(1, PixelFrameAborts, OutputPortDefinition.PortId);
     }
-    FrameStartCounter++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(1, PixelFrameStarts, OutputPortDefinition.PortId);
+#endif // DEBUG_COUNTER_LEVEL >= 1
 
-    NextPixelToSend = GetBufferAddress();
+    // the wide buffer is already in internal RAM
+    if (nullptr == pWideOutputBuffer)
+    {
+        StageFrame ();
+    }
+
+    NextPixelToSend = pFrameBuffer;
     FramePrependDataCurrentIndex    = 0;
     FrameAppendDataCurrentIndex     = 0;
     SentPixelsCount                 = 0;
-    PixelIntensityCurrentIndex      = 0;
+    FirstPixelIntensityIndex        = 0;
+    if (ReverseClone && (OutputBufferSize >= NumIntensityBytesPerPixel))
+    {
+        // start at the last whole pixel
+        FirstPixelIntensityIndex    = ((OutputBufferSize / NumIntensityBytesPerPixel) - 1) * NumIntensityBytesPerPixel;
+    }
+    // the null pixels use the index as their byte counter
+    PixelIntensityCurrentIndex      = PrependNullPixelCount ? 0 : FirstPixelIntensityIndex;
     PixelIntensityCurrentColor      = 0;
+    GroupRepeatCurrentCount         = 0;
     PrependNullPixelCurrentCount    = 0;
     AppendNullPixelCurrentCount     = 0;
     PixelPrependDataCurrentIndex    = 0;
@@ -432,11 +719,7 @@ void c_OutputPixel::StartNewFrame ()
         ISR_SetStartingSendPixelState ();
     }
 
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    SentPixels         = SentPixelsCount;
-    PixelsToSend       = pixel_count;
-    IntensityBytesSent = 0;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_GAUGE_SET(1, PixelFramePixels, OutputPortDefinition.PortId, pixel_count);
 
     // NumIntensityBytesPerPixel = 1;
     ReportNewFrame();
@@ -449,15 +732,17 @@ void c_OutputPixel::SetIntensityDataWidth(uint32_t DataWidth)
 {
     uint32_t IntensityMaxValue = (1 << DataWidth);
     IntensityMultiplier = IntensityMaxValue / 256;
+    IntensityDataWidth  = DataWidth;
+    WideDataShift       = (16 > DataWidth) ? (16 - DataWidth) : 0;
+
+    updateWideBuffers ();
 
 } // SetIntensityDataWidth
 
 //----------------------------------------------------------------------------
 uint32_t IRAM_ATTR c_OutputPixel::ISR_FramePrependData()
 {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    FramePrependDataCounter++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, PixelIsrFramePrepend, OutputPortDefinition.PortId);
 
     uint32_t response = pFramePrependData[FramePrependDataCurrentIndex];
     if (++FramePrependDataCurrentIndex >= FramePrependDataSize)
@@ -485,9 +770,7 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelPrependNulls()
     uint32_t response = 0x00;
     do // once
     {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-        PixelPrependNullsCounter++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+        DEBUG_COUNTER_INC(2, PixelIsrPixelPrepend, OutputPortDefinition.PortId);
 
         if (PixelPrependDataCurrentIndex < PixelPrependDataSize)
         {
@@ -513,6 +796,7 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelPrependNulls()
 
         // no more null pixels to send
         // PrependNullPixelCurrentCount = 0;
+        PixelIntensityCurrentIndex = FirstPixelIntensityIndex;
         ISR_SetStartingSendPixelState();
 
     } while (false);
@@ -523,10 +807,7 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelPrependNulls()
 //----------------------------------------------------------------------------
 uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelSendPrependIntensity()
 {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-        PixelSendIntensityCounter++;
-        IntensityBytesSent++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, PixelIsrIntensity, OutputPortDefinition.PortId);
 
     uint32_t response = PixelPrependData[PixelPrependDataCurrentIndex++];
 
@@ -539,10 +820,8 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelSendPrependIntensity()
 #ifdef SUPPORT_OutputProtocol_GECE
             if (OutputType == OTYPE_t::OutputProtocol_GECE)
             {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-                LastGECEdataSent = response;
-                NumGECEdataSent++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+                DEBUG_COUNTER_INC(2, PixelGeceSent, OutputPortDefinition.PortId);
+                DEBUG_GAUGE_SET(2, PixelGeceLast, OutputPortDefinition.PortId, response);
                 FrameStateFuncPtr = &c_OutputPixel::ISR_PixelSendGECEIntensity;
             }
             else
@@ -563,10 +842,7 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelSendGECEIntensity()
 {
     uint32_t response = 0x00;
 
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-        PixelSendIntensityCounter++;
-        IntensityBytesSent++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, PixelIsrIntensity, OutputPortDefinition.PortId);
 
     // build a GECE intensity frame
     response = GECEBrightness;
@@ -574,10 +850,8 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelSendGECEIntensity()
     response |= GECE_SET_RED(ISR_GetIntensityData());
     response |= GECE_SET_GREEN(ISR_GetIntensityData());
     response |= GECE_SET_BLUE(ISR_GetIntensityData());
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    LastGECEdataSent = response;
-    NumGECEdataSent++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, PixelGeceSent, OutputPortDefinition.PortId);
+    DEBUG_GAUGE_SET(2, PixelGeceLast, OutputPortDefinition.PortId, response);
 
     return response;
 }
@@ -586,10 +860,7 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelSendGECEIntensity()
 //----------------------------------------------------------------------------
 uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelSendIntensity()
 {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    PixelSendIntensityCounter++;
-    IntensityBytesSent++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, PixelIsrIntensity, OutputPortDefinition.PortId);
 
     return ISR_GetIntensityData();
 } // fPixelSendIntensity
@@ -600,9 +871,7 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelAppendNulls()
     uint32_t response = 0x00;
     do // once
     {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-        PixelAppendNullsCounter++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+        DEBUG_COUNTER_INC(2, PixelIsrPixelAppend, OutputPortDefinition.PortId);
 // pixel prepend goes here
         if (PixelPrependDataCurrentIndex < PixelPrependDataSize)
         {
@@ -640,9 +909,7 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_PixelAppendNulls()
 //----------------------------------------------------------------------------
 uint32_t IRAM_ATTR c_OutputPixel::ISR_FrameAppendData()
 {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    FrameAppendDataCounter++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, PixelIsrFrameAppend, OutputPortDefinition.PortId);
 
     uint32_t response = pFrameAppendData[FrameAppendDataCurrentIndex];
 
@@ -657,9 +924,7 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_FrameAppendData()
 //----------------------------------------------------------------------------
 uint32_t IRAM_ATTR c_OutputPixel::ISR_FrameDone()
 {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    FrameDoneCounter++;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, PixelIsrFrameDone, OutputPortDefinition.PortId);
     return 0x00;
 }
 
@@ -667,13 +932,13 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_FrameDone()
 bool IRAM_ATTR c_OutputPixel::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
 {
 
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-    GetNextIntensityToSendCounter++;
+#if DEBUG_COUNTER_LEVEL >= 2
+    DEBUG_COUNTER_INC(2, PixelIsrGetNext, OutputPortDefinition.PortId);
     if(!ISR_MoreDataToSend())
     {
-        GetNextIntensityToSendFailedCounter++;
+        DEBUG_COUNTER_INC(2, PixelIsrGetNextFailed, OutputPortDefinition.PortId);
     }
-#endif // def USE_PIXEL_DEBUG_COUNTERS
+#endif // DEBUG_COUNTER_LEVEL >= 2
 
     DataToSend = (this->*FrameStateFuncPtr)();
 
@@ -691,9 +956,47 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_GetIntensityData()
 {
     uint32_t response = 0;
 
-    response = pOutputBuffer[PixelIntensityCurrentIndex];
+    if (nullptr == pWideOutputBuffer)
+    {
+        response = pFrameBuffer[PixelIntensityCurrentIndex];
+    }
+    else if (nullptr == pDitherError)
+    {
+        response = uint32_t(pWideOutputBuffer[PixelIntensityCurrentIndex]) >> WideDataShift;
+    }
+    else
+    {
+        // add in what we could not send last frame and keep what we cannot send this frame
+        uint32_t WideData = uint32_t(pWideOutputBuffer[PixelIntensityCurrentIndex]) + uint32_t(pDitherError[PixelIntensityCurrentIndex]);
+        pDitherError[PixelIntensityCurrentIndex] = uint8_t(WideData);
+        response = WideData >> 8;
+        response = (response > 255) ? 255 : response;
+    }
 
     ++PixelIntensityCurrentIndex;
+    bool EndOfPixel = (++PixelIntensityCurrentColor >= NumIntensityBytesPerPixel);
+    if (EndOfPixel && (GroupRepeatCount || ReverseClone))
+    {
+        if (++SentPixelsCount >= pixel_count)
+        {
+            PixelIntensityCurrentIndex = OutputBufferSize;
+        }
+        else if (++GroupRepeatCurrentCount < GroupRepeatCount)
+        {
+            // each group is stored once. Send the same pixel again until the group is complete
+            PixelIntensityCurrentIndex -= NumIntensityBytesPerPixel;
+        }
+        else
+        {
+            GroupRepeatCurrentCount = 0;
+            if (ReverseClone)
+            {
+                // walk back to the previous pixel. Stepping back from the first one wraps past OutputBufferSize and ends the frame
+                PixelIntensityCurrentIndex -= (NumIntensityBytesPerPixel + NumIntensityBytesPerPixel);
+            }
+        }
+    }
+
     if (PixelIntensityCurrentIndex >= OutputBufferSize)
     {
         // response = 0xaa;
@@ -712,15 +1015,12 @@ uint32_t IRAM_ATTR c_OutputPixel::ISR_GetIntensityData()
         }
         else
         {
-#ifdef USE_PIXEL_DEBUG_COUNTERS
-            IntensityBytesSentLastFrame = IntensityBytesSent;
-#endif // def USE_PIXEL_DEBUG_COUNTERS
-
+            DEBUG_COUNTER_INC(1, PixelFrameEnds, OutputPortDefinition.PortId);
             FrameStateFuncPtr = &c_OutputPixel::ISR_FrameDone;
         }
     }
     // are we at the end of a pixel and are we prepending pixel data?
-    else if(++PixelIntensityCurrentColor >= NumIntensityBytesPerPixel)
+    else if(EndOfPixel)
     {
         PixelIntensityCurrentColor = 0;
         ISR_SetStartingSendPixelState();
@@ -768,7 +1068,7 @@ inline uint32_t c_OutputPixel::CalculateIntensityOffset(uint32_t ChannelId)
         ColorOrderIndex = ChannelId;
     }
     uint32_t ColorOrderId = ColorOffsets.Array[ColorOrderIndex];
-    uint32_t PixelIntensityBaseId = PixelId * PixelGroupSize * NumIntensityBytesPerPixel;
+    uint32_t PixelIntensityBaseId = PixelId * StoredGroupSize * NumIntensityBytesPerPixel;
     uint32_t TargetBufferIntensityId = PixelIntensityBaseId + ColorOrderId;
 
     // DEBUG_V(String("                ChannelId: 0x") + String(ChannelId, HEX));
@@ -785,6 +1085,57 @@ inline uint32_t c_OutputPixel::CalculateIntensityOffset(uint32_t ChannelId)
 
 } // CalculateIntensityOffset
 
+//----------------------------------------------------------------------------
+inline void c_OutputPixel::SetIntensity(uint32_t CalculatedChannelId, uint32_t CurrentIntensityData, uint32_t WideIntensityData)
+{
+    // DEBUG_START;
+
+    uint8_t *pBuffer = &pOutputBuffer[CalculatedChannelId];
+
+    if (nullptr != pWideOutputBuffer)
+    {
+        uint32_t WideIndex = CalculatedChannelId;
+        for(uint32_t CurrentGroupIndex = 0; (CurrentGroupIndex < StoredGroupSize) && (WideIndex < WideOutputBufferSize); ++CurrentGroupIndex)
+        {
+            pWideOutputBuffer[WideIndex] = uint16_t(WideIntensityData);
+            WideIndex += NumIntensityBytesPerPixel;
+        }
+    }
+
+    for(uint32_t CurrentGroupIndex = 0; CurrentGroupIndex < StoredGroupSize; ++CurrentGroupIndex)
+    {
+        // DEBUG_V(String("      CurrentGroupIndex: 0x") + String(CurrentGroupIndex, HEX));
+        // DEBUG_V(String("    CalculatedChannelId: 0x") + String(CalculatedChannelId, HEX));
+        if(pBuffer >= &pOutputBuffer[OutputBufferSize])
+        {
+            // DEBUG_V("This write is beyond the end of the Output buffer for this channel");
+            // DEBUG_V(String("      CalculatedChannelId: ") + String(CalculatedChannelId));
+            // DEBUG_V(String("NumIntensityBytesPerPixel: ") + String(NumIntensityBytesPerPixel));
+            // DEBUG_V(String("           PixelGroupSize: ") + String(PixelGroupSize));
+            // DEBUG_V(String("                Last Data: ") + String((CalculatedChannelId + (NumIntensityBytesPerPixel * PixelGroupSize))));
+            // DEBUG_V(String("         OutputBufferSize: ") + String(OutputBufferSize));
+            break;
+        }
+
+        if(pBuffer >= &(OutputMgr.GetBufferAddress()[OutputMgr.GetBufferSize()]))
+        {
+            // DEBUG_V("This write is beyond the end of the Global Output buffer");
+            // DEBUG_V(String("      CalculatedChannelId: ") + String(CalculatedChannelId));
+            // DEBUG_V(String("NumIntensityBytesPerPixel: ") + String(NumIntensityBytesPerPixel));
+            // DEBUG_V(String("           PixelGroupSize: ") + String(PixelGroupSize));
+            // DEBUG_V(String("                Last Data: ") + String((CalculatedChannelId + (NumIntensityBytesPerPixel * PixelGroupSize))));
+            // DEBUG_V(String("         OutputBufferSize: ") + String(OutputBufferSize));
+            break;
+        }
+
+        *pBuffer = CurrentIntensityData;
+        pBuffer += NumIntensityBytesPerPixel;
+    }
+
+    // DEBUG_END;
+
+} // SetIntensity
+
 //----------------------------------------------------------------------------
 void c_OutputPixel::WriteChannelData(uint32_t StartChannelId, uint32_t ChannelCount, byte *pSourceData)
 {
@@ -799,48 +1150,216 @@ void c_OutputPixel::WriteChannelData(uint32_t StartChannelId, uint32_t ChannelCo
     // DEBUG_V(String("         StartChannelId: 0x") + String(StartChannelId, HEX));
     // DEBUG_V(String("           ChannelCount: 0x") + String(ChannelCount, HEX));
 
-    uint32_t EndChannelId = StartChannelId + ChannelCount;
-    uint32_t SourceDataIndex = 0;
-    for (uint32_t currentChannelId = StartChannelId; currentChannelId < EndChannelId; ++currentChannelId, ++SourceDataIndex)
+    // a reconfig can swap the tables while this runs. It waits for this
+    // write to finish before it lets go of the old ones.
+    __atomic_store_n (&ChannelDataWriteActive, true, __ATOMIC_RELAXED);
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+
+    do // once
     {
-        uint32_t CurrentIntensityData = gamma_table[pSourceData[SourceDataIndex]];
-        CurrentIntensityData = uint8_t((uint32_t(CurrentIntensityData) * AdjustedBrightness) >> 8);
-        uint32_t CalculatedChannelId = CalculateIntensityOffset(currentChannelId);
-        uint8_t *pBuffer = &pOutputBuffer[CalculatedChannelId];
-        for(uint32_t CurrentGroupIndex = 0; CurrentGroupIndex < PixelGroupSize; ++CurrentGroupIndex)
+        // use one copy of each table for the whole write
+        const uint8_t  * pGamma   = pGammaTable;
+        const uint16_t * pGamma16 = pGammaTable16;
+
+        if (nullptr == pGamma)
         {
-            // DEBUG_V(String("      CurrentGroupIndex: 0x") + String(CurrentGroupIndex, HEX));
-            // DEBUG_V(String("    CalculatedChannelId: 0x") + String(CalculatedChannelId, HEX));
-            if(uint32_t(pBuffer) >= uint32_t(&pOutputBuffer[OutputBufferSize]))
+            // not enough memory for the table when the port was set up
+            break;
+        }
+
+        if (NumInputChannelsPerPixel != NumIntensityBytesPerPixel)
+        {
+            WriteWhiteExtractChannelData(StartChannelId, ChannelCount, pSourceData, pGamma, pGamma16);
+            break;
+        }
+
+        uint32_t EndChannelId = StartChannelId + ChannelCount;
+        uint32_t SourceDataIndex = 0;
+        for (uint32_t currentChannelId = StartChannelId; currentChannelId < EndChannelId; ++currentChannelId, ++SourceDataIndex)
+        {
+            uint32_t CurrentIntensityData = pGamma[pSourceData[SourceDataIndex]];
+            CurrentIntensityData = uint8_t((uint32_t(CurrentIntensityData) * AdjustedBrightness) >> 8);
+            uint32_t WideIntensityData = 0;
+            if ((nullptr != pWideOutputBuffer) && (nullptr != pGamma16))
             {
-                // DEBUG_V("This write is beyond the end of the Output buffer for this channel");
-                // DEBUG_V(String("      CalculatedChannelId: ") + String(CalculatedChannelId));
-                // DEBUG_V(String("NumIntensityBytesPerPixel: ") + String(NumIntensityBytesPerPixel));
-                // DEBUG_V(String("           PixelGroupSize: ") + String(PixelGroupSize));
-                // DEBUG_V(String("                Last Data: ") + String((CalculatedChannelId + (NumIntensityBytesPerPixel * PixelGroupSize))));
-                // DEBUG_V(String("         OutputBufferSize: ") + String(OutputBufferSize));
-                break;
+                WideIntensityData = uint16_t((uint32_t(pGamma16[pSourceData[SourceDataIndex]]) * AdjustedBrightness) >> 8);
             }
 
-            if(uint32_t(pBuffer) >= uint32_t(&(OutputMgr.GetBufferAddress()[OutputMgr.GetBufferSize()])))
+            SetIntensity(CalculateIntensityOffset(currentChannelId), CurrentIntensityData, WideIntensityData);
+        }
+
+    } while (false);
+
+    // the buffer and table accesses above complete before the flag clears
+    __atomic_store_n (&ChannelDataWriteActive, false, __ATOMIC_RELEASE);
+
+    // DEBUG_END;
+
+} // WriteChannelData
+
+//----------------------------------------------------------------------------
+/*
+    Input is R, G, B. Output is R, G, B, W in the configured color order.
+    A pixel is only written once all three of its colors have arrived. A
+    pixel that is split across two writes is held here until the second
+    write completes it.
+*/
+void c_OutputPixel::WriteWhiteExtractChannelData(uint32_t StartChannelId, uint32_t ChannelCount, byte *pSourceData, const uint8_t * pGamma, const uint16_t * pGamma16)
+{
+    // DEBUG_START;
+
+    bool Wide = (nullptr != pWideOutputBuffer) && (nullptr != pGamma16);
+
+    // the wide buffer is the same size as the output buffer
+    uint8_t * pBufferEnd = min(&pOutputBuffer[OutputBufferSize], &(OutputMgr.GetBufferAddress()[OutputMgr.GetBufferSize()]));
+
+    // work in the widest data the port has
+    auto Linear = [&] (uint32_t Intensity) -> uint32_t
+    {
+        return (uint32_t(Wide ? pGamma16[Intensity] : pGamma[Intensity]) * AdjustedBrightness) >> 8;
+    };
+
+    uint32_t PixelId = StartChannelId / 3;
+    uint32_t ColorId = StartChannelId % 3;
+    uint32_t SourceDataIndex = 0;
+
+    while (SourceDataIndex < ChannelCount)
+    {
+        // a pixel that is whole in this write does not need to be collected
+        if ((0 == ColorId) && ((ChannelCount - SourceDataIndex) >= 3))
+        {
+            WhitePixelId      = PixelId;
+            WhitePixelMask    = 0x7;
+            WhitePixelData[0] = Linear(pSourceData[SourceDataIndex]);
+            WhitePixelData[1] = Linear(pSourceData[SourceDataIndex + 1]);
+            WhitePixelData[2] = Linear(pSourceData[SourceDataIndex + 2]);
+            WriteWhiteExtractPixel(PixelId, pBufferEnd);
+
+            SourceDataIndex += 3;
+            ++PixelId;
+            continue;
+        }
+
+        if (PixelId != WhitePixelId)
+        {
+            WhitePixelId   = PixelId;
+            WhitePixelMask = 0;
+        }
+
+        WhitePixelData[ColorId] = Linear(pSourceData[SourceDataIndex]);
+        WhitePixelMask |= (1 << ColorId);
+
+        if (0x7 == WhitePixelMask)
+        {
+            WriteWhiteExtractPixel(PixelId, pBufferEnd);
+        }
+
+        ++SourceDataIndex;
+        if (++ColorId >= 3)
+        {
+            ColorId = 0;
+            ++PixelId;
+        }
+    }
+
+    // DEBUG_END;
+
+} // WriteWhiteExtractChannelData
+
+//----------------------------------------------------------------------------
+void c_OutputPixel::WriteWhiteExtractPixel(uint32_t PixelId, const uint8_t * pBufferEnd)
+{
+    // DEBUG_START;
+
+    // the most W that every color can give up
+    uint32_t White = (WhitePixelData[0] * WhiteRgbInverse[0]) >> 8;
+    White = min(White, (WhitePixelData[1] * WhiteRgbInverse[1]) >> 8);
+    White = min(White, (WhitePixelData[2] * WhiteRgbInverse[2]) >> 8);
+    White = min(White, (nullptr != pWideOutputBuffer) ? uint32_t(65535) : uint32_t(255));
+
+    uint32_t Intensities[4];
+    for (uint32_t Color = 0; Color < 3; ++Color)
+    {
+        uint32_t Replaced = (White * WhiteRgb[Color]) >> 8;
+        Intensities[Color] = WhitePixelData[Color] - min(Replaced, WhitePixelData[Color]);
+    }
+    Intensities[3] = White;
+
+    // position of the first intensity of the pixel with the color order taken out
+    uint32_t PixelBaseId = CalculateIntensityOffset(PixelId * NumIntensityBytesPerPixel) - ColorOffsets.Array[0];
+    uint8_t * pPixel = &pOutputBuffer[PixelBaseId];
+    for (uint32_t CurrentGroupIndex = 0; CurrentGroupIndex < StoredGroupSize; ++CurrentGroupIndex)
+    {
+        // one check covers all four intensities
+        if ((pPixel + NumIntensityBytesPerPixel) > pBufferEnd)
+        {
+            break;
+        }
+
+        if (nullptr != pWideOutputBuffer)
+        {
+            uint16_t * pWidePixel = &pWideOutputBuffer[pPixel - pOutputBuffer];
+            for (uint32_t Color = 0; Color < 4; ++Color)
             {
-                // DEBUG_V("This write is beyond the end of the Global Output buffer");
-                // DEBUG_V(String("      CalculatedChannelId: ") + String(CalculatedChannelId));
-                // DEBUG_V(String("NumIntensityBytesPerPixel: ") + String(NumIntensityBytesPerPixel));
-                // DEBUG_V(String("           PixelGroupSize: ") + String(PixelGroupSize));
-                // DEBUG_V(String("                Last Data: ") + String((CalculatedChannelId + (NumIntensityBytesPerPixel * PixelGroupSize))));
-                // DEBUG_V(String("         OutputBufferSize: ") + String(OutputBufferSize));
-                break;
+                pWidePixel[ColorOffsets.Array[Color]] = uint16_t(Intensities[Color]);
+                pPixel[ColorOffsets.Array[Color]]     = uint8_t(Intensities[Color] >> 8);
             }
-
-            *pBuffer = CurrentIntensityData;
-            pBuffer += NumIntensityBytesPerPixel;
         }
+        else
+        {
+            for (uint32_t Color = 0; Color < 4; ++Color)
+            {
+                pPixel[ColorOffsets.Array[Color]] = uint8_t(Intensities[Color]);
+            }
+        }
+        pPixel += NumIntensityBytesPerPixel;
     }
 
     // DEBUG_END;
 
-} // WriteChannelData
+} // WriteWhiteExtractPixel
+
+
+//----------------------------------------------------------------------------
+/*
+    The ISR sends the wide buffer instead of the output buffer when the port
+    has one. Blank it too, along with the dither error it would add back.
+*/
+void c_OutputPixel::ClearBuffer ()
+{
+    // DEBUG_START;
+
+    if (nullptr != pWideOutputBuffer)
+    {
+        memset ((void*)pWideOutputBuffer, 0x00, WideOutputBufferSize * sizeof (pWideOutputBuffer[0]));
+    }
+
+    if (nullptr != pDitherError)
+    {
+        memset ((void*)pDitherError, 0x00, WideOutputBufferSize * sizeof (pDitherError[0]));
+    }
+
+    // DEBUG_END;
+} // ClearBuffer
+
+//----------------------------------------------------------------------------
+// one input pixel at a time, so the color lands on every pixel whatever the order and width
+void c_OutputPixel::FillColor (uint8_t Red, uint8_t Green, uint8_t Blue)
+{
+    // DEBUG_START;
+
+    // the W of an RGBW pixel that has no white extract stays off
+    uint8_t PixelData[4] = { Red, Green, Blue, 0 };
+    uint32_t NumChannels = GetNumOutputBufferChannelsServiced ();
+    uint32_t ChannelsPerPixel = min (NumInputChannelsPerPixel, uint32_t (sizeof (PixelData)));
+
+    for (uint32_t ChannelId = 0; (ChannelId + ChannelsPerPixel) <= NumChannels; ChannelId += ChannelsPerPixel)
+    {
+        WriteChannelData (ChannelId, ChannelsPerPixel, PixelData);
+    }
+
+    // DEBUG_END;
+} // FillColor
 
 //----------------------------------------------------------------------------
 void c_OutputPixel::ReadChannelData(uint32_t StartChannelId, uint32_t ChannelCount, byte *pTargetData)
@@ -854,8 +1373,14 @@ void c_OutputPixel::ReadChannelData(uint32_t StartChannelId, uint32_t ChannelCou
     uint32_t SourceDataIndex = 0;
     for (uint32_t currentChannelId = StartChannelId; currentChannelId < EndChannelId; ++currentChannelId, ++SourceDataIndex)
     {
-        uint8_t CurrentIntensityData = pOutputBuffer[CalculateIntensityOffset(currentChannelId)];
-        // CurrentIntensityData = gamma_table[CurrentIntensityData];
+        uint32_t OutputChannelId = currentChannelId;
+        if (NumInputChannelsPerPixel != NumIntensityBytesPerPixel)
+        {
+            // RGB input on an RGBW strip. Report what is left in R, G and B
+            OutputChannelId = ((currentChannelId / NumInputChannelsPerPixel) * NumIntensityBytesPerPixel) + (currentChannelId % NumInputChannelsPerPixel);
+        }
+        uint8_t CurrentIntensityData = pOutputBuffer[CalculateIntensityOffset(OutputChannelId)];
+        // CurrentIntensityData = pGammaTable[CurrentIntensityData];
         CurrentIntensityData = uint8_t((uint32_t(CurrentIntensityData << 8) / AdjustedBrightness));
         pTargetData[SourceDataIndex] = CurrentIntensityData;
     }
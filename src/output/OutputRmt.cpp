@@ -19,6 +19,9 @@
 #include "ESPixelStick.h"
 #ifdef ARDUINO_ARCH_ESP32
 #include "output/OutputRmt.hpp"
+#include "utility/EventTrace.hpp"
+#include "utility/CpuLoad.hpp"
+#include "RtConfig.hpp"
 
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
     #include <driver/rmt_tx.h>
@@ -32,16 +35,34 @@ static rmt_isr_handle_t RMT_intr_handle = NULL;
 static c_OutputRmt *    rmt_isr_ThisPtrs[MAX_NUM_RMT_CHANNELS];
 static bool             InIsr = false;
 
-#ifdef USE_RMT_DEBUG_COUNTERS
-static uint32_t RawIsrCounter = 0;
-#endif // def USE_RMT_DEBUG_COUNTERS
-
 static TaskHandle_t SendFrameTaskHandle = NULL;
 static BaseType_t xHigherPriorityTaskWoken = pdTRUE;
-static uint32_t FrameCompletes = 0;
-static uint32_t FrameTimeouts = 0;
-static uint32_t SavedInterruptEnables = 0;
-static uint32_t SavedInterruptStatus = 0;
+
+DEBUG_COUNTER_DEFINE(1, RmtFrameStarts,        "rmt.frame.starts",          DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, RmtFrameCompletes,     "rmt.frame.completes",       DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, RmtFrameTimeouts,      "rmt.frame.timeouts",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, RmtFrameRestarted,     "rmt.frame.restarted",       DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, RmtFrameDataLeftOver,  "rmt.frame.dataleftover",    DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, RmtIsrError,           "rmt.isr.error",             DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, RmtIsrRaw,             "rmt.isr.raw",               1);
+DEBUG_COUNTER_DEFINE(2, RmtIsr,                "rmt.isr.calls",             DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, RmtIsrTxEnd,           "rmt.isr.txend",             DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, RmtIsrTxThres,         "rmt.isr.txthres",           DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, RmtIsrRefill,          "rmt.isr.refill",            DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, RmtIsrRanOutOfData,    "rmt.isr.ranoutofdata",      DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, RmtIsrUnknown,         "rmt.isr.unknown",           DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, RmtXmtFills,           "rmt.xmt.fills",             DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_GAUGE_DEFINE  (2, RmtXmtEntries,         "rmt.xmt.entries",           DEBUG_COUNTER_MAX_INSTANCES);
+
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitGetNextBit,  "rmt.bit.getnextbit",     DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitFrameStarts, "rmt.bit.framestarts",    DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitFrameEnds,   "rmt.bit.frameends",      DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitBreakBits,   "rmt.bit.breakbits",      DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitMabBits,     "rmt.bit.mabbits",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitStartBits,   "rmt.bit.startbits",      DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitDataBits,    "rmt.bit.databits",       DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitStopBits,    "rmt.bit.stopbits",       DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE_SHARED(2, RmtBitUnderrun,    "rmt.bit.underrun",       DEBUG_COUNTER_MAX_INSTANCES);
 
 //----------------------------------------------------------------------------
 void RMT_Task (void *arg)
@@ -72,11 +93,15 @@ void RMT_Task (void *arg)
                     if(1 == NotificationValue)
                     {
                         // DEBUG_V("The transmission ended as expected.");
-                        ++FrameCompletes;
+                        DEBUG_COUNTER_INC(1, RmtFrameCompletes, pRmt->pParent->GetOutputPortId());
                     }
                     else
                     {
-                        ++FrameTimeouts;
+                        DEBUG_COUNTER_INC(1, RmtFrameTimeouts, pRmt->pParent->GetOutputPortId());
+                        if (pRmt->pParent->GetTimingStats())
+                        {
+                            pRmt->pParent->GetTimingStats()->ISR_FrameAborted();
+                        }
                         // DEBUG_V("Transmit Timed Out.");
                     }
                 }
@@ -85,6 +110,12 @@ void RMT_Task (void *arg)
     }
 } // RMT_Task
 
+//----------------------------------------------------------------------------
+static void RMT_RegisterIsr (void * pThis)
+{
+    ESP_ERROR_CHECK(rmt_isr_register(rmt_intr_handler, pThis, ESP_INTR_FLAG_IRAM | RT_RMT_ISR_LEVEL | ESP_INTR_FLAG_SHARED, &RMT_intr_handle));
+} // RMT_RegisterIsr
+
 //----------------------------------------------------------------------------
 c_OutputRmt::c_OutputRmt()
 {
@@ -104,7 +135,7 @@ c_OutputRmt::~c_OutputRmt ()
     if (HasBeenInitialized)
     {
         String Reason = (F("Shutting down an RMT channel requires a reboot"));
-        RequestReboot(Reason, 100000);
+        RequestReboot(Reason, 4000);
 
         ISR_ResetRmtBlockPointers (); // Stop transmitter
         DisableRmtInterrupts();
@@ -122,7 +153,7 @@ c_OutputRmt::~c_OutputRmt ()
  */
 static void IRAM_ATTR rmt_intr_handler (void* param)
 {
-    RMT_DEBUG_COUNTER(RawIsrCounter++);
+    DEBUG_COUNTER_INC(2, RmtIsrRaw, 0);
 #ifdef DEBUG_GPIO
     // digitalWrite(DEBUG_GPIO, HIGH);
 #endif // def DEBUG_GPIO
@@ -178,7 +209,7 @@ void c_OutputRmt::Begin (OutputRmtConfig_t config, c_OutputCommon * _pParent )
             nullptr == OutputRmtConfig.StartNewDataFrame)
         {
             String Reason = (F("Invalid RMT configuration parameters. Rebooting"));
-            RequestReboot(Reason, 10000);
+            RequestReboot(Reason, 400);
             break;
         }
 
@@ -217,7 +248,8 @@ void c_OutputRmt::Begin (OutputRmtConfig_t config, c_OutputCommon * _pParent )
             {
                 currentThisPtr = nullptr;
             }
-            ESP_ERROR_CHECK(rmt_isr_register(rmt_intr_handler, this, ESP_INTR_FLAG_IRAM | ESP_INTR_FLAG_LEVEL1 | ESP_INTR_FLAG_SHARED, &RMT_intr_handle));
+            // the interrupt is serviced by the core that registers it
+            RtRunOnCore(RT_RMT_ISR_CORE, RMT_RegisterIsr, this);
         }
 
         // reset the internal and external pointers to the start of the mem block
@@ -228,11 +260,13 @@ void c_OutputRmt::Begin (OutputRmtConfig_t config, c_OutputCommon * _pParent )
         if(!SendFrameTaskHandle)
         {
             // DEBUG_V("Start SendFrameTask");
-            xTaskCreatePinnedToCore(RMT_Task, "RMT_Task", 4096, NULL, 5, &SendFrameTaskHandle, 1);
-            vTaskPrioritySet(SendFrameTaskHandle, 5);
+            xTaskCreatePinnedToCore(RMT_Task, "RMT_Task", RT_OUTPUT_TASK_STACK, NULL, RT_OUTPUT_TASK_PRIORITY, &SendFrameTaskHandle, RT_OUTPUT_TASK_CORE);
+            vTaskPrioritySet(SendFrameTaskHandle, RT_OUTPUT_TASK_PRIORITY);
+            CpuLoad.AddTask(SendFrameTaskHandle);
         }
         // DEBUG_V("Add this instance to the running list");
         pParent = _pParent;
+        pTimingStats = pParent->GetTimingStats();
         rmt_isr_ThisPtrs[OutputRmtConfig.RmtChannelId] = this;
 
         HasBeenInitialized = true;
@@ -248,7 +282,7 @@ void c_OutputRmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     // // DEBUG_START;
 
     jsonStatus[F("NumRmtSlotOverruns")] = NumRmtSlotOverruns;
-#ifdef USE_RMT_DEBUG_COUNTERS
+#if DEBUG_COUNTER_LEVEL >= 2
     jsonStatus[F("OutputIsPaused")] = OutputIsPaused;
     JsonObject debugStatus = jsonStatus["RMT Debug"].to<JsonObject>();
     debugStatus["RmtChannelId"]                 = OutputRmtConfig.RmtChannelId;
@@ -261,33 +295,9 @@ void c_OutputRmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     debugStatus["conf0"]                        = "0x" + String(RMT.conf_ch[OutputRmtConfig.RmtChannelId].conf0.val, HEX);
     debugStatus["conf1"]                        = "0x" + String(RMT.conf_ch[OutputRmtConfig.RmtChannelId].conf1.val, HEX);
     debugStatus["tx_lim_ch"]                    = String(RMT.tx_lim_ch[OutputRmtConfig.RmtChannelId].limit);
-    debugStatus["int_ena"]                      = "0x" + String(SavedInterruptEnables, HEX);
-    debugStatus["int_st"]                       = "0x" + String(SavedInterruptStatus, HEX);
-
     #endif // def CONFIG_IDF_TARGET_ESP32S3
 
-    debugStatus["ErrorIsr"]                     = ErrorIsr;
-    debugStatus["FrameCompletes"]               = FrameCompletes;
-    debugStatus["FrameStartCounter"]            = FrameStartCounter;
-    debugStatus["FrameTimeouts"]                = FrameTimeouts;
-    debugStatus["FailedToSendAllData"]          = FailedToSendAllData;
-    debugStatus["IncompleteFrame"]              = IncompleteFrame;
-    debugStatus["IntensityValuesSent"]          = IntensityValuesSent;
-    debugStatus["IntensityValuesSentLastFrame"] = IntensityValuesSentLastFrame;
-    debugStatus["IntensityBitsSent"]            = IntensityBitsSent;
-    debugStatus["IntensityBitsSentLastFrame"]   = IntensityBitsSentLastFrame;
-    debugStatus["IntTxEndIsrCounter"]           = IntTxEndIsrCounter;
-    debugStatus["IntTxThrIsrCounter"]           = IntTxThrIsrCounter;
-    debugStatus["ISRcounter"]                   = ISRcounter;
-    debugStatus["RanOutOfData"]                 = RanOutOfData;
-    debugStatus["RawIsrCounter"]                = RawIsrCounter;
     debugStatus["RMT_INT_BIT"]                  = "0x" + String (RMT_INT_BIT, HEX);
-    debugStatus["RmtEntriesTransfered"]         = RmtEntriesTransfered;
-    debugStatus["RmtWhiteDetected"]             = RmtWhiteDetected;
-    debugStatus["RmtXmtFills"]                  = RmtXmtFills;
-    debugStatus["RxIsr"]                        = RxIsr;
-    debugStatus["SendBlockIsrCounter"]          = SendBlockIsrCounter;
-    debugStatus["UnknownISRcounter"]            = UnknownISRcounter;
 
 #ifdef IncludeBufferData
     {
@@ -311,7 +321,7 @@ void c_OutputRmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
         }
     }
 #endif // def IncludeBufferData
-#endif // def USE_RMT_DEBUG_COUNTERS
+#endif // DEBUG_COUNTER_LEVEL >= 2
     // // DEBUG_END;
 } // GetStatus
 
@@ -376,7 +386,8 @@ void IRAM_ATTR c_OutputRmt::ISR_Handler (isrTxFlags_t isrTxFlags)
     ///DEBUG_V(String("         RMT_INT_BIT: 0x") + String(RMT_INT_BIT, HEX));
     // ClearRmtInterrupts;
 
-    RMT_DEBUG_COUNTER(++ISRcounter);
+    uint32_t IsrStartCycleCount = ESP.getCycleCount();
+    DEBUG_COUNTER_INC(2, RmtIsr, pParent->GetOutputPortId());
     if(OutputIsPaused)
     {
         DisableRmtInterrupts();
@@ -384,13 +395,23 @@ void IRAM_ATTR c_OutputRmt::ISR_Handler (isrTxFlags_t isrTxFlags)
     // did the transmitter stall?
     else if (isrTxFlags.End & RMT_INT_BIT )
     {
-        RMT_DEBUG_COUNTER(++IntTxEndIsrCounter);
+        DEBUG_COUNTER_INC(2, RmtIsrTxEnd, pParent->GetOutputPortId());
         DisableRmtInterrupts();
 
         if(NumUsedEntriesInSendBuffer)
         {
-            RMT_DEBUG_COUNTER(++FailedToSendAllData);
+            DEBUG_COUNTER_INC(1, RmtFrameDataLeftOver, pParent->GetOutputPortId());
+            if(pTimingStats)
+            {
+                pTimingStats->ISR_FrameAborted();
+            }
+        }
+
+        if(pTimingStats)
+        {
+            pTimingStats->ISR_FrameEnd(micros());
         }
+        EVENT_TRACE(FrameDone, pParent->GetOutputPortId(), 0, 0);
 
         // tell the background task to start the next output
         vTaskNotifyGiveFromISR( SendFrameTaskHandle, &xHigherPriorityTaskWoken );
@@ -398,13 +419,21 @@ void IRAM_ATTR c_OutputRmt::ISR_Handler (isrTxFlags_t isrTxFlags)
     }
     else if (isrTxFlags.Thres & RMT_INT_BIT )
     {
-        RMT_DEBUG_COUNTER(++IntTxThrIsrCounter);
+        DEBUG_COUNTER_INC(2, RmtIsrTxThres, pParent->GetOutputPortId());
 
         // do we still have data to send?
         if(NumUsedEntriesInSendBuffer)
         {
             // LOG_PORT.println(String("NumUsedEntriesInSendBuffer1: ") + String(NumUsedEntriesInSendBuffer));
-            RMT_DEBUG_COUNTER(++SendBlockIsrCounter);
+            DEBUG_COUNTER_INC(2, RmtIsrRefill, pParent->GetOutputPortId());
+            // time left before the hardware reaches the end of what has already been queued
+            int32_t SlackUs = int32_t((TxStartTimeUs + (NumTicksQueuedThisFrame / RMT_TicksPerUs)) - micros());
+            if(pTimingStats)
+            {
+                pTimingStats->ISR_RefillSlack(SlackUs);
+            }
+            EVENT_TRACE(Refill, pParent->GetOutputPortId(), 0, SlackUs);
+
             // transfer any prefetched data to the hardware transmitter
             ISR_TransferIntensityDataToRMT( MaxNumRmtSlotsPerInterrupt );
             // LOG_PORT.println(String("NumUsedEntriesInSendBuffer2: ") + String(NumUsedEntriesInSendBuffer));
@@ -416,25 +445,37 @@ void IRAM_ATTR c_OutputRmt::ISR_Handler (isrTxFlags_t isrTxFlags)
             // is there any data left to enqueue?
             if (!ThereIsDataToSend && 0 == NumUsedEntriesInSendBuffer)
             {
-                RMT_DEBUG_COUNTER(++RanOutOfData);
+                DEBUG_COUNTER_INC(2, RmtIsrRanOutOfData, pParent->GetOutputPortId());
                 DisableRmtInterrupts();
 
+                if(pTimingStats)
+                {
+                    // the frame is over when the hardware has sent everything we queued
+                    pTimingStats->ISR_FrameEnd(TxStartTimeUs + (NumTicksQueuedThisFrame / RMT_TicksPerUs));
+                }
+                EVENT_TRACE(FrameDone, pParent->GetOutputPortId(), 0, 0);
+
                 // tell the background task to start the next output
                 vTaskNotifyGiveFromISR( SendFrameTaskHandle, &xHigherPriorityTaskWoken );
             }
         }
         // else ignore the interrupt and let the transmitter stall when it runs out of data
     }
-#ifdef USE_RMT_DEBUG_COUNTERS
+#if DEBUG_COUNTER_LEVEL >= 1
     else
     {
-        RMT_DEBUG_COUNTER(++UnknownISRcounter);
+        DEBUG_COUNTER_INC(2, RmtIsrUnknown, pParent->GetOutputPortId());
         if (isrTxFlags.Err & RMT_INT_BIT)
         {
-            ErrorIsr++;
+            DEBUG_COUNTER_INC(1, RmtIsrError, pParent->GetOutputPortId());
         }
     }
-#endif // def USE_RMT_DEBUG_COUNTERS
+#endif // DEBUG_COUNTER_LEVEL >= 1
+
+    if(pTimingStats && ((isrTxFlags.End | isrTxFlags.Thres) & RMT_INT_BIT))
+    {
+        pTimingStats->IsrCycles.Add(ESP.getCycleCount() - IsrStartCycleCount);
+    }
 
     ///DEBUG_END;
 } // ISR_Handler
@@ -460,6 +501,7 @@ inline void IRAM_ATTR c_OutputRmt::ISR_ResetRmtBlockPointers()
     SendBufferWriteIndex = 0;
     SendBufferReadIndex  = 0;
     NumUsedEntriesInSendBuffer = 0;
+    NumTicksQueuedThisFrame = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -475,15 +517,16 @@ void IRAM_ATTR c_OutputRmt::ISR_TransferIntensityDataToRMT (uint32_t MaxNumEntri
 
     uint32_t NumEntriesToTransfer = min(NumUsedEntriesInSendBuffer, MaxNumEntriesToTransfer);
 
-#ifdef USE_RMT_DEBUG_COUNTERS
+#if DEBUG_COUNTER_LEVEL >= 2
     if(NumEntriesToTransfer)
     {
-        ++RmtXmtFills;
-        RmtEntriesTransfered = NumEntriesToTransfer;
+        DEBUG_COUNTER_INC(2, RmtXmtFills, pParent->GetOutputPortId());
+        DEBUG_GAUGE_SET(2, RmtXmtEntries, pParent->GetOutputPortId(), NumEntriesToTransfer);
     }
-#endif // def USE_RMT_DEBUG_COUNTERS
+#endif // DEBUG_COUNTER_LEVEL >= 2
     while(NumEntriesToTransfer)
     {
+        NumTicksQueuedThisFrame += SendBuffer[SendBufferReadIndex].duration0 + SendBuffer[SendBufferReadIndex].duration1;
         RMTMEM.chan[OutputRmtConfig.RmtChannelId].data32[RmtBufferWriteIndex++].val = SendBuffer[SendBufferReadIndex++].val;
         RmtBufferWriteIndex = (RmtBufferWriteIndex >= NUM_RMT_SLOTS ? 0 : RmtBufferWriteIndex); // do wrap
         SendBufferReadIndex &= (NumSendBufferSlots - 1); // do wrap
@@ -551,20 +594,14 @@ bool c_OutputRmt::StartNewFrame ()
 
         if(InterrupsAreEnabled)
         {
-            RMT_DEBUG_COUNTER(IncompleteFrame++);
+            DEBUG_COUNTER_INC(1, RmtFrameRestarted, pParent->GetOutputPortId());
         }
 
 		// Stop the transmitter
         DisableRmtInterrupts ();
         ISR_ResetRmtBlockPointers ();
 
-        #ifdef USE_RMT_DEBUG_COUNTERS
-        FrameStartCounter++;
-        IntensityValuesSentLastFrame = IntensityValuesSent;
-        IntensityValuesSent          = 0;
-        IntensityBitsSentLastFrame   = IntensityBitsSent;
-        IntensityBitsSent            = 0;
-        #endif // def USE_RMT_DEBUG_COUNTERS
+        DEBUG_COUNTER_INC(1, RmtFrameStarts, pParent->GetOutputPortId());
 
         ThereIsDataToSend = true;
         // DEBUG_V();
@@ -600,6 +637,7 @@ bool c_OutputRmt::StartNewFrame ()
         // DEBUG_V("start the transmitter");
         rmt_ll_power_down_mem(&RMT, false);
         // rmt_set_gpio (OutputRmtConfig.RmtChannelId, rmt_mode_t::RMT_MODE_TX, OutputRmtConfig.DataPin, false);
+        TxStartTimeUs = micros();
         rmt_ll_tx_start(&RMT, OutputRmtConfig.RmtChannelId);
         // digitalWrite(42, HIGH);
         // delay(1);
@@ -0,0 +1,175 @@
+/*
+* OutputSelfTest.cpp - Output throughput self test
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "output/OutputSelfTest.hpp"
+#include "output/OutputCommon.hpp"
+
+//----------------------------------------------------------------------------
+c_OutputSelfTest::c_OutputSelfTest ()
+{
+    memset ((void*)&CpuStart, 0x00, sizeof (CpuStart));
+    memset ((void*)&CpuEnd,   0x00, sizeof (CpuEnd));
+
+} // c_OutputSelfTest
+
+//----------------------------------------------------------------------------
+c_OutputSelfTest::~c_OutputSelfTest ()
+{
+} // ~c_OutputSelfTest
+
+//----------------------------------------------------------------------------
+void c_OutputSelfTest::Start (uint32_t NewDurationMs)
+{
+    // DEBUG_START;
+
+    DurationMs = min (max (NewDurationMs, uint32_t (1000)), uint32_t (OUTPUT_SELF_TEST_MAX_DURATION_MS));
+
+    CpuLoad.Begin ();
+    CpuLoad.GetSample (CpuStart);
+
+    StartMs     = millis ();
+    LastStepMs  = StartMs - 1;
+    ElapsedMs   = 0;
+    Running     = true;
+
+    logcon (String (F ("Started. Running for ")) + String (DurationMs) + F (" ms"));
+
+    // DEBUG_END;
+} // Start
+
+//----------------------------------------------------------------------------
+void c_OutputSelfTest::Stop ()
+{
+    // DEBUG_START;
+
+    if (Running)
+    {
+        CpuLoad.GetSample (CpuEnd);
+        ElapsedMs = max (uint32_t (1), uint32_t (millis () - StartMs));
+        Running   = false;
+
+        logcon (String (F ("Done after ")) + String (ElapsedMs) + F (" ms"));
+    }
+
+    // DEBUG_END;
+} // Stop
+
+//----------------------------------------------------------------------------
+bool c_OutputSelfTest::NextPattern ()
+{
+    // DEBUG_START;
+
+    // move the pattern once per ms. Rewriting the buffers more often would only cost CPU time
+    uint32_t Now = millis ();
+    bool Response = (Now != LastStepMs);
+    if (Response)
+    {
+        LastStepMs = Now;
+        ++Step;
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // NextPattern
+
+//----------------------------------------------------------------------------
+void c_OutputSelfTest::FillBuffer (uint8_t * pBuffer, uint32_t Size)
+{
+    // DEBUG_START;
+
+    // a ramp that moves one step every time the pattern changes
+    for (uint32_t index = 0; index < Size; ++index)
+    {
+        pBuffer[index] = uint8_t (index + Step);
+    }
+
+    // DEBUG_END;
+} // FillBuffer
+
+//----------------------------------------------------------------------------
+void c_OutputSelfTest::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    JsonWrite (jsonStatus, F ("running"),    Running);
+    JsonWrite (jsonStatus, F ("durationms"), DurationMs);
+    JsonWrite (jsonStatus, F ("elapsedms"),  GetElapsedMs ());
+
+    // no ticks means the sampler is not available on this platform
+    if (!Running && (CpuEnd.TotalTicks[0] != CpuStart.TotalTicks[0]))
+    {
+        JsonArray jsonIdle = jsonStatus[F ("idle")].to<JsonArray> ();
+        CpuLoad.GetStatus (jsonIdle, CpuStart, CpuEnd);
+    }
+
+    // DEBUG_END;
+} // GetStatus
+
+//----------------------------------------------------------------------------
+void c_OutputSelfTest::PortResult_t::Record (c_OutputCommon & Port)
+{
+    // DEBUG_START;
+
+    Valid           = true;
+    OutputType      = uint32_t (Port.GetOutputType ());
+    Frames          = Port.GetFrameCount ();
+    PixelsPerFrame  = Port.GetPixelCount ();
+    BytesPerFrame   = Port.GetNumOutputBufferBytesNeeded ();
+    WireFrameUs     = Port.GetActualFrameDurationMicroSec ();
+
+    c_OutputTimingStats * pTimingStats = Port.GetTimingStats ();
+    IsrCycles       = pTimingStats ? pTimingStats->IsrCycles.Sum   : 0;
+    MaxIsrCycles    = pTimingStats ? pTimingStats->IsrCycles.Max   : 0;
+    Underruns       = pTimingStats ? pTimingStats->Underruns       : 0;
+    AbortedFrames   = pTimingStats ? pTimingStats->AbortedFrames   : 0;
+
+    // DEBUG_END;
+} // Record
+
+//----------------------------------------------------------------------------
+uint32_t c_OutputSelfTest::PortResult_t::GetStatus (JsonObject & jsonStatus, uint32_t ElapsedMs)
+{
+    // DEBUG_START;
+
+    uint32_t CpuMHz          = max (uint32_t (1), uint32_t (ESP.getCpuFreqMHz ()));
+    uint32_t IsrUs           = uint32_t (IsrCycles / CpuMHz);
+    uint32_t FramesPerSecond = uint32_t ((uint64_t (Frames) * 1000) / ElapsedMs);
+    uint32_t PixelsPerSecond = uint32_t ((uint64_t (Frames) * PixelsPerFrame * 1000) / ElapsedMs);
+
+    JsonWrite (jsonStatus, CN_type,              OutputType);
+    JsonWrite (jsonStatus, F ("frames"),         Frames);
+    JsonWrite (jsonStatus, F ("fps"),            FramesPerSecond);
+    // what the wire time alone would allow. A port well below this is limited by the CPU
+    JsonWrite (jsonStatus, F ("wirefps"),        uint32_t (WireFrameUs ? (MicroSecondsInASecond / WireFrameUs) : 0));
+    JsonWrite (jsonStatus, F ("pixels"),         PixelsPerFrame);
+    JsonWrite (jsonStatus, F ("pixelspersec"),   PixelsPerSecond);
+    JsonWrite (jsonStatus, F ("bytespersec"),    uint32_t ((uint64_t (Frames) * BytesPerFrame * 1000) / ElapsedMs));
+    JsonWrite (jsonStatus, F ("isrus"),          IsrUs);
+    // us per ms is the share of one core in tenths of a percent
+    JsonWrite (jsonStatus, F ("isrpermille"),    IsrUs / ElapsedMs);
+    JsonWrite (jsonStatus, F ("isrmaxus"),       MaxIsrCycles / CpuMHz);
+    JsonWrite (jsonStatus, F ("underruns"),      Underruns);
+    JsonWrite (jsonStatus, F ("aborted"),        AbortedFrames);
+
+    // DEBUG_END;
+    return PixelsPerSecond;
+
+} // GetStatus
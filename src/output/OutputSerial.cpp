@@ -21,8 +21,19 @@
 #if defined(SUPPORT_OutputProtocol_FireGod) || defined(SUPPORT_OutputProtocol_DMX) || defined(SUPPORT_OutputProtocol_Serial) || defined(SUPPORT_OutputProtocol_Renard)
 
 #include "output/OutputSerial.hpp"
+#include "utility/DebugCounters.hpp"
+#include "utility/SpiRam.hpp"
 #define ADJUST_INTENSITY_AT_ISR
 
+DEBUG_COUNTER_DEFINE(1, SerialFrameStarts,      "serial.frame.starts",      DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, SerialFrameEnds,        "serial.frame.ends",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, SerialFrameAborts,      "serial.frame.aborts",      DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, SerialIsrIntensity,     "serial.isr.intensity",     DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, SerialIsrIdle,          "serial.isr.idle",          DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_GAUGE_DEFINE  (2, SerialIsrLastData,      "serial.isr.lastdata",      DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, SerialDmxFrameStart,    "serial.dmx.framestart",    DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, SerialDmxSendData,      "serial.dmx.senddata",      DEBUG_COUNTER_MAX_INSTANCES);
+
 //----------------------------------------------------------------------------
 c_OutputSerial::c_OutputSerial (OM_OutputPortDefinition_t & OutputPortDefinition,
     c_OutputMgr::e_OutputProtocolType outputType) :
@@ -31,6 +42,7 @@ c_OutputSerial::c_OutputSerial (OM_OutputPortDefinition_t & OutputPortDefinition
     // DEBUG_START;
     memset(GenericSerialHeader, 0x0, sizeof(GenericSerialHeader));
     memset(GenericSerialFooter, 0x0, sizeof(GenericSerialFooter));
+    IsrReadsFrameBuffer = true;
 
     #if defined(SUPPORT_OutputProtocol_DMX)
     if (outputType == c_OutputMgr::e_OutputProtocolType::OutputProtocol_DMX)
@@ -117,23 +129,6 @@ void c_OutputSerial::GetStatus (ArduinoJson::JsonObject& jsonStatus)
 
     c_OutputCommon::BaseGetStatus (jsonStatus);
 
-#ifdef USE_SERIAL_DEBUG_COUNTERS
-    JsonObject debugStatus = jsonStatus["Serial Debug"].to<JsonObject>();
-    debugStatus["Num_Channels"]                = Num_Channels;
-    debugStatus["NextIntensityToSend"]         = String(int(NextIntensityToSend), HEX);
-    debugStatus["IntensityBytesSent"]          = IntensityBytesSent;
-    debugStatus["IntensityBytesSentLastFrame"] = IntensityBytesSentLastFrame;
-    debugStatus["FrameStartCounter"]           = FrameStartCounter;
-    debugStatus["FrameEndCounter"]             = FrameEndCounter;
-    debugStatus["AbortFrameCounter"]           = AbortFrameCounter;
-    debugStatus["LastDataSent"]                = LastDataSent;
-    debugStatus["SerialFrameState"]            = SerialFrameState;
-    debugStatus["DmxFrameStart"]               = DmxFrameStart;
-    debugStatus["DmxSendData"]                 = DmxSendData;
-    debugStatus["Serialidle"]                  = Serialidle;
-
-#endif // def USE_SERIAL_DEBUG_COUNTERS
-
     // DEBUG_END;
 } // GetStatus
 
@@ -326,24 +321,21 @@ void c_OutputSerial::StartNewFrame ()
 {
     // DEBUG_START;
 
-#ifdef USE_SERIAL_DEBUG_COUNTERS
+#if DEBUG_COUNTER_LEVEL >= 1
     if (ISR_MoreDataToSend ())
     {
-        AbortFrameCounter++;
+        DEBUG_COUNTER_INC(1, SerialFrameAborts, OutputPortDefinition.PortId);
     }
-    FrameStartCounter++;
-#endif // def USE_SERIAL_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(1, SerialFrameStarts, OutputPortDefinition.PortId);
+#endif // DEBUG_COUNTER_LEVEL >= 1
 
-    NextIntensityToSend = GetBufferAddress();
+    StageFrame ();
+    NextIntensityToSend = pFrameBuffer;
     intensity_count     = Num_Channels;
     SentIntensityCount  = 0;
     SerialHeaderIndex   = 0;
     SerialFooterIndex   = 0;
 
-    SERIAL_DEBUG_COUNTER(IntensityBytesSentLastFrame = IntensityBytesSent);
-    SERIAL_DEBUG_COUNTER(IntensityBytesSent = 0);
-    SERIAL_DEBUG_COUNTER(IntensityBytesSentLastFrame = 0);
-
     // start the next frame
     switch (OutputType)
     {
@@ -396,7 +388,7 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
 {
     DataToSend = 0x00;
 
-    SERIAL_DEBUG_COUNTER(IntensityBytesSent++);
+    DEBUG_COUNTER_INC(2, SerialIsrIntensity, OutputPortDefinition.PortId);
 
     switch (SerialFrameState)
     {
@@ -432,7 +424,7 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
                 if (0 == --intensity_count)
                 {
                     SerialFrameState = SerialFrameState_t::SerialIdle;
-                    SERIAL_DEBUG_COUNTER(++FrameEndCounter);
+                    DEBUG_COUNTER_INC(1, SerialFrameEnds, OutputPortDefinition.PortId);
                 }
             }
 
@@ -446,7 +438,7 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
             if (0 == --intensity_count)
             {
                 SerialFrameState = SerialFrameState_t::SerialIdle;
-                SERIAL_DEBUG_COUNTER(++FrameEndCounter);
+                DEBUG_COUNTER_INC(1, SerialFrameEnds, OutputPortDefinition.PortId);
             }
             else
             {
@@ -457,7 +449,7 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
 
         case SerialFrameState_t::DMXSendFrameStart:
         {
-            SERIAL_DEBUG_COUNTER(DmxFrameStart++);
+            DEBUG_COUNTER_INC(2, SerialDmxFrameStart, OutputPortDefinition.PortId);
             DataToSend = 0x00; // DMX Lighting frame start
             SerialFrameState = SerialFrameState_t::DMXSendData;
             break;
@@ -465,12 +457,12 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
 
         case SerialFrameState_t::DMXSendData:
         {
-            SERIAL_DEBUG_COUNTER(DmxSendData++);
+            DEBUG_COUNTER_INC(2, SerialDmxSendData, OutputPortDefinition.PortId);
             DataToSend = *NextIntensityToSend++;
             if (0 == --intensity_count)
             {
                 SerialFrameState = SerialFrameState_t::SerialIdle;
-                SERIAL_DEBUG_COUNTER(++FrameEndCounter);
+                DEBUG_COUNTER_INC(1, SerialFrameEnds, OutputPortDefinition.PortId);
             }
             break;
         }
@@ -497,7 +489,7 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
                 else
                 {
                     SerialFrameState = SerialFrameState_t::SerialIdle;
-                    SERIAL_DEBUG_COUNTER(++FrameEndCounter);
+                    DEBUG_COUNTER_INC(1, SerialFrameEnds, OutputPortDefinition.PortId);
                 }
             }
             break;
@@ -509,7 +501,7 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
             if (SerialFooterSize <= SerialFooterIndex)
             {
                 SerialFrameState = SerialFrameState_t::SerialIdle;
-                SERIAL_DEBUG_COUNTER(++FrameEndCounter);
+                DEBUG_COUNTER_INC(1, SerialFrameEnds, OutputPortDefinition.PortId);
             }
             break;
         }
@@ -547,7 +539,7 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
                     FireGodCurrentController = 0;
                     FireGodBytesInFrameCount = 0;
                     SerialFrameState = SerialFrameState_t::SerialIdle;
-                    SERIAL_DEBUG_COUNTER(++FrameEndCounter);
+                    DEBUG_COUNTER_INC(1, SerialFrameEnds, OutputPortDefinition.PortId);
                 }
                 else
                 {
@@ -577,7 +569,7 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
                 FireGodCurrentController = 0;
                 FireGodBytesInFrameCount = 0;
                 SerialFrameState = SerialFrameState_t::SerialIdle;
-                SERIAL_DEBUG_COUNTER(++FrameEndCounter);
+                DEBUG_COUNTER_INC(1, SerialFrameEnds, OutputPortDefinition.PortId);
             }
             break;
         }
@@ -585,12 +577,12 @@ bool IRAM_ATTR c_OutputSerial::ISR_GetNextIntensityToSend (uint32_t &DataToSend)
         case SerialFrameState_t::SerialIdle:
         default:
         {
-            SERIAL_DEBUG_COUNTER(++Serialidle);
+            DEBUG_COUNTER_INC(2, SerialIsrIdle, OutputPortDefinition.PortId);
             break;
         }
     } // switch SerialFrameState
 
-    SERIAL_DEBUG_COUNTER(LastDataSent = DataToSend);
+    DEBUG_GAUGE_SET(2, SerialIsrLastData, OutputPortDefinition.PortId, DataToSend);
     return ISR_MoreDataToSend();
 } // NextIntensityToSend
 
@@ -175,19 +175,6 @@ void c_OutputSerialRmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     c_OutputSerial::GetStatus(jsonStatus);
     Rmt.GetStatus(jsonStatus);
 
-    #ifdef SERIAL_RMT_DEBUG_COUNTERS
-    JsonObject JsonCounters = jsonStatus["JsonCounters"].to<JsonObject>();
-    JsonWrite(JsonCounters, "GetNextBit",  RmtDebugCounters.GetNextBit);
-    JsonWrite(JsonCounters, "FrameStarts", RmtDebugCounters.FrameStarts);
-    JsonWrite(JsonCounters, "FrameEnds",   RmtDebugCounters.FrameEnds);
-    JsonWrite(JsonCounters, "BreakBits",   RmtDebugCounters.BreakBits);
-    JsonWrite(JsonCounters, "MabBits",     RmtDebugCounters.MabBits);
-    JsonWrite(JsonCounters, "StartBits",   RmtDebugCounters.StartBits);
-    JsonWrite(JsonCounters, "DataBits",    RmtDebugCounters.DataBits);
-    JsonWrite(JsonCounters, "StopBits",    RmtDebugCounters.StopBits);
-    JsonWrite(JsonCounters, "Underrun",    RmtDebugCounters.Underrun);
-    #endif // def SERIAL_RMT_DEBUG_COUNTERS
-
     // DEBUG_END;
 } // GetStatus
 
@@ -233,7 +220,7 @@ void c_OutputSerialRmt::StartNewDataFrame()
 {
     // DEBUG_START;
     // DEBUG_V(String("frame started on ") + String(OutputPortDefinition.gpios.data));
-    INC_SERIAL_RMT_DEBUG_COUNTERS(FrameStarts);
+    RMT_BIT_COUNTER(FrameStarts);
     #if defined(SUPPORT_OutputProtocol_DMX)
     if(OutputType == c_OutputMgr::e_OutputProtocolType::OutputProtocol_DMX)
     {
@@ -249,25 +236,25 @@ void c_OutputSerialRmt::StartNewDataFrame()
 //----------------------------------------------------------------------------
 bool IRAM_ATTR c_OutputSerialRmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSend)
 {
-    INC_SERIAL_RMT_DEBUG_COUNTERS(GetNextBit);
+    RMT_BIT_COUNTER(GetNextBit);
     bool Response = true;
     if(BreakBitCount)
     {
-        INC_SERIAL_RMT_DEBUG_COUNTERS(BreakBits);
+        RMT_BIT_COUNTER(BreakBits);
         BreakBitCount = 0;
         DataToSend = BreakBit;
         MabBitCount = 1;
     }
     else if(MabBitCount)
     {
-        INC_SERIAL_RMT_DEBUG_COUNTERS(MabBits);
+        RMT_BIT_COUNTER(MabBits);
         MabBitCount = 0;
         DataToSend = MabBit;
         StartBitCount = 1;
     }
     else if(StartBitCount)
     {
-        INC_SERIAL_RMT_DEBUG_COUNTERS(StartBits);
+        RMT_BIT_COUNTER(StartBits);
         StartBitCount = 0;
         DataToSend = StartBit;
         // set up for the next data byte
@@ -277,14 +264,14 @@ bool IRAM_ATTR c_OutputSerialRmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSen
     }
     else if(CurrentDataPairId)
     {
-        INC_SERIAL_RMT_DEBUG_COUNTERS(DataBits);
+        RMT_BIT_COUNTER(DataBits);
         --CurrentDataPairId;
         DataToSend = DataBitArray[DataPattern & 0x3];
         DataPattern = DataPattern >> 2;
     }
     else if(StopBitCount)
     {
-        INC_SERIAL_RMT_DEBUG_COUNTERS(StopBits);
+        RMT_BIT_COUNTER(StopBits);
         StopBitCount = 0;
         DataToSend = StopBit;
 
@@ -294,13 +281,13 @@ bool IRAM_ATTR c_OutputSerialRmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSen
         }
         else
         {
-            INC_SERIAL_RMT_DEBUG_COUNTERS(FrameEnds);
+            RMT_BIT_COUNTER(FrameEnds);
             Response = false;
         }
     }
     else
     {
-        INC_SERIAL_RMT_DEBUG_COUNTERS(Underrun);
+        RMT_BIT_COUNTER(Underrun);
         // nothing to send
         DataToSend.val = 0x0;
         Response = false;
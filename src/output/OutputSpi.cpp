@@ -20,6 +20,8 @@
 #ifdef ARDUINO_ARCH_ESP32
 
 #include "output/OutputSpi.hpp"
+#include "utility/CpuLoad.hpp"
+#include "RtConfig.hpp"
 #include "driver/spi_master.h"
 // #include <esp_heap_alloc_caps.h>
 
@@ -88,7 +90,7 @@ c_OutputSpi::~c_OutputSpi ()
     {
         spi_transfer_callback_enabled = false;
         String Reason = F(" SPI Interface Shutdown requires a reboot ");
-        RequestReboot(Reason, 100000);
+        RequestReboot(Reason, 4000);
     }
     // DEBUG_END;
 
@@ -120,7 +122,8 @@ void c_OutputSpi::Begin (OM_OutputPortDefinition_t & _OutputPortDefinition, c_Ou
 
     NextTransactionToFill = 0;
 
-    xTaskCreate (SendSpiIntensityDataTask, "SPITask", 2000, this, ESP_TASK_PRIO_MIN + 4, &SendIntensityDataTaskHandle);
+    xTaskCreatePinnedToCore (SendSpiIntensityDataTask, "SPITask", RT_SPI_TASK_STACK, this, RT_SPI_TASK_PRIORITY, &SendIntensityDataTaskHandle, RT_SPI_TASK_CORE);
+    CpuLoad.AddTask (SendIntensityDataTaskHandle);
 
     spi_bus_config_t SpiBusConfiguration;
     memset ( (void*)&SpiBusConfiguration, 0x00, sizeof (SpiBusConfiguration));
@@ -180,10 +180,6 @@ void c_OutputTLS3001Rmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     // // DEBUG_START;
     c_OutputTLS3001::GetStatus (jsonStatus);
     Rmt.GetStatus (jsonStatus);
-#ifdef USE_RMT_DEBUG_COUNTERS
-    // jsonStatus[F("Can Refresh")] = CanRefresh;
-    // jsonStatus[F("Cannot Refresh")] = CannotRefresh;
-#endif // def USE_RMT_DEBUG_COUNTERS
 
     #ifdef USE_TLS3001RMT_COUNTERS
     JsonObject CounterStatus = jsonStatus.createNestedObject("TLS3001");
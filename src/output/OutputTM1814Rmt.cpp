@@ -82,8 +82,8 @@ bool c_OutputTM1814Rmt::SetConfig (ArduinoJson::JsonObject& jsonConfig)
     bool response = c_OutputTM1814::SetConfig (jsonConfig);
 
     Rmt.SetBitDuration((InterFrameGapInMicroSec * NanoSecondsInAMicroSecond), IfgBit, IfgBitCount);
-    IfgBit.level0 = 0;
-    IfgBit.level1 = 0;
+    IfgBit.level0 = 1;
+    IfgBit.level1 = 1;
 
     // DEBUG_V (String ("DataPin: ") + String (DataPin));
     c_OutputRmt::OutputRmtConfig_t OutputRmtConfig;
@@ -121,19 +121,6 @@ void c_OutputTM1814Rmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     // jsonStatus["FrameStartCounter"] = FrameStartCounter;
     // jsonStatus["FrameEndISRcounter"] = FrameEndISRcounter;
 
-    #ifdef TM1814_RMT_DEBUG_COUNTERS
-    JsonObject JsonCounters = jsonStatus["JsonCounters"].to<JsonObject>();
-    JsonWrite(JsonCounters, "GetNextBit",  RmtDebugCounters.GetNextBit);
-    JsonWrite(JsonCounters, "FrameStarts", RmtDebugCounters.FrameStarts);
-    JsonWrite(JsonCounters, "FrameEnds",   RmtDebugCounters.FrameEnds);
-    JsonWrite(JsonCounters, "BreakBits",   RmtDebugCounters.BreakBits);
-    JsonWrite(JsonCounters, "MabBits",     RmtDebugCounters.MabBits);
-    JsonWrite(JsonCounters, "StartBits",   RmtDebugCounters.StartBits);
-    JsonWrite(JsonCounters, "DataBits",    RmtDebugCounters.DataBits);
-    JsonWrite(JsonCounters, "StopBits",    RmtDebugCounters.StopBits);
-    JsonWrite(JsonCounters, "Underrun",    RmtDebugCounters.Underrun);
-    #endif // def TM1814_RMT_DEBUG_COUNTERS
-
 } // GetStatus
 
 //----------------------------------------------------------------------------
@@ -181,7 +168,7 @@ void c_OutputTM1814Rmt::StartNewDataFrame()
 {
     // DEBUG_START;
     // DEBUG_V(String("frame started on ") + String(OutputPortDefinition.gpios.data));
-    INC_TM1814_RMT_DEBUG_COUNTERS(FrameStarts);
+    RMT_BIT_COUNTER(FrameStarts);
     IfgBitCurrentCount = IfgBitCount;
     StartNewFrame();
 
@@ -191,11 +178,11 @@ void c_OutputTM1814Rmt::StartNewDataFrame()
 //----------------------------------------------------------------------------
 bool IRAM_ATTR c_OutputTM1814Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSend)
 {
-    INC_TM1814_RMT_DEBUG_COUNTERS(GetNextBit);
+    RMT_BIT_COUNTER(GetNextBit);
     bool Response = true;
     if(IfgBitCurrentCount)
     {
-        INC_TM1814_RMT_DEBUG_COUNTERS(StartBits);
+        RMT_BIT_COUNTER(StartBits);
         --IfgBitCurrentCount;
         DataToSend = IfgBit;
         // set up for the next data byte
@@ -204,7 +191,7 @@ bool IRAM_ATTR c_OutputTM1814Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSen
     }
     else if(DataPatternMask)
     {
-        INC_TM1814_RMT_DEBUG_COUNTERS(DataBits);
+        RMT_BIT_COUNTER(DataBits);
         DataToSend = (DataPattern & DataPatternMask) ? OneBit : ZeroBit;
         DataPatternMask = DataPatternMask >> 1;
         if(0 == DataPatternMask)
@@ -216,14 +203,14 @@ bool IRAM_ATTR c_OutputTM1814Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSen
             }
             else
             {
-                INC_TM1814_RMT_DEBUG_COUNTERS(FrameEnds);
+                RMT_BIT_COUNTER(FrameEnds);
                 Response = false;
             }
         }
     }
     else
     {
-        INC_TM1814_RMT_DEBUG_COUNTERS(Underrun);
+        RMT_BIT_COUNTER(Underrun);
         // nothing to send
         DataToSend.val = 0x0;
         Response = false;
@@ -113,13 +113,6 @@ void c_OutputTM1814Uart::GetStatus(ArduinoJson::JsonObject &jsonStatus)
     c_OutputTM1814::GetStatus(jsonStatus);
     Uart.GetStatus(jsonStatus);
 
-#ifdef TM1814_UART_DEBUG_COUNTERS
-    JsonObject debugStatus = jsonStatus["TM1814 UART Debug"].to<JsonObject>();
-    debugStatus["NewFrameCounter"] = NewFrameCounter;
-    debugStatus["TimeSinceLastFrameMS"] = TimeSinceLastFrameMS;
-    debugStatus["TimeLastFrameStartedMS"] = TimeLastFrameStartedMS;
-#endif // def TM1814_UART_DEBUG_COUNTERS
-
     // DEBUG_END;
 
 } // GetStatus
@@ -0,0 +1,75 @@
+/*
+* OutputTimingStats.cpp - Per port frame timing histograms
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "output/OutputTimingStats.hpp"
+
+//----------------------------------------------------------------------------
+void c_OutputTimingStats::Clear ()
+{
+    // DEBUG_START;
+
+    // the ISR may be adding a sample while we clear. Losing it is harmless.
+    memset ((void*)this, 0x00, sizeof (*this));
+
+    // DEBUG_END;
+} // Clear
+
+//----------------------------------------------------------------------------
+void c_OutputTimingStats::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    JsonObject jsonTiming = jsonStatus[F ("timing")].to<JsonObject> ();
+
+    FrameDurationUs.GetStatus (jsonTiming, F ("FrameUs"));
+    FrameIntervalUs.GetStatus (jsonTiming, F ("IntervalUs"));
+    IsrCycles.GetStatus       (jsonTiming, F ("IsrCycles"));
+    RefillSlackUs.GetStatus   (jsonTiming, F ("SlackUs"));
+    JsonWrite (jsonTiming, F ("Underruns"), Underruns);
+    JsonWrite (jsonTiming, F ("Aborted"),   AbortedFrames);
+
+    // DEBUG_END;
+} // GetStatus
+
+//----------------------------------------------------------------------------
+void c_OutputTimingStats::LogHistogram_t::GetStatus (JsonObject & jsonStatus, const __FlashStringHelper * Name)
+{
+    // DEBUG_START;
+
+    // only report up to the highest bucket in use to keep the status small
+    uint32_t NumBucketsInUse = OUTPUT_TIMING_NUM_BUCKETS;
+    while (NumBucketsInUse && (0 == Buckets[NumBucketsInUse - 1]))
+    {
+        --NumBucketsInUse;
+    }
+
+    if (NumBucketsInUse)
+    {
+        JsonObject jsonHistogram = jsonStatus[Name].to<JsonObject> ();
+        JsonWrite (jsonHistogram, F ("max"), Max);
+        JsonArray jsonBuckets = jsonHistogram[F ("h")].to<JsonArray> ();
+        for (uint32_t index = 0; index < NumBucketsInUse; ++index)
+        {
+            jsonBuckets.add (Buckets[index]);
+        }
+    }
+
+    // DEBUG_END;
+} // GetStatus
@@ -116,18 +116,6 @@ void c_OutputUCS1903Rmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
 {
     c_OutputUCS1903::GetStatus (jsonStatus);
     Rmt.GetStatus (jsonStatus);
-    #ifdef UCS1903_RMT_DEBUG_COUNTERS
-    JsonObject JsonCounters = jsonStatus["JsonCounters"].to<JsonObject>();
-    JsonWrite(JsonCounters, "GetNextBit",  RmtDebugCounters.GetNextBit);
-    JsonWrite(JsonCounters, "FrameStarts", RmtDebugCounters.FrameStarts);
-    JsonWrite(JsonCounters, "FrameEnds",   RmtDebugCounters.FrameEnds);
-    JsonWrite(JsonCounters, "BreakBits",   RmtDebugCounters.BreakBits);
-    JsonWrite(JsonCounters, "MabBits",     RmtDebugCounters.MabBits);
-    JsonWrite(JsonCounters, "StartBits",   RmtDebugCounters.StartBits);
-    JsonWrite(JsonCounters, "DataBits",    RmtDebugCounters.DataBits);
-    JsonWrite(JsonCounters, "StopBits",    RmtDebugCounters.StopBits);
-    JsonWrite(JsonCounters, "Underrun",    RmtDebugCounters.Underrun);
-    #endif // def UCS1903_RMT_DEBUG_COUNTERS
 
 } // GetStatus
 
@@ -176,7 +164,7 @@ void c_OutputUCS1903Rmt::StartNewDataFrame()
 {
     // DEBUG_START;
     // DEBUG_V(String("frame started on ") + String(OutputPortDefinition.gpios.data));
-    INC_UCS1903_RMT_DEBUG_COUNTERS(FrameStarts);
+    RMT_BIT_COUNTER(FrameStarts);
     IfgBitCurrentCount = IfgBitCount;
     StartNewFrame();
 
@@ -186,11 +174,11 @@ void c_OutputUCS1903Rmt::StartNewDataFrame()
 //----------------------------------------------------------------------------
 bool IRAM_ATTR c_OutputUCS1903Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSend)
 {
-    INC_UCS1903_RMT_DEBUG_COUNTERS(GetNextBit);
+    RMT_BIT_COUNTER(GetNextBit);
     bool Response = true;
     if(IfgBitCurrentCount)
     {
-        INC_UCS1903_RMT_DEBUG_COUNTERS(StartBits);
+        RMT_BIT_COUNTER(StartBits);
         --IfgBitCurrentCount;
         DataToSend = IfgBit;
         // set up for the next data byte
@@ -199,7 +187,7 @@ bool IRAM_ATTR c_OutputUCS1903Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSe
     }
     else if(DataPatternMask)
     {
-        INC_UCS1903_RMT_DEBUG_COUNTERS(DataBits);
+        RMT_BIT_COUNTER(DataBits);
         DataToSend = (DataPattern & DataPatternMask) ? OneBit : ZeroBit;
         DataPatternMask = DataPatternMask >> 1;
         if(0 == DataPatternMask)
@@ -211,14 +199,14 @@ bool IRAM_ATTR c_OutputUCS1903Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSe
             }
             else
             {
-                INC_UCS1903_RMT_DEBUG_COUNTERS(FrameEnds);
+                RMT_BIT_COUNTER(FrameEnds);
                 Response = false;
             }
         }
     }
     else
     {
-        INC_UCS1903_RMT_DEBUG_COUNTERS(Underrun);
+        RMT_BIT_COUNTER(Underrun);
         // nothing to send
         DataToSend.val = 0x0;
         Response = false;
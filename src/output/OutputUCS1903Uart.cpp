@@ -112,13 +112,6 @@ void c_OutputUCS1903Uart::GetStatus(ArduinoJson::JsonObject &jsonStatus)
     c_OutputUCS1903::GetStatus(jsonStatus);
     Uart.GetStatus(jsonStatus);
 
-#ifdef UCS1903_UART_DEBUG_COUNTERS
-    JsonObject debugStatus = jsonStatus["UCS1903 UART Debug"].to<JsonObject>();
-    debugStatus["NewFrameCounter"] = NewFrameCounter;
-    debugStatus["TimeSinceLastFrameMS"] = TimeSinceLastFrameMS;
-    debugStatus["TimeLastFrameStartedMS"] = TimeLastFrameStartedMS;
-#endif // def UCS1903_UART_DEBUG_COUNTERS
-
     // DEBUG_END;
 
 } // GetStatus
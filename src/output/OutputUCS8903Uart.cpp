@@ -26,17 +26,21 @@
 /*
  * Inverted 8N1 UART lookup table for UCS8903.
  * Start and stop bits are part of the pixel stream.
+ * A zero is 3 UART bits high and 7 low, a one is 6 high and 4 low.
  */
 static const c_OutputUart::ConvertIntensityToUartDataStreamEntry_t ConvertIntensityToUartDataStream[] =
 {
     { 0b11111100, c_OutputUart::UartDataBitTranslationId_t::Uart_DATA_BIT_00_ID}, // (0)00111111(1)
-    { 0b11000000, c_OutputUart::UartDataBitTranslationId_t::Uart_DATA_BIT_01_ID}, // (0)00000011(1)
+    { 0b11100000, c_OutputUart::UartDataBitTranslationId_t::Uart_DATA_BIT_01_ID}, // (0)00000111(1)
     { 0,          c_OutputUart::UartDataBitTranslationId_t::Uart_LIST_END}
 };
 
 #define UCS8903_NUM_UART_BITS_PER_INTENSITY_BIT 10
 #define UCS8903_NUM_UART_DATA_BYTES_PER_INTENSITY_VALUE 16
-#define UCS8903_PIXEL_UART_BAUDRATE uint32_t(UCS8903_NUM_UART_BITS_PER_INTENSITY_BIT * UCS8903_PIXEL_DATA_RATE)
+// 130 ns UART bits: T0H 390 / T0L 910, T1H 780 / T1L 520. At the 1200 ns
+// datasheet bit rate T0H would be 360 ns, the datasheet minimum, and T1L 360 ns
+#define UCS8903_PIXEL_UART_NS_BIT_TOTAL 1300.0
+#define UCS8903_PIXEL_UART_BAUDRATE uint32_t(UCS8903_NUM_UART_BITS_PER_INTENSITY_BIT * (NanoSecondsInASecond / UCS8903_PIXEL_UART_NS_BIT_TOTAL))
 
 //----------------------------------------------------------------------------
 c_OutputUCS8903Uart::c_OutputUCS8903Uart (OM_OutputPortDefinition_t & OutputPortDefinition,
@@ -60,12 +64,12 @@ void c_OutputUCS8903Uart::Begin ()
 {
     // DEBUG_START;
 
-    // DEBUG_V(String("UCS8903_PIXEL_NS_BIT_TOTAL: ") + String(UCS8903_PIXEL_NS_BIT_TOTAL));
-    // DEBUG_V(String("   UCS8903_PIXEL_DATA_RATE: ") + String(UCS8903_PIXEL_DATA_RATE));
+    // DEBUG_V(String("UCS8903_PIXEL_UART_NS_BIT_TOTAL: ") + String(UCS8903_PIXEL_UART_NS_BIT_TOTAL));
+    // DEBUG_V(String("    UCS8903_PIXEL_UART_BAUDRATE: ") + String(UCS8903_PIXEL_UART_BAUDRATE));
 
     c_OutputUCS8903::Begin();
 
-    SetIntensityBitTimeInUS(float(UCS8903_PIXEL_NS_BIT_TOTAL) / float(NanoSecondsInAMicroSecond));
+    SetIntensityBitTimeInUS(float(UCS8903_PIXEL_UART_NS_BIT_TOTAL) / float(NanoSecondsInAMicroSecond));
 
     c_OutputUart::OutputUartConfig_t OutputUartConfig;
     OutputUartConfig.OutputPortId           = OutputPortDefinition.PortId;
@@ -128,13 +132,6 @@ void c_OutputUCS8903Uart::GetStatus(ArduinoJson::JsonObject &jsonStatus)
     c_OutputUCS8903::GetStatus(jsonStatus);
     Uart.GetStatus(jsonStatus);
 
-#ifdef UCS8903_UART_DEBUG_COUNTERS
-    JsonObject debugStatus = jsonStatus["UCS8903 UART Debug"].to<JsonObject>();
-    debugStatus["NewFrameCounter"]        = NewFrameCounter;
-    debugStatus["TimeSinceLastFrameMS"]   = TimeSinceLastFrameMS;
-    debugStatus["TimeLastFrameStartedMS"] = TimeLastFrameStartedMS;
-#endif // def UCS8903_UART_DEBUG_COUNTERS
-
     // DEBUG_END;
 
 } // GetStatus
@@ -163,12 +160,6 @@ uint32_t c_OutputUCS8903Uart::Poll ()
 
         // DEBUG_V("get the next frame started");
         // DEBUG_V();
-#ifdef UCS8903_UART_DEBUG_COUNTERS
-        NewFrameCounter++;
-        TimeSinceLastFrameMS = millis() - TimeLastFrameStartedMS;
-        TimeLastFrameStartedMS = millis();
-#endif // def UCS8903_UART_DEBUG_COUNTERS
-
         Uart.StartNewFrame();
 
         // DEBUG_V();
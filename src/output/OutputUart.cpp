@@ -19,6 +19,9 @@
 #include "ESPixelStick.h"
 
 #include "output/OutputUart.hpp"
+#include "utility/DebugCounters.hpp"
+#include "utility/EventTrace.hpp"
+#include "RtConfig.hpp"
 
 extern "C"
 {
@@ -56,6 +59,24 @@ extern "C"
 #   define UART_INV_MASK (0x3f << 19)
 #endif // ndef UART_INV_MASK
 
+DEBUG_COUNTER_DEFINE(1, UartFrameStarts,       "uart.frame.starts",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, UartFrameEnds,         "uart.frame.ends",          DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, UartFrameIncomplete,   "uart.frame.incomplete",    DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, UartTxStopped,         "uart.frame.txstopped",     DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartIsr,               "uart.isr.calls",           DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartIsrIdle,           "uart.isr.idle",            DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartIsrFifo,           "uart.isr.fifo",            DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartIsrBreak,          "uart.isr.break",           DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartIsrNotForUs,       "uart.isr.notforus",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartTimerIsr,          "uart.timer.calls",         DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartTimerIsrSendData,  "uart.timer.senddata",      DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartTimerIsrNoData,    "uart.timer.nodata",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartFifoHasRoom,       "uart.fifo.hasroom",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartFifoFull,          "uart.fifo.full",           DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartEnqueue,           "uart.fifo.enqueue",        DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartIntensityValues,   "uart.intensity.values",    DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(2, UartIntensityBits,     "uart.intensity.bits",      DEBUG_COUNTER_MAX_INSTANCES);
+
 // forward declaration for the isr handler
 static void IRAM_ATTR uart_intr_handler (void* param);
 #ifdef ARDUINO_ARCH_ESP8266
@@ -159,7 +180,11 @@ c_OutputUart::~c_OutputUart ()
 {
     // DEBUG_START;
 
-    RestoreSerialPortOperation();
+    // a driver that was never started does not own a UART
+    if (uart_port_t(-1) != OutputUartConfig.UartId)
+    {
+        RestoreSerialPortOperation();
+    }
 
 #ifdef ARDUINO_ARCH_ESP8266
 
@@ -208,10 +233,22 @@ void c_OutputUart::Begin (OutputUartConfig_t & config )
 
         {
             String Reason = (F("Invalid UART configuration parameters. Rebooting"));
-            RequestReboot(Reason, 100000);
+            RequestReboot(Reason, 4000);
             break;
         }
 
+        // timing telemetry is kept by the driver that owns this UART
+        if (nullptr != OutputUartConfig.pPixelDataSource)
+        {
+            pTimingStats = OutputUartConfig.pPixelDataSource->GetTimingStats();
+        }
+        #if defined(SUPPORT_OutputProtocol_FireGod) || defined(SUPPORT_OutputProtocol_DMX) || defined(SUPPORT_OutputProtocol_Serial) || defined(SUPPORT_OutputProtocol_Renard)
+        else
+        {
+            pTimingStats = OutputUartConfig.pSerialDataSource->GetTimingStats();
+        }
+        #endif // defined(SUPPORT_OutputProtocol_FireGod) || defined(SUPPORT_OutputProtocol_DMX) || defined(SUPPORT_OutputProtocol_Serial) || defined(SUPPORT_OutputProtocol_Renard)
+
         // initial data width
         SetIntensityDataWidth();
 
@@ -248,9 +285,10 @@ void c_OutputUart::StartBreak()
 #ifdef ARDUINO_ARCH_ESP8266
     SET_PERI_REG_MASK(UART_CONF0(OutputUartConfig.UartId), UART_TXD_BRK);
 #else
+    // set the level first, the pin takes it as soon as the UART lets go
+    digitalWrite(OutputUartConfig.DataPin, LOW);
     pinMatrixOutDetach(OutputUartConfig.DataPin, false, false);
     pinMode(OutputUartConfig.DataPin, OUTPUT);
-    digitalWrite(OutputUartConfig.DataPin, LOW);
 #endif // def ARDUINO_ARCH_ESP8266
 
     // DEBUG_END;
@@ -313,36 +351,12 @@ void c_OutputUart::GetStatus(ArduinoJson::JsonObject &jsonStatus)
 {
     // DEBUG_START;
 
-#ifdef USE_UART_DEBUG_COUNTERS
+#if DEBUG_COUNTER_LEVEL >= 2
     JsonObject debugStatus = jsonStatus["UART Debug"].to<JsonObject>();
-    debugStatus["ChannelId"]                     = OutputUartConfig.ChannelId;
-    debugStatus["RxIsr"]                         = RxIsr;
-    debugStatus["FiFoISRcounter"]                = FiFoISRcounter;
-    debugStatus["BreakIsrCounter"]               = BreakIsrCounter;
-    debugStatus["IdleIsrCounter"]                = IdleIsrCounter;
-    debugStatus["UnknownIsr"]                    = UnknownIsr;
-    debugStatus["IsrIsNotForUs"]                 = IsrIsNotForUs;
-    debugStatus["ErrorIsr"]                      = ErrorIsr;
-    debugStatus["FrameStartCounter"]             = FrameStartCounter;
-    debugStatus["FrameEndISRcounter"]            = FrameEndISRcounter;
-    debugStatus["FrameThresholdCounter"]         = FrameThresholdCounter;
-    debugStatus["IncompleteFrame"]               = IncompleteFrame;
-    debugStatus["IntensityValuesSent"]           = IntensityValuesSent;
-    debugStatus["IntensityValuesSentLastFrame"]  = IntensityValuesSentLastFrame;
-    debugStatus["IntensityBitsSent"]             = IntensityBitsSent;
-    debugStatus["IntensityBitsSentLastFrame"]    = IntensityBitsSentLastFrame;
-    debugStatus["EnqueueCounter"]                = EnqueueCounter;
-    debugStatus["TimerIsrCounter"]               = TimerIsrCounter;
-    debugStatus["TimerIsrNoDataToSend"]          = TimerIsrNoDataToSend;
-    debugStatus["TimerIsrSendData"]              = TimerIsrSendData;
-    debugStatus["FiFoNotEmpty"]                  = FiFoNotEmpty;
-    debugStatus["FiFoEmpty"]                     = FiFoEmpty;
-    debugStatus["UartFifoLength"]                = getUartFifoLength();
-    debugStatus["TxStopped"]                     = TxStopped;
-
+    debugStatus["UartFifoLength"] = ISR_getUartFifoLength();
     debugStatus["UART_CONF0"] = String(READ_PERI_REG(UART_CONF0(OutputUartConfig.UartId)), HEX);
     debugStatus["UART_CONF1"] = String(READ_PERI_REG(UART_CONF1(OutputUartConfig.UartId)), HEX);
-#endif // def USE_UART_DEBUG_COUNTERS
+#endif // DEBUG_COUNTER_LEVEL >= 2
     // DEBUG_END;
 } // GetStatus
 
@@ -609,61 +623,68 @@ uint32_t inline IRAM_ATTR c_OutputUart::ISR_getUartFifoLength()
 #endif // defined(ARDUINO_ARCH_ESP32)
 } // getUartFifoLength
 
+//----------------------------------------------------------------------------
+uint32_t inline IRAM_ATTR c_OutputUart::ISR_GetFifoDrainTimeUs()
+{
+    return (ISR_getUartFifoLength() * UartSlotTimeNs) / NanoSecondsInAMicroSecond;
+} // ISR_GetFifoDrainTimeUs
+
 //----------------------------------------------------------------------------
 void inline IRAM_ATTR c_OutputUart::ISR_enqueueUartData(uint8_t value)
 {
-#ifdef USE_UART_DEBUG_COUNTERS
-    EnqueueCounter++;
-#endif // def USE_UART_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, UartEnqueue, OutputUartConfig.OutputPortId);
 #ifdef ARDUINO_ARCH_ESP8266
     (U1F = (char)(value));
 #elif defined(ARDUINO_ARCH_ESP32)
-    (*((volatile uint32_t *)(UART_FIFO_AHB_REG(OutputUartConfig.UartId)))) = (uint32_t)(value);
+    WRITE_PERI_REG(UART_FIFO_AHB_REG(OutputUartConfig.UartId), (uint32_t)(value));
 #endif // defined(ARDUINO_ARCH_ESP32)
 } // enqueueUartData
 
 //----------------------------------------------------------------------------
 void IRAM_ATTR c_OutputUart::ISR_UART_Handler()
 {
+    uint32_t IsrStartCycleCount = ESP.getCycleCount();
+
     do // once
     {
-#ifdef USE_UART_DEBUG_COUNTERS
-        RxIsr++;
-#endif // def USE_UART_DEBUG_COUNTERS
+        DEBUG_COUNTER_INC(2, UartIsr, OutputUartConfig.OutputPortId);
 
         // Process if the desired UART has raised an interrupt
         uint32_t isrStatus = READ_PERI_REG(UART_INT_ST(OutputUartConfig.UartId));
         if (0 != (isrStatus & ActiveIsrMask))
         {
-#ifdef USE_UART_DEBUG_COUNTERS
+#if DEBUG_COUNTER_LEVEL >= 2
 #ifdef ARDUINO_ARCH_ESP32
             if (isrStatus & UART_TX_BRK_IDLE_DONE_INT_ENA)
             {
-                IdleIsrCounter++;
+                DEBUG_COUNTER_INC(2, UartIsrIdle, OutputUartConfig.OutputPortId);
             }
 #endif // def ARDUINO_ARCH_ESP32
 
             if (isrStatus & UART_TXFIFO_EMPTY_INT_ENA)
             {
-                FiFoISRcounter++;
+                DEBUG_COUNTER_INC(2, UartIsrFifo, OutputUartConfig.OutputPortId);
             }
 
             if (isrStatus & UART_TX_BRK_DONE_INT_ENA)
             {
-                BreakIsrCounter++;
+                DEBUG_COUNTER_INC(2, UartIsrBreak, OutputUartConfig.OutputPortId);
             }
-#endif // def USE_UART_DEBUG_COUNTERS
+#endif // DEBUG_COUNTER_LEVEL >= 2
 
             // Clear all interrupt flags for this uart
             ISR_ClearUartInterrupts();
 #ifdef ARDUINO_ARCH_ESP32
             if(isrStatus & UART_TX_DONE_INT_ST)
             {
-#ifdef USE_UART_DEBUG_COUNTERS
-                TxStopped++;
-#endif // def USE_UART_DEBUG_COUNTERS
+                DEBUG_COUNTER_INC(1, UartTxStopped, OutputUartConfig.OutputPortId);
                 // abort the frame
                 ISR_DisableUartInterrupts();
+                if (pTimingStats)
+                {
+                    pTimingStats->ISR_FrameAborted();
+                }
+                xSemaphoreGive(WaitFrameDone);
                 break;
             }
 #endif // def ARDUINO_ARCH_ESP32
@@ -671,6 +692,17 @@ void IRAM_ATTR c_OutputUart::ISR_UART_Handler()
         digitalWrite(DEBUG_GPIO, LOW);
 #endif // def DEBUG_GPIO
 
+            if (ISR_MoreDataToSend())
+            {
+                // an empty FIFO means the line already went idle in the middle of the frame
+                int32_t SlackUs = ISR_getUartFifoLength() ? int32_t(ISR_GetFifoDrainTimeUs()) : -1;
+                if (pTimingStats)
+                {
+                    pTimingStats->ISR_RefillSlack(SlackUs);
+                }
+                EVENT_TRACE(Refill, OutputUartConfig.OutputPortId, 0, SlackUs);
+            }
+
             // Fill the FIFO with new data
             ISR_Handler_SendIntensityData();
 #ifdef DEBUG_GPIO
@@ -681,22 +713,31 @@ void IRAM_ATTR c_OutputUart::ISR_UART_Handler()
             {
                 ISR_DisableUartInterrupts();
 
+                if (pTimingStats)
+                {
+                    // the frame is over once the FIFO has drained
+                    pTimingStats->ISR_FrameEnd(micros() + ISR_GetFifoDrainTimeUs());
+                }
+                EVENT_TRACE(FrameDone, OutputUartConfig.OutputPortId, 0, 0);
+
                 #ifdef ARDUINO_ARCH_ESP32
                 xSemaphoreGive(WaitFrameDone);
                 #endif // def ARDUINO_ARCH_ESP32
-                
-#ifdef USE_UART_DEBUG_COUNTERS
-                FrameEndISRcounter++;
-#endif // def USE_UART_DEBUG_COUNTERS
+
+                DEBUG_COUNTER_INC(1, UartFrameEnds, OutputUartConfig.OutputPortId);
             }
 
         } // end Our uart generated an interrupt
-#ifdef USE_UART_DEBUG_COUNTERS
         else
         {
-            IsrIsNotForUs++;
+            DEBUG_COUNTER_INC(2, UartIsrNotForUs, OutputUartConfig.OutputPortId);
+            break;
+        }
+
+        if (pTimingStats)
+        {
+            pTimingStats->IsrCycles.Add(ESP.getCycleCount() - IsrStartCycleCount);
         }
-#endif // def USE_UART_DEBUG_COUNTERS
 
     } while (false);
 
@@ -727,15 +768,11 @@ void c_OutputUart::CalculateInterIntensityMabTime()
 //----------------------------------------------------------------------------
 void IRAM_ATTR c_OutputUart::ISR_Timer_Handler()
 {
-#ifdef USE_UART_DEBUG_COUNTERS
-    TimerIsrCounter++;
-#endif // def USE_UART_DEBUG_COUNTERS
+    DEBUG_COUNTER_INC(2, UartTimerIsr, OutputUartConfig.OutputPortId);
 
     if (ISR_MoreDataToSend())
     {
-#ifdef USE_UART_DEBUG_COUNTERS
-        TimerIsrSendData++;
-#endif // def USE_UART_DEBUG_COUNTERS
+        DEBUG_COUNTER_INC(2, UartTimerIsrSendData, OutputUartConfig.OutputPortId);
         CLEAR_PERI_REG_MASK(UART_CONF0(OutputUartConfig.UartId), UART_TXD_BRK);
 
         if (MarkAfterInterintensityBreakBitCCOUNT)
@@ -749,19 +786,21 @@ void IRAM_ATTR c_OutputUart::ISR_Timer_Handler()
 
         ISR_Handler_SendIntensityData();
         ISR_DisableUartInterrupts();
-#ifdef USE_UART_DEBUG_COUNTERS
-        if (!MoreDataToSend())
+
+        if (!ISR_MoreDataToSend())
         {
-            FrameEndISRcounter++;
+            if (pTimingStats)
+            {
+                pTimingStats->ISR_FrameEnd(micros() + ISR_GetFifoDrainTimeUs());
+            }
+            EVENT_TRACE(FrameDone, OutputUartConfig.OutputPortId, 0, 0);
+            DEBUG_COUNTER_INC(1, UartFrameEnds, OutputUartConfig.OutputPortId);
         }
-#endif // def USE_UART_DEBUG_COUNTERS
     }
-#ifdef USE_UART_DEBUG_COUNTERS
     else
     {
-        TimerIsrNoDataToSend++;
+        DEBUG_COUNTER_INC(2, UartTimerIsrNoData, OutputUartConfig.OutputPortId);
     }
-#endif // def USE_UART_DEBUG_COUNTERS
 
 } // ISR_Timer_Handler
 #endif // def ARDUINO_ARCH_ESP8266
@@ -770,25 +809,23 @@ void IRAM_ATTR c_OutputUart::ISR_Timer_Handler()
 void IRAM_ATTR c_OutputUart::ISR_Handler_SendIntensityData ()
 {
     uint32_t NumAvailableIntensitySlotsToFill = ((((uint32_t)UART_TX_FIFO_SIZE) - (ISR_getUartFifoLength())) / NumUartSlotsPerIntensityValue);
-#ifdef USE_UART_DEBUG_COUNTERS
+#if DEBUG_COUNTER_LEVEL >= 2
     if (NumAvailableIntensitySlotsToFill)
     {
-        FiFoNotEmpty++;
+        DEBUG_COUNTER_INC(2, UartFifoHasRoom, OutputUartConfig.OutputPortId);
     }
     else
     {
-        FiFoEmpty++;
+        DEBUG_COUNTER_INC(2, UartFifoFull, OutputUartConfig.OutputPortId);
     }
-#endif // def USE_UART_DEBUG_COUNTERS
+#endif // DEBUG_COUNTER_LEVEL >= 2
 
     uint32_t IntensityValue;
     bool MoreData = ISR_MoreDataToSend();
 
     while (MoreData && NumAvailableIntensitySlotsToFill)
     {
-#ifdef USE_UART_DEBUG_COUNTERS
-        IntensityValuesSent++;
-#endif // def USE_UART_DEBUG_COUNTERS
+        DEBUG_COUNTER_INC(2, UartIntensityValues, OutputUartConfig.OutputPortId);
 
         NumAvailableIntensitySlotsToFill--;
 
@@ -807,9 +844,7 @@ void IRAM_ATTR c_OutputUart::ISR_Handler_SendIntensityData ()
             {
                 ISR_enqueueUartData(IntensityValue & 0xFF);
                 IntensityValue >>= 8;
-#ifdef USE_UART_DEBUG_COUNTERS
-                IntensityBitsSent += 8;
-#endif // def USE_UART_DEBUG_COUNTERS
+                DEBUG_COUNTER_ADD(2, UartIntensityBits, OutputUartConfig.OutputPortId, 8);
             }
         } // end no translation
 
@@ -819,9 +854,7 @@ void IRAM_ATTR c_OutputUart::ISR_Handler_SendIntensityData ()
             {
                 // convert the intensity data into UART data
                 ISR_enqueueUartData(Intensity2Uart[(IntensityValue & mask) ? UartDataBitTranslationId_t::Uart_DATA_BIT_01_ID : UartDataBitTranslationId_t::Uart_DATA_BIT_00_ID]);
-#ifdef USE_UART_DEBUG_COUNTERS
-                IntensityBitsSent += 1;
-#endif // def USE_UART_DEBUG_COUNTERS
+                DEBUG_COUNTER_ADD(2, UartIntensityBits, OutputUartConfig.OutputPortId, 1);
             }
         } // end 1:1
 
@@ -834,15 +867,11 @@ void IRAM_ATTR c_OutputUart::ISR_Handler_SendIntensityData ()
             {
                 // convert the intensity data into UART data
                 ISR_enqueueUartData(Intensity2Uart[(IntensityValue >> NumBitsToShift) & 0x3]);
-#ifdef USE_UART_DEBUG_COUNTERS
-                IntensityBitsSent += 2;
-#endif // def USE_UART_DEBUG_COUNTERS
+                DEBUG_COUNTER_ADD(2, UartIntensityBits, OutputUartConfig.OutputPortId, 2);
             }
             // handle the last two bits
             ISR_enqueueUartData(Intensity2Uart[IntensityValue & 0x3]);
-#ifdef USE_UART_DEBUG_COUNTERS
-            IntensityBitsSent += 2;
-#endif    // def USE_UART_DEBUG_COUNTERS
+            DEBUG_COUNTER_ADD(2, UartIntensityBits, OutputUartConfig.OutputPortId, 2);
         } // end 2:1
 
         if (OutputUartConfig.NumInterIntensityBreakBits)
@@ -888,32 +917,58 @@ bool c_OutputUart::RegisterUartIsrHandler()
     // ETS_UART_INTR_DETACH(uart_intr_handler);
     ETS_UART_INTR_ATTACH(uart_intr_handler, this);
 #else
-    // UART_ENTER_CRITICAL(&(uart_context[uart_num].spinlock));
-    if (IsrHandle)
-    {
-        esp_intr_free(IsrHandle);
-        IsrHandle = nullptr;
-    }
-    #ifdef CONFIG_IDF_TARGET_ESP32S3
-    ret = (ESP_OK == uart_isr_register(OutputUartConfig.UartId,
-                                       uart_intr_handler,
-                                       this,
-                                       UART_TXFIFO_EMPTY_INT_ENA | ESP_INTR_FLAG_IRAM,
-                                       &IsrHandle));
-    #else
-    ret = (ESP_OK == esp_intr_alloc((OutputUartConfig.UartId == UART_NUM_1) ? ETS_UART1_INTR_SOURCE : ETS_UART2_INTR_SOURCE,
-                                    UART_TXFIFO_EMPTY_INT_ENA | ESP_INTR_FLAG_IRAM,
-                                    uart_intr_handler,
-                                    this,
-                                    &IsrHandle));
-    // UART_EXIT_CRITICAL(&(uart_context[uart_num].spinlock));
-    #endif // def CONFIG_IDF_TARGET_ESP32S3
+    // the interrupt is serviced by the core that allocates it
+    RtRunOnCore(RT_UART_ISR_CORE, FreeIsr, this);
+    RtRunOnCore(RT_UART_ISR_CORE, AllocateIsr, this);
+    ret = (nullptr != IsrHandle);
 #endif
     // DEBUG_END;
 
     return ret;
 } // RegisterUartIsrHandler
 
+#ifdef ARDUINO_ARCH_ESP32
+//-----------------------------------------------------------------------------
+void c_OutputUart::AllocateIsr(void * pThis)
+{
+    c_OutputUart * pUart = static_cast<c_OutputUart *>(pThis);
+
+    // UART_ENTER_CRITICAL(&(uart_context[uart_num].spinlock));
+    #ifdef CONFIG_IDF_TARGET_ESP32S3
+    if (ESP_OK != uart_isr_register(pUart->OutputUartConfig.UartId,
+                                    uart_intr_handler,
+                                    pUart,
+                                    RT_UART_ISR_LEVEL | ESP_INTR_FLAG_IRAM,
+                                    &pUart->IsrHandle))
+    #else
+    int IntrSource = (pUart->OutputUartConfig.UartId == UART_NUM_0) ? ETS_UART0_INTR_SOURCE :
+                     (pUart->OutputUartConfig.UartId == UART_NUM_1) ? ETS_UART1_INTR_SOURCE : ETS_UART2_INTR_SOURCE;
+    if (ESP_OK != esp_intr_alloc(IntrSource,
+                                 RT_UART_ISR_LEVEL | ESP_INTR_FLAG_IRAM,
+                                 uart_intr_handler,
+                                 pUart,
+                                 &pUart->IsrHandle))
+    #endif // def CONFIG_IDF_TARGET_ESP32S3
+    {
+        pUart->IsrHandle = nullptr;
+    }
+    // UART_EXIT_CRITICAL(&(uart_context[uart_num].spinlock));
+} // AllocateIsr
+
+//-----------------------------------------------------------------------------
+void c_OutputUart::FreeIsr(void * pThis)
+{
+    c_OutputUart * pUart = static_cast<c_OutputUart *>(pThis);
+
+    // must run on the core that allocated the interrupt
+    if (pUart->IsrHandle)
+    {
+        esp_intr_free(pUart->IsrHandle);
+        pUart->IsrHandle = nullptr;
+    }
+} // FreeIsr
+#endif // def ARDUINO_ARCH_ESP32
+
 //----------------------------------------------------------------------------
 bool c_OutputUart::SetConfig(JsonObject &jsonConfig)
 {
@@ -1089,19 +1144,14 @@ void c_OutputUart::StartNewFrame()
 
     ISR_DisableUartInterrupts();
 
-#ifdef USE_UART_DEBUG_COUNTERS
-    FrameStartCounter++;
+#if DEBUG_COUNTER_LEVEL >= 1
+    DEBUG_COUNTER_INC(1, UartFrameStarts, OutputUartConfig.OutputPortId);
 
-    if(MoreDataToSend())
+    if(ISR_MoreDataToSend())
     {
-        IncompleteFrame++;
+        DEBUG_COUNTER_INC(1, UartFrameIncomplete, OutputUartConfig.OutputPortId);
     }
-
-    IntensityValuesSentLastFrame    = IntensityValuesSent;
-    IntensityValuesSent             = 0;
-    IntensityBitsSentLastFrame      = IntensityBitsSent;
-    IntensityBitsSent               = 0;
-#endif // def USE_UART_DEBUG_COUNTERS
+#endif // DEBUG_COUNTER_LEVEL >= 1
 
     // set up to send a new frame
     GenerateBreak(OutputUartConfig.FrameStartBreakUS, OutputUartConfig.FrameStartMarkAfterBreakUS);
@@ -1119,8 +1169,28 @@ void c_OutputUart::StartNewFrame()
     }
 #else
     ISR_Handler_SendIntensityData();
+    // a frame that fits in the FIFO never enables the interrupt that would end it
+    bool WaitForFrameDone = ISR_MoreDataToSend();
     EnableUartInterrupts();
-    xSemaphoreTake(WaitFrameDone, portMAX_DELAY);
+    if (WaitForFrameDone)
+    {
+        xSemaphoreTake(WaitFrameDone, portMAX_DELAY);
+    }
+
+    if (OutputUartConfig.NumInterIntensityBreakBits)
+    {
+        // The UART goes back to the mark level after the break that follows
+        // the last intensity. Take the pin over half way through that break
+        // so the line stays at the break level until the next frame.
+        delayMicroseconds(ISR_GetFifoDrainTimeUs());
+        while (ISR_getUartFifoLength())
+        {
+            delayMicroseconds(1);
+        }
+        uint32_t BreakTimeNs = OutputUartConfig.NumInterIntensityBreakBits * (NanoSecondsInASecond / OutputUartConfig.Baudrate);
+        delayMicroseconds((UartSlotTimeNs + (BreakTimeNs / 2)) / NanoSecondsInAMicroSecond);
+        StartBreak();
+    }
 #endif // defined(ARDUINO_ARCH_ESP32)
 
     // DEBUG_END;
@@ -1146,6 +1216,10 @@ void c_OutputUart::StartUart()
         // Initialize uart also sets pin
         InitializeUart();
 
+        // how long the UART takes to shift out one FIFO entry: start bit, data bits and stop bits
+        uint32_t NumBitsPerUartSlot = 1 + (5 + (uint32_t(OutputUartConfig.UartDataSize) / 2)) + (1 + (uint32_t(OutputUartConfig.UartDataSize) & 1));
+        UartSlotTimeNs = (OutputUartConfig.Baudrate) ? ((NanoSecondsInASecond / OutputUartConfig.Baudrate) * NumBitsPerUartSlot) : 0;
+
         // Atttach interrupt handler
         RegisterUartIsrHandler();
 
@@ -1204,11 +1278,7 @@ void c_OutputUart::TerminateSerialPortOperation()
     } // end switch (UartId)
 
 #ifdef ARDUINO_ARCH_ESP32
-    if (IsrHandle)
-    {
-        esp_intr_free(IsrHandle);
-        IsrHandle = nullptr;
-    }
+    RtRunOnCore(RT_UART_ISR_CORE, FreeIsr, this);
     // uart_driver_delete(OutputUartConfig.UartId);
 #endif // def ARDUINO_ARCH_ESP32
 
@@ -21,6 +21,9 @@
 
 #include "output/OutputWS2811Rmt.hpp"
 
+DEBUG_COUNTER_DEFINE(1, Ws2811RmtCanRefresh,    "ws2811rmt.canrefresh",    DEBUG_COUNTER_MAX_INSTANCES);
+DEBUG_COUNTER_DEFINE(1, Ws2811RmtCannotRefresh, "ws2811rmt.cannotrefresh", DEBUG_COUNTER_MAX_INSTANCES);
+
 //----------------------------------------------------------------------------
 static bool IRAM_ATTR ISR_GetNextBitToSendBase (void * arg, rmt_item32_t & DataToSend)
 {
@@ -82,8 +85,8 @@ bool c_OutputWS2811Rmt::SetConfig (ArduinoJson::JsonObject& jsonConfig)
     bool response = c_OutputWS2811::SetConfig (jsonConfig);
 
     Rmt.SetBitDuration((InterFrameGapInMicroSec * NanoSecondsInAMicroSecond), IfgBit, IfgBitCount);
-    IfgBit.level0 = 0;
-    IfgBit.level1 = 0;
+    IfgBit.level0 = 1;
+    IfgBit.level1 = 1;
 
     c_OutputRmt::OutputRmtConfig_t OutputRmtConfig;
     OutputRmtConfig.RmtChannelId            = uint32_t(OutputPortDefinition.PortId);
@@ -118,27 +121,6 @@ void c_OutputWS2811Rmt::GetStatus (ArduinoJson::JsonObject& jsonStatus)
     // // DEBUG_START;
     c_OutputWS2811::GetStatus (jsonStatus);
     Rmt.GetStatus (jsonStatus);
-#ifdef USE_RMT_DEBUG_COUNTERS
-    jsonStatus[F("Can Refresh")] = CanRefresh;
-    jsonStatus[F("Cannot Refresh")] = CannotRefresh;
-    jsonStatus[F("FrameDurationInMicroSec")] = FrameDurationInMicroSec;
-    jsonStatus[F("FrameStartTimeInMicroSec")] = FrameStartTimeInMicroSec;
-    uint32_t now = micros();
-    jsonStatus[F("Now")] = now;
-    jsonStatus[F("FrameStartDelta")] = now - FrameStartTimeInMicroSec;
-#endif // def USE_RMT_DEBUG_COUNTERS
-    #ifdef WS2811_RMT_DEBUG_COUNTERS
-    JsonObject JsonCounters = jsonStatus["JsonCounters"].to<JsonObject>();
-    JsonWrite(JsonCounters, "GetNextBit",  RmtDebugCounters.GetNextBit);
-    JsonWrite(JsonCounters, "FrameStarts", RmtDebugCounters.FrameStarts);
-    JsonWrite(JsonCounters, "FrameEnds",   RmtDebugCounters.FrameEnds);
-    JsonWrite(JsonCounters, "BreakBits",   RmtDebugCounters.BreakBits);
-    JsonWrite(JsonCounters, "MabBits",     RmtDebugCounters.MabBits);
-    JsonWrite(JsonCounters, "StartBits",   RmtDebugCounters.StartBits);
-    JsonWrite(JsonCounters, "DataBits",    RmtDebugCounters.DataBits);
-    JsonWrite(JsonCounters, "StopBits",    RmtDebugCounters.StopBits);
-    JsonWrite(JsonCounters, "Underrun",    RmtDebugCounters.Underrun);
-    #endif // def WS2811_RMT_DEBUG_COUNTERS
 
     // // DEBUG_END;
 } // GetStatus
@@ -167,12 +149,12 @@ bool c_OutputWS2811Rmt::RmtPoll ()
 
         if(!canRefresh())
         {
-            RMT_DEBUG_COUNTER(CannotRefresh++);
+            DEBUG_COUNTER_INC(1, Ws2811RmtCannotRefresh, OutputPortDefinition.PortId);
 
             // DEBUG_V ("not ready to send yet");
             break;
         }
-        RMT_DEBUG_COUNTER(CanRefresh++);
+        DEBUG_COUNTER_INC(1, Ws2811RmtCanRefresh, OutputPortDefinition.PortId);
 
         // DEBUG_V(String("get the next frame started on ") + String(DataPin));
         Response = Rmt.StartNewFrame ();
@@ -195,7 +177,7 @@ void c_OutputWS2811Rmt::StartNewDataFrame()
 {
     // DEBUG_START;
     // DEBUG_V(String("frame started on ") + String(OutputPortDefinition.gpios.data));
-    INC_WS2811_RMT_DEBUG_COUNTERS(FrameStarts);
+    RMT_BIT_COUNTER(FrameStarts);
     IfgBitCurrentCount = IfgBitCount;
     StartNewFrame();
 
@@ -205,11 +187,11 @@ void c_OutputWS2811Rmt::StartNewDataFrame()
 //----------------------------------------------------------------------------
 bool IRAM_ATTR c_OutputWS2811Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSend)
 {
-    INC_WS2811_RMT_DEBUG_COUNTERS(GetNextBit);
+    RMT_BIT_COUNTER(GetNextBit);
     bool Response = true;
     if(IfgBitCurrentCount)
     {
-        INC_WS2811_RMT_DEBUG_COUNTERS(StartBits);
+        RMT_BIT_COUNTER(StartBits);
         --IfgBitCurrentCount;
         DataToSend = IfgBit;
         // set up for the next data byte
@@ -218,7 +200,7 @@ bool IRAM_ATTR c_OutputWS2811Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSen
     }
     else if(DataPatternMask)
     {
-        INC_WS2811_RMT_DEBUG_COUNTERS(DataBits);
+        RMT_BIT_COUNTER(DataBits);
         DataToSend = (DataPattern & DataPatternMask) ? OneBit : ZeroBit;
         DataPatternMask = DataPatternMask >> 1;
         if(0 == DataPatternMask)
@@ -230,14 +212,14 @@ bool IRAM_ATTR c_OutputWS2811Rmt::ISR_GetNextBitToSend (rmt_item32_t & DataToSen
             }
             else
             {
-                INC_WS2811_RMT_DEBUG_COUNTERS(FrameEnds);
+                RMT_BIT_COUNTER(FrameEnds);
                 Response = false;
             }
         }
     }
     else
     {
-        INC_WS2811_RMT_DEBUG_COUNTERS(Underrun);
+        RMT_BIT_COUNTER(Underrun);
         // nothing to send
         DataToSend.val = 0x0;
         Response = false;
@@ -119,13 +119,6 @@ void c_OutputWS2811Uart::GetStatus(ArduinoJson::JsonObject &jsonStatus)
     c_OutputWS2811::GetStatus(jsonStatus);
     Uart.GetStatus(jsonStatus);
 
-#ifdef WS2811_UART_DEBUG_COUNTERS
-    JsonObject debugStatus = jsonStatus["WS2811 UART Debug"].to<JsonObject>();
-    debugStatus["NewFrameCounter"]        = NewFrameCounter;
-    debugStatus["TimeSinceLastFrameMS"]   = TimeSinceLastFrameMS;
-    debugStatus["TimeLastFrameStartedMS"] = TimeLastFrameStartedMS;
-#endif // def WS2811_UART_DEBUG_COUNTERS
-
     // DEBUG_END;
 
 } // GetStatus
@@ -151,12 +144,6 @@ uint32_t c_OutputWS2811Uart::Poll ()
         }
 
         // DEBUG_V("get the next frame started");
-#ifdef WS2811_UART_DEBUG_COUNTERS
-        NewFrameCounter++;
-        TimeSinceLastFrameMS = millis() - TimeLastFrameStartedMS;
-        TimeLastFrameStartedMS = millis();
-#endif // def WS2811_UART_DEBUG_COUNTERS
-
         Uart.StartNewFrame();
 
         // DEBUG_V();
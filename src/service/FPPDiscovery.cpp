@@ -22,6 +22,9 @@
 #include "FileMgr.hpp"
 #include "output/OutputMgr.hpp"
 #include "network/NetworkMgr.hpp"
+#include "utility/EventTrace.hpp"
+#include "utility/TimerWheel.hpp"
+#include "utility/SpiRam.hpp"
 #include <Int64String.h>
 #include <time.h>
 
@@ -94,6 +97,8 @@ void c_FPPDiscovery::begin ()
 
     NetworkStateChanged (NetworkMgr.IsConnected ());
 
+    TimerWheel.Add (F ("FPP"), [] (void * pThis) -> uint32_t { return ((c_FPPDiscovery*)pThis)->Poll (); }, this, 0, 5000);
+
     // DEBUG_END;
 } // begin
 
@@ -447,6 +452,8 @@ void c_FPPDiscovery::ProcessReceivedUdpPacket (AsyncUDPPacket & UDPpacket)
 void c_FPPDiscovery::ProcessSyncPacket (uint8_t action, String FileName, float SecondsElapsed)
 {
     // DEBUG_START;
+    EVENT_TRACE(MultiSync, 0, action, uint32_t(SecondsElapsed * 1000.0));
+
     do // once
     {
         if (!AllowedToPlayRemoteFile ())
@@ -648,7 +655,7 @@ void c_FPPDiscovery::BuildFseqResponse (String fname, c_FileMgr::FileId fseqFile
 {
     // DEBUG_START;
 
-    JsonDocument JsonDoc;
+    JsonDocument JsonDoc (&SpiRam);
     JsonObject JsonData = JsonDoc.to<JsonObject> ();
 
     // DEBUG_V(String("FileHandle: ") + String(fseq));
@@ -838,7 +845,7 @@ void c_FPPDiscovery::ProcessGET (AsyncWebServerRequest* request)
                         break;
                     }
                 }
-                logcon (String (F ("Could not open: '")) + seq + F("' for reading"));
+                logerr (String (F ("Could not open: '")) + seq + F("' for reading"));
             }
         }
         else if (path.startsWith (F ("/api/system/status")))
@@ -846,7 +853,7 @@ void c_FPPDiscovery::ProcessGET (AsyncWebServerRequest* request)
             LastFppMasterMessageRcvTime = now();
             String Response;
             {
-	            JsonDocument JsonDoc;
+	            JsonDocument JsonDoc (&SpiRam);
 	            JsonObject JsonData = JsonDoc.to<JsonObject> ();
 	            GetStatusJSON(JsonData, true);
 	            serializeJson (JsonDoc, Response);
@@ -861,7 +868,7 @@ void c_FPPDiscovery::ProcessGET (AsyncWebServerRequest* request)
             LastFppMasterMessageRcvTime = now();
             String Response;
             {
-	            JsonDocument JsonDoc;
+	            JsonDocument JsonDoc (&SpiRam);
 	            JsonObject JsonData = JsonDoc.to<JsonObject> ();
 	            GetSysInfoJSON(JsonData);
                 // PrettyPrint(JsonDoc, "ProcessGET/api/system/info");
@@ -1220,7 +1227,7 @@ void c_FPPDiscovery::ProcessFPPJson (AsyncWebServerRequest* request)
             break;
         }
 
-        JsonDocument JsonDoc;
+        JsonDocument JsonDoc (&SpiRam);
         JsonObject JsonData = JsonDoc.to<JsonObject> ();
 
         String command = request->getParam (ulrCommand)->value ();
@@ -1544,7 +1551,7 @@ bool c_FPPDiscovery::AllowedToPlayRemoteFile()
 } // AllowedToPlayRemoteFile
 
 //-----------------------------------------------------------------------------
-void c_FPPDiscovery::Poll ()
+uint32_t c_FPPDiscovery::Poll ()
 {
     ///DEBUG_START;
 
@@ -1568,6 +1575,8 @@ void c_FPPDiscovery::Poll ()
     }
 
     ///DEBUG_END;
+    // the master timeout is counted in seconds
+    return MilliSecondsInASecond;
 } // Poll
 
 c_FPPDiscovery FPPDiscovery;
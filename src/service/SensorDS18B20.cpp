@@ -21,20 +21,69 @@
 #ifdef SUPPORT_SENSOR_DS18B20
 
 #include "service/SensorDS18B20.h"
-#include <DS18B20.h>
-#include <TimeLib.h>
+#include "utility/TimerWheel.hpp"
 
-DS18B20 Device(ONEWIRE_PIN);
+#define DS18S20_FAMILY          0x10
+#define DS1822_FAMILY           0x22
+#define DS18B20_FAMILY          0x28
+
+#define DS18B20_CMD_SKIP_ROM    0xCC
+#define DS18B20_CMD_MATCH_ROM   0x55
+#define DS18B20_CMD_CONVERT_T   0x44
+#define DS18B20_CMD_READ_SCRATCHPAD 0xBE
+#define DS18B20_CMD_READ_POWER  0xB4
+
+#define DS18B20_MAX_CONVERSION_MS   750     // 12 bit resolution
 
 //-----------------------------------------------------------------------------
 void c_SensorDS18B20::Begin ()
 {
     // DEBUG_START;
 
-    // DEBUG_V(String("Devices: ") + String(Device.getNumberOfDevices()));
+    do // once
+    {
+        Bus.reset_search ();
+        if (!Bus.search (Address) || (Address[7] != OneWire::crc8 (Address, 7)))
+        {
+            break;
+        }
+
+        if ((DS18S20_FAMILY != Address[0]) && (DS1822_FAMILY != Address[0]) && (DS18B20_FAMILY != Address[0]))
+        {
+            logcon (String (F ("Unsupported 1-Wire device family: ")) + String (Address[0], HEX));
+            break;
+        }
 
-    SensorPresent = Device.selectNext();
-    // DEBUG_V(String("selected: ") + String(SensorPresent));
+        // the power mode and the resolution are read once, blocking, while booting
+        Bus.reset ();
+        Bus.select (Address);
+        Bus.write (DS18B20_CMD_READ_POWER);
+        ParasitePower = (0 == Bus.read_bit ());
+
+        Bus.reset ();
+        Bus.select (Address);
+        Bus.write (DS18B20_CMD_READ_SCRATCHPAD);
+        Bus.read_bytes (Scratchpad, sizeof (Scratchpad));
+        if (Scratchpad[8] != OneWire::crc8 (Scratchpad, 8))
+        {
+            logcon (F ("Could not read the sensor configuration"));
+            break;
+        }
+
+        // the DS18S20 always converts at 9 bits plus the count remain, which takes the full time
+        ConversionMs = DS18B20_MAX_CONVERSION_MS;
+        if (DS18S20_FAMILY != Address[0])
+        {
+            ConversionMs = DS18B20_MAX_CONVERSION_MS >> (3 - ((Scratchpad[4] >> 5) & 0x03));
+        }
+
+        SensorPresent = true;
+        // DEBUG_V(String("ConversionMs: ") + String(ConversionMs));
+        // DEBUG_V(String("ParasitePower: ") + String(ParasitePower));
+
+    } while (false);
+
+    TimerWheel.Add (F ("Sensor"), [] (void * pThis) -> uint32_t { return ((c_SensorDS18B20*)pThis)->Poll (); }, this, 0, 5000);
 
     // DEBUG_END;
 } // Begin
@@ -69,7 +118,6 @@ bool c_SensorDS18B20::SetConfig (JsonObject& json)
         uint32_t t = TempUnit_t::TempUnitCentegrade;
         ConfigChanged |= setFromJSON (t, JsonDeviceConfig, CN_units);
         TempUnit = TempUnit_t(t);
-        LastReadingTime = 0; // force a reading
     } while(false);
 
     // DEBUG_V (String ("TempUnit: ") + String (TempUnit));
@@ -95,7 +143,16 @@ void c_SensorDS18B20::GetStatus (JsonObject& json)
 
         JsonObject SensorStatus = json[(char*)CN_sensor].to<JsonObject> ();
 
-        JsonWrite(SensorStatus, CN_reading, String(LastReading) + ((TempUnit == TempUnit_t::TempUnitCentegrade) ? " C" : " F"));
+        if (TempUnit == TempUnit_t::TempUnitCentegrade)
+        {
+            JsonWrite(SensorStatus, CN_reading, String(LastReading) + " C");
+        }
+        else
+        {
+            JsonWrite(SensorStatus, CN_reading, String((LastReading * 1.8) + 32.0) + " F");
+        }
+        JsonWrite(SensorStatus, F("maxpollus"), MaxPollUs);
+        JsonWrite(SensorStatus, CN_errors,      ReadErrors);
 
     } while(false);
 
@@ -104,39 +161,159 @@ void c_SensorDS18B20::GetStatus (JsonObject& json)
 } // GetStatus
 
 //-----------------------------------------------------------------------------
-void c_SensorDS18B20::Poll()
+uint32_t c_SensorDS18B20::Poll()
 {
     // pDEBUG_START;
 
-    do // once
+    uint32_t Response = TIMER_WHEEL_STOP;
+
+    if (SensorPresent)
     {
-        if(false == SensorPresent)
+        uint32_t StartUs = micros ();
+        Response = RunState ();
+        MaxPollUs = max (MaxPollUs, uint32_t (micros () - StartUs));
+    }
+
+    // pDEBUG_END;
+    return Response;
+} // Poll
+
+//-----------------------------------------------------------------------------
+uint32_t c_SensorDS18B20::RunState ()
+{
+    // pDEBUG_START;
+
+    // the next bus operation runs as soon as the other jobs had their turn
+    uint32_t Response = 0;
+
+    switch (State)
+    {
+        case State_t::StartConversion:
         {
+            if (!Bus.reset ())
+            {
+                Response = ReadFailed ();
+                break;
+            }
+            // every sensor on the bus converts, only the selected one is read
+            Command[0] = DS18B20_CMD_SKIP_ROM;
+            Command[1] = DS18B20_CMD_CONVERT_T;
+            CommandLength = 2;
+            ByteIndex = 0;
+            State = State_t::SendConvertCommand;
             break;
         }
 
-        // only read once per sevond
-        if(LastReadingTime == now())
+        case State_t::SendConvertCommand:
         {
+            // a parasite powered sensor draws its conversion current through the strong pull up
+            bool LastByte = (ByteIndex + 1) == CommandLength;
+            Bus.write (Command[ByteIndex++], LastByte && ParasitePower);
+            if (LastByte)
+            {
+                ConversionStartMs = millis ();
+                State = State_t::WaitForConversion;
+                Response = ConversionMs;
+            }
             break;
         }
 
-        // remember the last reading
-        LastReadingTime = now();
+        case State_t::WaitForConversion:
+        {
+            if (ParasitePower)
+            {
+                Bus.depower ();
+            }
+            State = State_t::StartRead;
+            break;
+        }
 
-        if (TempUnit == TempUnit_t::TempUnitCentegrade)
+        case State_t::StartRead:
         {
-            LastReading = Device.getTempC();
+            if (!Bus.reset ())
+            {
+                Response = ReadFailed ();
+                break;
+            }
+            Command[0] = DS18B20_CMD_MATCH_ROM;
+            memcpy (&Command[1], Address, sizeof (Address));
+            Command[9] = DS18B20_CMD_READ_SCRATCHPAD;
+            CommandLength = 10;
+            ByteIndex = 0;
+            State = State_t::SendReadCommand;
+            break;
         }
-        else
+
+        case State_t::SendReadCommand:
         {
-            LastReading = Device.getTempF();
+            Bus.write (Command[ByteIndex++]);
+            if (ByteIndex == CommandLength)
+            {
+                ByteIndex = 0;
+                State = State_t::ReadScratchpad;
+            }
+            break;
         }
 
-    } while(false);
+        case State_t::ReadScratchpad:
+        {
+            Scratchpad[ByteIndex++] = Bus.read ();
+            if (ByteIndex < sizeof (Scratchpad))
+            {
+                break;
+            }
+
+            if (Scratchpad[8] != OneWire::crc8 (Scratchpad, 8))
+            {
+                Response = ReadFailed ();
+                break;
+            }
+
+            int16_t Raw = int16_t ((uint16_t (Scratchpad[1]) << 8) | Scratchpad[0]);
+            if (DS18S20_FAMILY == Address[0])
+            {
+                // 9 bit reading, extended with the count remain
+                Raw = Raw * 8;
+                if (0x10 == Scratchpad[7])
+                {
+                    Raw = (Raw & 0xFFF0) + 12 - Scratchpad[6];
+                }
+            }
+            else
+            {
+                // the low bits are undefined below 12 bit resolution
+                Raw &= ~((1 << (3 - ((Scratchpad[4] >> 5) & 0x03))) - 1);
+            }
+            LastReading = float (Raw) / 16.0;
+
+            // start the next conversion one read period after this one started
+            State = State_t::StartConversion;
+            int32_t TimeLeft = int32_t (SENSOR_DS18B20_READ_PERIOD_MS - (millis () - ConversionStartMs));
+            Response = (0 < TimeLeft) ? uint32_t (TimeLeft) : 0;
+            break;
+        }
+
+        default:
+        {
+            State = State_t::StartConversion;
+            break;
+        }
+    } // switch (State)
 
     // pDEBUG_END;
-} // Poll
+    return Response;
+} // RunState
+
+//-----------------------------------------------------------------------------
+uint32_t c_SensorDS18B20::ReadFailed ()
+{
+    // DEBUG_V("No presence pulse or bad CRC");
+
+    ++ReadErrors;
+    State = State_t::StartConversion;
+    return SENSOR_DS18B20_READ_PERIOD_MS;
+
+} // ReadFailed
 
 c_SensorDS18B20 SensorDS18B20;
 
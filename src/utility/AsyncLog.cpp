@@ -0,0 +1,374 @@
+/*
+* AsyncLog.cpp - Ring buffered console log
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/AsyncLog.hpp"
+#include "network/NetworkMgr.hpp"
+
+#ifdef ARDUINO_ARCH_ESP32
+#   include "RtConfig.hpp"
+#   include "utility/CpuLoad.hpp"
+#else
+#   include "utility/TimerWheel.hpp"
+#   define ASYNC_LOG_UART_FIFO_SIZE 128
+#endif // def ARDUINO_ARCH_ESP32
+
+static_assert (0 == (ASYNC_LOG_BUFFER_SIZE & (ASYNC_LOG_BUFFER_SIZE - 1)), "the free running positions need a power of two");
+static_assert (ASYNC_LOG_MAX_LINE <= 255, "the line length is stored in a byte");
+static_assert (ASYNC_LOG_BUFFER_SIZE > (ASYNC_LOG_MAX_LINE * 2), "the ring must hold a few lines");
+
+#define SYSLOG_FACILITY_LOCAL0  16
+
+// syslog severity of each log level
+static const uint8_t SyslogSeverity[] = { 3, 4, 6, 7 };
+
+uint32_t LogLevel = LOG_LEVEL_INFO;
+
+//----------------------------------------------------------------------------
+void _logcon (uint32_t Level, String & DriverName, const String & Message)
+{
+    AsyncLog.Write (Level, DriverName, Message);
+} // _logcon
+
+//----------------------------------------------------------------------------
+c_AsyncLog::c_AsyncLog ()
+{
+} // c_AsyncLog
+
+//----------------------------------------------------------------------------
+c_AsyncLog::~c_AsyncLog ()
+{
+} // ~c_AsyncLog
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::Begin ()
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (Started)
+        {
+            break;
+        }
+
+        // write out whatever the boot left behind before handing over
+        Flush ();
+
+#ifdef ARDUINO_ARCH_ESP32
+        DrainLock = xSemaphoreCreateMutex ();
+        xTaskCreatePinnedToCore (DrainTask, "LogTask", RT_LOG_TASK_STACK, this, RT_LOG_TASK_PRIORITY, &DrainTaskHandle, RT_LOG_TASK_CORE);
+        CpuLoad.AddTask (DrainTaskHandle);
+#else
+        TimerWheel.Add (F ("Log"), DrainJob, this, ASYNC_LOG_POLL_MS, 2000);
+#endif // def ARDUINO_ARCH_ESP32
+
+        Started = true;
+
+    } while (false);
+
+    // DEBUG_END;
+} // Begin
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::CopyIn (uint32_t Position, const void * pData, uint32_t Length)
+{
+    uint32_t Offset = Position % ASYNC_LOG_BUFFER_SIZE;
+    uint32_t FirstPart = min (Length, uint32_t (ASYNC_LOG_BUFFER_SIZE - Offset));
+    memcpy (&Buffer[Offset], pData, FirstPart);
+    memcpy (&Buffer[0], ((const uint8_t *)pData) + FirstPart, Length - FirstPart);
+} // CopyIn
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::CopyOut (uint32_t Position, void * pData, uint32_t Length)
+{
+    uint32_t Offset = Position % ASYNC_LOG_BUFFER_SIZE;
+    uint32_t FirstPart = min (Length, uint32_t (ASYNC_LOG_BUFFER_SIZE - Offset));
+    memcpy (pData, &Buffer[Offset], FirstPart);
+    memcpy (((uint8_t *)pData) + FirstPart, &Buffer[0], Length - FirstPart);
+} // CopyOut
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::Write (uint32_t Level, const String & DriverName, const String & Message)
+{
+    // DEBUG_START;
+
+    char Prefix[24];
+    uint32_t PrefixLength = min (uint32_t (snprintf (Prefix, sizeof (Prefix), "[%6s] ", DriverName.c_str ())), uint32_t (sizeof (Prefix) - 1));
+    uint32_t MessageLength = min (uint32_t (Message.length ()), uint32_t (ASYNC_LOG_MAX_LINE - PrefixLength));
+
+    Header_t Header;
+    Header.Level  = uint8_t (min (Level, uint32_t (LOG_LEVEL_DEBUG)));
+    Header.Length = uint8_t (PrefixLength + MessageLength);
+    uint32_t RecordLength = sizeof (Header) + Header.Length;
+
+    bool Queued = false;
+#ifdef ARDUINO_ARCH_ESP32
+    portENTER_CRITICAL (&WriteLock);
+#endif // def ARDUINO_ARCH_ESP32
+    uint32_t Position = Head;
+    if (RecordLength <= (ASYNC_LOG_BUFFER_SIZE - (Position - Tail)))
+    {
+        CopyIn (Position, &Header, sizeof (Header));
+        Position += sizeof (Header);
+        CopyIn (Position, Prefix, PrefixLength);
+        Position += PrefixLength;
+        CopyIn (Position, Message.c_str (), MessageLength);
+        Position += MessageLength;
+        // the drain must not see the line before all of it is in place
+        __sync_synchronize ();
+        Head = Position;
+        ++Lines;
+        Queued = true;
+    }
+    else
+    {
+        ++Dropped;
+    }
+#ifdef ARDUINO_ARCH_ESP32
+    portEXIT_CRITICAL (&WriteLock);
+#endif // def ARDUINO_ARCH_ESP32
+
+    if (!Started)
+    {
+        Flush ();
+    }
+#ifdef ARDUINO_ARCH_ESP32
+    else if (Queued && DrainTaskHandle)
+    {
+        xTaskNotifyGive (DrainTaskHandle);
+    }
+#else
+    (void)Queued;
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+} // Write
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::LockDrain ()
+{
+#ifdef ARDUINO_ARCH_ESP32
+    if (DrainLock)
+    {
+        xSemaphoreTake (DrainLock, portMAX_DELAY);
+    }
+#endif // def ARDUINO_ARCH_ESP32
+} // LockDrain
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::UnlockDrain ()
+{
+#ifdef ARDUINO_ARCH_ESP32
+    if (DrainLock)
+    {
+        xSemaphoreGive (DrainLock);
+    }
+#endif // def ARDUINO_ARCH_ESP32
+} // UnlockDrain
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::Drain (bool MayBlock)
+{
+    // DEBUG_START;
+
+    char Line[ASYNC_LOG_MAX_LINE + 1];
+
+    while (Tail != Head)
+    {
+        Header_t Header;
+        CopyOut (Tail, &Header, sizeof (Header));
+
+#ifdef ARDUINO_ARCH_ESP8266
+        // the job must not wait for the UART. A line longer than the FIFO waits for it to empty
+        if (!MayBlock && ConsoleUartIsActive &&
+            (uint32_t (LOG_PORT.availableForWrite ()) < min (uint32_t (Header.Length + 2), uint32_t (ASYNC_LOG_UART_FIFO_SIZE))))
+        {
+            break;
+        }
+#else
+        (void)MayBlock;
+#endif // def ARDUINO_ARCH_ESP8266
+
+        CopyOut (Tail + sizeof (Header), Line, Header.Length);
+        Line[Header.Length] = '\0';
+        // free the space before the slow part
+        Tail = Tail + sizeof (Header) + Header.Length;
+
+        Send (Header.Level, Line, Header.Length);
+    }
+
+    uint32_t CurrentDropped = Dropped;
+    if (CurrentDropped != ReportedDropped)
+    {
+        uint32_t Length = snprintf (Line, sizeof (Line), "[   Log] %u lines dropped", unsigned (CurrentDropped - ReportedDropped));
+        ReportedDropped = CurrentDropped;
+        Send (LOG_LEVEL_WARNING, Line, min (Length, uint32_t (sizeof (Line) - 1)));
+    }
+
+    // DEBUG_END;
+} // Drain
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::Send (uint32_t Level, const char * pLine, uint32_t Length)
+{
+    // DEBUG_START;
+
+    if (ConsoleUartIsActive)
+    {
+        LOG_PORT.write (pLine, Length);
+        LOG_PORT.println ();
+    }
+
+    if (SyslogEnabled && NetworkMgr.IsConnected ())
+    {
+        String Hostname;
+        NetworkMgr.GetHostname (Hostname);
+
+        // RFC 3164: <PRI>HOSTNAME TAG: MSG
+        char Packet[ASYNC_LOG_MAX_LINE + 100];
+        uint32_t PacketLength = snprintf (Packet, sizeof (Packet), "<%u>%s %s: %.*s",
+                                          unsigned ((SYSLOG_FACILITY_LOCAL0 << 3) | SyslogSeverity[Level]),
+                                          Hostname.c_str (), CN_ESPixelStick, int (Length), pLine);
+        SyslogUdp.writeTo ((uint8_t *)Packet, min (PacketLength, uint32_t (sizeof (Packet) - 1)), SyslogServer, SyslogPort);
+    }
+
+    // DEBUG_END;
+} // Send
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::Flush ()
+{
+    // DEBUG_START;
+
+    LockDrain ();
+    Drain (true);
+    if (ConsoleUartIsActive)
+    {
+        LOG_PORT.flush ();
+    }
+    UnlockDrain ();
+
+    // DEBUG_END;
+} // Flush
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::StopConsole ()
+{
+    // DEBUG_START;
+
+    // nothing may be written to the UART once an output owns its pins
+    LockDrain ();
+    Drain (true);
+    LOG_PORT.flush ();
+    ConsoleUartIsActive = false;
+    UnlockDrain ();
+
+    // DEBUG_END;
+} // StopConsole
+
+#ifdef ARDUINO_ARCH_ESP32
+//----------------------------------------------------------------------------
+void c_AsyncLog::DrainTask (void * pContext)
+{
+    c_AsyncLog * pAsyncLog = (c_AsyncLog *)pContext;
+
+    while (1)
+    {
+        // every queued line gives a notification
+        ulTaskNotifyTake (pdTRUE, portMAX_DELAY);
+        pAsyncLog->LockDrain ();
+        pAsyncLog->Drain (true);
+        pAsyncLog->UnlockDrain ();
+    }
+} // DrainTask
+#endif // def ARDUINO_ARCH_ESP32
+
+//----------------------------------------------------------------------------
+uint32_t c_AsyncLog::DrainJob (void * pContext)
+{
+    ((c_AsyncLog *)pContext)->Drain (false);
+    return ASYNC_LOG_POLL_MS;
+} // DrainJob
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::GetConfig (JsonObject & json)
+{
+    // DEBUG_START;
+
+    JsonObject LogConfig = json[(char*)CN_log].to<JsonObject> ();
+
+    JsonWrite (LogConfig, CN_level,  LogLevel);
+    JsonWrite (LogConfig, CN_syslog, SyslogEnabled ? SyslogServer.toString () : String ());
+    JsonWrite (LogConfig, CN_port,   SyslogPort);
+
+    // DEBUG_END;
+} // GetConfig
+
+//----------------------------------------------------------------------------
+bool c_AsyncLog::SetConfig (JsonObject & json)
+{
+    // DEBUG_START;
+
+    bool ConfigChanged = false;
+
+    do // once
+    {
+        JsonObject LogConfig = json[(char*)CN_log];
+        if (!LogConfig)
+        {
+            logcon (F ("No Log settings found."));
+            // write the defaults out
+            ConfigChanged = true;
+            break;
+        }
+
+        uint32_t NewLevel = LogLevel;
+        ConfigChanged |= setFromJSON (NewLevel, LogConfig, CN_level);
+        LogLevel = min (NewLevel, uint32_t (LOG_LEVEL_DEBUG));
+
+        ConfigChanged |= setFromJSON (SyslogPort, LogConfig, CN_port);
+
+        String Server = SyslogEnabled ? SyslogServer.toString () : String ();
+        ConfigChanged |= setFromJSON (Server, LogConfig, CN_syslog);
+        // an empty or invalid address turns syslog off
+        SyslogEnabled = (0 != Server.length ()) && SyslogServer.fromString (Server) && (0 != uint32_t (SyslogServer));
+
+    } while (false);
+
+    // DEBUG_END;
+
+    return ConfigChanged;
+
+} // SetConfig
+
+//----------------------------------------------------------------------------
+void c_AsyncLog::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    JsonObject jsonLog = jsonStatus[(char*)CN_log].to<JsonObject> ();
+    JsonWrite (jsonLog, F ("lines"),   Lines);
+    JsonWrite (jsonLog, F ("dropped"), uint32_t (Dropped));
+    JsonWrite (jsonLog, F ("queued"),  uint32_t (Head - Tail));
+
+    // DEBUG_END;
+} // GetStatus
+
+c_AsyncLog AsyncLog;
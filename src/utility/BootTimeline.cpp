@@ -0,0 +1,85 @@
+/*
+* BootTimeline.cpp - Time from reset to each step of the start up
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/BootTimeline.hpp"
+
+//----------------------------------------------------------------------------
+c_BootTimeline::c_BootTimeline ()
+{
+} // c_BootTimeline
+
+//----------------------------------------------------------------------------
+c_BootTimeline::~c_BootTimeline ()
+{
+} // ~c_BootTimeline
+
+//----------------------------------------------------------------------------
+void c_BootTimeline::Mark (const __FlashStringHelper * Phase)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        uint32_t Now = millis ();
+        String PhaseName (Phase);
+
+        bool AlreadyMarked = false;
+        for (uint32_t index = 0; index < NumPhases; ++index)
+        {
+            if (PhaseName.equals (String (Phases[index].Name)))
+            {
+                AlreadyMarked = true;
+                break;
+            }
+        }
+
+        if (AlreadyMarked || (BOOT_TIMELINE_MAX_PHASES <= NumPhases))
+        {
+            break;
+        }
+
+        uint32_t PreviousMs = NumPhases ? Phases[NumPhases - 1].TimeMs : 0;
+        Phases[NumPhases].Name   = Phase;
+        Phases[NumPhases].TimeMs = Now;
+        ++NumPhases;
+
+        logcon (PhaseName + F (": ") + String (Now) + F (" ms after reset (+") + String (Now - PreviousMs) + F (" ms)"));
+
+    } while (false);
+
+    // DEBUG_END;
+} // Mark
+
+//----------------------------------------------------------------------------
+void c_BootTimeline::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    // ms since reset
+    JsonObject jsonBoot = jsonStatus[F ("boot")].to<JsonObject> ();
+    for (uint32_t index = 0; index < NumPhases; ++index)
+    {
+        jsonBoot[String (Phases[index].Name)] = Phases[index].TimeMs;
+    }
+
+    // DEBUG_END;
+} // GetStatus
+
+c_BootTimeline BootTimeline;
@@ -0,0 +1,173 @@
+/*
+* ConfigSnapshot.cpp - Binary copies of the JSON config files for a fast boot
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/ConfigSnapshot.hpp"
+#include "utility/SpiRam.hpp"
+
+//----------------------------------------------------------------------------
+c_ConfigSnapshot::c_ConfigSnapshot ()
+{
+} // c_ConfigSnapshot
+
+//----------------------------------------------------------------------------
+c_ConfigSnapshot::~c_ConfigSnapshot ()
+{
+} // ~c_ConfigSnapshot
+
+//----------------------------------------------------------------------------
+String c_ConfigSnapshot::GetFileName (const String & JsonFileName)
+{
+    // "/config.json" -> "/config.snap"
+    return JsonFileName.substring (0, JsonFileName.length () - 5) + F (".snap");
+
+} // GetFileName
+
+//----------------------------------------------------------------------------
+uint32_t c_ConfigSnapshot::Checksum (const uint8_t * pData, size_t Length)
+{
+    // FNV-1a
+    uint32_t Response = 2166136261;
+    while (Length--)
+    {
+        Response = (Response ^ *pData++) * 16777619;
+    }
+    return Response;
+
+} // Checksum
+
+//----------------------------------------------------------------------------
+uint8_t * c_ConfigSnapshot::Encode (JsonDocument & Doc, uint32_t JsonFileSize, uint32_t JsonFileTime, size_t & Length)
+{
+    // DEBUG_START;
+
+    uint8_t * Response = nullptr;
+    Length = 0;
+
+    do // once
+    {
+        size_t PayloadSize = measureMsgPack (Doc);
+        Response = (uint8_t *)SpiRam.Malloc (sizeof (Header_t) + PayloadSize);
+        if (nullptr == Response)
+        {
+            logwarn (F ("Not enough memory to make a config snapshot"));
+            break;
+        }
+
+        uint8_t * pPayload = &Response[sizeof (Header_t)];
+        PayloadSize = serializeMsgPack (Doc, pPayload, PayloadSize);
+
+        Header_t Header;
+        Header.Signature    = CONFIG_SNAPSHOT_SIGNATURE;
+        Header.Version      = CONFIG_SNAPSHOT_VERSION;
+        Header.HeaderSize   = sizeof (Header_t);
+        Header.JsonFileSize = JsonFileSize;
+        Header.JsonFileTime = JsonFileTime;
+        Header.PayloadSize  = PayloadSize;
+        Header.Checksum     = Checksum (pPayload, PayloadSize);
+        memcpy (Response, &Header, sizeof (Header));
+
+        Length = sizeof (Header_t) + PayloadSize;
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // Encode
+
+//----------------------------------------------------------------------------
+bool c_ConfigSnapshot::Decode (const uint8_t * pData, size_t Length, uint32_t JsonFileSize, uint32_t JsonFileTime, JsonDocument & Doc)
+{
+    // DEBUG_START;
+
+    bool Response = false;
+
+    do // once
+    {
+        Header_t Header;
+        if (Length < sizeof (Header))
+        {
+            break;
+        }
+        memcpy (&Header, pData, sizeof (Header));
+
+        // an old format or a JSON file that was changed behind our back
+        if ((CONFIG_SNAPSHOT_SIGNATURE != Header.Signature)     ||
+            (CONFIG_SNAPSHOT_VERSION   != Header.Version)       ||
+            (sizeof (Header_t)         != Header.HeaderSize)    ||
+            (JsonFileSize              != Header.JsonFileSize)  ||
+            (JsonFileTime              != Header.JsonFileTime))
+        {
+            break;
+        }
+
+        const uint8_t * pPayload = &pData[sizeof (Header_t)];
+        if (((Length - sizeof (Header_t)) != Header.PayloadSize) ||
+            (Checksum (pPayload, Header.PayloadSize) != Header.Checksum))
+        {
+            logwarn (F ("Config snapshot is damaged. Using the JSON file."));
+            break;
+        }
+
+        DeserializationError error = deserializeMsgPack (Doc, pPayload, Header.PayloadSize);
+        if (error)
+        {
+            logwarn (String (F ("Could not decode the config snapshot: ")) + error.c_str ());
+            break;
+        }
+
+        Response = true;
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // Decode
+
+//----------------------------------------------------------------------------
+void c_ConfigSnapshot::CountLoad (bool FromSnapshot, uint32_t DurationUs)
+{
+    if (FromSnapshot)
+    {
+        ++SnapshotLoads;
+    }
+    else
+    {
+        ++JsonLoads;
+    }
+    LoadDurationUs += DurationUs;
+
+} // CountLoad
+
+//----------------------------------------------------------------------------
+void c_ConfigSnapshot::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    JsonObject jsonLoad = jsonStatus[F ("configload")].to<JsonObject> ();
+    JsonWrite (jsonLoad, F ("snapshot"), SnapshotLoads);
+    JsonWrite (jsonLoad, F ("json"),     JsonLoads);
+    JsonWrite (jsonLoad, F ("us"),       LoadDurationUs);
+
+    // DEBUG_END;
+} // GetStatus
+
+c_ConfigSnapshot ConfigSnapshot;
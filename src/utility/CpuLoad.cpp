@@ -0,0 +1,283 @@
+/*
+* CpuLoad.cpp - Per core idle time sampler
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/CpuLoad.hpp"
+
+#ifdef ARDUINO_ARCH_ESP32
+#   include <esp_freertos_hooks.h>
+
+//----------------------------------------------------------------------------
+static void IRAM_ATTR CpuLoad_TickCore0 ()
+{
+    CpuLoad.ISR_Tick (0);
+} // CpuLoad_TickCore0
+
+//----------------------------------------------------------------------------
+static void IRAM_ATTR CpuLoad_TickCore1 ()
+{
+    CpuLoad.ISR_Tick (1);
+} // CpuLoad_TickCore1
+
+static esp_freertos_tick_cb_t const TickHooks[CPU_LOAD_MAX_CORES] = { CpuLoad_TickCore0, CpuLoad_TickCore1 };
+
+// tasks that are not ours but share the cores with the real time tasks
+static const char * const SystemTaskNames[] =
+{
+    "loopTask",
+    "wifi",
+    "tiT",
+    "async_tcp",
+};
+#endif // def ARDUINO_ARCH_ESP32
+
+//----------------------------------------------------------------------------
+c_CpuLoad::c_CpuLoad ()
+{
+    memset ((void*)IdleTicks,  0x00, sizeof (IdleTicks));
+    memset ((void*)TotalTicks, 0x00, sizeof (TotalTicks));
+    memset ((void*)&Reported,  0x00, sizeof (Reported));
+#ifdef ARDUINO_ARCH_ESP32
+    memset ((void*)Tasks,      0x00, sizeof (Tasks));
+#endif // def ARDUINO_ARCH_ESP32
+
+} // c_CpuLoad
+
+//----------------------------------------------------------------------------
+c_CpuLoad::~c_CpuLoad ()
+{
+} // ~c_CpuLoad
+
+//----------------------------------------------------------------------------
+void c_CpuLoad::Begin ()
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    do // once
+    {
+        if (NumCores)
+        {
+            // already sampling
+            break;
+        }
+
+        uint32_t NumCoresToSample = min (uint32_t (portNUM_PROCESSORS), uint32_t (CPU_LOAD_MAX_CORES));
+        for (uint32_t Core = 0; Core < NumCoresToSample; ++Core)
+        {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+            IdleTaskHandle[Core] = xTaskGetIdleTaskHandleForCore (Core);
+#else
+            IdleTaskHandle[Core] = xTaskGetIdleTaskHandleForCPU (Core);
+#endif // ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+        }
+
+        for (uint32_t Core = 0; Core < NumCoresToSample; ++Core)
+        {
+            if (ESP_OK != esp_register_freertos_tick_hook_for_cpu (TickHooks[Core], Core))
+            {
+                logcon (String (F ("Could not register the tick hook for core ")) + String (Core));
+                break;
+            }
+            NumCores = Core + 1;
+        }
+
+    } while (false);
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+} // Begin
+
+//----------------------------------------------------------------------------
+void c_CpuLoad::GetSample (Sample_t & Sample)
+{
+    // DEBUG_START;
+
+    for (uint32_t Core = 0; Core < CPU_LOAD_MAX_CORES; ++Core)
+    {
+        Sample.IdleTicks[Core]  = IdleTicks[Core];
+        Sample.TotalTicks[Core] = TotalTicks[Core];
+    }
+
+    // DEBUG_END;
+} // GetSample
+
+//----------------------------------------------------------------------------
+void c_CpuLoad::GetStatus (JsonArray & jsonIdle, const Sample_t & Start, const Sample_t & End)
+{
+    // DEBUG_START;
+
+    // idle percentage per core. A core that saw no ticks is left out
+    for (uint32_t Core = 0; Core < NumCores; ++Core)
+    {
+        uint32_t Ticks = End.TotalTicks[Core] - Start.TotalTicks[Core];
+        if (Ticks)
+        {
+            uint32_t Idle = End.IdleTicks[Core] - Start.IdleTicks[Core];
+            jsonIdle.add (uint32_t ((uint64_t (Idle) * 100) / Ticks));
+        }
+    }
+
+    // DEBUG_END;
+} // GetStatus
+
+//----------------------------------------------------------------------------
+void c_CpuLoad::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (0 == NumCores)
+        {
+            // not sampling
+            break;
+        }
+
+        Sample_t Now;
+        GetSample (Now);
+
+        JsonObject jsonCpu = jsonStatus[F ("cpu")].to<JsonObject> ();
+        JsonArray jsonIdle = jsonCpu[F ("idle")].to<JsonArray> ();
+        GetStatus (jsonIdle, Reported, Now);
+
+#ifdef ARDUINO_ARCH_ESP32
+        FindSystemTasks ();
+
+        // every core sees the same ticks. Task time is a percentage of one core
+        uint32_t ElapsedTicks = Now.TotalTicks[0] - Reported.TotalTicks[0];
+        JsonArray jsonTasks = jsonCpu[F ("tasks")].to<JsonArray> ();
+        for (auto & CurrentTask : Tasks)
+        {
+            TaskHandle_t Handle = CurrentTask.Handle;
+            if (nullptr == Handle)
+            {
+                continue;
+            }
+
+            uint32_t Ticks = CurrentTask.Ticks;
+            BaseType_t Core = xTaskGetAffinity (Handle);
+
+            JsonObject jsonTask = jsonTasks.add<JsonObject> ();
+            JsonWrite (jsonTask, F ("name"),      pcTaskGetName (Handle));
+            JsonWrite (jsonTask, F ("core"),      int32_t ((Core < portNUM_PROCESSORS) ? Core : -1));
+            JsonWrite (jsonTask, F ("priority"),  uint32_t (uxTaskPriorityGet (Handle)));
+            JsonWrite (jsonTask, F ("stackfree"), uint32_t (uxTaskGetStackHighWaterMark (Handle)));
+            if (ElapsedTicks)
+            {
+                JsonWrite (jsonTask, F ("cpu"), uint32_t ((uint64_t (Ticks - CurrentTask.ReportedTicks) * 100) / ElapsedTicks));
+            }
+            CurrentTask.ReportedTicks = Ticks;
+        }
+#endif // def ARDUINO_ARCH_ESP32
+
+        Reported = Now;
+
+    } while (false);
+
+    // DEBUG_END;
+} // GetStatus
+
+#ifdef ARDUINO_ARCH_ESP32
+//----------------------------------------------------------------------------
+void c_CpuLoad::AddTask (TaskHandle_t Handle)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (nullptr == Handle)
+        {
+            break;
+        }
+
+        Task_t * pFreeEntry = nullptr;
+        bool Found = false;
+        for (auto & CurrentTask : Tasks)
+        {
+            if (CurrentTask.Handle == Handle)
+            {
+                Found = true;
+                break;
+            }
+            if (!pFreeEntry && (nullptr == CurrentTask.Handle))
+            {
+                pFreeEntry = &CurrentTask;
+            }
+        }
+
+        if (Found)
+        {
+            break;
+        }
+
+        if (nullptr == pFreeEntry)
+        {
+            logcon (String (F ("No room to track task ")) + pcTaskGetName (Handle));
+            break;
+        }
+
+        pFreeEntry->Ticks         = 0;
+        pFreeEntry->ReportedTicks = 0;
+        // the tick hook only looks at entries with a handle. Set it last
+        pFreeEntry->Handle        = Handle;
+
+    } while (false);
+
+    // DEBUG_END;
+} // AddTask
+
+//----------------------------------------------------------------------------
+void c_CpuLoad::RemoveTask (TaskHandle_t Handle)
+{
+    // DEBUG_START;
+
+    for (auto & CurrentTask : Tasks)
+    {
+        if (CurrentTask.Handle == Handle)
+        {
+            CurrentTask.Handle = nullptr;
+        }
+    }
+
+    // DEBUG_END;
+} // RemoveTask
+
+//----------------------------------------------------------------------------
+void c_CpuLoad::FindSystemTasks ()
+{
+    // DEBUG_START;
+
+#if INCLUDE_xTaskGetHandle
+    // WiFi and the web server start their tasks late. Keep looking
+    for (auto CurrentName : SystemTaskNames)
+    {
+        TaskHandle_t Handle = xTaskGetHandle (CurrentName);
+        if (Handle)
+        {
+            AddTask (Handle);
+        }
+    }
+#endif // INCLUDE_xTaskGetHandle
+
+    // DEBUG_END;
+} // FindSystemTasks
+#endif // def ARDUINO_ARCH_ESP32
+
+c_CpuLoad CpuLoad;
@@ -0,0 +1,101 @@
+/*
+* DebugCounters.cpp - Registry of named debug counters and gauges
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/DebugCounters.hpp"
+
+// zero initialized before any constructor runs so registration order does not matter
+c_DebugCounter * c_DebugCounter::pFirst = nullptr;
+
+//----------------------------------------------------------------------------
+c_DebugCounter::c_DebugCounter (const char * _Name, CounterType_t _Type, uint32_t _NumInstances, uint32_t * _pValues)
+{
+    // DEBUG_START;
+
+    Name         = _Name;
+    Type         = _Type;
+    NumInstances = _NumInstances;
+    pValues      = _pValues;
+
+    // add ourselves to the registry
+    pNext  = pFirst;
+    pFirst = this;
+
+    // DEBUG_END;
+} // c_DebugCounter
+
+//----------------------------------------------------------------------------
+uint32_t c_DebugCounter::Get (uint32_t Instance)
+{
+    // DEBUG_START;
+
+    uint32_t Response = pValues[Instance * DEBUG_COUNTER_NUM_CORES];
+
+    if (Counter == Type)
+    {
+        for (uint32_t CoreId = 1; CoreId < DEBUG_COUNTER_NUM_CORES; ++CoreId)
+        {
+            Response += pValues[(Instance * DEBUG_COUNTER_NUM_CORES) + CoreId];
+        }
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // Get
+
+//----------------------------------------------------------------------------
+void c_DebugCounter::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    JsonWrite(jsonStatus, F ("level"), DEBUG_COUNTER_LEVEL);
+    JsonObject jsonCounters = jsonStatus[F ("counters")].to<JsonObject> ();
+
+    for (c_DebugCounter * pCurrent = pFirst; nullptr != pCurrent; pCurrent = pCurrent->pNext)
+    {
+        // only report up to the highest instance that has been used
+        uint32_t NumInstancesInUse = pCurrent->NumInstances;
+        while (NumInstancesInUse && (0 == pCurrent->Get (NumInstancesInUse - 1)))
+        {
+            --NumInstancesInUse;
+        }
+
+        JsonArray jsonValues = jsonCounters[pCurrent->Name].to<JsonArray> ();
+        for (uint32_t Instance = 0; Instance < NumInstancesInUse; ++Instance)
+        {
+            jsonValues.add (pCurrent->Get (Instance));
+        }
+    }
+
+    // DEBUG_END;
+} // GetStatus
+
+//----------------------------------------------------------------------------
+void c_DebugCounter::ClearAll ()
+{
+    // DEBUG_START;
+
+    for (c_DebugCounter * pCurrent = pFirst; nullptr != pCurrent; pCurrent = pCurrent->pNext)
+    {
+        memset ((void*)pCurrent->pValues, 0x00, pCurrent->NumInstances * DEBUG_COUNTER_NUM_CORES * sizeof (uint32_t));
+    }
+
+    // DEBUG_END;
+} // ClearAll
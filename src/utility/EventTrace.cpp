@@ -0,0 +1,393 @@
+/*
+* EventTrace.cpp - Ring buffer of timestamped trace events
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/EventTrace.hpp"
+
+static_assert (0 == (EVENT_TRACE_NUM_ENTRIES & (EVENT_TRACE_NUM_ENTRIES - 1)), "EVENT_TRACE_NUM_ENTRIES must be a power of two");
+
+// Chrome trace process ids used to group the events
+#define TRACE_PID_OUTPUTS   1
+#define TRACE_PID_INPUTS    2
+#define TRACE_PID_SERVICES  3
+
+#define TRACE_TID_SD        0
+#define TRACE_TID_MULTISYNC 1
+
+#define TRACE_MAX_IDS       32
+
+struct TraceEventDefinition_t
+{
+    const char * Name;
+    char         Phase;         ///< Chrome trace phase. i = instant, B = begin, E = end
+    uint8_t      Pid;
+    int8_t       Tid;           ///< -1 = use the entry Id
+    const char * Arg16Name;     ///< nullptr if unused
+    const char * Arg32Name;     ///< nullptr if unused
+    bool         Arg32IsSigned;
+};
+
+static const TraceEventDefinition_t TraceEventDefinitions[c_EventTrace::NumTraceEventTypes] =
+{
+    {"packet",       'i', TRACE_PID_INPUTS,   -1,                  "universe", "offset",    false},
+    {"channel data", 'i', TRACE_PID_OUTPUTS,  -1,                  "count",    "start",     false},
+    {"frame",        'B', TRACE_PID_OUTPUTS,  -1,                  nullptr,    nullptr,     false},
+    {"refill",       'i', TRACE_PID_OUTPUTS,  -1,                  nullptr,    "slackUs",   true },
+    {"frame",        'E', TRACE_PID_OUTPUTS,  -1,                  nullptr,    nullptr,     false},
+    {"sd read",      'B', TRACE_PID_SERVICES, TRACE_TID_SD,        nullptr,    "bytes",     false},
+    {"sd read",      'E', TRACE_PID_SERVICES, TRACE_TID_SD,        nullptr,    "bytes",     false},
+    {"multisync",    'i', TRACE_PID_SERVICES, TRACE_TID_MULTISYNC, "action",   "elapsedMs", false},
+};
+
+// metadata records emitted after the events: 3 process names, then the output and input threads, then the service threads
+#define TRACE_METADATA_FIRST_OUTPUT     3
+#define TRACE_METADATA_FIRST_INPUT      (TRACE_METADATA_FIRST_OUTPUT + TRACE_MAX_IDS)
+#define TRACE_METADATA_FIRST_SERVICE    (TRACE_METADATA_FIRST_INPUT + TRACE_MAX_IDS)
+#define TRACE_METADATA_COUNT            (TRACE_METADATA_FIRST_SERVICE + 2)
+
+//----------------------------------------------------------------------------
+c_EventTrace::c_EventTrace ()
+{
+    // DEBUG_START;
+    // DEBUG_END;
+} // c_EventTrace
+
+//----------------------------------------------------------------------------
+c_EventTrace::~c_EventTrace ()
+{
+    // DEBUG_START;
+
+    Enabled = false;
+    if (pEntries)
+    {
+        free (pEntries);
+        pEntries = nullptr;
+    }
+
+    // DEBUG_END;
+} // ~c_EventTrace
+
+//----------------------------------------------------------------------------
+void c_EventTrace::SetEnabled (bool NewState)
+{
+    // DEBUG_START;
+
+    do // once
+    {
+        if (!NewState)
+        {
+            Enabled = false;
+            break;
+        }
+
+        if (nullptr == pEntries)
+        {
+            // allocated once and kept. An ISR may still be writing to it.
+            pEntries = (TraceEntry_t *)malloc (sizeof (TraceEntry_t) * EVENT_TRACE_NUM_ENTRIES);
+            if (nullptr == pEntries)
+            {
+                logcon (F ("Could not allocate the trace buffer"));
+                break;
+            }
+            memset ((void*)pEntries, 0x00, sizeof (TraceEntry_t) * EVENT_TRACE_NUM_ENTRIES);
+            WriteIndex = 0;
+        }
+
+        if (ExportIdle == ExportState)
+        {
+            Enabled = true;
+        }
+        else
+        {
+            // turn it back on once the download has finished
+            EnabledBeforeExport = true;
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+} // SetEnabled
+
+//----------------------------------------------------------------------------
+void c_EventTrace::Clear ()
+{
+    // DEBUG_START;
+
+    WriteIndex = 0;
+
+    // DEBUG_END;
+} // Clear
+
+//----------------------------------------------------------------------------
+void c_EventTrace::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    uint32_t CurrentWriteIndex = WriteIndex;
+
+    JsonWrite(jsonStatus, F ("enabled"),  bool(Enabled || EnabledBeforeExport));
+    JsonWrite(jsonStatus, F ("capacity"), uint32_t(EVENT_TRACE_NUM_ENTRIES));
+    JsonWrite(jsonStatus, F ("entries"),  min(CurrentWriteIndex, uint32_t(EVENT_TRACE_NUM_ENTRIES)));
+    JsonWrite(jsonStatus, F ("total"),    CurrentWriteIndex);
+
+    // DEBUG_END;
+} // GetStatus
+
+//----------------------------------------------------------------------------
+void c_EventTrace::BeginExport ()
+{
+    // DEBUG_START;
+
+    if (ExportIdle == ExportState)
+    {
+        EnabledBeforeExport = Enabled;
+    }
+
+    // stop the writers so the ring does not change under us
+    Enabled = false;
+
+    ExportEnd           = (nullptr == pEntries) ? 0 : WriteIndex;
+    ExportIndex         = (ExportEnd > EVENT_TRACE_NUM_ENTRIES) ? (ExportEnd - EVENT_TRACE_NUM_ENTRIES) : 0;
+    ExportBaseTimeUs    = (ExportIndex < ExportEnd) ? pEntries[ExportIndex & (EVENT_TRACE_NUM_ENTRIES - 1)].TimeUs : 0;
+    ExportOutputsSeen   = 0;
+    ExportInputsSeen    = 0;
+    ExportMetadataIndex = 0;
+    ExportFirstRecord   = true;
+    ExportRecordLen     = 0;
+    ExportRecordOffset  = 0;
+    ExportState         = ExportHeader;
+
+    // DEBUG_END;
+} // BeginExport
+
+//----------------------------------------------------------------------------
+void c_EventTrace::EndExport ()
+{
+    // DEBUG_START;
+
+    if (ExportIdle != ExportState)
+    {
+        ExportState = ExportIdle;
+        Enabled     = EnabledBeforeExport;
+    }
+
+    // DEBUG_END;
+} // EndExport
+
+//----------------------------------------------------------------------------
+size_t c_EventTrace::FormatEntry (char * Buffer, size_t MaxLen, TraceEntry_t & Entry)
+{
+    // DEBUG_START;
+
+    size_t Response = 0;
+
+    do // once
+    {
+        if (Entry.Type >= NumTraceEventTypes)
+        {
+            break;
+        }
+
+        const TraceEventDefinition_t & Definition = TraceEventDefinitions[Entry.Type];
+        uint32_t Tid = (Definition.Tid < 0) ? Entry.Id : uint32_t(Definition.Tid);
+
+        if (Tid < TRACE_MAX_IDS)
+        {
+            if (TRACE_PID_OUTPUTS == Definition.Pid) { ExportOutputsSeen |= (1 << Tid); }
+            if (TRACE_PID_INPUTS  == Definition.Pid) { ExportInputsSeen  |= (1 << Tid); }
+        }
+
+        int Len = snprintf (Buffer, MaxLen, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%u,\"pid\":%u,\"tid\":%u%s",
+                            ExportFirstRecord ? "" : ",\n",
+                            Definition.Name,
+                            Definition.Phase,
+                            unsigned(Entry.TimeUs - ExportBaseTimeUs),
+                            unsigned(Definition.Pid),
+                            unsigned(Tid),
+                            ('i' == Definition.Phase) ? ",\"s\":\"t\"" : "");
+
+        if (Definition.Arg16Name || Definition.Arg32Name)
+        {
+            Len += snprintf (&Buffer[Len], MaxLen - Len, ",\"args\":{");
+            if (Definition.Arg16Name)
+            {
+                Len += snprintf (&Buffer[Len], MaxLen - Len, "\"%s\":%u%s",
+                                 Definition.Arg16Name, unsigned(Entry.Arg16), Definition.Arg32Name ? "," : "");
+            }
+            if (Definition.Arg32Name)
+            {
+                if (Definition.Arg32IsSigned)
+                {
+                    Len += snprintf (&Buffer[Len], MaxLen - Len, "\"%s\":%d", Definition.Arg32Name, int(int32_t(Entry.Arg32)));
+                }
+                else
+                {
+                    Len += snprintf (&Buffer[Len], MaxLen - Len, "\"%s\":%u", Definition.Arg32Name, unsigned(Entry.Arg32));
+                }
+            }
+            Len += snprintf (&Buffer[Len], MaxLen - Len, "}");
+        }
+        Len += snprintf (&Buffer[Len], MaxLen - Len, "}");
+
+        ExportFirstRecord = false;
+        Response = size_t(Len);
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // FormatEntry
+
+//----------------------------------------------------------------------------
+size_t c_EventTrace::FormatNextRecord (char * Buffer, size_t MaxLen)
+{
+    // DEBUG_START;
+
+    static const char * ProcessNames[] = {"Outputs", "Inputs", "Services"};
+    static const char * ServiceNames[] = {"SD", "MultiSync"};
+
+    size_t Response = 0;
+
+    switch (ExportState)
+    {
+        case ExportHeader:
+        {
+            Response = snprintf (Buffer, MaxLen, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+            ExportState = ExportEvents;
+            break;
+        }
+
+        case ExportEvents:
+        {
+            if (ExportIndex >= ExportEnd)
+            {
+                ExportState = ExportMetadata;
+                break;
+            }
+            Response = FormatEntry (Buffer, MaxLen, pEntries[ExportIndex & (EVENT_TRACE_NUM_ENTRIES - 1)]);
+            ++ExportIndex;
+            break;
+        }
+
+        case ExportMetadata:
+        {
+            if (ExportMetadataIndex >= TRACE_METADATA_COUNT)
+            {
+                ExportState = ExportFooter;
+                break;
+            }
+
+            uint32_t Index = ExportMetadataIndex++;
+            const char * Separator = ExportFirstRecord ? "" : ",\n";
+
+            if (Index < TRACE_METADATA_FIRST_OUTPUT)
+            {
+                Response = snprintf (Buffer, MaxLen, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"%s\"}}",
+                                     Separator, unsigned(TRACE_PID_OUTPUTS + Index), ProcessNames[Index]);
+            }
+            else if (Index < TRACE_METADATA_FIRST_INPUT)
+            {
+                uint32_t Tid = Index - TRACE_METADATA_FIRST_OUTPUT;
+                if (ExportOutputsSeen & (1 << Tid))
+                {
+                    Response = snprintf (Buffer, MaxLen, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"Output %u\"}}",
+                                         Separator, unsigned(TRACE_PID_OUTPUTS), unsigned(Tid), unsigned(Tid));
+                }
+            }
+            else if (Index < TRACE_METADATA_FIRST_SERVICE)
+            {
+                uint32_t Tid = Index - TRACE_METADATA_FIRST_INPUT;
+                if (ExportInputsSeen & (1 << Tid))
+                {
+                    Response = snprintf (Buffer, MaxLen, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"Input %u\"}}",
+                                         Separator, unsigned(TRACE_PID_INPUTS), unsigned(Tid), unsigned(Tid));
+                }
+            }
+            else
+            {
+                uint32_t Tid = Index - TRACE_METADATA_FIRST_SERVICE;
+                Response = snprintf (Buffer, MaxLen, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                                     Separator, unsigned(TRACE_PID_SERVICES), unsigned(Tid), ServiceNames[Tid]);
+            }
+
+            if (Response)
+            {
+                ExportFirstRecord = false;
+            }
+            break;
+        }
+
+        case ExportFooter:
+        {
+            Response = snprintf (Buffer, MaxLen, "\n]}\n");
+            ExportState = ExportDone;
+            break;
+        }
+
+        default:
+        {
+            ExportState = ExportDone;
+            break;
+        }
+    } // switch ExportState
+
+    // DEBUG_END;
+    return min (Response, MaxLen - 1);
+
+} // FormatNextRecord
+
+//----------------------------------------------------------------------------
+size_t c_EventTrace::Export (uint8_t * Buffer, size_t MaxLen)
+{
+    // DEBUG_START;
+
+    size_t BytesWritten = 0;
+
+    while (BytesWritten < MaxLen)
+    {
+        if (ExportRecordOffset >= ExportRecordLen)
+        {
+            if ((ExportIdle == ExportState) || (ExportDone == ExportState))
+            {
+                break;
+            }
+            ExportRecordLen    = FormatNextRecord (ExportRecord, sizeof (ExportRecord));
+            ExportRecordOffset = 0;
+            continue;
+        }
+
+        // a record that does not fit is finished on the next call
+        size_t BytesToCopy = min (MaxLen - BytesWritten, size_t(ExportRecordLen - ExportRecordOffset));
+        memcpy (&Buffer[BytesWritten], &ExportRecord[ExportRecordOffset], BytesToCopy);
+        ExportRecordOffset += BytesToCopy;
+        BytesWritten       += BytesToCopy;
+    }
+
+    if (0 == BytesWritten)
+    {
+        EndExport ();
+    }
+
+    // DEBUG_END;
+    return BytesWritten;
+
+} // Export
+
+c_EventTrace EventTrace;
@@ -0,0 +1,137 @@
+/*
+* FrameLatency.cpp - Packet to output frame latency per input channel
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/FrameLatency.hpp"
+#include "input/InputMgr.hpp"
+
+static_assert (FRAME_LATENCY_MAX_INPUTS >= c_InputMgr::e_InputChannelIds::InputChannelId_End, "FRAME_LATENCY_MAX_INPUTS is too small");
+
+//----------------------------------------------------------------------------
+c_FrameLatency::c_FrameLatency ()
+{
+    Clear ();
+} // c_FrameLatency
+
+//----------------------------------------------------------------------------
+c_FrameLatency::~c_FrameLatency ()
+{
+} // ~c_FrameLatency
+
+//----------------------------------------------------------------------------
+void c_FrameLatency::Begin ()
+{
+    // DEBUG_START;
+
+#ifdef LATENCY_GPIO
+    ResetGpio (LATENCY_GPIO);
+    pinMode (LATENCY_GPIO, OUTPUT);
+    digitalWrite (LATENCY_GPIO, LOW);
+#endif // def LATENCY_GPIO
+
+    // DEBUG_END;
+} // Begin
+
+//----------------------------------------------------------------------------
+void c_FrameLatency::Clear ()
+{
+    // DEBUG_START;
+
+    for (auto & CurrentInput : Inputs)
+    {
+        CurrentInput.PendingTimeUs = 0;
+        CurrentInput.Count = 0;
+        CurrentInput.Max = 0;
+        memset (CurrentInput.Buckets, 0x00, sizeof (CurrentInput.Buckets));
+    }
+
+    // DEBUG_END;
+} // Clear
+
+//----------------------------------------------------------------------------
+uint32_t c_FrameLatency::GetBucketUpperEdge (uint32_t Bucket)
+{
+    if (Bucket < (1 << FRAME_LATENCY_SUB_BUCKET_BITS))
+    {
+        return Bucket;
+    }
+    uint32_t Shift = (Bucket >> FRAME_LATENCY_SUB_BUCKET_BITS) - 1;
+    uint32_t SubBucket = Bucket & ((1 << FRAME_LATENCY_SUB_BUCKET_BITS) - 1);
+    return (((1 << FRAME_LATENCY_SUB_BUCKET_BITS) + SubBucket + 1) << Shift) - 1;
+} // GetBucketUpperEdge
+
+//----------------------------------------------------------------------------
+uint32_t c_FrameLatency::GetPercentile (uint32_t InputId, uint32_t Percent)
+{
+    // DEBUG_START;
+
+    uint32_t Response = 0;
+
+    do // once
+    {
+        if (InputId >= FRAME_LATENCY_MAX_INPUTS)
+        {
+            break;
+        }
+
+        Input_t & CurrentInput = Inputs[InputId];
+        if (0 == CurrentInput.Count)
+        {
+            break;
+        }
+
+        // rank of the sample, rounded up
+        uint64_t Rank = ((uint64_t (CurrentInput.Count) * Percent) + 99) / 100;
+        uint64_t Seen = 0;
+        for (uint32_t Bucket = 0; Bucket < FRAME_LATENCY_NUM_BUCKETS; ++Bucket)
+        {
+            Seen += CurrentInput.Buckets[Bucket];
+            if (Seen >= Rank)
+            {
+                Response = GetBucketUpperEdge (Bucket);
+                break;
+            }
+        }
+
+        Response = min (Response, uint32_t (CurrentInput.Max));
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // GetPercentile
+
+//----------------------------------------------------------------------------
+void c_FrameLatency::GetStatus (JsonObject & jsonStatus, uint32_t InputId)
+{
+    // DEBUG_START;
+
+    // all values in microseconds
+    JsonObject jsonLatency = jsonStatus[F ("latency")].to<JsonObject> ();
+    JsonWrite (jsonLatency, F ("count"), GetCount (InputId));
+    JsonWrite (jsonLatency, F ("p50"),   GetPercentile (InputId, 50));
+    JsonWrite (jsonLatency, F ("p95"),   GetPercentile (InputId, 95));
+    JsonWrite (jsonLatency, F ("p99"),   GetPercentile (InputId, 99));
+    JsonWrite (jsonLatency, F ("max"),   GetMax (InputId));
+
+    // DEBUG_END;
+} // GetStatus
+
+c_FrameLatency FrameLatency;
@@ -0,0 +1,153 @@
+/*
+* SpiRam.cpp - Placement of the large buffers in PSRAM
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/SpiRam.hpp"
+
+#ifdef BOARD_HAS_PSRAM
+#   include <esp_heap_caps.h>
+#endif // def BOARD_HAS_PSRAM
+
+//----------------------------------------------------------------------------
+c_SpiRam::c_SpiRam ()
+{
+} // c_SpiRam
+
+//----------------------------------------------------------------------------
+c_SpiRam::~c_SpiRam ()
+{
+} // ~c_SpiRam
+
+//----------------------------------------------------------------------------
+void c_SpiRam::Begin ()
+{
+    // DEBUG_START;
+
+#ifdef BOARD_HAS_PSRAM
+    Present = psramFound ();
+    if (Present)
+    {
+        logcon (String (F ("PSRAM: ")) + String (ESP.getPsramSize ()) + F (" bytes. Free: ") + String (GetFreeSize ()));
+    }
+    else
+    {
+        logwarn (F ("Built for PSRAM but none was found. Using the heap."));
+    }
+#endif // def BOARD_HAS_PSRAM
+
+    // DEBUG_END;
+} // Begin
+
+//----------------------------------------------------------------------------
+uint32_t c_SpiRam::GetFreeSize ()
+{
+#ifdef BOARD_HAS_PSRAM
+    return Present ? ESP.getFreePsram () : 0;
+#else
+    return 0;
+#endif // def BOARD_HAS_PSRAM
+} // GetFreeSize
+
+//----------------------------------------------------------------------------
+uint32_t c_SpiRam::GetMaxAllocSize ()
+{
+#ifdef BOARD_HAS_PSRAM
+    return Present ? ESP.getMaxAllocPsram () : 0;
+#else
+    return 0;
+#endif // def BOARD_HAS_PSRAM
+} // GetMaxAllocSize
+
+//----------------------------------------------------------------------------
+void * c_SpiRam::Malloc (size_t Size)
+{
+    // DEBUG_START;
+
+    void * Response = nullptr;
+
+#ifdef BOARD_HAS_PSRAM
+    if (Present)
+    {
+        Response = heap_caps_malloc (Size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+#endif // def BOARD_HAS_PSRAM
+
+    if (nullptr == Response)
+    {
+        Response = malloc (Size);
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // Malloc
+
+//----------------------------------------------------------------------------
+void * c_SpiRam::InternalMalloc (size_t Size)
+{
+#ifdef BOARD_HAS_PSRAM
+    return heap_caps_malloc (Size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+    return malloc (Size);
+#endif // def BOARD_HAS_PSRAM
+} // InternalMalloc
+
+//----------------------------------------------------------------------------
+void * c_SpiRam::reallocate (void * pMemory, size_t NewSize)
+{
+    // DEBUG_START;
+
+    void * Response = nullptr;
+
+#ifdef BOARD_HAS_PSRAM
+    if (Present)
+    {
+        Response = heap_caps_realloc (pMemory, NewSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+#endif // def BOARD_HAS_PSRAM
+
+    if (nullptr == Response)
+    {
+        Response = realloc (pMemory, NewSize);
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // reallocate
+
+//----------------------------------------------------------------------------
+void c_SpiRam::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+#ifdef BOARD_HAS_PSRAM
+    if (Present)
+    {
+        JsonObject jsonPsram = jsonStatus[F ("psram")].to<JsonObject> ();
+        JsonWrite (jsonPsram, F ("size"), uint32_t (ESP.getPsramSize ()));
+        JsonWrite (jsonPsram, F ("free"), GetFreeSize ());
+        JsonWrite (jsonPsram, F ("max"),  GetMaxAllocSize ());
+    }
+#endif // def BOARD_HAS_PSRAM
+
+    // DEBUG_END;
+} // GetStatus
+
+c_SpiRam SpiRam;
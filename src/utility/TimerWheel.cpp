@@ -0,0 +1,333 @@
+/*
+* TimerWheel.cpp - Deadline scheduler for the jobs run by the main loop
+*
+* Project: ESPixelStick - An ESP8266 / ESP32 and E1.31 based pixel driver
+* Copyright (c) 2026 Shelby Merrick
+* http://www.forkineye.com
+*
+*  This program is provided free for you to use in any way that you wish,
+*  subject to the laws and regulations where you are using it.  Due diligence
+*  is strongly suggested before using this code.  Please give credit where due.
+*
+*  The Author makes no warranty of any kind, express or implied, with regard
+*  to this program or the documentation contained in this document.  The
+*  Author shall not be liable in any event for incidental or consequential
+*  damages in connection with, or arising out of, the furnishing, performance
+*  or use of these programs.
+*
+*/
+
+#include "ESPixelStick.h"
+#include "utility/TimerWheel.hpp"
+
+static_assert (0 == (TIMER_WHEEL_NUM_SLOTS & (TIMER_WHEEL_NUM_SLOTS - 1)), "TIMER_WHEEL_NUM_SLOTS must be a power of two");
+static_assert (TIMER_WHEEL_MAX_SLEEP_MS < TIMER_WHEEL_NUM_SLOTS, "the next deadline is only searched for one revolution");
+
+#define TIMER_WHEEL_SLOT(ms) ((ms) & (TIMER_WHEEL_NUM_SLOTS - 1))
+
+//----------------------------------------------------------------------------
+c_TimerWheel::c_TimerWheel ()
+{
+    memset (Jobs, 0x00, sizeof (Jobs));
+    memset (Slots, TIMER_WHEEL_NO_JOB, sizeof (Slots));
+} // c_TimerWheel
+
+//----------------------------------------------------------------------------
+c_TimerWheel::~c_TimerWheel ()
+{
+} // ~c_TimerWheel
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::Begin ()
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    MainTaskHandle = xTaskGetCurrentTaskHandle ();
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+} // Begin
+
+//----------------------------------------------------------------------------
+c_TimerWheel::JobId_t c_TimerWheel::Add (const __FlashStringHelper * Name, TimerWheelJob_t Job, void * pContext, uint32_t FirstRunMs, uint32_t BudgetUs)
+{
+    // DEBUG_START;
+
+    JobId_t Response = TIMER_WHEEL_NO_JOB;
+
+    do // once
+    {
+        if (TIMER_WHEEL_MAX_JOBS <= NumJobs)
+        {
+            logcon (String (F ("No room for job: ")) + String (Name));
+            break;
+        }
+
+        Response = JobId_t (NumJobs++);
+        Job_t & NewJob   = Jobs[Response];
+        NewJob.Name      = Name;
+        NewJob.Job       = Job;
+        NewJob.pContext  = pContext;
+        NewJob.BudgetUs  = BudgetUs;
+        NewJob.Next      = TIMER_WHEEL_NO_JOB;
+
+        if (TIMER_WHEEL_STOP != FirstRunMs)
+        {
+            Insert (Response, millis () + FirstRunMs);
+        }
+
+    } while (false);
+
+    // DEBUG_END;
+    return Response;
+
+} // Add
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::Schedule (JobId_t JobId, uint32_t DelayMs)
+{
+    // DEBUG_START;
+
+    if (JobId < NumJobs)
+    {
+        // the delay has to be in place before the flag is seen
+        Jobs[JobId].RequestedDelayMs = DelayMs;
+        Jobs[JobId].Requested = true;
+        RequestPending = true;
+        Wake ();
+    }
+
+    // DEBUG_END;
+} // Schedule
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::Insert (JobId_t JobId, uint32_t DeadlineMs)
+{
+    // DEBUG_START;
+
+    // nothing is due before the slot the wheel is on
+    if (0 > int32_t (DeadlineMs - CurrentMs))
+    {
+        DeadlineMs = CurrentMs;
+    }
+
+    Job_t & CurrentJob = Jobs[JobId];
+    JobId_t & Slot = Slots[TIMER_WHEEL_SLOT (DeadlineMs)];
+    CurrentJob.DeadlineMs = DeadlineMs;
+    CurrentJob.Next = Slot;
+    CurrentJob.Armed = true;
+    Slot = JobId;
+
+    // DEBUG_END;
+} // Insert
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::Remove (JobId_t JobId)
+{
+    // DEBUG_START;
+
+    Job_t & CurrentJob = Jobs[JobId];
+    if (CurrentJob.Armed)
+    {
+        JobId_t * pLink = &Slots[TIMER_WHEEL_SLOT (CurrentJob.DeadlineMs)];
+        while (TIMER_WHEEL_NO_JOB != *pLink)
+        {
+            if (JobId == *pLink)
+            {
+                *pLink = CurrentJob.Next;
+                break;
+            }
+            pLink = &Jobs[*pLink].Next;
+        }
+        CurrentJob.Next = TIMER_WHEEL_NO_JOB;
+        CurrentJob.Armed = false;
+    }
+
+    // DEBUG_END;
+} // Remove
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::ApplyRequests ()
+{
+    // DEBUG_START;
+
+    if (RequestPending)
+    {
+        RequestPending = false;
+        uint32_t Now = millis ();
+        for (JobId_t JobId = 0; JobId < NumJobs; ++JobId)
+        {
+            Job_t & CurrentJob = Jobs[JobId];
+            if (!CurrentJob.Requested)
+            {
+                continue;
+            }
+            // a request made after the flag is cleared is applied again on the next pass
+            CurrentJob.Requested = false;
+            uint32_t DelayMs = CurrentJob.RequestedDelayMs;
+
+            Remove (JobId);
+            if (TIMER_WHEEL_STOP != DelayMs)
+            {
+                Insert (JobId, Now + DelayMs);
+            }
+        }
+    }
+
+    // DEBUG_END;
+} // ApplyRequests
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::RunJob (JobId_t JobId)
+{
+    // DEBUG_START;
+
+    Job_t & CurrentJob = Jobs[JobId];
+
+    uint32_t StartUs   = micros ();
+    uint32_t NextRunMs = CurrentJob.Job (CurrentJob.pContext);
+    uint32_t ElapsedUs = micros () - StartUs;
+
+    ++CurrentJob.Runs;
+    CurrentJob.TotalUs += ElapsedUs;
+    if (CurrentJob.BudgetUs && (CurrentJob.BudgetUs < ElapsedUs))
+    {
+        ++CurrentJob.Overruns;
+        if (CurrentJob.MaxUs < ElapsedUs)
+        {
+            logcon (String (CurrentJob.Name) + F (" took ") + String (ElapsedUs) + F (" us. Budget: ") + String (CurrentJob.BudgetUs) + F (" us"));
+        }
+    }
+    CurrentJob.MaxUs = max (CurrentJob.MaxUs, ElapsedUs);
+
+    if (TIMER_WHEEL_STOP != NextRunMs)
+    {
+        Insert (JobId, millis () + NextRunMs);
+    }
+
+    // DEBUG_END;
+} // RunJob
+
+//----------------------------------------------------------------------------
+uint32_t c_TimerWheel::Run ()
+{
+    // DEBUG_START;
+
+    ApplyRequests ();
+
+    // take every job that is due off the wheel before any of them runs
+    uint32_t Now = millis ();
+    uint32_t NumSlotsToVisit = min (uint32_t (Now - CurrentMs) + 1, uint32_t (TIMER_WHEEL_NUM_SLOTS));
+    JobId_t  DueJobs[TIMER_WHEEL_MAX_JOBS];
+    uint32_t NumDueJobs = 0;
+
+    for (uint32_t SlotMs = CurrentMs; NumSlotsToVisit--; ++SlotMs)
+    {
+        JobId_t * pLink = &Slots[TIMER_WHEEL_SLOT (SlotMs)];
+        while (TIMER_WHEEL_NO_JOB != *pLink)
+        {
+            JobId_t JobId = *pLink;
+            Job_t & CurrentJob = Jobs[JobId];
+            if (0 < int32_t (CurrentJob.DeadlineMs - Now))
+            {
+                // due on a later revolution
+                pLink = &CurrentJob.Next;
+                continue;
+            }
+            *pLink = CurrentJob.Next;
+            CurrentJob.Next = TIMER_WHEEL_NO_JOB;
+            CurrentJob.Armed = false;
+            DueJobs[NumDueJobs++] = JobId;
+        }
+    }
+    CurrentMs = Now;
+
+    for (uint32_t index = 0; index < NumDueJobs; ++index)
+    {
+        RunJob (DueJobs[index]);
+    }
+
+    // a request left by a job is applied on the next pass. Otherwise the
+    // first slot holding a job due on this revolution has the next deadline.
+    // The jobs were re-armed from the time they finished, so the search
+    // covers the time they ran plus the longest sleep. A run too long for
+    // the wheel to cover goes round again at once
+    uint32_t RunMs = millis () - CurrentMs;
+    uint32_t NumSlotsToSearch = RunMs + TIMER_WHEEL_MAX_SLEEP_MS;
+    uint32_t Response = (RequestPending || (TIMER_WHEEL_NUM_SLOTS < NumSlotsToSearch)) ? 0 : TIMER_WHEEL_MAX_SLEEP_MS;
+    for (uint32_t Offset = 0; Response && (Offset < NumSlotsToSearch); ++Offset)
+    {
+        for (JobId_t JobId = Slots[TIMER_WHEEL_SLOT (CurrentMs + Offset)]; TIMER_WHEEL_NO_JOB != JobId; JobId = Jobs[JobId].Next)
+        {
+            if (Offset == (Jobs[JobId].DeadlineMs - CurrentMs))
+            {
+                int32_t TimeLeft = int32_t (Jobs[JobId].DeadlineMs - millis ());
+                Response = (0 < TimeLeft) ? uint32_t (TimeLeft) : 0;
+                NumSlotsToSearch = 0;
+                break;
+            }
+        }
+    }
+
+    // DEBUG_END;
+    return Response;
+
+} // Run
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::Sleep (uint32_t DelayMs)
+{
+    // DEBUG_START;
+
+    if (DelayMs)
+    {
+#ifdef ARDUINO_ARCH_ESP32
+        ulTaskNotifyTake (pdTRUE, pdMS_TO_TICKS (DelayMs));
+#else
+        delay (DelayMs);
+#endif // def ARDUINO_ARCH_ESP32
+    }
+
+    // DEBUG_END;
+} // Sleep
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::Wake ()
+{
+    // DEBUG_START;
+
+#ifdef ARDUINO_ARCH_ESP32
+    if (MainTaskHandle && (MainTaskHandle != xTaskGetCurrentTaskHandle ()))
+    {
+        xTaskNotifyGive (MainTaskHandle);
+    }
+#endif // def ARDUINO_ARCH_ESP32
+
+    // DEBUG_END;
+} // Wake
+
+//----------------------------------------------------------------------------
+void c_TimerWheel::GetStatus (JsonObject & jsonStatus)
+{
+    // DEBUG_START;
+
+    JsonArray jsonJobs = jsonStatus[F ("jobs")].to<JsonArray> ();
+    for (JobId_t JobId = 0; JobId < NumJobs; ++JobId)
+    {
+        Job_t & CurrentJob = Jobs[JobId];
+        uint32_t Runs = CurrentJob.Runs;
+
+        JsonObject jsonJob = jsonJobs.add<JsonObject> ();
+        JsonWrite (jsonJob, F ("name"),     String (CurrentJob.Name));
+        JsonWrite (jsonJob, F ("runs"),     Runs);
+        JsonWrite (jsonJob, F ("avg"),      uint32_t (Runs ? (CurrentJob.TotalUs / Runs) : 0));
+        JsonWrite (jsonJob, F ("max"),      CurrentJob.MaxUs);
+        JsonWrite (jsonJob, F ("budget"),   CurrentJob.BudgetUs);
+        JsonWrite (jsonJob, F ("overruns"), CurrentJob.Overruns);
+    }
+
+    // DEBUG_END;
+} // GetStatus
+
+c_TimerWheel TimerWheel;